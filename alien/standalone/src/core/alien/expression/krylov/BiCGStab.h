@@ -93,6 +93,17 @@ class BiCGStab
       return m_status;
     }
 
+    //! stop test from the squared residual norm already computed by the solver
+    //! (used by pipelined solvers which compute it in a fused reduction)
+    bool stopFromSquareNorm(ValueType r_nrm2)
+    {
+      if (m_iter >= m_max_iteration)
+        return true;
+      m_value = r_nrm2;
+      m_status = m_value < m_criteria_value;
+      return m_status;
+    }
+
     void operator++()
     {
       if (m_trace_mng)
@@ -456,6 +467,175 @@ class BiCGStab
     return 0;
   }
 
+  /*
+   * Pipelined preconditioned BiCGStab (S. Cools, W. Vanroose, 2017).
+   *
+   * The matrix vector products of the auxiliary vectors are computed by
+   * recurrences so that the dot products of one iteration are grouped in two
+   * non blocking reductions (instead of three blocking ones in solve()).
+   * The first one is overlapped with the computation of zhat = M z and
+   * v = A zhat, the second one (which also computes the residual norm used
+   * by the stop criteria) with what = M w and t = A what.
+   * The algebra has to provide ReductionType and startDots().
+   */
+  template <typename PrecondT, typename iterT>
+  int solvePipelined(PrecondT& precond, iterT& iter, MatrixType const& A,
+                     VectorType const& b, VectorType& x)
+  {
+    if (iter.nullRhs())
+      return 0;
+    typedef typename AlgebraType::ReductionType ReductionType;
+    typedef Arccore::ConstArrayView<const VectorType*> VectorPtrView;
+    ValueType rho(0), rho1(0), alpha(0), beta(0), omega(0), denom(0), rr(0);
+    VectorType r, r0, rhat, w, what, t, phat, s, shat, z, zhat, v, q, qhat, y;
+
+    m_algebra.allocate(AlgebraType::resource(A), r, r0, rhat, w, what, t, phat, s, shat,
+                       z, zhat, v, q, qhat, y);
+
+    ReductionType reduction;
+    const VectorType* init_left[3] = { &r0, &r0, &r };
+    const VectorType* init_right[3] = { &r, &w, &r };
+    const VectorType* omega_left[2] = { &q, &y };
+    const VectorType* omega_right[2] = { &y, &y };
+    const VectorType* beta_left[5] = { &r0, &r0, &r0, &r0, &r };
+    const VectorType* beta_right[5] = { &r, &w, &s, &z, &r };
+
+    // SEQ0
+    /*
+     * r = b - A * x
+     * r0 = r
+     * rhat = solve(M,r)
+     * w = A*rhat
+     * start rho = dot(r0,r), dot(r0,w), rr = dot(r,r)
+     * what = solve(M,w)
+     * t = A*what
+     * wait reduction
+     * alpha = rho/dot(r0,w)
+     */
+    m_algebra.copy(b, r);
+    m_algebra.mult(A, x, y);
+    m_algebra.axpy(-1., y, r);
+    m_algebra.copy(r, r0);
+    m_algebra.exec(precond, r, rhat);
+    m_algebra.mult(A, rhat, w);
+    m_algebra.startDots(VectorPtrView(3, init_left), VectorPtrView(3, init_right), reduction);
+    m_algebra.exec(precond, w, what);
+    m_algebra.mult(A, what, t);
+    rho = reduction.value(0);
+    denom = reduction.value(1);
+    rr = reduction.value(2);
+    if (m_output_level > 1)
+      _print(0, "Seq 0", "rho", rho, "denom", denom);
+
+    bool is_first = true;
+    while (!iter.stopFromSquareNorm(rr)) {
+      if (rho == 0 || denom == 0) {
+        m_algebra.free(r, r0, rhat, w, what, t, phat, s, shat, z, zhat, v, q, qhat, y);
+        throw typename AlgebraType::NullValueException(rho == 0 ? "rho" : "alpha");
+      }
+      alpha = rho / denom;
+
+      // SEQ1
+      /*
+       * phat = rhat + beta*(phat - omega*shat)
+       * s = w + beta*(s - omega*z)
+       * shat = what + beta*(shat - omega*zhat)
+       * z = t + beta*(z - omega*v)
+       */
+      if (is_first) {
+        m_algebra.copy(rhat, phat);
+        m_algebra.copy(w, s);
+        m_algebra.copy(what, shat);
+        m_algebra.copy(t, z);
+      }
+      else {
+        m_algebra.axpy(-omega, shat, phat);
+        m_algebra.scal(beta, phat);
+        m_algebra.axpy(1., rhat, phat);
+        m_algebra.axpy(-omega, z, s);
+        m_algebra.scal(beta, s);
+        m_algebra.axpy(1., w, s);
+        m_algebra.axpy(-omega, zhat, shat);
+        m_algebra.scal(beta, shat);
+        m_algebra.axpy(1., what, shat);
+        m_algebra.axpy(-omega, v, z);
+        m_algebra.scal(beta, z);
+        m_algebra.axpy(1., t, z);
+      }
+
+      // SEQ2
+      /*
+       * q = r - alpha*s
+       * qhat = rhat - alpha*shat
+       * y = w - alpha*z
+       * start dot(q,y), dot(y,y)
+       * zhat = solve(M,z)
+       * v = A*zhat
+       * wait reduction
+       * omega = dot(q,y)/dot(y,y)
+       */
+      m_algebra.copy(r, q);
+      m_algebra.axpy(-alpha, s, q);
+      m_algebra.copy(rhat, qhat);
+      m_algebra.axpy(-alpha, shat, qhat);
+      m_algebra.copy(w, y);
+      m_algebra.axpy(-alpha, z, y);
+      m_algebra.startDots(VectorPtrView(2, omega_left), VectorPtrView(2, omega_right), reduction);
+      m_algebra.exec(precond, z, zhat);
+      m_algebra.mult(A, zhat, v);
+      denom = reduction.value(1);
+      omega = (denom == 0) ? 0 : reduction.value(0) / denom;
+      if (omega == 0) {
+        m_algebra.free(r, r0, rhat, w, what, t, phat, s, shat, z, zhat, v, q, qhat, y);
+        throw typename AlgebraType::NullValueException("omega");
+      }
+
+      // SEQ3
+      /*
+       * x += alpha*phat + omega*qhat
+       * r = q - omega*y
+       * rhat = qhat - omega*(what - alpha*zhat)
+       * w = y - omega*(t - alpha*v)
+       */
+      m_algebra.axpy(alpha, phat, x);
+      m_algebra.axpy(omega, qhat, x);
+      m_algebra.copy(q, r);
+      m_algebra.axpy(-omega, y, r);
+      m_algebra.copy(qhat, rhat);
+      m_algebra.axpy(-omega, what, rhat);
+      m_algebra.axpy(omega * alpha, zhat, rhat);
+      m_algebra.copy(y, w);
+      m_algebra.axpy(-omega, t, w);
+      m_algebra.axpy(omega * alpha, v, w);
+
+      // SEQ4
+      /*
+       * start rho1 = dot(r0,r), dot(r0,w), dot(r0,s), dot(r0,z), rr = dot(r,r)
+       * what = solve(M,w)
+       * t = A*what
+       * wait reduction
+       * beta = (alpha/omega)*(rho1/rho)
+       * denom = dot(r0,w) + beta*dot(r0,s) - beta*omega*dot(r0,z)
+       */
+      m_algebra.startDots(VectorPtrView(5, beta_left), VectorPtrView(5, beta_right), reduction);
+      m_algebra.exec(precond, w, what);
+      m_algebra.mult(A, what, t);
+      rho1 = reduction.value(0);
+      rr = reduction.value(4);
+      beta = (alpha / omega) * (rho1 / rho);
+      denom = reduction.value(1) + beta * (reduction.value(2) - omega * reduction.value(3));
+      rho = rho1;
+      if (m_output_level > 1)
+        _print(iter(), "Seq 4", "beta", beta, "alpha", alpha, "rho", rho, "omega", omega);
+      is_first = false;
+      ++iter;
+    }
+
+    m_algebra.free(r, r0, rhat, w, what, t, phat, s, shat, z, zhat, v, q, qhat, y);
+
+    return 0;
+  }
+
  private:
   void
   _print(int iter, std::string const& msg, std::string const& label0,
@@ -243,6 +243,128 @@ class CG
     return 0;
   }
 
+  /*
+   * Pipelined preconditioned CG (P. Ghysels, W. Vanroose, 2014).
+   *
+   * The three dot products of one iteration (including the residual norm
+   * used by the stop criteria) are fused in a single non blocking reduction
+   * which is overlapped with the preconditioner and the matrix vector
+   * product. The algebra has to provide ReductionType and startDots().
+   * The residual is only updated by recurrences, so the attainable accuracy
+   * may be slightly lower than with solve().
+   */
+  template <typename PrecondT, typename iterT>
+  int solvePipelined(PrecondT& precond,
+                     iterT& iter,
+                     MatrixType const& A,
+                     VectorType const& b,
+                     VectorType& x)
+  {
+    if (iter.nullRhs())
+      return 0;
+    typedef typename AlgebraType::ReductionType ReductionType;
+    ValueType gamma(0), gamma_old(0), delta(0), alpha(0), alpha_old(0), beta(0);
+    VectorType r, u, w, m, n, p, s, q, z;
+
+    m_algebra.allocate(AlgebraType::resource(A), r, u, w, m, n, p, s, q, z);
+
+    // SEQ0
+    /*
+     * r = b - A * x
+     * u = solve(M,r)
+     * w = A*u
+     */
+    m_algebra.copy(b, r);
+    m_algebra.mult(A, x, p);
+    m_algebra.axpy(-1., p, r);
+    m_algebra.exec(precond, r, u);
+    m_algebra.mult(A, u, w);
+
+    ReductionType reduction;
+    const VectorType* left[3] = { &r, &w, &r };
+    const VectorType* right[3] = { &u, &u, &r };
+    Arccore::ConstArrayView<const VectorType*> left_view(3, left);
+    Arccore::ConstArrayView<const VectorType*> right_view(3, right);
+
+    bool is_first = true;
+    while (true) {
+      // SEQ1
+      /*
+       * start gamma = dot(r,u), delta = dot(w,u), rr = dot(r,r)
+       * m = solve(M,w)
+       * n = A*m
+       * wait reduction
+       */
+      m_algebra.startDots(left_view, right_view, reduction);
+      m_algebra.exec(precond, w, m);
+      m_algebra.mult(A, m, n);
+      gamma = reduction.value(0);
+      delta = reduction.value(1);
+      if (iter.stopFromSquareNorm(reduction.value(2)))
+        break;
+
+      // SEQ2
+      /*
+       * beta = gamma/gamma_old
+       * alpha = gamma/(delta - beta*gamma/alpha_old)
+       */
+      if (is_first) {
+        beta = 0;
+      }
+      else {
+        beta = gamma / gamma_old;
+        delta -= beta * gamma / alpha_old;
+      }
+      if (delta == 0) {
+        m_algebra.free(r, u, w, m, n, p, s, q, z);
+        throw typename AlgebraType::NullValueException("delta");
+      }
+      alpha = gamma / delta;
+      if (m_output_level > 1)
+        _print(iter(), "Seq 2", "gamma", gamma, "delta", delta, "alpha", alpha, "beta", beta);
+
+      // SEQ3
+      /*
+       * z = n + beta*z
+       * q = m + beta*q
+       * s = w + beta*s
+       * p = u + beta*p
+       * x += alpha*p
+       * r -= alpha*s
+       * u -= alpha*q
+       * w -= alpha*z
+       */
+      if (is_first) {
+        m_algebra.copy(n, z);
+        m_algebra.copy(m, q);
+        m_algebra.copy(w, s);
+        m_algebra.copy(u, p);
+      }
+      else {
+        m_algebra.scal(beta, z);
+        m_algebra.axpy(1., n, z);
+        m_algebra.scal(beta, q);
+        m_algebra.axpy(1., m, q);
+        m_algebra.scal(beta, s);
+        m_algebra.axpy(1., w, s);
+        m_algebra.scal(beta, p);
+        m_algebra.axpy(1., u, p);
+      }
+      m_algebra.axpy(alpha, p, x);
+      m_algebra.axpy(-alpha, s, r);
+      m_algebra.axpy(-alpha, q, u);
+      m_algebra.axpy(-alpha, z, w);
+      gamma_old = gamma;
+      alpha_old = alpha;
+      is_first = false;
+      ++iter;
+    }
+
+    m_algebra.free(r, u, w, m, n, p, s, q, z);
+
+    return 0;
+  }
+
  private:
   void
   _print(int iter, std::string const& msg, std::string const& label0,
@@ -89,6 +89,17 @@ class Iteration
     return m_status;
   }
 
+  //! stop test from the squared residual norm already computed by the solver
+  //! (used by pipelined solvers which compute it in a fused reduction)
+  bool stopFromSquareNorm(ValueType r_nrm2)
+  {
+    if (m_iter >= m_max_iteration)
+      return true;
+    m_value = r_nrm2;
+    m_status = m_value < m_criteria_value;
+    return m_status;
+  }
+
   void operator++()
   {
     if (m_trace_mng) {
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2020 IFPEN-CEA
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <alien/handlers/profiler/BaseMatrixProfiler.h>
+#include <alien/utils/ThreadLocalStorage.h>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Alien
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Common
+{
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+
+  /*!
+   * \brief Profileur de matrice pouvant être rempli par plusieurs threads.
+   *
+   * addMatrixEntry() peut être appelée en concurrence, par exemple dans une
+   * boucle parallèle sur les mailles. Les entrées sont stockées dans un tampon
+   * propre à chaque thread et fusionnées lors de allocate() : elles sont
+   * réparties par ligne puis chaque ligne est triée et dédoublonnée en
+   * parallèle (avec OpenMP si ALIEN_USE_OPENMP est défini).
+   *
+   * allocate() doit être appelée en dehors de toute section concurrente.
+   */
+  template <typename ValueT = Real>
+  class ConcurrentMatrixProfilerT : public MatrixProfilerT<ValueT>
+  {
+   public:
+    explicit ConcurrentMatrixProfilerT(IMatrix& matrix);
+
+    ~ConcurrentMatrixProfilerT() override;
+
+   public:
+    //! Ajoute l'entrée (\a iIndex, \a jIndex). Peut être appelée en concurrence.
+    void addMatrixEntry(Integer iIndex, Integer jIndex);
+
+    void allocate();
+
+   private:
+    //! Entrées ajoutées par un thread
+    struct LocalEntries
+    {
+      UniqueArray<Integer> m_rows;
+      UniqueArray<Integer> m_cols;
+    };
+
+    ThreadLocalStorage<LocalEntries> m_local_entries;
+
+    bool m_allocated = false;
+
+   private:
+    void _mergeLocalEntries();
+  };
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+
+} // namespace Common
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Alien
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "ConcurrentMatrixProfilerT.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -64,6 +64,17 @@ namespace Common
 
     void allocate();
 
+   protected:
+    Integer _localOffset() const { return m_local_offset; }
+    Integer _localSize() const { return m_local_size; }
+
+    /*!
+     * Ajoute à la ligne locale \a local_row les colonnes \a sorted_cols,
+     * triées et sans doublon. Des lignes différentes peuvent être
+     * complétées en concurrence.
+     */
+    void _addSortedRowEntries(Integer local_row, ConstArrayView<Integer> sorted_cols);
+
    private:
     IMatrix& m_matrix;
 
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2020 IFPEN-CEA
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <algorithm>
+
+#include <arccore/base/FatalErrorException.h>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Alien
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Common
+{
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+
+  template <typename ValueT>
+  ConcurrentMatrixProfilerT<ValueT>::ConcurrentMatrixProfilerT(IMatrix& matrix)
+  : MatrixProfilerT<ValueT>(matrix)
+  {}
+
+  /*---------------------------------------------------------------------------*/
+
+  template <typename ValueT>
+  ConcurrentMatrixProfilerT<ValueT>::~ConcurrentMatrixProfilerT()
+  {
+    if (!m_allocated) {
+      allocate();
+    }
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  template <typename ValueT>
+  void ConcurrentMatrixProfilerT<ValueT>::addMatrixEntry(Integer iIndex, Integer jIndex)
+  {
+    LocalEntries& entries = m_local_entries.local();
+    entries.m_rows.add(iIndex);
+    entries.m_cols.add(jIndex);
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  template <typename ValueT>
+  void ConcurrentMatrixProfilerT<ValueT>::allocate()
+  {
+    if (m_allocated)
+      return;
+    _mergeLocalEntries();
+    MatrixProfilerT<ValueT>::allocate();
+    m_allocated = true;
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  template <typename ValueT>
+  void ConcurrentMatrixProfilerT<ValueT>::_mergeLocalEntries()
+  {
+    const Integer local_offset = this->_localOffset();
+    const Integer local_size = this->_localSize();
+
+    // Répartition des entrées par ligne (tri par dénombrement)
+    UniqueArray<Integer> row_offsets(local_size + 1);
+    row_offsets.fill(0);
+    for (std::size_t t = 0; t < m_local_entries.size(); ++t) {
+      for (Integer row : m_local_entries[t].m_rows) {
+        const Integer local_row = row - local_offset;
+        if (local_row < 0 || local_row >= local_size)
+          throw FatalErrorException("Cannot add entry on non local row");
+        ++row_offsets[local_row + 1];
+      }
+    }
+    for (Integer i = 0; i < local_size; ++i)
+      row_offsets[i + 1] += row_offsets[i];
+
+    UniqueArray<Integer> cols(row_offsets[local_size]);
+    {
+      UniqueArray<Integer> positions(row_offsets.subConstView(0, local_size));
+      for (std::size_t t = 0; t < m_local_entries.size(); ++t) {
+        const LocalEntries& entries = m_local_entries[t];
+        for (Integer k = 0, n = entries.m_rows.size(); k < n; ++k)
+          cols[positions[entries.m_rows[k] - local_offset]++] = entries.m_cols[k];
+      }
+    }
+    m_local_entries.clear();
+
+    // Chaque ligne est triée et fusionnée indépendamment des autres
+#ifdef ALIEN_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (Integer i = 0; i < local_size; ++i) {
+      Integer* row_begin = cols.data() + row_offsets[i];
+      Integer* row_end = cols.data() + row_offsets[i + 1];
+      if (row_begin == row_end)
+        continue;
+      std::sort(row_begin, row_end);
+      row_end = std::unique(row_begin, row_end);
+      this->_addSortedRowEntries(i, ConstArrayView<Integer>(static_cast<Integer>(row_end - row_begin), row_begin));
+    }
+  }
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+
+} // namespace Common
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Alien
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
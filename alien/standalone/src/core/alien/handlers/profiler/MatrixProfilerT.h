@@ -14,6 +14,9 @@
 #include <alien/core/impl/MultiMatrixImpl.h>
 #include <alien/kernels/simple_csr/CSRStructInfo.h>
 #include <alien/kernels/simple_csr/SimpleCSRInternal.h>
+#include <algorithm>
+#include <iterator>
+
 #include <alien/kernels/simple_csr/SimpleCSRMatrix.h>
 
 #include <alien/utils/ArrayUtils.h>
@@ -103,6 +106,24 @@ namespace Common
 
   /*---------------------------------------------------------------------------*/
 
+  template <typename ValueT>
+  void MatrixProfilerT<ValueT>::_addSortedRowEntries(Integer local_row,
+                                                     ConstArrayView<Integer> sorted_cols)
+  {
+    std::vector<Integer>& row_def = m_def_matrix[local_row];
+    if (row_def.empty()) {
+      row_def.assign(sorted_cols.begin(), sorted_cols.end());
+      return;
+    }
+    VectorDefinition merged_def;
+    merged_def.reserve(row_def.size() + sorted_cols.size());
+    std::set_union(row_def.begin(), row_def.end(), sorted_cols.begin(), sorted_cols.end(),
+                   std::back_inserter(merged_def));
+    row_def.swap(merged_def);
+  }
+
+  /*---------------------------------------------------------------------------*/
+
   template <typename ValueT>
   void MatrixProfilerT<ValueT>::allocate()
   {
@@ -0,0 +1,378 @@
+/*
+ * Copyright 2020 IFPEN-CEA
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "BaseConcurrentDirectMatrixBuilder.h"
+
+#include <algorithm>
+
+#include <arccore/message_passing/Messages.h>
+
+#include <alien/core/impl/MultiMatrixImpl.h>
+#include <alien/kernels/simple_csr/CSRStructInfo.h>
+#include <alien/kernels/simple_csr/SimpleCSRMatrix.h>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Alien
+{
+
+using namespace Arccore;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Common
+{
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+
+  ConcurrentDirectMatrixBuilder::ConcurrentDirectMatrixBuilder(IMatrix& matrix,
+                                                               const ResetFlag reset_flag)
+  : m_matrix(matrix)
+  , m_matrix_impl(nullptr)
+  , m_reset_flag(reset_flag)
+  , m_nproc(0)
+  , m_parallel_mng(nullptr)
+  {
+    m_matrix.impl()->lock();
+    m_matrix_impl = &m_matrix.impl()->get<BackEnd::tag::simplecsr>(true);
+    if (m_matrix_impl->block() || m_matrix_impl->vblock())
+      throw FatalErrorException("ConcurrentDirectMatrixBuilder only supports scalar matrices");
+
+    const MatrixDistribution& dist = m_matrix_impl->distribution();
+
+    m_parallel_mng = dist.parallelMng();
+
+    if (!m_parallel_mng) {
+      m_nproc = 1;
+    }
+    else {
+      m_nproc = m_parallel_mng->commSize();
+    }
+
+    m_local_size = dist.localRowSize();
+    m_global_size = dist.globalRowSize();
+    m_local_offset = dist.rowOffset();
+
+    m_col_global_size = m_matrix_impl->colSpace().size();
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  ConcurrentDirectMatrixBuilder::~ConcurrentDirectMatrixBuilder()
+  {
+    if (!m_finalized) {
+      finalize();
+    }
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  void ConcurrentDirectMatrixBuilder::addData(
+  const Integer iIndex, const Integer jIndex, const Real value)
+  {
+    // skip dead zone
+    if (iIndex == -1 or jIndex == -1)
+      return;
+    LocalEntries& local_entries = m_local_entries.local();
+    local_entries.m_rows.add(iIndex);
+    local_entries.m_entries.add(Entry{ jIndex, value });
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  void ConcurrentDirectMatrixBuilder::addData(const Integer iIndex, const Real factor,
+                                              ConstArrayView<Integer> jIndexes,
+                                              ConstArrayView<Real> jValues)
+  {
+    ALIEN_ASSERT((jIndexes.size() == jValues.size()),
+                 ("Inconsistent sizes: %d vs %d", jIndexes.size(), jValues.size()));
+
+    if (iIndex == -1)
+      return; // skip dead zone
+    LocalEntries& local_entries = m_local_entries.local();
+    for (Integer i = 0, n = jIndexes.size(); i < n; ++i) {
+      const Integer jIndex = jIndexes[i];
+      if (jIndex == -1)
+        continue; // skip dead zone
+      local_entries.m_rows.add(iIndex);
+      local_entries.m_entries.add(Entry{ jIndex, factor * jValues[i] });
+    }
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  void ConcurrentDirectMatrixBuilder::finalize()
+  {
+    if (m_finalized)
+      return;
+
+    UniqueArray<Integer> row_offsets;
+    UniqueArray<Entry> entries;
+    UniqueArray<Integer> row_sizes;
+    _mergeLocalEntries(row_offsets, entries, row_sizes);
+
+    SimpleCSRInternal::CSRStructInfo& profile = m_matrix_impl->internal().getCSRProfile();
+    const bool never_allocated = (profile.getNRow() == 0);
+    const bool keep_profile = !never_allocated && (m_reset_flag == DirectMatrixOptions::eNoReset || m_reset_flag == DirectMatrixOptions::eResetValues);
+
+    UniqueArray<Integer> positions;
+    bool need_update_profile = true;
+    if (keep_profile) {
+      positions.resize(entries.size());
+      need_update_profile = !_findInProfile(row_offsets, entries, row_sizes, positions);
+    }
+
+    // Parallel reduction of the decision
+    if (m_parallel_mng)
+      need_update_profile = Arccore::MessagePassing::mpAllReduce(
+      m_parallel_mng, Arccore::MessagePassing::ReduceMax, need_update_profile);
+
+    if (!need_update_profile) {
+      _updateValues(row_offsets, entries, row_sizes, positions);
+      m_reused_profile = true;
+    }
+    else {
+      if (keep_profile) {
+        // Union du profil actuel et des nouvelles entrées
+        ConstArrayView<Integer> old_row_offsets = profile.getRowOffset();
+        ConstArrayView<Integer> old_cols = profile.getCols();
+        ConstArrayView<Real> old_values = m_matrix_impl->internal().getValues();
+        const bool keep_values = (m_reset_flag == DirectMatrixOptions::eNoReset);
+
+        UniqueArray<Integer> union_row_offsets(m_local_size + 1);
+        union_row_offsets[0] = 0;
+        for (Integer i = 0; i < m_local_size; ++i)
+          union_row_offsets[i + 1] = union_row_offsets[i] + (old_row_offsets[i + 1] - old_row_offsets[i]) + row_sizes[i];
+        UniqueArray<Entry> union_entries(union_row_offsets[m_local_size]);
+#ifdef ALIEN_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+        for (Integer i = 0; i < m_local_size; ++i) {
+          Integer pos = union_row_offsets[i];
+          for (Integer k = old_row_offsets[i]; k < old_row_offsets[i + 1]; ++k)
+            union_entries[pos++] = Entry{ old_cols[k], (keep_values) ? old_values[k] : 0. };
+          for (Integer k = row_offsets[i], kend = row_offsets[i] + row_sizes[i]; k < kend; ++k)
+            union_entries[pos++] = entries[k];
+        }
+        row_offsets.swap(union_row_offsets);
+        entries.swap(union_entries);
+        _compactRows(row_offsets, entries, row_sizes);
+      }
+      _updateProfile(row_offsets, entries, row_sizes);
+      m_reused_profile = false;
+    }
+
+    m_matrix.impl()->unlock();
+    m_finalized = true;
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  void ConcurrentDirectMatrixBuilder::_mergeLocalEntries(UniqueArray<Integer>& row_offsets,
+                                                         UniqueArray<Entry>& entries,
+                                                         UniqueArray<Integer>& row_sizes)
+  {
+    // Répartition des contributions par ligne (tri par dénombrement)
+    row_offsets.resize(m_local_size + 1);
+    row_offsets.fill(0);
+    for (std::size_t t = 0; t < m_local_entries.size(); ++t) {
+      const LocalEntries& local_entries = m_local_entries[t];
+      for (Integer k = 0, n = local_entries.m_rows.size(); k < n; ++k) {
+        const Integer local_row = local_entries.m_rows[k] - m_local_offset;
+        if (local_row < 0 or local_row >= m_local_size)
+          throw FatalErrorException("Cannot add data on undefined row");
+        const Integer jIndex = local_entries.m_entries[k].m_col;
+        if (jIndex < 0 or jIndex >= m_col_global_size)
+          throw FatalErrorException("column index undefined");
+        ++row_offsets[local_row + 1];
+      }
+    }
+    for (Integer i = 0; i < m_local_size; ++i)
+      row_offsets[i + 1] += row_offsets[i];
+
+    entries.resize(row_offsets[m_local_size]);
+    {
+      UniqueArray<Integer> positions(row_offsets.subConstView(0, m_local_size));
+      for (std::size_t t = 0; t < m_local_entries.size(); ++t) {
+        const LocalEntries& local_entries = m_local_entries[t];
+        for (Integer k = 0, n = local_entries.m_rows.size(); k < n; ++k)
+          entries[positions[local_entries.m_rows[k] - m_local_offset]++] = local_entries.m_entries[k];
+      }
+    }
+    m_local_entries.clear();
+
+    _compactRows(row_offsets, entries, row_sizes);
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  /*!
+   * Trie chaque ligne par colonne et somme les contributions d'une même
+   * colonne. Les \a row_sizes[i] premières entrées de la ligne i sont
+   * ensuite les entrées distinctes de cette ligne.
+   */
+  void ConcurrentDirectMatrixBuilder::_compactRows(ConstArrayView<Integer> row_offsets,
+                                                   ArrayView<Entry> entries,
+                                                   UniqueArray<Integer>& row_sizes)
+  {
+    row_sizes.resize(m_local_size);
+#ifdef ALIEN_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (Integer i = 0; i < m_local_size; ++i) {
+      Entry* row_begin = entries.data() + row_offsets[i];
+      Entry* row_end = entries.data() + row_offsets[i + 1];
+      if (row_begin == row_end) {
+        row_sizes[i] = 0;
+        continue;
+      }
+      std::sort(row_begin, row_end, [](const Entry& a, const Entry& b) { return a.m_col < b.m_col; });
+      Entry* last = row_begin;
+      for (Entry* e = row_begin + 1; e != row_end; ++e) {
+        if (e->m_col == last->m_col)
+          last->m_value += e->m_value;
+        else
+          *(++last) = *e;
+      }
+      row_sizes[i] = static_cast<Integer>(last + 1 - row_begin);
+    }
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  /*!
+   * Calcule dans \a positions l'indice dans le profil actuel de chaque
+   * entrée. Retourne \a false si au moins une entrée n'est pas dans le profil.
+   */
+  bool ConcurrentDirectMatrixBuilder::_findInProfile(ConstArrayView<Integer> row_offsets,
+                                                     ConstArrayView<Entry> entries,
+                                                     ConstArrayView<Integer> row_sizes,
+                                                     ArrayView<Integer> positions)
+  {
+    const SimpleCSRInternal::CSRStructInfo& profile = m_matrix_impl->internal().getCSRProfile();
+    ConstArrayView<Integer> profile_row_offsets = profile.getRowOffset();
+    ConstArrayView<Integer> profile_cols = profile.getCols();
+
+    Integer nb_missing = 0;
+#ifdef ALIEN_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 256) reduction(+ : nb_missing)
+#endif
+    for (Integer i = 0; i < m_local_size; ++i) {
+      const Integer* cols_begin = profile_cols.data() + profile_row_offsets[i];
+      const Integer* cols_end = profile_cols.data() + profile_row_offsets[i + 1];
+      // Les colonnes ne sont pas forcément triées après parallelStart()
+      const bool is_sorted = std::is_sorted(cols_begin, cols_end);
+      for (Integer k = row_offsets[i], kend = row_offsets[i] + row_sizes[i]; k < kend; ++k) {
+        const Integer col = entries[k].m_col;
+        const Integer* found = (is_sorted) ? std::lower_bound(cols_begin, cols_end, col) : std::find(cols_begin, cols_end, col);
+        if (found == cols_end || *found != col) {
+          positions[k] = -1;
+          ++nb_missing;
+        }
+        else
+          positions[k] = static_cast<Integer>(found - profile_cols.data());
+      }
+    }
+    return nb_missing == 0;
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  void ConcurrentDirectMatrixBuilder::_updateValues(ConstArrayView<Integer> row_offsets,
+                                                    ConstArrayView<Entry> entries,
+                                                    ConstArrayView<Integer> row_sizes,
+                                                    ConstArrayView<Integer> positions)
+  {
+    ArrayView<Real> values = m_matrix_impl->internal().getValues();
+    if (m_reset_flag != DirectMatrixOptions::eNoReset)
+      values.fill(0.);
+#ifdef ALIEN_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (Integer i = 0; i < m_local_size; ++i) {
+      for (Integer k = row_offsets[i], kend = row_offsets[i] + row_sizes[i]; k < kend; ++k)
+        values[positions[k]] += entries[k].m_value;
+    }
+  }
+
+  /*---------------------------------------------------------------------------*/
+
+  void ConcurrentDirectMatrixBuilder::_updateProfile(ConstArrayView<Integer> row_offsets,
+                                                     ConstArrayView<Entry> entries,
+                                                     ConstArrayView<Integer> row_sizes)
+  {
+    UniqueArray<Integer> offset;
+    offset.resize(m_nproc + 1);
+    if (m_parallel_mng) {
+      Arccore::MessagePassing::mpAllGather(m_parallel_mng,
+                                           ConstArrayView<Integer>(1, &m_local_offset), offset.subView(0, m_nproc));
+    }
+    offset[m_nproc] = m_global_size;
+
+    SimpleCSRInternal::CSRStructInfo& profile = m_matrix_impl->internal().getCSRProfile();
+    profile.init(m_local_size);
+    {
+      ArrayView<Integer> row_starts = profile.getRowOffset();
+      Integer pos = 0;
+      for (Integer i = 0; i < m_local_size; ++i) {
+        row_starts[i] = pos;
+        pos += row_sizes[i];
+      }
+      row_starts[m_local_size] = pos;
+    }
+    profile.allocate();
+    profile.setTimestamp(m_matrix_impl->timestamp() + 1);
+    m_matrix_impl->allocate();
+
+    ConstArrayView<Integer> row_starts = profile.getRowOffset();
+    ArrayView<Integer> cols = profile.getCols();
+    ArrayView<Real> values = m_matrix_impl->internal().getValues();
+#ifdef ALIEN_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (Integer i = 0; i < m_local_size; ++i) {
+      const Integer row_start = row_starts[i];
+      const Integer entry_start = row_offsets[i];
+      for (Integer k = 0; k < row_sizes[i]; ++k) {
+        cols[row_start + k] = entries[entry_start + k].m_col;
+        values[row_start + k] = entries[entry_start + k].m_value;
+      }
+    }
+    values[row_starts[m_local_size]] = 0.;
+    profile.getColOrdering() = SimpleCSRInternal::CSRStructInfo::eFull;
+
+    if (m_nproc > 1)
+      m_matrix_impl->parallelStart(offset, m_parallel_mng, true);
+    else
+      m_matrix_impl->sequentialStart();
+  }
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+
+} // namespace Common
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Alien
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2020 IFPEN-CEA
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <alien/handlers/scalar/BaseDirectMatrixBuilder.h>
+#include <alien/utils/ThreadLocalStorage.h>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Alien
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Common
+{
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+
+  /*!
+   * \brief Constructeur de matrice scalaire pouvant être rempli par plusieurs threads.
+   *
+   * Contrairement à DirectMatrixBuilder, les méthodes addData() peuvent être
+   * appelées en concurrence, par exemple dans une boucle parallèle sur les
+   * mailles. Les contributions sont stockées dans un tampon propre à chaque
+   * thread et fusionnées lors de finalize() : elles sont réparties par ligne
+   * puis chaque ligne est triée et ses doublons sont sommés en parallèle
+   * (avec OpenMP si ALIEN_USE_OPENMP est défini).
+   *
+   * Avec DirectMatrixOptions::eNoReset ou DirectMatrixOptions::eResetValues,
+   * si toutes les contributions appartiennent au profil actuel de la matrice
+   * (cas d'un assemblage identique à celui du pas de temps précédent), seules
+   * les valeurs sont mises à jour. Sinon, le profil est reconstruit comme
+   * l'union du profil actuel et des nouvelles entrées. Dans les autres modes,
+   * le profil est celui des seules entrées ajoutées.
+   *
+   * L'ordre de sommation des contributions d'une même entrée venant de
+   * threads différents n'est pas déterministe.
+   *
+   * finalize() doit être appelée en dehors de toute section concurrente.
+   */
+  class ALIEN_EXPORT ConcurrentDirectMatrixBuilder
+  {
+   public:
+    using ResetFlag = DirectMatrixOptions::ResetFlag;
+
+   public:
+    ConcurrentDirectMatrixBuilder(IMatrix& matrix, ResetFlag reset_flag);
+
+    virtual ~ConcurrentDirectMatrixBuilder();
+
+    ConcurrentDirectMatrixBuilder(ConcurrentDirectMatrixBuilder&) = delete;
+    ConcurrentDirectMatrixBuilder(ConcurrentDirectMatrixBuilder&&) = delete;
+    ConcurrentDirectMatrixBuilder& operator=(const ConcurrentDirectMatrixBuilder&) = delete;
+    ConcurrentDirectMatrixBuilder& operator=(ConcurrentDirectMatrixBuilder&&) = delete;
+
+   public:
+    //! Ajoute \a value à l'entrée (\a iIndex, \a jIndex). Peut être appelée en concurrence.
+    void addData(Arccore::Integer iIndex, Arccore::Integer jIndex, Arccore::Real value);
+
+    //! Ajoute \a factor * \a jValues à la ligne \a iIndex. Peut être appelée en concurrence.
+    void addData(Arccore::Integer iIndex, Arccore::Real factor,
+                 Arccore::ConstArrayView<Arccore::Integer> jIndexes,
+                 Arccore::ConstArrayView<Arccore::Real> jValues);
+
+    void finalize();
+
+    //! Indique si finalize() a conservé le profil existant de la matrice
+    bool hasReusedProfile() const { return m_reused_profile; }
+
+   private:
+    //! Contribution à une entrée de la matrice
+    struct Entry
+    {
+      Integer m_col;
+      Real m_value;
+    };
+
+    //! Contributions ajoutées par un thread
+    struct LocalEntries
+    {
+      UniqueArray<Integer> m_rows;
+      UniqueArray<Entry> m_entries;
+    };
+
+    IMatrix& m_matrix;
+
+    SimpleCSRMatrix<Real>* m_matrix_impl;
+
+    Integer m_local_offset, m_global_size, m_local_size;
+    Integer m_col_global_size;
+
+    ResetFlag m_reset_flag;
+    bool m_finalized = false;
+    bool m_reused_profile = false;
+
+    Integer m_nproc;
+    IMessagePassingMng* m_parallel_mng;
+
+    ThreadLocalStorage<LocalEntries> m_local_entries;
+
+   private:
+    void _mergeLocalEntries(UniqueArray<Integer>& row_offsets,
+                            UniqueArray<Entry>& entries,
+                            UniqueArray<Integer>& row_sizes);
+    void _compactRows(ConstArrayView<Integer> row_offsets, ArrayView<Entry> entries,
+                      UniqueArray<Integer>& row_sizes);
+    bool _findInProfile(ConstArrayView<Integer> row_offsets, ConstArrayView<Entry> entries,
+                        ConstArrayView<Integer> row_sizes, ArrayView<Integer> positions);
+    void _updateValues(ConstArrayView<Integer> row_offsets, ConstArrayView<Entry> entries,
+                       ConstArrayView<Integer> row_sizes, ConstArrayView<Integer> positions);
+    void _updateProfile(ConstArrayView<Integer> row_offsets, ConstArrayView<Entry> entries,
+                        ConstArrayView<Integer> row_sizes);
+  };
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+
+} // namespace Common
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Alien
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
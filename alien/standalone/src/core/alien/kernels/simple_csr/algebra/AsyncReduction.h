@@ -0,0 +1,131 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* AsyncReduction.h                                            (C) 2000-2024 */
+/*                                                                           */
+/* Réduction (somme) non bloquante d'un ensemble de valeurs.                 */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <alien/utils/Precomp.h>
+
+#include <arccore/collections/Array.h>
+#include <arccore/message_passing/Messages.h>
+
+/*---------------------------------------------------------------------------*/
+
+namespace Alien
+{
+
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Réduction (somme) non bloquante d'un ensemble de valeurs.
+ *
+ * Une instance est remplie par les noyaux de calcul (par exemple
+ * CBLASMPIKernel::startDots()) qui calculent les contributions locales puis
+ * appellent start(). La réduction globale est alors en cours et
+ * l'appelant peut effectuer d'autres calculs (par exemple un produit
+ * matrice-vecteur) avant d'appeler wait() ou value().
+ *
+ * Les buffers sont utilisés par la requête de communication tant que la
+ * réduction est en cours. Une instance ne peut donc pas être copiée et le
+ * destructeur attend la fin de la réduction.
+ */
+template <typename ValueT>
+class AsyncReduction
+{
+ public:
+  typedef ValueT ValueType;
+
+  AsyncReduction() = default;
+  AsyncReduction(const AsyncReduction<ValueT>&) = delete;
+  AsyncReduction<ValueT>& operator=(const AsyncReduction<ValueT>&) = delete;
+
+  ~AsyncReduction()
+  {
+    wait();
+  }
+
+ public:
+  //! Nombre de valeurs réduites
+  Arccore::Integer size() const { return m_values.size(); }
+
+  //! Indique si la réduction est en cours
+  bool isPending() const { return m_is_pending; }
+
+  //! Attend la fin de la réduction
+  void wait()
+  {
+    if (!m_is_pending)
+      return;
+    Arccore::MessagePassing::mpWait(m_parallel_mng, m_request);
+    m_is_pending = false;
+  }
+
+  //! Valeur réduite d'indice \a i. Attend la fin de la réduction si besoin.
+  ValueType value(Arccore::Integer i)
+  {
+    wait();
+    return m_values[i];
+  }
+
+  //! Valeurs réduites. Attend la fin de la réduction si besoin.
+  Arccore::ConstArrayView<ValueType> values()
+  {
+    wait();
+    return m_values.constView();
+  }
+
+ public:
+  /*!
+   * \brief Redimensionne les buffers pour \a n valeurs et retourne les
+   * valeurs locales initialisées à zéro.
+   *
+   * La réduction précédente doit être terminée.
+   */
+  Arccore::ArrayView<ValueType> localValues(Arccore::Integer n)
+  {
+    wait();
+    m_local_values.resize(n);
+    m_local_values.fill(ValueType());
+    m_values.resize(n);
+    return m_local_values.view();
+  }
+
+  /*!
+   * \brief Démarre la réduction des valeurs locales.
+   *
+   * Si \a pm est nul, il n'y a pas de réduction et les valeurs sont
+   * directement disponibles.
+   */
+  void start(Arccore::MessagePassing::IMessagePassingMng* pm)
+  {
+    if (!pm) {
+      m_values.copy(m_local_values.constSpan());
+      return;
+    }
+    m_parallel_mng = pm;
+    m_request = Arccore::MessagePassing::mpNonBlockingAllReduce(
+    pm, Arccore::MessagePassing::ReduceSum, m_local_values.constSpan(), m_values.span());
+    m_is_pending = true;
+  }
+
+ private:
+  Arccore::UniqueArray<ValueType> m_local_values;
+  Arccore::UniqueArray<ValueType> m_values;
+  Arccore::MessagePassing::IMessagePassingMng* m_parallel_mng = nullptr;
+  Arccore::MessagePassing::Request m_request;
+  bool m_is_pending = false;
+};
+
+/*---------------------------------------------------------------------------*/
+
+} // namespace Alien
+
+/*---------------------------------------------------------------------------*/
@@ -19,10 +19,18 @@
 #pragma once
 
 #include <cmath>
+#include <algorithm>
+#include <utility>
+#include <vector>
 #include <arccore/message_passing/Messages.h>
 
 #include <alien/utils/Precomp.h>
 #include <alien/kernels/simple_csr/algebra/alien_cblas.h>
+#include <alien/kernels/simple_csr/algebra/AsyncReduction.h>
+
+#ifdef ALIEN_USE_OPENMP
+#include <omp.h>
+#endif
 
 namespace Alien
 {
@@ -34,6 +42,9 @@ class CBLASMPIKernel
   static const bool is_hybrid = false;
   static const bool is_mpi = true;
 
+  //! Taille minimale des vecteurs pour utiliser plusieurs threads
+  static const std::size_t parallel_threshold = 8192;
+
   template <typename Distribution, typename VectorT>
   static void copy(
   Distribution const& dist ALIEN_UNUSED_PARAM, const VectorT& x, VectorT& y)
@@ -67,9 +78,11 @@ class CBLASMPIKernel
     auto x_ptr = x.getDataPtr();
     auto y_ptr = y.getDataPtr();
     auto z_ptr = z.getDataPtr();
-    for (std::size_t i = 0; i < local_size; ++i) {
-      z_ptr[i] = x_ptr[i] * y_ptr[i];
-    }
+    parallelFor(local_size, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        z_ptr[i] = x_ptr[i] * y_ptr[i];
+      }
+    });
   }
 
   template <typename Distribution, typename VectorT>
@@ -79,9 +92,11 @@ class CBLASMPIKernel
   {
     auto local_size = y.scalarizedLocalSize();
     auto y_ptr = y.getDataPtr();
-    for (std::size_t i = 0; i < local_size; ++i) {
-      y_ptr[i] = alpha;
-    }
+    parallelFor(local_size, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        y_ptr[i] = alpha;
+      }
+    });
   }
 
   template <typename Distribution, typename VectorT>
@@ -98,6 +113,150 @@ class CBLASMPIKernel
     return value;
   }
 
+  /*!
+   * \brief Calcule y = y + alpha * x et retourne le produit scalaire (y,z).
+   *
+   * Les deux opérations sont faites en une seule passe sur les vecteurs.
+   */
+  template <typename Distribution, typename VectorT>
+  static typename VectorT::ValueType axpyDot(Distribution const& dist,
+                                             typename VectorT::ValueType alpha,
+                                             const VectorT& x, VectorT& y, const VectorT& z)
+  {
+    typedef typename VectorT::ValueType ValueType;
+    auto x_ptr = x.getDataPtr();
+    auto y_ptr = y.getDataPtr();
+    auto z_ptr = z.getDataPtr();
+    ValueType value = ValueType();
+    parallelSum(x.scalarizedLocalSize(), 1, &value,
+                [&](std::size_t begin, std::size_t end, ValueType* sum) {
+                  ValueType s = ValueType();
+                  for (std::size_t i = begin; i < end; ++i) {
+                    y_ptr[i] += alpha * x_ptr[i];
+                    s += y_ptr[i] * z_ptr[i];
+                  }
+                  sum[0] += s;
+                });
+    if (dist.isParallel()) {
+      return Arccore::MessagePassing::mpAllReduce(
+      dist.parallelMng(), Arccore::MessagePassing::ReduceSum, value);
+    }
+    return value;
+  }
+
+  /*!
+   * \brief Calcule les produits scalaires (x[k],y[k]).
+   *
+   * Les produits sont calculés en une seule passe sur les vecteurs et avec
+   * une seule réduction globale.
+   */
+  template <typename Distribution, typename VectorT>
+  static void dots(Distribution const& dist,
+                   Arccore::ConstArrayView<const VectorT*> x,
+                   Arccore::ConstArrayView<const VectorT*> y,
+                   Arccore::ArrayView<typename VectorT::ValueType> values)
+  {
+    localDots(x, y, values);
+    if (dist.isParallel()) {
+      Arccore::MessagePassing::mpAllReduce(
+      dist.parallelMng(), Arccore::MessagePassing::ReduceSum, Arccore::Span<typename VectorT::ValueType>(values));
+    }
+  }
+
+  /*!
+   * \brief Calcule les contributions locales des produits scalaires
+   * (x[k],y[k]) et démarre leur réduction non bloquante dans \a reduction.
+   */
+  template <typename Distribution, typename VectorT>
+  static void startDots(Distribution const& dist,
+                        Arccore::ConstArrayView<const VectorT*> x,
+                        Arccore::ConstArrayView<const VectorT*> y,
+                        AsyncReduction<typename VectorT::ValueType>& reduction)
+  {
+    localDots(x, y, reduction.localValues(x.size()));
+    reduction.start(dist.isParallel() ? dist.parallelMng() : nullptr);
+  }
+
+  //! Contributions locales (sans réduction) des produits scalaires (x[k],y[k])
+  template <typename VectorT>
+  static void localDots(Arccore::ConstArrayView<const VectorT*> x,
+                        Arccore::ConstArrayView<const VectorT*> y,
+                        Arccore::ArrayView<typename VectorT::ValueType> values)
+  {
+    typedef typename VectorT::ValueType ValueType;
+    const Arccore::Integer nb_dot = x.size();
+    if (nb_dot == 0)
+      return;
+    std::vector<const ValueType*> x_ptr(nb_dot);
+    std::vector<const ValueType*> y_ptr(nb_dot);
+    for (Arccore::Integer k = 0; k < nb_dot; ++k) {
+      x_ptr[k] = x[k]->getDataPtr();
+      y_ptr[k] = y[k]->getDataPtr();
+      values[k] = ValueType();
+    }
+    parallelSum(x[0]->scalarizedLocalSize(), nb_dot, values.data(),
+                [&](std::size_t begin, std::size_t end, ValueType* sum) {
+                  std::vector<ValueType> s(nb_dot, ValueType());
+                  for (std::size_t i = begin; i < end; ++i) {
+                    for (Arccore::Integer k = 0; k < nb_dot; ++k)
+                      s[k] += x_ptr[k][i] * y_ptr[k][i];
+                  }
+                  for (Arccore::Integer k = 0; k < nb_dot; ++k)
+                    sum[k] += s[k];
+                });
+  }
+
+  /*!
+   * \brief Applique \a func(begin,end) sur des sous-intervalles de [0,n[.
+   *
+   * Si Alien est compilé avec OpenMP (ALIEN_USE_OPENMP) et que \a n est
+   * suffisamment grand, chaque thread traite un sous-intervalle contigu.
+   */
+  template <typename LambdaT>
+  static void parallelFor(std::size_t n, const LambdaT& func)
+  {
+#ifdef ALIEN_USE_OPENMP
+    if (n >= parallel_threshold && omp_get_max_threads() > 1) {
+#pragma omp parallel
+      {
+        auto range = _threadRange(n, omp_get_num_threads(), omp_get_thread_num());
+        func(range.first, range.second);
+      }
+      return;
+    }
+#endif
+    func(0, n);
+  }
+
+  /*!
+   * \brief Ajoute à \a sums les \a nb_value sommes calculées par
+   * \a func(begin,end,partial_sums) sur des sous-intervalles de [0,n[.
+   *
+   * Avec OpenMP, chaque thread calcule ses sommes partielles qui sont
+   * ensuite ajoutées dans l'ordre des threads. Pour un nombre de threads
+   * donné, le résultat est donc reproductible.
+   */
+  template <typename ValueT, typename LambdaT>
+  static void parallelSum(std::size_t n, Arccore::Integer nb_value, ValueT* sums, const LambdaT& func)
+  {
+#ifdef ALIEN_USE_OPENMP
+    int nb_thread = omp_get_max_threads();
+    if (n >= parallel_threshold && nb_thread > 1) {
+      std::vector<ValueT> partial_sums(nb_thread * nb_value, ValueT());
+#pragma omp parallel num_threads(nb_thread)
+      {
+        auto range = _threadRange(n, omp_get_num_threads(), omp_get_thread_num());
+        func(range.first, range.second, partial_sums.data() + omp_get_thread_num() * nb_value);
+      }
+      for (int t = 0; t < nb_thread; ++t)
+        for (Arccore::Integer k = 0; k < nb_value; ++k)
+          sums[k] += partial_sums[t * nb_value + k];
+      return;
+    }
+#endif
+    func(0, n, sums);
+  }
+
   template <typename Distribution, typename VectorT>
   static typename VectorT::ValueType nrm1(Distribution const& dist, const VectorT& x)
   {
@@ -136,6 +295,15 @@ class CBLASMPIKernel
     }
     return std::sqrt(value);
   }
+
+ private:
+  static std::pair<std::size_t, std::size_t> _threadRange(std::size_t n, int nb_thread, int thread_index)
+  {
+    std::size_t chunk_size = (n + nb_thread - 1) / nb_thread;
+    std::size_t begin = std::min(n, chunk_size * thread_index);
+    std::size_t end = std::min(n, begin + chunk_size);
+    return std::make_pair(begin, end);
+  }
 };
 
 } // namespace Alien
@@ -19,6 +19,7 @@
 #include "SimpleCSRInternalLinearAlgebra.h"
 #include <alien/utils/Precomp.h>
 
+#include <arccore/base/FatalErrorException.h>
 #include <arccore/base/NotImplementedException.h>
 #include <arccore/base/TraceInfo.h>
 
@@ -217,6 +218,57 @@ void SimpleCSRInternalLinearAlgebra::dot(const CSRVector& vx,
 
 /*---------------------------------------------------------------------------*/
 
+namespace
+{
+  void _checkDotsArgs(ConstArrayView<const CSRVector*> vx,
+                      ConstArrayView<const CSRVector*> vy,
+                      Integer nb_value)
+  {
+    if (vx.size() != vy.size() || vx.size() != nb_value)
+      throw FatalErrorException(A_FUNCINFO, "Incompatible sizes for dot products");
+  }
+} // namespace
+
+Real SimpleCSRInternalLinearAlgebra::axpyDot(Real alpha, const CSRVector& vx, CSRVector& vy,
+                                             const CSRVector& vz) const
+{
+#ifdef ALIEN_USE_PERF_TIMER
+  SentryType s(m_timer, "CSR-AXPY-DOT");
+#endif
+  return CBLASMPIKernel::axpyDot(vx.distribution(), alpha, vx, vy, vz);
+}
+
+void SimpleCSRInternalLinearAlgebra::dots(ConstArrayView<const CSRVector*> vx,
+                                          ConstArrayView<const CSRVector*> vy,
+                                          ArrayView<Real> values) const
+{
+#ifdef ALIEN_USE_PERF_TIMER
+  SentryType s(m_timer, "CSR-DOTS");
+#endif
+  _checkDotsArgs(vx, vy, values.size());
+  if (vx.empty())
+    return;
+  CBLASMPIKernel::dots(vx[0]->distribution(), vx, vy, values);
+}
+
+void SimpleCSRInternalLinearAlgebra::startDots(ConstArrayView<const CSRVector*> vx,
+                                               ConstArrayView<const CSRVector*> vy,
+                                               ReductionType& reduction) const
+{
+#ifdef ALIEN_USE_PERF_TIMER
+  SentryType s(m_timer, "CSR-START-DOTS");
+#endif
+  _checkDotsArgs(vx, vy, vx.size());
+  if (vx.empty()) {
+    reduction.localValues(0);
+    reduction.start(nullptr);
+    return;
+  }
+  CBLASMPIKernel::startDots(vx[0]->distribution(), vx, vy, reduction);
+}
+
+/*---------------------------------------------------------------------------*/
+
 void SimpleCSRInternalLinearAlgebra::scal(Real alpha, CSRVector& vx) const
 {
 #ifdef ALIEN_USE_PERF_TIMER
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* SimpleCSRInternalLinearAlgebra.h                            (C) 2000-2023 */
+/* SimpleCSRInternalLinearAlgebra.h                            (C) 2000-2024 */
 /*                                                                           */
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -21,6 +21,7 @@
 #include <alien/kernels/simple_csr/SimpleCSRVector.h>
 #include <alien/kernels/simple_csr/SendRecvOp.h>
 #include <alien/kernels/simple_csr/LUSendRecvOp.h>
+#include <alien/kernels/simple_csr/algebra/AsyncReduction.h>
 
 #include <alien/distribution/VectorDistribution.h>
 #include <alien/distribution/MatrixDistribution.h>
@@ -95,6 +96,9 @@ class ALIEN_EXPORT SimpleCSRInternalLinearAlgebra
 
   typedef Future<Real> FutureType;
 
+  //! Réduction non bloquante de produits scalaires
+  typedef AsyncReduction<Real> ReductionType;
+
   typedef Alien::StdTimer TimerType;
   typedef TimerType::Sentry SentryType;
 
@@ -121,6 +125,21 @@ class ALIEN_EXPORT SimpleCSRInternalLinearAlgebra
   Real dot(const Vector& x, const Vector& y) const;
   void dot(const Vector& x, const Vector& y, FutureType& res) const;
 
+  //! Calcule y = y + alpha * x et retourne (y,z) en une seule passe
+  Real axpyDot(Real alpha, const Vector& x, Vector& y, const Vector& z) const;
+  //! Calcule les produits scalaires (x[k],y[k]) avec une seule réduction
+  void dots(ConstArrayView<const Vector*> x, ConstArrayView<const Vector*> y,
+            ArrayView<Real> values) const;
+  /*!
+   * \brief Démarre le calcul non bloquant des produits scalaires (x[k],y[k]).
+   *
+   * Les valeurs sont disponibles dans \a reduction après l'appel à
+   * ReductionType::wait(). Cela permet de recouvrir la réduction globale
+   * par d'autres calculs.
+   */
+  void startDots(ConstArrayView<const Vector*> x, ConstArrayView<const Vector*> y,
+                 ReductionType& reduction) const;
+
   void scal(Real alpha, Vector& x) const;
   void diagonal(const Matrix& a, Vector& x) const;
   void reciprocal(Vector& x) const;
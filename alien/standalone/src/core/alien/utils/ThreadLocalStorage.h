@@ -0,0 +1,120 @@
+/*
+ * Copyright 2020 IFPEN-CEA
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Alien
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*!
+ * \brief Instance de \a T propre à chaque thread.
+ *
+ * local() retourne l'instance associée au thread appelant, créée au premier
+ * appel. local() peut être appelée en concurrence depuis des threads
+ * quelconques (std::thread, OpenMP, TBB...). Un cache thread_local évite
+ * de prendre le verrou après le premier accès d'un thread.
+ *
+ * Les autres méthodes ne doivent être appelées qu'en dehors des sections
+ * concurrentes, typiquement pour fusionner les instances.
+ */
+template <typename T>
+class ThreadLocalStorage
+{
+ public:
+  ThreadLocalStorage()
+  : m_id(_nextId())
+  {}
+
+  ThreadLocalStorage(const ThreadLocalStorage&) = delete;
+  ThreadLocalStorage& operator=(const ThreadLocalStorage&) = delete;
+
+ public:
+  //! Instance du thread appelant
+  T& local()
+  {
+    struct Cache
+    {
+      std::uint64_t id = 0;
+      T* value = nullptr;
+    };
+    static thread_local Cache cache;
+    if (cache.id == m_id)
+      return *cache.value;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    T*& value = m_thread_values[std::this_thread::get_id()];
+    if (!value) {
+      m_values.emplace_back(std::make_unique<T>());
+      value = m_values.back().get();
+    }
+    cache.id = m_id;
+    cache.value = value;
+    return *value;
+  }
+
+  //! Nombre d'instances créées
+  std::size_t size() const { return m_values.size(); }
+
+  //! \a i-ème instance créée
+  T& operator[](std::size_t i) { return *m_values[i]; }
+  const T& operator[](std::size_t i) const { return *m_values[i]; }
+
+  //! Détruit toutes les instances
+  void clear()
+  {
+    m_values.clear();
+    m_thread_values.clear();
+    // Invalide les caches des threads qui référencent les instances détruites
+    m_id = _nextId();
+  }
+
+ private:
+  static std::uint64_t _nextId()
+  {
+    static std::atomic<std::uint64_t> next_id(0);
+    return ++next_id;
+  }
+
+ private:
+  std::uint64_t m_id;
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<T>> m_values;
+  std::map<std::thread::id, T*> m_thread_values;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Alien
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
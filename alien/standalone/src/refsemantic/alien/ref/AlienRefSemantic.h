@@ -37,7 +37,9 @@
 
 #include <alien/ref/handlers/block/ProfiledBlockMatrixBuilder.h>
 #include <alien/ref/handlers/block/ProfiledVBlockMatrixBuilder.h>
+#include <alien/ref/handlers/profiler/ConcurrentMatrixProfiler.h>
 #include <alien/ref/handlers/profiler/MatrixProfiler.h>
+#include <alien/ref/handlers/scalar/ConcurrentDirectMatrixBuilder.h>
 #include <alien/ref/handlers/scalar/DirectMatrixBuilder.h>
 #include <alien/ref/handlers/scalar/ProfiledMatrixBuilder.h>
 #include <alien/ref/handlers/stream/StreamMatrixBuilder.h>
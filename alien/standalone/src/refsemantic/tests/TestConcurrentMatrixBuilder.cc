@@ -0,0 +1,133 @@
+/*
+ * Copyright 2020 IFPEN-CEA
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <alien/ref/AlienRefSemantic.h>
+
+#include <Environment.h>
+#include <alien/core/backend/LinearAlgebra.h>
+
+namespace
+{
+const Arccore::Integer nb_thread = 4;
+
+// Assemble le laplacien 1D (une contribution 2x2 par arête) avec plusieurs threads.
+void _assembleLaplacian(Alien::ConcurrentDirectMatrixBuilder& builder, Arccore::Integer n)
+{
+  std::vector<std::thread> threads;
+  for (Arccore::Integer t = 0; t < nb_thread; ++t) {
+    threads.emplace_back([&builder, n, t]() {
+      for (Arccore::Integer e = t; e < n - 1; e += nb_thread) {
+        builder.addData(e, e, 1.);
+        builder.addData(e, e + 1, -1.);
+        builder.addData(e + 1, e, -1.);
+        builder.addData(e + 1, e + 1, 1.);
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+}
+
+// Vérifie A * x avec x[i] = i * i.
+void _checkLaplacian(Alien::Matrix& A, const Alien::VectorDistribution& vdist, Arccore::Integer n)
+{
+  Alien::LinearAlgebra<Alien::BackEnd::tag::simplecsr> alg(vdist.parallelMng());
+  Alien::Vector X(vdist);
+  {
+    Alien::LocalVectorWriter writer(X);
+    for (Arccore::Integer i = 0; i < n; ++i)
+      writer[i] = Arccore::Real(i) * i;
+  }
+  Alien::Vector R(vdist);
+  alg.mult(A, X, R);
+  Alien::LocalVectorReader reader(R);
+  ASSERT_EQ(reader[0], -1.);
+  for (Arccore::Integer i = 1; i < n - 1; ++i)
+    ASSERT_EQ(reader[i], -2.);
+  ASSERT_EQ(reader[n - 1], Arccore::Real(2 * n - 3));
+}
+} // namespace
+
+TEST(TestConcurrentMatrixBuilder, Profiler)
+{
+  const Arccore::Integer n = 1000;
+  Alien::Space space(n, "Space");
+  Alien::MatrixDistribution mdist(space, space, AlienTest::Environment::parallelMng());
+  Alien::Matrix A(mdist);
+  {
+    Alien::ConcurrentMatrixProfiler profiler(A);
+    std::vector<std::thread> threads;
+    for (Arccore::Integer t = 0; t < nb_thread; ++t) {
+      threads.emplace_back([&profiler, n, t]() {
+        for (Arccore::Integer e = t; e < n - 1; e += nb_thread) {
+          profiler.addMatrixEntry(e, e);
+          profiler.addMatrixEntry(e, e + 1);
+          profiler.addMatrixEntry(e + 1, e);
+          profiler.addMatrixEntry(e + 1, e + 1);
+        }
+      });
+    }
+    for (auto& thread : threads)
+      thread.join();
+  }
+  const auto& profile = A.impl()->get<Alien::BackEnd::tag::simplecsr>().getCSRProfile();
+  ASSERT_EQ(profile.getNRow(), n);
+  ASSERT_EQ(profile.getNnz(), 3 * n - 2);
+}
+
+TEST(TestConcurrentMatrixBuilder, DirectBuilder)
+{
+  const Arccore::Integer n = 1000;
+  Alien::Space space(n, "Space");
+  Alien::MatrixDistribution mdist(space, space, AlienTest::Environment::parallelMng());
+  Alien::VectorDistribution vdist(space, AlienTest::Environment::parallelMng());
+  Alien::Matrix A(mdist);
+  {
+    Alien::ConcurrentDirectMatrixBuilder builder(A, Alien::DirectMatrixOptions::eResetValues);
+    _assembleLaplacian(builder, n);
+    builder.finalize();
+    ASSERT_FALSE(builder.hasReusedProfile());
+  }
+  _checkLaplacian(A, vdist, n);
+
+  // Même assemblage : seules les valeurs sont mises à jour
+  {
+    Alien::ConcurrentDirectMatrixBuilder builder(A, Alien::DirectMatrixOptions::eResetValues);
+    _assembleLaplacian(builder, n);
+    builder.finalize();
+    ASSERT_TRUE(builder.hasReusedProfile());
+  }
+  _checkLaplacian(A, vdist, n);
+
+  // Entrée hors profil : le profil est étendu et les valeurs conservées
+  {
+    Alien::ConcurrentDirectMatrixBuilder builder(A, Alien::DirectMatrixOptions::eNoReset);
+    builder.addData(0, n - 1, 1.);
+    builder.addData(0, n - 1, -1.);
+    builder.finalize();
+    ASSERT_FALSE(builder.hasReusedProfile());
+  }
+  const auto& profile = A.impl()->get<Alien::BackEnd::tag::simplecsr>().getCSRProfile();
+  ASSERT_EQ(profile.getNnz(), 3 * n - 1);
+  _checkLaplacian(A, vdist, n);
+}
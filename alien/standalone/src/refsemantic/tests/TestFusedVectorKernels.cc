@@ -0,0 +1,100 @@
+/*
+ * Copyright 2020 IFPEN-CEA
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <alien/ref/AlienRefSemantic.h>
+#include <alien/kernels/simple_csr/algebra/SimpleCSRInternalLinearAlgebra.h>
+
+#include <Environment.h>
+
+namespace
+{
+// x = 1, y = global index, z = 2
+void _fillVectors(Alien::Vector& x, Alien::Vector& y, Alien::Vector& z)
+{
+  auto const& dist = x.distribution();
+  auto local_size = dist.localSize();
+  auto offset = dist.offset();
+  Alien::LocalVectorWriter x_writer(x);
+  Alien::LocalVectorWriter y_writer(y);
+  Alien::LocalVectorWriter z_writer(z);
+  for (Arccore::Integer i = 0; i < local_size; ++i) {
+    x_writer[i] = 1.;
+    y_writer[i] = offset + i;
+    z_writer[i] = 2.;
+  }
+}
+} // namespace
+
+// Size larger than CBLASMPIKernel::parallel_threshold to use threads when enabled.
+TEST(TestFusedVectorKernels, AxpyDot)
+{
+  const Arccore::Integer global_size = 20000;
+  const Alien::VectorDistribution dist(global_size, AlienTest::Environment::parallelMng());
+  Alien::Vector x(dist), y(dist), z(dist);
+  _fillVectors(x, y, z);
+
+  typedef Alien::BackEnd::tag::simplecsr BackEndType;
+  Alien::SimpleCSRInternalLinearAlgebra alg;
+  auto const& true_x = x.impl()->get<BackEndType>();
+  auto& true_y = y.impl()->get<BackEndType>(true);
+  auto const& true_z = z.impl()->get<BackEndType>();
+
+  // y = y + 0.5 * x, (y,z) = sum(2 * i + 1) = n^2
+  Arccore::Real value = alg.axpyDot(0.5, true_x, true_y, true_z);
+  ASSERT_EQ(value, Arccore::Real(global_size) * global_size);
+  ASSERT_EQ(alg.dot(true_y, true_z), value);
+}
+
+TEST(TestFusedVectorKernels, Dots)
+{
+  const Arccore::Integer global_size = 20000;
+  const Alien::VectorDistribution dist(global_size, AlienTest::Environment::parallelMng());
+  Alien::Vector x(dist), y(dist), z(dist);
+  _fillVectors(x, y, z);
+
+  typedef Alien::BackEnd::tag::simplecsr BackEndType;
+  typedef Alien::SimpleCSRInternalLinearAlgebra::Vector CSRVector;
+  Alien::SimpleCSRInternalLinearAlgebra alg;
+  const CSRVector* true_x = &x.impl()->get<BackEndType>();
+  const CSRVector* true_y = &y.impl()->get<BackEndType>();
+  const CSRVector* true_z = &z.impl()->get<BackEndType>();
+
+  const CSRVector* left[3] = { true_x, true_y, true_y };
+  const CSRVector* right[3] = { true_x, true_z, true_x };
+  const Arccore::Real expected[3] = { Arccore::Real(global_size),
+                                      Arccore::Real(global_size) * (global_size - 1),
+                                      Arccore::Real(global_size) * (global_size - 1) / 2 };
+
+  Arccore::Real values[3];
+  alg.dots(Arccore::ConstArrayView<const CSRVector*>(3, left),
+           Arccore::ConstArrayView<const CSRVector*>(3, right),
+           Arccore::ArrayView<Arccore::Real>(3, values));
+  for (int k = 0; k < 3; ++k)
+    ASSERT_EQ(values[k], expected[k]);
+
+  Alien::SimpleCSRInternalLinearAlgebra::ReductionType reduction;
+  alg.startDots(Arccore::ConstArrayView<const CSRVector*>(3, left),
+                Arccore::ConstArrayView<const CSRVector*>(3, right),
+                reduction);
+  ASSERT_EQ(reduction.size(), 3);
+  for (int k = 0; k < 3; ++k)
+    ASSERT_EQ(reduction.value(k), expected[k]);
+  ASSERT_FALSE(reduction.isPending());
+}
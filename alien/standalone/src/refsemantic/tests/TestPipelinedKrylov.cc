@@ -0,0 +1,124 @@
+/*
+ * Copyright 2020 IFPEN-CEA
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <alien/ref/AlienRefSemantic.h>
+#include <alien/kernels/simple_csr/algebra/SimpleCSRInternalLinearAlgebra.h>
+#include <alien/expression/krylov/AlienKrylov.h>
+
+#include <Environment.h>
+
+namespace
+{
+const Arccore::Integer global_size = 100;
+
+// 1D Laplacian: 2 on the diagonal, -1 on the off diagonals
+void _buildLaplacian(Alien::Matrix& A)
+{
+  auto const& dist = A.distribution();
+  auto offset = dist.rowOffset();
+  auto local_size = dist.localRowSize();
+  Alien::DirectMatrixBuilder builder(A, Alien::DirectMatrixOptions::eResetValues,
+                                     Alien::DirectMatrixOptions::SymmetricFlag::eUnSymmetric);
+  builder.reserve(3);
+  builder.allocate();
+  for (Arccore::Integer i = offset; i < offset + local_size; ++i) {
+    builder(i, i) = 2.;
+    if (i > 0)
+      builder(i, i - 1) = -1.;
+    if (i < global_size - 1)
+      builder(i, i + 1) = -1.;
+  }
+}
+
+// Solves A x = b with b = A * 1 and checks that x = 1
+template <typename SolveFunctor>
+void _solveAndCheck(SolveFunctor solve)
+{
+  auto* pm = AlienTest::Environment::parallelMng();
+  const Alien::MatrixDistribution mdist(global_size, global_size, pm);
+  const Alien::VectorDistribution vdist(global_size, pm);
+  Alien::Matrix A(mdist);
+  _buildLaplacian(A);
+  Alien::Vector b(vdist), x(vdist);
+  {
+    auto offset = vdist.offset();
+    Alien::LocalVectorWriter b_writer(b);
+    Alien::LocalVectorWriter x_writer(x);
+    for (Arccore::Integer i = 0; i < vdist.localSize(); ++i) {
+      Arccore::Integer global_i = offset + i;
+      b_writer[i] = (global_i == 0 || global_i == global_size - 1) ? 1. : 0.;
+      x_writer[i] = 0.;
+    }
+  }
+
+  typedef Alien::BackEnd::tag::simplecsr BackEndType;
+  typedef Alien::SimpleCSRInternalLinearAlgebra AlgebraType;
+  AlgebraType alg;
+  {
+    auto const& true_A = A.impl()->get<BackEndType>();
+    auto const& true_b = b.impl()->get<BackEndType>();
+    auto& true_x = x.impl()->get<BackEndType>(true);
+
+    Alien::DiagPreconditioner<AlgebraType> precond(alg, true_A);
+    precond.init();
+    Alien::Iteration<AlgebraType> iter(alg, true_b, 1e-9, 1000);
+    solve(alg, precond, iter, true_A, true_b, true_x);
+    ASSERT_TRUE(iter.getStatus());
+  }
+
+  Alien::LocalVectorReader reader(x);
+  for (Arccore::Integer i = 0; i < vdist.localSize(); ++i)
+    ASSERT_NEAR(reader[i], 1., 1e-4);
+}
+} // namespace
+
+TEST(TestPipelinedKrylov, CG)
+{
+  _solveAndCheck([](auto& alg, auto& precond, auto& iter, auto const& A, auto const& b, auto& x) {
+    Alien::CG<Alien::SimpleCSRInternalLinearAlgebra> solver(alg);
+    solver.solve(precond, iter, A, b, x);
+  });
+}
+
+TEST(TestPipelinedKrylov, PipelinedCG)
+{
+  _solveAndCheck([](auto& alg, auto& precond, auto& iter, auto const& A, auto const& b, auto& x) {
+    Alien::CG<Alien::SimpleCSRInternalLinearAlgebra> solver(alg);
+    solver.solvePipelined(precond, iter, A, b, x);
+  });
+}
+
+TEST(TestPipelinedKrylov, BiCGStab)
+{
+  _solveAndCheck([](auto& alg, auto& precond, auto& iter, auto const& A, auto const& b, auto& x) {
+    Alien::BiCGStab<Alien::SimpleCSRInternalLinearAlgebra> solver(alg);
+    solver.solve(precond, iter, A, b, x);
+  });
+}
+
+TEST(TestPipelinedKrylov, PipelinedBiCGStab)
+{
+  _solveAndCheck([](auto& alg, auto& precond, auto& iter, auto const& A, auto const& b, auto& x) {
+    Alien::BiCGStab<Alien::SimpleCSRInternalLinearAlgebra> solver(alg);
+    solver.solvePipelined(precond, iter, A, b, x);
+  });
+}
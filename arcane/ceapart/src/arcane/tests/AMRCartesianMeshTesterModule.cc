@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* AMRCartesianMeshTesterModule.cc                             (C) 2000-2023 */
+/* AMRCartesianMeshTesterModule.cc                             (C) 2000-2024 */
 /*                                                                           */
 /* Module de test du gestionnaire de maillages cartésiens AMR.               */
 /*---------------------------------------------------------------------------*/
@@ -15,6 +15,7 @@
 #include "arcane/utils/PlatformUtils.h"
 #include "arcane/utils/Real2.h"
 #include "arcane/utils/MD5HashAlgorithm.h"
+#include "arcane/utils/IAMRTransportFunctor.h"
 
 #include "arcane/core/MeshUtils.h"
 #include "arcane/core/Directory.h"
@@ -48,6 +49,7 @@
 #include "arcane/cartesianmesh/ICartesianMeshPatch.h"
 #include "arcane/cartesianmesh/CartesianMeshUtils.h"
 #include "arcane/cartesianmesh/CartesianMeshCoarsening2.h"
+#include "arcane/cartesianmesh/CartesianMeshAMRPatchRegridder.h"
 #include "arcane/cartesianmesh/CartesianMeshPatchListView.h"
 
 #include "arcane/tests/ArcaneTestGlobal.h"
@@ -62,6 +64,74 @@ namespace ArcaneTest
 
 using namespace Arcane;
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Fonction de transport utilisée pour tester le recalcul des patchs.
+ *
+ * Lors du raffinement, la maille fille d'indice \a i prend la valeur de la
+ * maille parente plus childOffset(i). Lors du dé-raffinement, la maille
+ * parente prend la moyenne des valeurs des mailles filles. Comme la somme
+ * des décalages est nulle, un raffinement suivi d'un dé-raffinement redonne
+ * la valeur initiale.
+ */
+class AMRTransportTester
+: public IAMRTransportFunctor
+{
+ public:
+
+  explicit AMRTransportTester(VariableCellReal& value)
+  : m_value(value)
+  {}
+
+ public:
+
+  static Real childOffset(Int32 index, Int32 nb_child)
+  {
+    return (index - (nb_child - 1) / 2.0) * 0.25;
+  }
+
+ public:
+
+  void executeFunctor(Array<ItemInternal*>&, AMROperationType) override
+  {
+    ARCANE_FATAL("Not implemented");
+  }
+  void executeFunctor(Array<Cell>& cells, AMROperationType op) override
+  {
+    for (Cell cell : cells) {
+      Int32 nb_child = cell.nbHChildren();
+      if (op == Prolongation) {
+        for (Int32 i = 0; i < nb_child; ++i)
+          m_value[cell.hChild(i)] = m_value[cell] + childOffset(i, nb_child);
+      }
+      else {
+        Real sum = 0.0;
+        for (Int32 i = 0; i < nb_child; ++i)
+          sum += m_value[cell.hChild(i)];
+        m_value[cell] = sum / nb_child;
+      }
+      if (cell.isOwn()) {
+        if (op == Prolongation)
+          ++m_nb_prolongation;
+        else
+          ++m_nb_restriction;
+      }
+    }
+  }
+
+ public:
+
+  //! Nombre de mailles propres passées à la prolongation
+  Int64 m_nb_prolongation = 0;
+  //! Nombre de mailles propres passées à la restriction
+  Int64 m_nb_restriction = 0;
+
+ private:
+
+  VariableCellReal& m_value;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -92,6 +162,8 @@ class AMRCartesianMeshTesterModule
   VariableCellReal3 m_cell_center;
   VariableFaceReal3 m_face_center;
   VariableNodeReal m_node_density; 
+  VariableCellReal m_amr_transport_value;
+  VariableCellReal m_amr_transport_expected_value;
   ICartesianMesh* m_cartesian_mesh;
   Ref<CartesianMeshTestUtils> m_utils;
   UniqueArray<VariableCellReal*> m_cell_patch_variables;
@@ -102,6 +174,8 @@ class AMRCartesianMeshTesterModule
   void _compute1();
   void _compute2();
   void _initAMR();
+  void _regrid();
+  void _checkAMRTransportValues(Int32 level);
   void _computeSubCellDensity(Cell cell);
   void _computeCenters();
   void _processPatches();
@@ -121,6 +195,8 @@ AMRCartesianMeshTesterModule(const ModuleBuildInfo& mbi)
 , m_cell_center(VariableBuildInfo(this,"CellCenter"))
 , m_face_center(VariableBuildInfo(this,"FaceCenter"))
 , m_node_density(VariableBuildInfo(this,"NodeDensity"))
+, m_amr_transport_value(VariableBuildInfo(this,"AMRTransportValue"))
+, m_amr_transport_expected_value(VariableBuildInfo(this,"AMRTransportExpectedValue"))
 , m_cartesian_mesh(nullptr)
 {
 }
@@ -263,6 +339,10 @@ init()
   if (do_coarse_at_init)
     ++m_nb_expected_patch;
 
+  // Si on recalcule les patchs, on ne connait pas à l'avance leur nombre.
+  if (!options()->regrid().empty())
+    m_nb_expected_patch = options()->expectedNumberOfCellsInPatchs.size();
+
   if (subDomain()->isContinue())
     m_cartesian_mesh->recreateFromDump();
   else{
@@ -509,6 +589,133 @@ _initAMR()
       m_cartesian_mesh->computeDirections();
     }
   }
+
+  if (!options()->regrid().empty())
+    _regrid();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Recalcule les patchs à partir des mailles dont le centre est
+ * dans la boîte spécifiée dans le jeu de données.
+ *
+ * Vérifie aussi que les fonctions de transport sont appelées avec
+ * les bonnes valeurs lors des raffinements et des dé-raffinements.
+ * Entre deux recalculs, on ajoute 1.0 à la valeur des mailles filles
+ * pour que le dé-raffinement modifie la valeur des mailles parentes.
+ */
+void AMRCartesianMeshTesterModule::
+_regrid()
+{
+  m_cartesian_mesh->computeDirections();
+  Ref<CartesianMeshAMRPatchRegridder> regridder = CartesianMeshUtils::createCartesianMeshAMRPatchRegridder(m_cartesian_mesh);
+  IMesh* mesh = m_cartesian_mesh->mesh();
+  IParallelMng* pm = mesh->parallelMng();
+  Int32 dim = mesh->dimension();
+  VariableNodeReal3& nodes_coord = mesh->nodesCoordinates();
+
+  ENUMERATE_(Cell,icell,allCells()){
+    Real v = static_cast<Real>(icell->uniqueId().asInt64());
+    m_amr_transport_value[icell] = v;
+    m_amr_transport_expected_value[icell] = v;
+  }
+  AMRTransportTester transport_tester(m_amr_transport_value);
+  regridder->registerCallBack(&transport_tester);
+
+  for( auto& x : options()->regrid() ){
+    const Int32 level = x->level();
+    const Real3 box_min = x->position();
+    const Real3 box_max = x->position() + x->length();
+    UniqueArray<Int32> cells_to_flag;
+    ENUMERATE_(Cell,icell,mesh->ownLevelCells(level)){
+      Cell cell = *icell;
+      Real3 center;
+      for( NodeLocalId node : cell.nodes() )
+        center += nodes_coord[node];
+      center /= cell.nbNode();
+      bool is_inside = true;
+      for( Int32 d=0; d<dim; ++d )
+        if (center[d]<box_min[d] || center[d]>box_max[d])
+          is_inside = false;
+      if (is_inside)
+        cells_to_flag.add(icell.itemLocalId());
+    }
+    regridder->setEfficiency(x->efficiency());
+    regridder->regrid(level,cells_to_flag);
+    info() << "Regrid level=" << level << " nb_box=" << regridder->boxes(level).size();
+
+    _checkAMRTransportValues(level);
+
+    // Simule un calcul sur les mailles filles.
+    ENUMERATE_(Cell,icell,mesh->allLevelCells(level)){
+      Cell cell = *icell;
+      Int32 nb_child = cell.nbHChildren();
+      if (nb_child==0)
+        continue;
+      m_amr_transport_expected_value[cell] += 1.0;
+      for( Int32 i=0; i<nb_child; ++i )
+        m_amr_transport_value[cell.hChild(i)] += 1.0;
+    }
+  }
+  regridder->unRegisterCallBack(&transport_tester);
+
+  Int64 nb_prolongation = pm->reduce(Parallel::ReduceSum,transport_tester.m_nb_prolongation);
+  Int64 nb_restriction = pm->reduce(Parallel::ReduceSum,transport_tester.m_nb_restriction);
+  info() << "Regrid nb_prolongation=" << nb_prolongation << " nb_restriction=" << nb_restriction;
+  Int32 expected_nb_prolongation = options()->expectedNumberOfProlongatedCells();
+  if (expected_nb_prolongation>=0 && nb_prolongation!=expected_nb_prolongation)
+    ARCANE_FATAL("Bad number of prolongated cells v={0} expected={1}",
+                 nb_prolongation,expected_nb_prolongation);
+  Int32 expected_nb_restriction = options()->expectedNumberOfRestrictedCells();
+  if (expected_nb_restriction>=0 && nb_restriction!=expected_nb_restriction)
+    ARCANE_FATAL("Bad number of restricted cells v={0} expected={1}",
+                 nb_restriction,expected_nb_restriction);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie les valeurs issues des fonctions de transport.
+ *
+ * Une maille propre de niveau \a level sans mailles filles doit avoir la valeur
+ * attendue, ce qui teste la restriction. Les mailles filles doivent avoir
+ * la valeur attendue de la maille parente plus leur décalage, ce qui
+ * teste la prolongation.
+ */
+void AMRCartesianMeshTesterModule::
+_checkAMRTransportValues(Int32 level)
+{
+  IMesh* mesh = m_cartesian_mesh->mesh();
+  Integer nb_error = 0;
+  ENUMERATE_(Cell,icell,mesh->ownLevelCells(level)){
+    Cell cell = *icell;
+    Real expected_value = m_amr_transport_expected_value[cell];
+    Int32 nb_child = cell.nbHChildren();
+    if (nb_child==0){
+      Real value = m_amr_transport_value[cell];
+      if (value!=expected_value){
+        ++nb_error;
+        if (nb_error<10)
+          info() << "Bad restricted value cell=" << ItemPrinter(cell)
+                 << " v=" << value << " expected=" << expected_value;
+      }
+      continue;
+    }
+    for( Int32 i=0; i<nb_child; ++i ){
+      Cell child = cell.hChild(i);
+      Real child_expected_value = expected_value + AMRTransportTester::childOffset(i,nb_child);
+      Real value = m_amr_transport_value[child];
+      if (value!=child_expected_value){
+        ++nb_error;
+        if (nb_error<10)
+          info() << "Bad prolongated value cell=" << ItemPrinter(child)
+                 << " v=" << value << " expected=" << child_expected_value;
+      }
+    }
+  }
+  if (nb_error!=0)
+    ARCANE_FATAL("Bad values for AMR transport nb_error={0}",nb_error);
 }
 
 /*---------------------------------------------------------------------------*/
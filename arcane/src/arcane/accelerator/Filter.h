@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* Filtering.h                                                 (C) 2000-2023 */
+/* Filtering.h                                                 (C) 2000-2024 */
 /*                                                                           */
 /* Algorithme de filtrage.                                                   */
 /*---------------------------------------------------------------------------*/
@@ -129,6 +129,10 @@ class GenericFilteringFlag
       // Pas encore implémenté en multi-thread
       [[fallthrough]];
     case eExecutionPolicy::Sequential: {
+      // Les commandes précédentes de la file peuvent s'exécuter de manière
+      // asynchrone sur l'hôte. Il faut attendre qu'elles soient terminées.
+      if (queue)
+        queue->barrier();
       Int32 index = 0;
       for (Int32 i = 0; i < nb_item; ++i) {
         if (flag[i] != 0) {
@@ -216,6 +220,10 @@ class GenericFilteringIf
       // Pas encore implémenté en multi-thread
       [[fallthrough]];
     case eExecutionPolicy::Sequential: {
+      // Les commandes précédentes de la file peuvent s'exécuter de manière
+      // asynchrone sur l'hôte. Il faut attendre qu'elles soient terminées.
+      if (queue)
+        queue->barrier();
       Int32 index = 0;
       for (Int32 i = 0; i < nb_item; ++i) {
         if (select_lambda(input[i])) {
@@ -5,7 +5,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MaterialVariableViews.h                                     (C) 2000-2023 */
+/* MaterialVariableViews.h                                     (C) 2000-2024 */
 /*                                                                           */
 /* Gestion des vues sur les variables matériaux pour les accélérateurs.      */
 /*---------------------------------------------------------------------------*/
@@ -20,6 +20,7 @@
 #include "arcane/core/materials/MeshMaterialVariableRef.h"
 #include "arcane/core/materials/MeshEnvironmentVariableRef.h"
 #include "arcane/core/materials/MatItem.h"
+#include "arcane/core/materials/CellMajorMaterialVariableScalar.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -254,6 +255,40 @@ viewIn(RunCommand& cmd,const CellEnvironmentVariableScalarRef<DataType>& var)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Vue en lecture pour le stockage contigu par maille d'une variable matériau.
+ */
+template<typename DataType> auto
+viewIn(RunCommand&,const CellMajorMaterialVariableScalar<DataType>& var)
+{
+  return var.constView();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue en écriture pour le stockage contigu par maille d'une variable matériau.
+ */
+template<typename DataType> auto
+viewOut(RunCommand&,CellMajorMaterialVariableScalar<DataType>& var)
+{
+  return var.view();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue en lecture/écriture pour le stockage contigu par maille d'une variable matériau.
+ */
+template<typename DataType> auto
+viewInOut(RunCommand&,CellMajorMaterialVariableScalar<DataType>& var)
+{
+  return var.view();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 }
 
 #endif
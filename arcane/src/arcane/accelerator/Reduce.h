@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* Reduce.h                                                    (C) 2000-2023 */
+/* Reduce.h                                                    (C) 2000-2024 */
 /*                                                                           */
 /* Gestion des réductions pour les accélérateurs.                            */
 /*---------------------------------------------------------------------------*/
@@ -47,6 +47,8 @@ namespace impl
 {
 extern "C++" ARCANE_ACCELERATOR_CORE_EXPORT IReduceMemoryImpl*
 internalGetOrCreateReduceMemoryImpl(RunCommand* command);
+extern "C++" ARCANE_ACCELERATOR_CORE_EXPORT void
+internalWaitHostCommand(RunCommand* command);
 
 template<typename DataType>
 class ReduceIdentity;
@@ -237,7 +239,8 @@ class ReduceFunctorMin
  * La réduction finale a lieu lors de l'appel à reduce(). Il ne faut donc
  * faire cet appel qu'une seule fois et dans une partie collective. Cet appel
  * n'est valide que sur les instance créées avec un constructeur vide. Ces dernières
- * ne peuvent être créées que sur l'hôte.
+ * ne peuvent être créées que sur l'hôte. Si reduce() n'est pas appelé, le
+ * destructeur de ces instances attend la fin de la commande associée.
  *
  * \warning Le constructeur de recopie ne doit pas être appelé explicitement.
  * L'instance de départ doit rester valide tant qu'il existe des copies ou
@@ -327,6 +330,12 @@ class Reducer
     if (!m_is_master_instance)
       ReduceFunctor::apply(m_parent_value,m_local_value);
 
+    // Si reduce() n'a pas été appelé, la commande peut encore être en cours
+    // d'exécution sur l'hôte et ses copies référencent 'm_atomic_value'.
+    // Il faut donc attendre sa fin avant de détruire l'instance.
+    if (m_is_master_instance && !m_memory_impl && !m_is_reduced)
+      impl::internalWaitHostCommand(m_command);
+
     //printf("Destroy host %p %p\n",m_host_or_device_memory_for_reduced_value,this);
     if (m_memory_impl && m_is_master_instance)
       m_memory_impl->release();
@@ -346,10 +355,17 @@ class Reducer
   {
     // Si la réduction est faite sur accélérateur, il faut recopier la valeur du device sur l'hôte.
     DataType* final_ptr = m_host_or_device_memory_for_reduced_value;
+    m_is_reduced = true;
     if (m_memory_impl){
       m_memory_impl->copyReduceValueFromDevice();
       final_ptr = reinterpret_cast<DataType*>(m_grid_memory_info.m_host_memory_for_reduced_value);
     }
+    else{
+      // Sur l'hôte, la commande peut s'exécuter de manière asynchrone.
+      // Il faut attendre qu'elle soit terminée pour que toutes les copies
+      // aient été détruites et aient mis à jour 'm_parent_value'.
+      impl::internalWaitHostCommand(m_command);
+    }
 
     if (m_parent_value){
       //std::cout << String::format("Reduce host has parent this={0} local_value={1} parent_value={2}\n",
@@ -386,6 +402,7 @@ class Reducer
  private:
   bool m_is_allocated = false;
   bool m_is_master_instance = false;
+  bool m_is_reduced = false;
 };
 
 /*---------------------------------------------------------------------------*/
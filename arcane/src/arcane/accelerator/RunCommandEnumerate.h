@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* RunCommandEnumerate.h                                       (C) 2000-2023 */
+/* RunCommandEnumerate.h                                       (C) 2000-2024 */
 /*                                                                           */
 /* Macros pour exécuter une boucle sur une liste d'entités.                  */
 /*---------------------------------------------------------------------------*/
@@ -76,16 +76,25 @@ _applyItems(RunCommand& command,ItemVectorViewT<ItemType> items,const Lambda& fu
     _applyKernelHIP(launch_info,ARCANE_KERNEL_HIP_FUNC(doIndirectGPULambda)<ItemType,Lambda>,func,items.localIds());
     break;
   case eExecutionPolicy::Sequential:
-    ENUMERATE_NO_TRACE_(ItemType,iitem,items){
-      func(LocalIdType(iitem.itemLocalId()));
-    }
+    launch_info._executeOnHost([=]()
+                               {
+                                 ENUMERATE_NO_TRACE_(ItemType,iitem,items){
+                                   func(LocalIdType(iitem.itemLocalId()));
+                                 }
+                               });
     break;
   case eExecutionPolicy::Thread:
-    arcaneParallelForeach(items,launch_info.loopRunInfo(),
-                          [&](ItemVectorViewT<ItemType> sub_items)
-                          {
-                            impl::_doIndirectThreadLambda(sub_items,func);
-                          });
+  {
+    ForLoopRunInfo loop_run_info(launch_info.loopRunInfo());
+    launch_info._executeOnHost([=]()
+                               {
+                                 arcaneParallelForeach(items,loop_run_info,
+                                                       [&](ItemVectorViewT<ItemType> sub_items)
+                                                       {
+                                                         impl::_doIndirectThreadLambda(sub_items,func);
+                                                       });
+                               });
+  }
     break;
   default:
     ARCANE_FATAL("Invalid execution policy '{0}'",exec_policy);
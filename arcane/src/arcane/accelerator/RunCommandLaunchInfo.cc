@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* RunCommandLaunchInfo.cc                                     (C) 2000-2022 */
+/* RunCommandLaunchInfo.cc                                     (C) 2000-2024 */
 /*                                                                           */
 /* Informations pour l'exécution d'une 'RunCommand'.                         */
 /*---------------------------------------------------------------------------*/
@@ -18,6 +18,7 @@
 
 #include "arcane/accelerator/core/RunQueue.h"
 #include "arcane/accelerator/core/IRunQueueStream.h"
+#include "arcane/accelerator/core/internal/HostRunQueueWorker.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -67,6 +68,8 @@ _begin()
   m_exec_policy = queue.executionPolicy();
   m_queue_stream = queue._internalStream();
   m_runtime = queue._internalRuntime();
+  if (!isAcceleratorPolicy(m_exec_policy))
+    m_host_worker = m_queue_stream->_internalHostWorker(queue.isAsync());
   m_command._allocateReduceMemory(m_thread_block_info.nb_block_per_grid);
 }
 
@@ -126,6 +129,15 @@ _internalStreamImpl()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void RunCommandLaunchInfo::
+_enqueueHostCommand(std::function<void()>&& func)
+{
+  m_host_worker->enqueue(std::move(func));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 auto RunCommandLaunchInfo::
 computeThreadBlockInfo(Int64 full_size) const -> ThreadBlockInfo
 {
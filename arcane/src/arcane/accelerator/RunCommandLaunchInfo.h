@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* RunCommandLaunchInfo.h                                      (C) 2000-2022 */
+/* RunCommandLaunchInfo.h                                      (C) 2000-2024 */
 /*                                                                           */
 /* Informations pour l'exécution d'une 'RunCommand'.                         */
 /*---------------------------------------------------------------------------*/
@@ -20,6 +20,8 @@
 
 #include "arcane/accelerator/AcceleratorGlobal.h"
 
+#include <functional>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -91,6 +93,24 @@ class ARCANE_ACCELERATOR_EXPORT RunCommandLaunchInfo
 
   void* _internalStreamImpl();
 
+  /*!
+   * \brief Exécute \a func sur l'hôte.
+   *
+   * Si la file associée à la commande est asynchrone et possède un thread
+   * d'exécution sur l'hôte (voir HostRunQueueWorker), une copie de \a func
+   * est exécutée par ce thread et cette méthode retourne immédiatement.
+   * Sinon, \a func est exécutée directement.
+   *
+   * \a func doit donc capturer ses arguments par valeur.
+   */
+  template <typename Func> void _executeOnHost(const Func& func)
+  {
+    if (m_host_worker)
+      _enqueueHostCommand(std::function<void()>(func));
+    else
+      func();
+  }
+
  private:
 
   RunCommand& m_command;
@@ -98,6 +118,7 @@ class ARCANE_ACCELERATOR_EXPORT RunCommandLaunchInfo
   bool m_is_notify_end_kernel_done = false;
   IRunnerRuntime* m_runtime = nullptr;
   IRunQueueStream* m_queue_stream = nullptr;
+  HostRunQueueWorker* m_host_worker = nullptr;
   eExecutionPolicy m_exec_policy = eExecutionPolicy::Sequential;
   ThreadBlockInfo m_thread_block_info;
   ForLoopRunInfo m_loop_run_info;
@@ -106,6 +127,7 @@ class ARCANE_ACCELERATOR_EXPORT RunCommandLaunchInfo
 
   void _begin();
   void _doEndKernelLaunch();
+  void _enqueueHostCommand(std::function<void()>&& func);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -611,16 +611,21 @@ _applyEnvCells(RunCommand& command, ContainerType items, const Lambda& func)
     _applyKernelHIP(launch_info, ARCANE_KERNEL_HIP_FUNC(doMatContainerGPULambda) < ContainerType, Lambda >, func, items);
     break;
   case eExecutionPolicy::Sequential:
-    for (Int32 i = 0, n = vsize; i < n; ++i)
-      func(items[i]);
-    break;
-  case eExecutionPolicy::Thread:
-    arcaneParallelFor(0, vsize, launch_info.loopRunInfo(),
-                      [&](Int32 begin, Int32 size) {
-                        for (Int32 i = begin, n = (begin + size); i < n; ++i)
-                          func(items[i]);
-                      });
+    launch_info._executeOnHost([=]() {
+      for (Int32 i = 0, n = vsize; i < n; ++i)
+        func(items[i]);
+    });
     break;
+  case eExecutionPolicy::Thread: {
+    ForLoopRunInfo loop_run_info(launch_info.loopRunInfo());
+    launch_info._executeOnHost([=]() {
+      arcaneParallelFor(0, vsize, loop_run_info,
+                        [&](Int32 begin, Int32 size) {
+                          for (Int32 i = begin, n = (begin + size); i < n; ++i)
+                            func(items[i]);
+                        });
+    });
+  } break;
   default:
     ARCANE_FATAL("Invalid execution policy '{0}'", exec_policy);
   }
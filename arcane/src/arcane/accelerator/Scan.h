@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* Scan.h                                                      (C) 2000-2023 */
+/* Scan.h                                                      (C) 2000-2024 */
 /*                                                                           */
 /* Gestion des opérations de scan pour les accélérateurs.                    */
 /*---------------------------------------------------------------------------*/
@@ -155,6 +155,10 @@ class GenericScanner
       // Pas encore implémenté en multi-thread
       [[fallthrough]];
     case eExecutionPolicy::Sequential: {
+      // Les commandes précédentes de la file peuvent s'exécuter de manière
+      // asynchrone sur l'hôte. Il faut attendre qu'elles soient terminées.
+      if (m_queue)
+        m_queue->barrier();
       DataType sum = init_value;
       for (Int32 i = 0; i < nb_item; ++i) {
         if constexpr (IsExclusive) {
@@ -230,6 +230,43 @@ class ItemVariableScalarInViewT
   SmallSpan<const DataType> m_values;
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue en lecture avec conversion sur une variable scalaire du maillage.
+ *
+ * Les valeurs sont conservées avec le type \a StorageType et sont converties
+ * en \a DataType à chaque accès. Les instances sont créées via viewInAs().
+ */
+template<typename ItemType,typename StorageType,typename DataType>
+class ItemVariableScalarConvertInViewT
+: public VariableViewBase
+{
+ private:
+
+  typedef typename ItemTraitsT<ItemType>::LocalIdType ItemIndexType;
+
+ public:
+
+  ItemVariableScalarConvertInViewT(RunCommand& command,IVariable* var,SmallSpan<const StorageType> v)
+  : VariableViewBase(command,var), m_values(v){}
+
+  //! Opérateur d'accès pour l'entité \a item
+  ARCCORE_HOST_DEVICE DataType operator[](ItemIndexType item) const
+  {
+    return static_cast<DataType>(this->m_values[item.localId()]);
+  }
+
+  //! Opérateur d'accès pour l'entité \a item
+  ARCCORE_HOST_DEVICE DataType value(ItemIndexType item) const
+  {
+    return static_cast<DataType>(this->m_values[item.localId()]);
+  }
+
+ private:
+  SmallSpan<const StorageType> m_values;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -510,6 +547,46 @@ viewIn(RunCommand& command,const MeshVariableArrayRefT<ItemType,DataType>& var)
   return ItemVariableArrayInViewT<ItemType,DataType>(command,var.variable(),var.asArray());
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue en lecture avec conversion vers le type \a DataType.
+ *
+ * Cela permet par exemple de manipuler sous forme de 'Real' une variable
+ * dont les valeurs sont conservées en 'Float32':
+ *
+ * \code
+ * VariableCellFloat32 density = ...;
+ * auto in_density = viewInAs<Real>(command,density);
+ * Real d = in_density[cell];
+ * \endcode
+ */
+template<typename DataType,typename ItemType,typename StorageType> auto
+viewInAs(RunCommand& command,const MeshVariableScalarRefT<ItemType,StorageType>& var)
+{
+  return ItemVariableScalarConvertInViewT<ItemType,StorageType,DataType>(command,var.variable(),var.asArray());
+}
+
+/*!
+ * \brief Vue en écriture avec conversion depuis le type \a DataType.
+ */
+template<typename DataType,typename ItemType,typename StorageType> auto
+viewOutAs(RunCommand& command,MeshVariableScalarRefT<ItemType,StorageType>& var)
+{
+  using Accessor = DataViewConvertSetter<StorageType,DataType>;
+  return ItemVariableScalarOutViewT<ItemType,Accessor>(command,var.variable(),var.asArray());
+}
+
+/*!
+ * \brief Vue en lecture/écriture avec conversion vers le type \a DataType.
+ */
+template<typename DataType,typename ItemType,typename StorageType> auto
+viewInOutAs(RunCommand& command,MeshVariableScalarRefT<ItemType,StorageType>& var)
+{
+  using Accessor = DataViewConvertGetterSetter<StorageType,DataType>;
+  return ItemVariableScalarOutViewT<ItemType,Accessor>(command,var.variable(),var.asArray());
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -543,6 +620,12 @@ typedef ItemVariableScalarInViewT<Face,Real> VariableFaceRealInView;
 typedef ItemVariableScalarInViewT<Cell,Real> VariableCellRealInView;
 typedef ItemVariableScalarInViewT<Particle,Real> VariableParticleRealInView;
 
+typedef ItemVariableScalarInViewT<Node,Float32> VariableNodeFloat32InView;
+typedef ItemVariableScalarInViewT<Edge,Float32> VariableEdgeFloat32InView;
+typedef ItemVariableScalarInViewT<Face,Float32> VariableFaceFloat32InView;
+typedef ItemVariableScalarInViewT<Cell,Float32> VariableCellFloat32InView;
+typedef ItemVariableScalarInViewT<Particle,Float32> VariableParticleFloat32InView;
+
 typedef ItemVariableScalarInViewT<Node,Real2> VariableNodeReal2InView;
 typedef ItemVariableScalarInViewT<Edge,Real2> VariableEdgeReal2InView;
 typedef ItemVariableScalarInViewT<Face,Real2> VariableFaceReal2InView;
@@ -588,6 +671,12 @@ typedef ItemVariableScalarOutViewT<Face,DataViewSetter<Real>> VariableFaceRealOu
 typedef ItemVariableScalarOutViewT<Cell,DataViewSetter<Real>> VariableCellRealOutView;
 typedef ItemVariableScalarOutViewT<Particle,DataViewSetter<Real>> VariableParticleRealOutView;
 
+typedef ItemVariableScalarOutViewT<Node,DataViewSetter<Float32>> VariableNodeFloat32OutView;
+typedef ItemVariableScalarOutViewT<Edge,DataViewSetter<Float32>> VariableEdgeFloat32OutView;
+typedef ItemVariableScalarOutViewT<Face,DataViewSetter<Float32>> VariableFaceFloat32OutView;
+typedef ItemVariableScalarOutViewT<Cell,DataViewSetter<Float32>> VariableCellFloat32OutView;
+typedef ItemVariableScalarOutViewT<Particle,DataViewSetter<Float32>> VariableParticleFloat32OutView;
+
 typedef ItemVariableRealNScalarOutViewT<Node,DataViewSetter<Real2>> VariableNodeReal2OutView;
 typedef ItemVariableRealNScalarOutViewT<Edge,DataViewSetter<Real2>> VariableEdgeReal2OutView;
 typedef ItemVariableRealNScalarOutViewT<Face,DataViewSetter<Real2>> VariableFaceReal2OutView;
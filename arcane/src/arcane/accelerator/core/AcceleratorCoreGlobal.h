@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* AcceleratorCoreGlobal.h                                     (C) 2000-2023 */
+/* AcceleratorCoreGlobal.h                                     (C) 2000-2024 */
 /*                                                                           */
 /* Déclarations générales pour le support des accélérateurs.                 */
 /*---------------------------------------------------------------------------*/
@@ -70,6 +70,7 @@ namespace impl
   class RunQueueImpl;
   class IRunQueueEventImpl;
   class RunCommandLaunchInfo;
+  class HostRunQueueWorker;
 } // namespace impl
 
 /*---------------------------------------------------------------------------*/
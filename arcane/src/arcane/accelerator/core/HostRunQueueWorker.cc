@@ -0,0 +1,184 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* HostRunQueueWorker.cc                                       (C) 2000-2024 */
+/*                                                                           */
+/* Thread d'exécution des commandes d'une RunQueue asynchrone sur l'hôte.    */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/accelerator/core/internal/HostRunQueueWorker.h"
+
+#include "arcane/utils/FatalErrorException.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Accelerator::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class HostRunQueueWorker::Impl
+{
+ public:
+
+  ~Impl()
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_is_stopping = true;
+    }
+    m_work_cond.notify_one();
+    if (m_thread.joinable())
+      m_thread.join();
+  }
+
+ public:
+
+  void enqueue(std::function<void()>&& func)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (!m_thread.joinable())
+        m_thread = std::thread([this]() { _run(); });
+      m_commands.push_back(std::move(func));
+      ++m_nb_pending;
+    }
+    m_work_cond.notify_one();
+  }
+
+  void barrier()
+  {
+    if (m_thread.joinable() && std::this_thread::get_id() == m_thread.get_id())
+      ARCANE_FATAL("barrier() can not be called from the worker thread of the queue");
+    std::exception_ptr ex;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_done_cond.wait(lock, [this]() { return m_nb_pending == 0; });
+      std::swap(ex, m_exception);
+    }
+    if (ex)
+      std::rethrow_exception(ex);
+  }
+
+  bool hasPendingCommand() const
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_nb_pending != 0;
+  }
+
+ private:
+
+  void _run()
+  {
+    for (;;) {
+      std::function<void()> func;
+      bool has_error = false;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_work_cond.wait(lock, [this]() { return m_is_stopping || !m_commands.empty(); });
+        if (m_commands.empty())
+          return;
+        func = std::move(m_commands.front());
+        m_commands.pop_front();
+        has_error = static_cast<bool>(m_exception);
+      }
+      // Après une erreur, les actions suivantes ne sont pas exécutées
+      // car elles dépendent en général du résultat des précédentes.
+      if (!has_error) {
+        try {
+          func();
+        }
+        catch (...) {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_exception = std::current_exception();
+        }
+      }
+      // Il faut détruire l'action avant de signaler sa fin car son
+      // destructeur peut avoir des effets de bord (par exemple pour les
+      // réductions).
+      func = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        --m_nb_pending;
+        if (m_nb_pending == 0)
+          m_done_cond.notify_all();
+      }
+    }
+  }
+
+ private:
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_work_cond;
+  std::condition_variable m_done_cond;
+  std::deque<std::function<void()>> m_commands;
+  Int64 m_nb_pending = 0;
+  bool m_is_stopping = false;
+  std::exception_ptr m_exception;
+  std::thread m_thread;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+HostRunQueueWorker::
+HostRunQueueWorker()
+: m_p(std::make_unique<Impl>())
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+HostRunQueueWorker::
+~HostRunQueueWorker()
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void HostRunQueueWorker::
+enqueue(std::function<void()>&& func)
+{
+  m_p->enqueue(std::move(func));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void HostRunQueueWorker::
+barrier()
+{
+  m_p->barrier();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool HostRunQueueWorker::
+hasPendingCommand() const
+{
+  return m_p->hasPendingCommand();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator::impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IRunQueueStream.h                                           (C) 2000-2022 */
+/* IRunQueueStream.h                                           (C) 2000-2024 */
 /*                                                                           */
 /* Interface d'un flux d'exécution pour une RunQueue.                        */
 /*---------------------------------------------------------------------------*/
@@ -65,6 +65,20 @@ class ARCANE_ACCELERATOR_CORE_EXPORT IRunQueueStream
 
   //! Pointeur sur la structure interne dépendante de l'implémentation
   virtual void* _internalImpl() = 0;
+
+  /*!
+   * \brief Thread d'exécution des commandes sur l'hôte.
+   *
+   * Si \a is_async est vrai et que l'implémentation le supporte, retourne
+   * l'instance qui exécute les commandes de la file sur l'hôte de manière
+   * asynchrone. Si \a is_async est faux, retourne cette instance uniquement
+   * s'il reste des commandes en cours d'exécution afin de conserver l'ordre
+   * des commandes.
+   *
+   * Retourne nullptr si les commandes doivent être exécutées directement par
+   * le thread appelant.
+   */
+  virtual HostRunQueueWorker* _internalHostWorker([[maybe_unused]] bool is_async) { return nullptr; }
 };
 
 /*---------------------------------------------------------------------------*/
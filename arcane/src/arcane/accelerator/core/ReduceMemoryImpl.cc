@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ReduceMemoryImpl.cc                                         (C) 2000-2023 */
+/* ReduceMemoryImpl.cc                                         (C) 2000-2024 */
 /*                                                                           */
 /* Gestion de la mémoire pour les réductions.                                */
 /*---------------------------------------------------------------------------*/
@@ -148,6 +148,20 @@ internalGetOrCreateReduceMemoryImpl(RunCommand* command)
   return command->m_p->getOrCreateReduceMemoryImpl();
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Attend la fin des actions de la file de \a command exécutées sur l'hôte.
+ *
+ * Cela est nécessaire si la file est asynchrone et utilise un
+ * HostRunQueueWorker. Dans les autres cas, la barrière ne fait rien.
+ */
+extern "C++" void
+internalWaitHostCommand(RunCommand* command)
+{
+  command->m_p->internalStream()->barrier();
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
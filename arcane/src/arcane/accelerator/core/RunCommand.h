@@ -25,6 +25,8 @@ namespace impl
 {
 extern "C++" ARCANE_ACCELERATOR_CORE_EXPORT IReduceMemoryImpl*
 internalGetOrCreateReduceMemoryImpl(RunCommand* command);
+extern "C++" ARCANE_ACCELERATOR_CORE_EXPORT void
+internalWaitHostCommand(RunCommand* command);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -40,6 +42,7 @@ internalGetOrCreateReduceMemoryImpl(RunCommand* command);
 class ARCANE_ACCELERATOR_CORE_EXPORT RunCommand
 {
   friend impl::IReduceMemoryImpl* impl::internalGetOrCreateReduceMemoryImpl(RunCommand* command);
+  friend void impl::internalWaitHostCommand(RunCommand* command);
   friend impl::RunCommandLaunchInfo;
   friend impl::RunQueueImpl;
   friend class VariableViewBase;
@@ -99,7 +102,14 @@ class ARCANE_ACCELERATOR_CORE_EXPORT RunCommand
    */
   Int32 nbThreadPerBlock() const;
 
-  //! Positionne la configuration des boucles multi-thread
+  /*!
+   * \brief Positionne la configuration des boucles multi-thread.
+   *
+   * Cette configuration est utilisée uniquement avec la politique
+   * eExecutionPolicy::Thread. Avec ParallelLoopOptions::Partitioner::Weighted,
+   * les coûts spécifiés dans \a opt sont indexés par la position de l'entité
+   * dans la liste des entités de la boucle.
+   */
   void setParallelLoopOptions(const ParallelLoopOptions& opt);
 
   //! Configuration des boucles multi-thread
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* RunQueueRuntime.cc                                          (C) 2000-2022 */
+/* RunQueueRuntime.cc                                          (C) 2000-2024 */
 /*                                                                           */
 /* Implémentation d'un RunQueue pour une cible donnée.                       */
 /*---------------------------------------------------------------------------*/
@@ -16,13 +16,18 @@
 #include "arcane/accelerator/core/IRunQueueEventImpl.h"
 #include "arcane/accelerator/core/Memory.h"
 #include "arcane/accelerator/core/DeviceInfoList.h"
+#include "arcane/accelerator/core/internal/HostRunQueueWorker.h"
 
 #include "arcane/utils/NotImplementedException.h"
 #include "arcane/utils/MemoryView.h"
 #include "arcane/utils/PlatformUtils.h"
 #include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include <cstring>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -38,55 +43,152 @@ class ARCANE_ACCELERATOR_CORE_EXPORT HostRunQueueStream
 {
  public:
 
-  HostRunQueueStream(IRunnerRuntime* runtime)
+  HostRunQueueStream(IRunnerRuntime* runtime, bool use_async_worker)
   : m_runtime(runtime)
+  , m_use_async_worker(use_async_worker)
   {}
 
  public:
 
   void notifyBeginLaunchKernel(RunCommandImpl&) override { return m_runtime->notifyBeginLaunchKernel(); }
   void notifyEndLaunchKernel(RunCommandImpl&) override { return m_runtime->notifyEndLaunchKernel(); }
-  void barrier() override { return m_runtime->barrier(); }
+  void barrier() override
+  {
+    if (m_worker)
+      m_worker->barrier();
+    return m_runtime->barrier();
+  }
   void copyMemory(const MemoryCopyArgs& args) override
   {
+    // Conserve l'ordre par rapport aux commandes en cours d'exécution.
+    if (HostRunQueueWorker* worker = activeWorker()) {
+      if (args.isAsync()) {
+        MemoryCopyArgs copy_args(args);
+        worker->enqueue([copy_args]() { copy_args.destination().copyHost(copy_args.source()); });
+        return;
+      }
+      worker->barrier();
+    }
     args.destination().copyHost(args.source());
   }
   void prefetchMemory(const MemoryPrefetchArgs&) override {}
   void* _internalImpl() override { return nullptr; }
+  HostRunQueueWorker* _internalHostWorker(bool is_async) override
+  {
+    if (!m_use_async_worker)
+      return nullptr;
+    m_is_async = is_async;
+    if (is_async && !m_worker)
+      m_worker = std::make_unique<HostRunQueueWorker>();
+    return activeWorker();
+  }
+
+ public:
+
+  /*!
+   * \brief Thread d'exécution à utiliser pour les actions de la file.
+   *
+   * Il s'agit du thread d'exécution si la dernière commande a été lancée
+   * de manière asynchrone ou s'il reste des actions en cours. Sinon,
+   * retourne nullptr et les actions peuvent être effectuées directement.
+   */
+  HostRunQueueWorker* activeWorker() const
+  {
+    if (!m_worker)
+      return nullptr;
+    if (m_is_async || m_worker->hasPendingCommand())
+      return m_worker.get();
+    return nullptr;
+  }
 
  private:
 
   IRunnerRuntime* m_runtime;
+  bool m_use_async_worker = false;
+  bool m_is_async = false;
+  std::unique_ptr<HostRunQueueWorker> m_worker;
 };
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
-
+/*!
+ * \brief Evènement pour les files s'exécutant sur l'hôte.
+ *
+ * Si la file associée possède un thread d'exécution (HostRunQueueWorker),
+ * l'enregistrement de l'évènement ajoute une action à ce thread et
+ * l'évènement est considéré comme terminé lorsque cette action a été
+ * exécutée. Sinon, l'évènement est terminé dès son enregistrement.
+ */
 class ARCANE_ACCELERATOR_CORE_EXPORT HostRunQueueEvent
 : public IRunQueueEventImpl
 {
+  //! Etat d'un enregistrement de l'évènement
+  struct State
+  {
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    bool m_is_done = false;
+    double m_recorded_time = 0.0;
+
+    void setDone(bool has_timer)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (has_timer)
+        m_recorded_time = platform::getRealTime();
+      m_is_done = true;
+      m_cond.notify_all();
+    }
+    void wait()
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cond.wait(lock, [this]() { return m_is_done; });
+    }
+  };
+
  public:
 
   explicit HostRunQueueEvent(bool has_timer)
   : m_has_timer(has_timer)
-  {}
+  , m_state(std::make_shared<State>())
+  {
+    m_state->m_is_done = true;
+  }
 
  public:
 
-  void recordQueue(IRunQueueStream*) final
+  void recordQueue(IRunQueueStream* stream) final
   {
-    if (m_has_timer)
-      m_recorded_time = platform::getRealTime();
+    auto state = std::make_shared<State>();
+    m_state = state;
+    HostRunQueueWorker* worker = _worker(stream);
+    bool has_timer = m_has_timer;
+    if (worker)
+      worker->enqueue([state, has_timer]() { state->setDone(has_timer); });
+    else
+      state->setDone(has_timer);
+  }
+  void wait() final
+  {
+    m_state->wait();
+  }
+  void waitForEvent(IRunQueueStream* stream) final
+  {
+    std::shared_ptr<State> state = m_state;
+    HostRunQueueWorker* worker = _worker(stream);
+    if (worker)
+      worker->enqueue([state]() { state->wait(); });
+    else
+      state->wait();
   }
-  void wait() final {}
-  void waitForEvent(IRunQueueStream*) final {}
   Int64 elapsedTime(IRunQueueEventImpl* start_event) final
   {
     ARCANE_CHECK_POINTER(start_event);
     auto* true_start_event = static_cast<HostRunQueueEvent*>(start_event);
     if (!m_has_timer || !true_start_event->m_has_timer)
       ARCANE_FATAL("Event has no timer support");
-    double diff_time = m_recorded_time - true_start_event->m_recorded_time;
+    true_start_event->wait();
+    wait();
+    double diff_time = m_state->m_recorded_time - true_start_event->m_state->m_recorded_time;
     Int64 diff_as_int64 = static_cast<Int64>(diff_time * 1.0e9);
     return diff_as_int64;
   }
@@ -94,7 +196,20 @@ class ARCANE_ACCELERATOR_CORE_EXPORT HostRunQueueEvent
  private:
 
   bool m_has_timer = false;
-  double m_recorded_time = 0.0;
+  std::shared_ptr<State> m_state;
+
+ private:
+
+  // NOTE: ces évènements peuvent aussi être utilisés avec les files
+  // accélérateurs (pour mesurer le temps des commandes). Dans ce cas il n'y
+  // a pas de thread d'exécution associé.
+  static HostRunQueueWorker* _worker(IRunQueueStream* stream)
+  {
+    auto* host_stream = dynamic_cast<HostRunQueueStream*>(stream);
+    if (!host_stream)
+      return nullptr;
+    return host_stream->activeWorker();
+  }
 };
 
 /*---------------------------------------------------------------------------*/
@@ -118,7 +233,10 @@ class ARCANE_ACCELERATOR_CORE_EXPORT CommonRunnerRuntime
   void notifyBeginLaunchKernel() final {}
   void notifyEndLaunchKernel() final {}
   void barrier() final {}
-  IRunQueueStream* createStream(const RunQueueBuildInfo&) final { return new HostRunQueueStream(this); }
+  IRunQueueStream* createStream(const RunQueueBuildInfo&) final
+  {
+    return new HostRunQueueStream(this, _isHostAsyncQueue());
+  }
   IRunQueueEventImpl* createEventImpl() final { return new HostRunQueueEvent(false); }
   IRunQueueEventImpl* createEventImplWithTimer() final { return new HostRunQueueEvent(true); }
   void setMemoryAdvice(ConstMemoryView, eMemoryAdvice, DeviceId) final {}
@@ -133,6 +251,24 @@ class ARCANE_ACCELERATOR_CORE_EXPORT CommonRunnerRuntime
  private:
 
   DeviceInfoList m_device_info_list;
+
+ private:
+
+  /*!
+   * \brief Indique si les files asynchrones utilisent un thread d'exécution.
+   *
+   * Si ce n'est pas le cas, les commandes sont exécutées directement par
+   * le thread qui les lance, même si la file est asynchrone.
+   */
+  static bool _isHostAsyncQueue()
+  {
+    static bool is_async = []() {
+      if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_ACCELERATOR_HOST_ASYNC_QUEUE", true))
+        return (v.value() != 0);
+      return false;
+    }();
+    return is_async;
+  }
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,83 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* HostRunQueueWorker.h                                        (C) 2000-2024 */
+/*                                                                           */
+/* Thread d'exécution des commandes d'une RunQueue asynchrone sur l'hôte.    */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_ACCELERATOR_CORE_INTERNAL_HOSTRUNQUEUEWORKER_H
+#define ARCANE_ACCELERATOR_CORE_INTERNAL_HOSTRUNQUEUEWORKER_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/accelerator/core/AcceleratorCoreGlobal.h"
+
+#include <functional>
+#include <memory>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Accelerator::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Thread d'exécution des commandes d'une RunQueue asynchrone sur l'hôte.
+ *
+ * Cette classe joue pour les politiques eExecutionPolicy::Sequential et
+ * eExecutionPolicy::Thread le rôle d'un flux (stream) sur accélérateur :
+ * les actions ajoutées via enqueue() sont exécutées dans l'ordre par un
+ * thread dédié et l'appelant peut continuer son exécution (par exemple
+ * pour faire des communications) ou lancer des commandes sur d'autres files.
+ *
+ * Le thread est créé lors du premier appel à enqueue().
+ *
+ * Si une action lève une exception, les actions suivantes ne sont pas
+ * exécutées et l'exception est relancée lors du prochain appel à barrier().
+ */
+class ARCANE_ACCELERATOR_CORE_EXPORT HostRunQueueWorker
+{
+  class Impl;
+
+ public:
+
+  HostRunQueueWorker();
+  ~HostRunQueueWorker();
+
+ public:
+
+  HostRunQueueWorker(const HostRunQueueWorker&) = delete;
+  HostRunQueueWorker& operator=(const HostRunQueueWorker&) = delete;
+
+ public:
+
+  //! Ajoute l'action \a func à la liste des actions à exécuter.
+  void enqueue(std::function<void()>&& func);
+
+  //! Bloque jusqu'à ce que toutes les actions ajoutées soient terminées.
+  void barrier();
+
+  //! Indique s'il reste des actions en attente ou en cours d'exécution.
+  bool hasPendingCommand() const;
+
+ private:
+
+  std::unique_ptr<Impl> m_p;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator::impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
@@ -5,6 +5,7 @@ set( ARCANE_SOURCES
   AcceleratorRuntimeInitialisationInfo.h
   IAcceleratorMng.h
   AcceleratorMng.cc
+  HostRunQueueWorker.cc
   DeviceId.h
   DeviceInfo.h
   DeviceInfoList.h
@@ -31,6 +32,7 @@ set( ARCANE_SOURCES
   RunQueueImpl.h
   RunQueueImpl.cc
   RunQueueRuntime.cc
+  internal/HostRunQueueWorker.h
   internal/IRunnerRuntime.h
   internal/AcceleratorCoreGlobalInternal.h
   internal/MemoryTracer.h
@@ -37,6 +37,7 @@
 #include "arcane/cartesianmesh/CartesianMeshRenumberingInfo.h"
 #include "arcane/cartesianmesh/CartesianMeshCoarsening.h"
 #include "arcane/cartesianmesh/CartesianMeshCoarsening2.h"
+#include "arcane/cartesianmesh/CartesianMeshAMRPatchRegridder.h"
 #include "arcane/cartesianmesh/CartesianMeshPatchListView.h"
 #include "arcane/cartesianmesh/internal/CartesianMeshPatch.h"
 #include "arcane/cartesianmesh/internal/ICartesianMeshInternal.h"
@@ -88,9 +89,17 @@ class CartesianMeshImpl
     {
       return m_cartesian_mesh->_createCartesianMeshCoarsening2();
     }
-    void addPatchFromExistingChildren(ConstArrayView<Int32> parent_cells_local_id) override
+    CellGroup addPatchFromExistingChildren(ConstArrayView<Int32> parent_cells_local_id) override
     {
-      m_cartesian_mesh->_addPatchFromExistingChildren(parent_cells_local_id);
+      return m_cartesian_mesh->_addPatchFromExistingChildren(parent_cells_local_id);
+    }
+    void removePatch(const CellGroup& patch_cells) override
+    {
+      m_cartesian_mesh->_removePatch(patch_cells);
+    }
+    Ref<CartesianMeshAMRPatchRegridder> createCartesianMeshAMRPatchRegridder() override
+    {
+      return m_cartesian_mesh->_createCartesianMeshAMRPatchRegridder();
     }
 
    private:
@@ -172,7 +181,9 @@ class CartesianMeshImpl
 
   // Implémentation de 'ICartesianMeshInternal'
   Ref<CartesianMeshCoarsening2> _createCartesianMeshCoarsening2();
-  void _addPatchFromExistingChildren(ConstArrayView<Int32> parent_cells_local_id);
+  CellGroup _addPatchFromExistingChildren(ConstArrayView<Int32> parent_cells_local_id);
+  void _removePatch(const CellGroup& patch_cells);
+  Ref<CartesianMeshAMRPatchRegridder> _createCartesianMeshAMRPatchRegridder();
 
  private:
 
@@ -206,7 +217,8 @@ class CartesianMeshImpl
                              VariableFaceReal3& faces_center,CellGroup all_cells,
                              NodeGroup all_nodes);
   void _applyRefine(ConstArrayView<Int32> cells_local_id);
-  void _addPatch(const CellGroup& parent_group);
+  CellGroup _addPatch(const CellGroup& parent_group);
+  Integer _nextPatchIndex() const;
   void _saveInfosInProperties();
 
   std::tuple<CellGroup,NodeGroup>
@@ -670,14 +682,63 @@ refinePatch3D(Real3 position,Real3 length)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
-void CartesianMeshImpl::
+CellGroup CartesianMeshImpl::
 _addPatchFromExistingChildren(ConstArrayView<Int32> parent_cells_local_id)
 {
   IItemFamily* cell_family = m_mesh->cellFamily();
-  Integer index = m_amr_patch_cell_groups.size();
+  Integer index = _nextPatchIndex();
   String parent_group_name = String("CartesianMeshPatchParentCells")+index;
   CellGroup parent_cells = cell_family->createGroup(parent_group_name,parent_cells_local_id,true);
-  _addPatch(parent_cells);
+  return _addPatch(parent_cells);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshImpl::
+_removePatch(const CellGroup& patch_cells)
+{
+  Integer index = -1;
+  for( Integer i=0, n=m_amr_patch_cell_groups.size(); i<n; ++i )
+    if (m_amr_patch_cell_groups[i]==patch_cells){
+      index = i;
+      break;
+    }
+  if (index==(-1))
+    ARCANE_FATAL("Group '{0}' is not a patch group",patch_cells.name());
+  info(4) << "Remove AMR patch group=" << patch_cells.name();
+  m_amr_patch_cell_groups.remove(index);
+  // Le groupe n'est pas détruit car il peut être réutilisé par un futur patch.
+  CellGroup group(patch_cells);
+  group.clear();
+  _saveInfosInProperties();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Indice à utiliser pour les noms des groupes d'un nouveau patch.
+ *
+ * Après une suppression de patch, le nombre de patchs peut correspondre
+ * à l'indice d'un groupe d'un patch existant. Dans ce cas on prend le
+ * premier indice libre suivant.
+ */
+Integer CartesianMeshImpl::
+_nextPatchIndex() const
+{
+  Integer index = m_amr_patch_cell_groups.size();
+  for(;;){
+    String name = String("CartesianMeshPatchCells")+index;
+    bool is_used = false;
+    for( const CellGroup& x : m_amr_patch_cell_groups )
+      if (x.name()==name){
+        is_used = true;
+        break;
+      }
+    if (!is_used)
+      return index;
+    ++index;
+  }
 }
 
 /*---------------------------------------------------------------------------*/
@@ -685,10 +746,10 @@ _addPatchFromExistingChildren(ConstArrayView<Int32> parent_cells_local_id)
 /*!
  * \brief Créé un patch avec tous les enfants du groupe \a parent_cells.
  */
-void CartesianMeshImpl::
+CellGroup CartesianMeshImpl::
 _addPatch(const CellGroup& parent_cells)
 {
-  Integer index = m_amr_patch_cell_groups.size();
+  Integer index = _nextPatchIndex();
   // Créé le groupe contenant les mailles AMR
   // Il s'agit des mailles filles de \a parent_cells
   String children_group_name = String("CartesianMeshPatchCells")+index;
@@ -703,6 +764,7 @@ _addPatch(const CellGroup& parent_cells)
   IItemFamily* cell_family = m_mesh->cellFamily();
   CellGroup children_cells = cell_family->createGroup(children_group_name,children_local_id,true);
   m_amr_patch_cell_groups.add(children_cells);
+  return children_cells;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -714,7 +776,7 @@ _applyRefine(ConstArrayView<Int32> cells_local_id)
   IItemFamily* cell_family = m_mesh->cellFamily();
   Integer nb_cell = cells_local_id.size();
   info(4) << "Local_NbCellToRefine = " << nb_cell;
-  Integer index = m_amr_patch_cell_groups.size();
+  Integer index = _nextPatchIndex();
   String parent_group_name = String("CartesianMeshPatchParentCells")+index;
   CellGroup parent_cells = cell_family->createGroup(parent_group_name,cells_local_id,true);
 
@@ -826,6 +888,17 @@ _createCartesianMeshCoarsening2()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+Ref<CartesianMeshAMRPatchRegridder> CartesianMeshImpl::
+_createCartesianMeshAMRPatchRegridder()
+{
+  if (m_amr_type != eMeshAMRKind::PatchCartesianMeshOnly)
+    ARCANE_FATAL("Regridding is only available with AMR type PatchCartesianMeshOnly (3)");
+  return makeRef(new CartesianMeshAMRPatchRegridder(this,m_amr_mng.get()));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
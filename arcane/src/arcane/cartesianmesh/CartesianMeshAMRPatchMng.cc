@@ -18,12 +18,21 @@
 #include "arcane/core/IParallelMng.h"
 #include "arcane/core/VariableTypes.h"
 #include "arcane/core/IMeshModifier.h"
+#include "arcane/core/IItemFamily.h"
+#include "arcane/core/IVariableSynchronizer.h"
+#include "arcane/core/IParallelExchanger.h"
+#include "arcane/core/ISerializeMessage.h"
+#include "arcane/core/ISerializer.h"
+#include "arcane/core/ParallelMngUtils.h"
 
 #include "arcane/cartesianmesh/CellDirectionMng.h"
 #include "arcane/cartesianmesh/CartesianMeshNumberingMng.h"
 
 #include "arcane/utils/Array2View.h"
 #include "arcane/utils/Array3View.h"
+#include "arcane/utils/IAMRTransportFunctor.h"
+
+#include <unordered_set>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -87,6 +96,9 @@ _syncFlagCell()
     if(flag_cells_consistent[cell] & ItemFlags::II_Inactive) {
       cell.mutableItemBase().setFlags(ItemFlags::II_Inactive);
     }
+    if(flag_cells_consistent[cell] & ItemFlags::II_Coarsen) {
+      cell.mutableItemBase().addFlags(ItemFlags::II_Coarsen);
+    }
     debug() << "After Compute " << cell << " flag : " << cell.mutableItemBase().flags() << " II_Refine : " << (cell.itemBase().flags() & ItemFlags::II_Refine) << " -- II_Inactive : " << (cell.itemBase().flags() & ItemFlags::II_Inactive);
   }
 }
@@ -2441,6 +2453,9 @@ refine()
     }
   }
 
+  // On initialise les variables des mailles enfants.
+  m_call_back_mng.callCallBacks(cell_to_refine_internals, Prolongation);
+
 //  ENUMERATE_(Cell, icell, m_mesh->allCells()){
 //    debug() << "\t" << *icell;
 //    for(Node node : icell->nodes()){
@@ -2461,6 +2476,237 @@ refine()
 
 
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchMng::
+flagCellToCoarsen(Int32ConstArrayView cells_lids)
+{
+  ItemInfoListView cells(m_mesh->cellFamily());
+  for (int lid : cells_lids) {
+    Item item = cells[lid];
+    item.mutableItemBase().addFlags(ItemFlags::II_Coarsen);
+  }
+  _syncFlagCell();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchMng::
+coarsen()
+{
+  IParallelMng* pm = m_mesh->parallelMng();
+
+  // Une maille parente est dé-raffinée si toutes ses mailles enfants sont
+  // marquées et qu'aucune d'elles n'est raffinée. Comme les flags sont
+  // synchronisés, les mailles fantômes sont traitées de la même manière
+  // dans tous les sous-domaines.
+  UniqueArray<Cell> parent_cells;
+  UniqueArray<Int32> cells_to_remove;
+  ENUMERATE_ (Cell, icell, m_mesh->allCells()) {
+    Cell cell = *icell;
+    Int32 nb_child = cell.nbHChildren();
+    if (nb_child == 0)
+      continue;
+    bool do_coarsen = true;
+    for (Integer i = 0; i < nb_child; ++i) {
+      Cell child = cell.hChild(i);
+      if (!(child.itemBase().flags() & ItemFlags::II_Coarsen) || child.nbHChildren() != 0) {
+        do_coarsen = false;
+        break;
+      }
+    }
+    if (!do_coarsen)
+      continue;
+    parent_cells.add(cell);
+    for (Integer i = 0; i < nb_child; ++i)
+      cells_to_remove.add(cell.hChild(i).localId());
+  }
+
+  // Les mailles marquées qui ne peuvent pas être supprimées gardent leur flag
+  // jusqu'ici. On le retire pour ne pas les dé-raffiner au prochain appel.
+  ENUMERATE_ (Cell, icell, m_mesh->allCells()) {
+    icell->mutableItemBase().removeFlags(ItemFlags::II_Coarsen);
+  }
+
+  Int64 total_nb_cell = pm->reduce(Parallel::ReduceSum, parent_cells.largeSize());
+  debug() << "Nb parent cells to coarsen : " << parent_cells.size() << " (total=" << total_nb_cell << ")";
+  if (total_nb_cell == 0)
+    return;
+
+  // On transfère les valeurs des mailles enfants vers les mailles parentes.
+  m_call_back_mng.callCallBacks(parent_cells, Restriction);
+
+  // On conserve les uniqueIds des noeuds et des faces des mailles supprimées.
+  // Ceux qui restent (car partagés avec des mailles non supprimées) peuvent
+  // avoir perdu le sous-domaine qui en était propriétaire.
+  UniqueArray<Int64> nodes_uid;
+  UniqueArray<Int64> faces_uid;
+  {
+    std::unordered_set<Int64> nodes_uid_set;
+    std::unordered_set<Int64> faces_uid_set;
+    CellInfoListView cells(m_mesh->cellFamily());
+    for (Int32 lid : cells_to_remove) {
+      Cell cell = cells[lid];
+      for (Node node : cell.nodes())
+        if (nodes_uid_set.insert(node.uniqueId()).second)
+          nodes_uid.add(node.uniqueId());
+      for (Face face : cell.faces())
+        if (faces_uid_set.insert(face.uniqueId()).second)
+          faces_uid.add(face.uniqueId());
+    }
+  }
+
+  // Les sous-domaines qui partagent des entités avec ce sous-domaine.
+  // On les récupère avant la suppression des mailles car le synchroniseur
+  // est recalculé lors de la mise à jour du maillage.
+  UniqueArray<Int32> neighbour_ranks;
+  if (pm->isParallel())
+    neighbour_ranks = m_mesh->cellFamily()->allItemsSynchronizer()->communicatingRanks();
+
+  m_mesh->modifier()->removeCells(cells_to_remove, false);
+
+  for (Cell cell : parent_cells) {
+    cell.mutableItemBase().addFlags(ItemFlags::II_JustCoarsened);
+  }
+
+  if (pm->isParallel()) {
+    _updateOwnersAfterCoarsen(m_mesh->nodeFamily(), nodes_uid, neighbour_ranks);
+    _updateOwnersAfterCoarsen(m_mesh->faceFamily(), faces_uid, neighbour_ranks);
+  }
+
+  m_mesh->modifier()->endUpdate();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Recalcule les propriétaires des entités restantes après un dé-raffinement.
+ *
+ * Le nouveau propriétaire d'une entité est celui de la maille connectée
+ * ayant le plus petit uniqueId(). Un sous-domaine propriétaire d'une maille
+ * connaît toutes les mailles connectées aux entités de cette maille et
+ * calcule donc directement la bonne valeur. Un sous-domaine qui ne connaît
+ * une entité que via des mailles fantômes est voisin du propriétaire de
+ * ces mailles. Il suffit donc d'échanger les valeurs avec les sous-domaines
+ * voisins \a neighbour_ranks et de prendre le minimum.
+ */
+void CartesianMeshAMRPatchMng::
+_updateOwnersAfterCoarsen(IItemFamily* family, Int64ConstArrayView uids,
+                          Int32ConstArrayView neighbour_ranks)
+{
+  IParallelMng* pm = m_mesh->parallelMng();
+  Int32 my_rank = pm->commRank();
+
+  UniqueArray<Int32> lids(uids.size());
+  family->itemsUniqueIdToLocalId(lids, uids, false);
+
+  // Triplets (uid de l'entité, uid de la maille, propriétaire de la maille).
+  UniqueArray<Int64> send_buffer;
+  ItemInfoListView items(family);
+  for (Int32 lid : lids) {
+    if (lid == NULL_ITEM_LOCAL_ID)
+      continue;
+    Item item = items[lid];
+    Cell min_cell;
+    auto update_min_cell = [&](Cell cell) {
+      if (min_cell.null() || cell.uniqueId() < min_cell.uniqueId())
+        min_cell = cell;
+    };
+    if (item.kind() == IK_Node)
+      for (Cell cell : item.toNode().cells())
+        update_min_cell(cell);
+    else
+      for (Cell cell : item.toFace().cells())
+        update_min_cell(cell);
+    if (min_cell.null())
+      continue;
+    send_buffer.add(item.uniqueId());
+    send_buffer.add(min_cell.uniqueId());
+    send_buffer.add(min_cell.owner());
+  }
+
+  std::unordered_map<Int64, std::pair<Int64, Int32>> uid_to_owner;
+  auto merge_buffer = [&](ConstArrayView<Int64> buffer) {
+    for (Integer i = 0, n = buffer.size(); i < n; i += 3) {
+      Int64 item_uid = buffer[i];
+      Int64 cell_uid = buffer[i + 1];
+      auto cell_owner = static_cast<Int32>(buffer[i + 2]);
+      auto x = uid_to_owner.find(item_uid);
+      if (x == uid_to_owner.end() || cell_uid < x->second.first)
+        uid_to_owner[item_uid] = std::make_pair(cell_uid, cell_owner);
+    }
+  };
+  merge_buffer(send_buffer);
+
+  // Échange avec les sous-domaines voisins uniquement.
+  {
+    auto exchanger = ParallelMngUtils::createExchangerRef(pm);
+    for (Int32 rank : neighbour_ranks)
+      exchanger->addSender(rank);
+    exchanger->initializeCommunicationsMessages(neighbour_ranks);
+    for (Integer i = 0, ns = exchanger->nbSender(); i < ns; ++i) {
+      ISerializer* s = exchanger->messageToSend(i)->serializer();
+      s->setMode(ISerializer::ModeReserve);
+      s->reserveArray(send_buffer.constSpan());
+      s->allocateBuffer();
+      s->setMode(ISerializer::ModePut);
+      s->putArray(send_buffer.constSpan());
+    }
+    exchanger->processExchange();
+    UniqueArray<Int64> recv_buffer;
+    for (Integer i = 0, nr = exchanger->nbReceiver(); i < nr; ++i) {
+      ISerializer* s = exchanger->messageToReceive(i)->serializer();
+      s->setMode(ISerializer::ModeGet);
+      s->getArray(recv_buffer);
+      merge_buffer(recv_buffer);
+    }
+  }
+
+  UniqueArray<Int64> changed_uids;
+  changed_uids.reserve(uid_to_owner.size());
+  for (const auto& x : uid_to_owner)
+    changed_uids.add(x.first);
+  UniqueArray<Int32> changed_lids(changed_uids.size());
+  family->itemsUniqueIdToLocalId(changed_lids, changed_uids, false);
+  for (Integer i = 0, n = changed_lids.size(); i < n; ++i) {
+    if (changed_lids[i] == NULL_ITEM_LOCAL_ID)
+      continue;
+    Item item = items[changed_lids[i]];
+    Int32 new_owner = uid_to_owner[changed_uids[i]].second;
+    if (item.owner() == new_owner)
+      continue;
+    debug() << "Change owner after coarsen -- UniqueId : " << item.uniqueId()
+            << " -- Old Owner : " << item.owner()
+            << " -- New Owner : " << new_owner;
+    item.mutableItemBase().setOwner(new_owner, my_rank);
+    if (new_owner == my_rank)
+      item.mutableItemBase().addFlags(ItemFlags::II_Own);
+    else
+      item.mutableItemBase().removeFlags(ItemFlags::II_Own);
+  }
+  family->notifyItemsOwnerChanged();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchMng::
+registerCallBack(IAMRTransportFunctor* f)
+{
+  m_call_back_mng.registerCallBack(f);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchMng::
+unRegisterCallBack(IAMRTransportFunctor* f)
+{
+  m_call_back_mng.unregisterCallBack(f);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -20,6 +20,7 @@
 #include "arcane/core/VariableTypedef.h"
 
 #include "arcane/utils/TraceAccessor.h"
+#include "arcane/utils/AMRCallBackMng.h"
 
 #include "arcane/cartesianmesh/ICartesianMeshAMRPatchMng.h"
 #include "arcane/cartesianmesh/CartesianMeshGlobal.h"
@@ -46,10 +47,19 @@ class CartesianMeshAMRPatchMng
   void flagCellToRefine(Int32ConstArrayView cells_lids) override;
   void _syncFlagCell();
   void refine() override;
+  void flagCellToCoarsen(Int32ConstArrayView cells_lids) override;
+  void coarsen() override;
+  void registerCallBack(IAMRTransportFunctor* f) override;
+  void unRegisterCallBack(IAMRTransportFunctor* f) override;
+
+ private:
+  void _updateOwnersAfterCoarsen(IItemFamily* family, Int64ConstArrayView uids,
+                                 Int32ConstArrayView neighbour_ranks);
 
  private:
   IMesh* m_mesh;
   Ref<ICartesianMeshNumberingMng> m_num_mng;
+  AMRCallBackMng m_call_back_mng;
 };
 
 /*---------------------------------------------------------------------------*/
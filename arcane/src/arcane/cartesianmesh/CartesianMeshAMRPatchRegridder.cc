@@ -0,0 +1,457 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* CartesianMeshAMRPatchRegridder.cc                           (C) 2000-2024 */
+/*                                                                           */
+/* Recalcul automatique des patchs AMR d'un maillage cartésien.              */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/cartesianmesh/CartesianMeshAMRPatchRegridder.h"
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ArgumentException.h"
+#include "arcane/utils/CheckedConvert.h"
+
+#include "arcane/core/IMesh.h"
+#include "arcane/core/IItemFamily.h"
+#include "arcane/core/IParallelMng.h"
+
+#include "arcane/cartesianmesh/ICartesianMesh.h"
+#include "arcane/cartesianmesh/ICartesianMeshAMRPatchMng.h"
+#include "arcane/cartesianmesh/CartesianMeshNumberingMng.h"
+#include "arcane/cartesianmesh/internal/ICartesianMeshInternal.h"
+
+#include <cmath>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace
+{
+  using Box = CartesianMeshAMRPatchRegridder::Box;
+
+  /*!
+   * \brief Regroupement de mailles marquées en boîtes (Berger-Rigoutsos).
+   *
+   * Les mailles marquées sont données par leurs coordonnées (trois valeurs
+   * par maille). Pour chaque boîte englobante dont l'efficacité est
+   * insuffisante, on cherche un plan de découpe avec par ordre de priorité:
+   * - un trou dans la signature (plan sans maille marquée) le plus proche
+   *   du centre,
+   * - le point d'inflexion de la signature avec le plus fort changement
+   *   du laplacien,
+   * - le milieu de la plus grande dimension.
+   *
+   * L'algorithme est déterministe : tous les sous-domaines obtiennent les
+   * mêmes boîtes à partir des mêmes mailles.
+   */
+  class BergerRigoutsosClustering
+  {
+   public:
+
+    BergerRigoutsosClustering(Int32 dimension, Real efficiency, Int32 min_size,
+                              ConstArrayView<Int64> tags)
+    : m_dimension(dimension)
+    , m_efficiency(efficiency)
+    , m_min_size(min_size)
+    , m_tags(tags)
+    {}
+
+   public:
+
+    void compute(Array<Box>& boxes)
+    {
+      Int32 nb_tag = CheckedConvert::toInt32(m_tags.size() / 3);
+      if (nb_tag == 0)
+        return;
+      UniqueArray<Int32> indexes(nb_tag);
+      for (Int32 i = 0; i < nb_tag; ++i)
+        indexes[i] = i;
+      _cluster(indexes, boxes);
+    }
+
+   private:
+
+    Int32 m_dimension;
+    Real m_efficiency;
+    Int32 m_min_size;
+    ConstArrayView<Int64> m_tags;
+
+   private:
+
+    Int64 _coord(Int32 index, Int32 dir) const { return m_tags[index * 3 + dir]; }
+
+    Box _boundingBox(ConstArrayView<Int32> indexes) const
+    {
+      Box box;
+      for (Int32 d = 0; d < m_dimension; ++d) {
+        box.lower[d] = _coord(indexes[0], d);
+        box.upper[d] = box.lower[d] + 1;
+      }
+      for (Int32 idx : indexes)
+        for (Int32 d = 0; d < m_dimension; ++d) {
+          Int64 c = _coord(idx, d);
+          box.lower[d] = std::min(box.lower[d], c);
+          box.upper[d] = std::max(box.upper[d], c + 1);
+        }
+      return box;
+    }
+
+    void _cluster(ConstArrayView<Int32> indexes, Array<Box>& boxes)
+    {
+      Box box = _boundingBox(indexes);
+      if (indexes.size() >= m_efficiency * static_cast<Real>(box.nbCell())) {
+        boxes.add(box);
+        return;
+      }
+      Int32 split_dir = -1;
+      Int64 split_pos = 0;
+      _findSplit(indexes, box, split_dir, split_pos);
+      if (split_dir < 0) {
+        boxes.add(box);
+        return;
+      }
+      UniqueArray<Int32> left;
+      UniqueArray<Int32> right;
+      for (Int32 idx : indexes) {
+        if (_coord(idx, split_dir) < split_pos)
+          left.add(idx);
+        else
+          right.add(idx);
+      }
+      _cluster(left, boxes);
+      _cluster(right, boxes);
+    }
+
+    //! Indique si on peut couper une boîte de longueur \a len après \a i mailles
+    bool _isValidSplit(Int64 i, Int64 len) const
+    {
+      return i >= m_min_size && (len - i) >= m_min_size;
+    }
+
+    void _findSplit(ConstArrayView<Int32> indexes, const Box& box, Int32& split_dir, Int64& split_pos) const
+    {
+      UniqueArray<Int64> signatures[3];
+      for (Int32 d = 0; d < m_dimension; ++d) {
+        Int64 len = box.upper[d] - box.lower[d];
+        signatures[d].resize(len, 0);
+        for (Int32 idx : indexes)
+          ++signatures[d][_coord(idx, d) - box.lower[d]];
+      }
+
+      // Cherche un trou le plus proche du centre.
+      Int64 best_distance = -1;
+      for (Int32 d = 0; d < m_dimension; ++d) {
+        ConstArrayView<Int64> sig = signatures[d];
+        Int64 len = sig.size();
+        for (Int64 i = 1; i < len; ++i) {
+          if (sig[i] != 0 || !_isValidSplit(i, len))
+            continue;
+          Int64 distance = std::abs(2 * i - len);
+          if (best_distance < 0 || distance < best_distance) {
+            best_distance = distance;
+            split_dir = d;
+            split_pos = box.lower[d] + i;
+          }
+        }
+      }
+      if (split_dir >= 0)
+        return;
+
+      // Cherche le point d'inflexion le plus marqué.
+      Int64 best_strength = 0;
+      for (Int32 d = 0; d < m_dimension; ++d) {
+        ConstArrayView<Int64> sig = signatures[d];
+        Int64 len = sig.size();
+        if (len < 4)
+          continue;
+        UniqueArray<Int64> laplacian(len, 0);
+        for (Int64 i = 1; i < (len - 1); ++i)
+          laplacian[i] = sig[i - 1] - 2 * sig[i] + sig[i + 1];
+        for (Int64 i = 2; i < (len - 1); ++i) {
+          Int64 a = laplacian[i - 1];
+          Int64 b = laplacian[i];
+          if (!((a < 0 && b > 0) || (a > 0 && b < 0)) || !_isValidSplit(i, len))
+            continue;
+          Int64 strength = std::abs(b - a);
+          Int64 distance = std::abs(2 * i - len);
+          if (strength > best_strength || (strength == best_strength && distance < best_distance)) {
+            best_strength = strength;
+            best_distance = distance;
+            split_dir = d;
+            split_pos = box.lower[d] + i;
+          }
+        }
+      }
+      if (split_dir >= 0)
+        return;
+
+      // Coupe au milieu de la plus grande dimension.
+      Int64 max_len = 0;
+      for (Int32 d = 0; d < m_dimension; ++d) {
+        Int64 len = box.upper[d] - box.lower[d];
+        if (len > max_len && _isValidSplit(len / 2, len)) {
+          max_len = len;
+          split_dir = d;
+          split_pos = box.lower[d] + len / 2;
+        }
+      }
+    }
+  };
+
+  bool _isInBoxes(ConstArrayView<Box> boxes, const Int64* coord)
+  {
+    for (const Box& box : boxes)
+      if (box.contains(coord[0], coord[1], coord[2]))
+        return true;
+    return false;
+  }
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+CartesianMeshAMRPatchRegridder::
+CartesianMeshAMRPatchRegridder(ICartesianMesh* cm, ICartesianMeshAMRPatchMng* amr_mng)
+: TraceAccessor(cm->traceMng())
+, m_cartesian_mesh(cm)
+, m_amr_mng(amr_mng)
+, m_num_mng(Arccore::makeRef(new CartesianMeshNumberingMng(cm->mesh())))
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchRegridder::
+setEfficiency(Real v)
+{
+  if (v < 0.0 || v > 1.0)
+    ARCANE_THROW(ArgumentException, "Invalid efficiency '{0}'. Value has to be in [0,1]", v);
+  m_efficiency = v;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchRegridder::
+setMinPatchSize(Int32 v)
+{
+  if (v < 1)
+    ARCANE_THROW(ArgumentException, "Invalid min patch size '{0}'. Value has to be positive", v);
+  m_min_patch_size = v;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+UniqueArray<CartesianMeshAMRPatchRegridder::Box> CartesianMeshAMRPatchRegridder::
+boxes(Int32 level) const
+{
+  UniqueArray<Box> level_boxes;
+  for (const PatchInfo& p : m_patches)
+    if (p.level == level)
+      level_boxes.add(p.box);
+  return level_boxes;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchRegridder::
+registerCallBack(IAMRTransportFunctor* f)
+{
+  m_amr_mng->registerCallBack(f);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchRegridder::
+unRegisterCallBack(IAMRTransportFunctor* f)
+{
+  m_amr_mng->unRegisterCallBack(f);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchRegridder::
+_cellCoord(Cell cell, Int64* coord)
+{
+  coord[0] = m_num_mng->uidToCoordX(cell);
+  coord[1] = m_num_mng->uidToCoordY(cell);
+  coord[2] = (m_cartesian_mesh->mesh()->dimension() == 3) ? m_num_mng->uidToCoordZ(cell) : 0;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchRegridder::
+_computeBoxes(ConstArrayView<Int64> tags, Array<Box>& boxes)
+{
+  Int32 dimension = m_cartesian_mesh->mesh()->dimension();
+  BergerRigoutsosClustering clustering(dimension, m_efficiency, m_min_patch_size, tags);
+  clustering.compute(boxes);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CartesianMeshAMRPatchRegridder::
+regrid(Int32 level, ConstArrayView<Int32> cells_local_id)
+{
+  IMesh* mesh = m_cartesian_mesh->mesh();
+  IParallelMng* pm = mesh->parallelMng();
+  if (level < 0)
+    ARCANE_FATAL("Invalid level '{0}'", level);
+
+  // Récupère les coordonnées de toutes les mailles marquées. Chaque
+  // sous-domaine calcule ensuite les mêmes boîtes.
+  UniqueArray<Int64> all_tags;
+  {
+    UniqueArray<Int64> own_tags;
+    own_tags.reserve(cells_local_id.size() * 3);
+    CellInfoListView cells(mesh->cellFamily());
+    Int64 coord[3];
+    for (Int32 lid : cells_local_id) {
+      Cell cell = cells[lid];
+      if (!cell.isOwn())
+        continue;
+      if (cell.level() != level)
+        ARCANE_FATAL("Cell uid={0} has level {1} (expected {2})", cell.uniqueId(), cell.level(), level);
+      _cellCoord(cell, coord);
+      own_tags.addRange(ConstArrayView<Int64>(3, coord));
+    }
+    pm->allGatherVariable(own_tags, all_tags);
+  }
+
+  UniqueArray<Box> new_boxes;
+  _computeBoxes(all_tags, new_boxes);
+  info() << "AMR regrid level=" << level << " nb_flagged_cell=" << (all_tags.size() / 3)
+         << " nb_box=" << new_boxes.size();
+
+  // Conserve les patchs dont la boîte n'a pas changé.
+  UniqueArray<bool> is_new_box(new_boxes.size(), true);
+  UniqueArray<PatchInfo> new_patches;
+  UniqueArray<PatchInfo> removed_patches;
+  for (const PatchInfo& p : m_patches) {
+    bool is_kept = false;
+    if (p.level == level) {
+      for (Integer i = 0, n = new_boxes.size(); i < n; ++i)
+        if (is_new_box[i] && new_boxes[i] == p.box) {
+          is_new_box[i] = false;
+          is_kept = true;
+          break;
+        }
+    }
+    else
+      is_kept = true;
+    if (is_kept)
+      new_patches.add(p);
+    else
+      removed_patches.add(p);
+  }
+
+  Int64 coord[3];
+
+  // Dé-raffine les mailles qui ne sont plus dans aucune boîte.
+  {
+    UniqueArray<Int32> children_to_coarsen;
+    Integer nb_not_coarsened = 0;
+    ENUMERATE_ (Cell, icell, mesh->allLevelCells(level)) {
+      Cell cell = *icell;
+      Int32 nb_child = cell.nbHChildren();
+      if (nb_child == 0)
+        continue;
+      _cellCoord(cell, coord);
+      if (_isInBoxes(new_boxes, coord))
+        continue;
+      bool has_grand_children = false;
+      for (Int32 i = 0; i < nb_child; ++i)
+        if (cell.hChild(i).nbHChildren() != 0)
+          has_grand_children = true;
+      if (has_grand_children) {
+        ++nb_not_coarsened;
+        continue;
+      }
+      for (Int32 i = 0; i < nb_child; ++i)
+        children_to_coarsen.add(cell.hChild(i).localId());
+    }
+    if (nb_not_coarsened != 0)
+      warning() << "AMR regrid: " << nb_not_coarsened << " cells of level " << level
+                << " can not be coarsened because their children are refined";
+    m_amr_mng->flagCellToCoarsen(children_to_coarsen);
+    m_amr_mng->coarsen();
+  }
+
+  // Raffine les mailles des nouvelles boîtes qui ne le sont pas encore.
+  {
+    UniqueArray<Int32> cells_to_refine;
+    ENUMERATE_ (Cell, icell, mesh->allLevelCells(level)) {
+      Cell cell = *icell;
+      if (cell.nbHChildren() != 0)
+        continue;
+      _cellCoord(cell, coord);
+      if (_isInBoxes(new_boxes, coord))
+        cells_to_refine.add(icell.itemLocalId());
+    }
+    Int64 total_nb_cell = pm->reduce(Parallel::ReduceSum, cells_to_refine.largeSize());
+    info(4) << "AMR regrid: nb_cell_to_refine=" << total_nb_cell;
+    if (total_nb_cell != 0) {
+      m_amr_mng->flagCellToRefine(cells_to_refine);
+      m_amr_mng->refine();
+    }
+  }
+
+  // Met à jour les patchs.
+  ICartesianMeshInternal* internal_api = m_cartesian_mesh->_internalApi();
+  for (const PatchInfo& p : removed_patches)
+    internal_api->removePatch(p.cells);
+  Integer nb_added_patch = 0;
+  for (Integer i = 0, n = new_boxes.size(); i < n; ++i) {
+    if (!is_new_box[i])
+      continue;
+    ++nb_added_patch;
+    const Box& box = new_boxes[i];
+    UniqueArray<Int32> parent_cells;
+    ENUMERATE_ (Cell, icell, mesh->allLevelCells(level)) {
+      Cell cell = *icell;
+      if (cell.nbHChildren() == 0)
+        continue;
+      _cellCoord(cell, coord);
+      if (box.contains(coord[0], coord[1], coord[2]))
+        parent_cells.add(icell.itemLocalId());
+    }
+    PatchInfo p;
+    p.level = level;
+    p.box = box;
+    p.cells = internal_api->addPatchFromExistingChildren(parent_cells);
+    new_patches.add(p);
+  }
+  info() << "AMR regrid: nb_removed_patch=" << removed_patches.size()
+         << " nb_added_patch=" << nb_added_patch
+         << " nb_total_patch=" << new_patches.size();
+  m_patches = new_patches;
+
+  m_cartesian_mesh->computeDirections();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
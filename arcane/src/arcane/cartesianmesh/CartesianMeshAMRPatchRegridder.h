@@ -0,0 +1,180 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* CartesianMeshAMRPatchRegridder.h                            (C) 2000-2024 */
+/*                                                                           */
+/* Recalcul automatique des patchs AMR d'un maillage cartésien.              */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_CARTESIANMESH_CARTESIANMESHAMRPATCHREGRIDDER_H
+#define ARCANE_CARTESIANMESH_CARTESIANMESHAMRPATCHREGRIDDER_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/TraceAccessor.h"
+#include "arcane/utils/UniqueArray.h"
+#include "arcane/utils/Ref.h"
+
+#include "arcane/core/ItemGroup.h"
+
+#include "arcane/cartesianmesh/CartesianMeshGlobal.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+class ICartesianMeshNumberingMng;
+class IAMRTransportFunctor;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \ingroup ArcaneCartesianMesh
+ *
+ * \brief Recalcule automatiquement les patchs AMR d'un niveau.
+ *
+ * \warning Cette classe est expérimentale.
+ *
+ * Cette classe n'est utilisable qu'avec le type d'AMR
+ * eMeshAMRKind::PatchCartesianMeshOnly. Les instances sont créées via
+ * CartesianMeshUtils::createCartesianMeshAMRPatchRegridder().
+ *
+ * A partir d'une liste de mailles marquées d'un niveau, regrid() regroupe
+ * ces mailles en boîtes avec l'algorithme de Berger-Rigoutsos. Une boîte
+ * est découpée tant que le rapport entre le nombre de mailles marquées et
+ * le nombre de mailles de la boîte est inférieur à efficiency(). Chaque
+ * boîte donne un patch dont les mailles sont les mailles filles des mailles
+ * de la boîte.
+ *
+ * Les patchs créés lors d'un appel précédent dont la boîte n'a pas changé
+ * sont conservés tels quels. Les mailles du niveau qui ne sont plus dans
+ * aucune boîte sont dé-raffinées et celles qui sont dans une nouvelle boîte
+ * sont raffinées. Le transfert des valeurs des variables se fait via les
+ * fonctions enregistrées avec registerCallBack().
+ *
+ * Voici un exemple de code utilisateur:
+ *
+ * \code
+ * ICartesianMesh* cartesian_mesh = ...;
+ * Ref<CartesianMeshAMRPatchRegridder> regridder = CartesianMeshUtils::createCartesianMeshAMRPatchRegridder(cartesian_mesh);
+ * UniqueArray<Int32> flagged_cells = ...;
+ * // A chaque adaptation:
+ * regridder->regrid(0,flagged_cells);
+ * \endcode
+ */
+class ARCANE_CARTESIANMESH_EXPORT CartesianMeshAMRPatchRegridder
+: public TraceAccessor
+{
+  friend CartesianMeshImpl;
+
+ public:
+
+  //! Boîte (en coordonnées de maille d'un niveau) couverte par un patch
+  struct Box
+  {
+    //! Coordonnées de la première maille de la boîte
+    Int64 lower[3] = { 0, 0, 0 };
+    //! Coordonnées après la dernière maille de la boîte
+    Int64 upper[3] = { 1, 1, 1 };
+
+    Int64 nbCell() const { return (upper[0] - lower[0]) * (upper[1] - lower[1]) * (upper[2] - lower[2]); }
+    bool contains(Int64 x, Int64 y, Int64 z) const
+    {
+      return x >= lower[0] && x < upper[0] && y >= lower[1] && y < upper[1] && z >= lower[2] && z < upper[2];
+    }
+    friend bool operator==(const Box& a, const Box& b)
+    {
+      for (Int32 d = 0; d < 3; ++d)
+        if (a.lower[d] != b.lower[d] || a.upper[d] != b.upper[d])
+          return false;
+      return true;
+    }
+  };
+
+ private:
+
+  CartesianMeshAMRPatchRegridder(ICartesianMesh* cm, ICartesianMeshAMRPatchMng* amr_mng);
+
+ public:
+
+  /*!
+   * \brief Positionne l'efficacité minimale d'un patch.
+   *
+   * Il s'agit du rapport minimal entre le nombre de mailles marquées et le
+   * nombre de mailles d'une boîte. Doit être compris entre 0 et 1. La
+   * valeur par défaut est 0.7.
+   */
+  void setEfficiency(Real v);
+  Real efficiency() const { return m_efficiency; }
+
+  /*!
+   * \brief Positionne la taille minimale d'une boîte issue d'un découpage.
+   *
+   * Une boîte n'est pas découpée si l'une des deux parties a moins de \a v
+   * mailles dans la direction du découpage. La valeur par défaut est 2.
+   */
+  void setMinPatchSize(Int32 v);
+  Int32 minPatchSize() const { return m_min_patch_size; }
+
+  /*!
+   * \brief Recalcule les patchs issus des mailles de niveau \a level.
+   *
+   * \a cells_local_id contient les localId() des mailles propres de niveau
+   * \a level à raffiner. Les mailles fantômes de cette liste sont ignorées.
+   *
+   * Les mailles de niveau \a level en dehors des nouvelles boîtes sont
+   * dé-raffinées sauf si l'une de leurs mailles filles est raffinée.
+   *
+   * Cette méthode est collective.
+   */
+  void regrid(Int32 level, ConstArrayView<Int32> cells_local_id);
+
+  //! Boîtes des patchs issus des mailles de niveau \a level
+  UniqueArray<Box> boxes(Int32 level) const;
+
+  /*!
+   * \brief Enregistre une fonction de transport des variables.
+   *
+   * \sa ICartesianMeshAMRPatchMng::registerCallBack().
+   */
+  void registerCallBack(IAMRTransportFunctor* f);
+
+  //! Supprime l'enregistrement de la fonction de transport \a f.
+  void unRegisterCallBack(IAMRTransportFunctor* f);
+
+ private:
+
+  //! Patch créé par cette instance
+  struct PatchInfo
+  {
+    Int32 level = 0;
+    Box box;
+    CellGroup cells;
+  };
+
+  ICartesianMesh* m_cartesian_mesh = nullptr;
+  ICartesianMeshAMRPatchMng* m_amr_mng = nullptr;
+  Ref<ICartesianMeshNumberingMng> m_num_mng;
+  Real m_efficiency = 0.7;
+  Int32 m_min_patch_size = 2;
+  UniqueArray<PatchInfo> m_patches;
+
+ private:
+
+  void _computeBoxes(ConstArrayView<Int64> tags, Array<Box>& boxes);
+  void _cellCoord(Cell cell, Int64* coord);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
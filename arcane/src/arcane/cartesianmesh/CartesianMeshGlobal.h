@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* CartesianMeshGlobal.h                                       (C) 2000-2023 */
+/* CartesianMeshGlobal.h                                       (C) 2000-2024 */
 /*                                                                           */
 /* Déclarations de la composante 'arcane_cartesianmesh'.                     */
 /*---------------------------------------------------------------------------*/
@@ -40,6 +40,8 @@ class CartesianMeshPatch;
 class CartesianConnectivity;
 class CartesianMeshCoarsening;
 class CartesianMeshCoarsening2;
+class CartesianMeshAMRPatchRegridder;
+class ICartesianMeshAMRPatchMng;
 class CartesianMeshRenumberingInfo;
 class ICartesianMeshInternal;
 class CartesianMeshPatchListView;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* CartesianMeshUtils.cc                                       (C) 2000-2023 */
+/* CartesianMeshUtils.cc                                       (C) 2000-2024 */
 /*                                                                           */
 /* Fonctions utilitaires associées à 'ICartesianMesh'.                       */
 /*---------------------------------------------------------------------------*/
@@ -38,6 +38,19 @@ createCartesianMeshCoarsening2(ICartesianMesh* cm)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Créé une instance pour recalculer automatiquement les patchs AMR.
+ * \warning Experimental method !
+ */
+Ref<CartesianMeshAMRPatchRegridder> CartesianMeshUtils::
+createCartesianMeshAMRPatchRegridder(ICartesianMesh* cm)
+{
+  return cm->_internalApi()->createCartesianMeshAMRPatchRegridder();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // namespace Arcane
 
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* CartesianMeshUtils.h                                        (C) 2000-2023 */
+/* CartesianMeshUtils.h                                        (C) 2000-2024 */
 /*                                                                           */
 /* Fonctions utilitaires associées à 'ICartesianMesh'.                       */
 /*---------------------------------------------------------------------------*/
@@ -36,6 +36,13 @@ namespace Arcane::CartesianMeshUtils
 extern "C++" ARCANE_CARTESIANMESH_EXPORT Ref<CartesianMeshCoarsening2>
 createCartesianMeshCoarsening2(ICartesianMesh* cm);
 
+/*!
+ * \brief Créé une instance pour recalculer automatiquement les patchs AMR.
+ * \warning Experimental method !
+ */
+extern "C++" ARCANE_CARTESIANMESH_EXPORT Ref<CartesianMeshAMRPatchRegridder>
+createCartesianMeshAMRPatchRegridder(ICartesianMesh* cm);
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
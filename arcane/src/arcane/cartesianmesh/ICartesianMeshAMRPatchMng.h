@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ICartesianMeshAMRPatchMng.h                                 (C) 2000-2023 */
+/* ICartesianMeshAMRPatchMng.h                                 (C) 2000-2024 */
 /*                                                                           */
 /* Interface de gestionnaire de l'AMR par patch d'un maillage cartésien.     */
 /*---------------------------------------------------------------------------*/
@@ -24,6 +24,7 @@
 
 namespace Arcane
 {
+class IAMRTransportFunctor;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -31,7 +32,7 @@ namespace Arcane
 class ARCANE_CARTESIANMESH_EXPORT ICartesianMeshAMRPatchMng
 {
  public:
-  ~ICartesianMeshAMRPatchMng() = default;
+  virtual ~ICartesianMeshAMRPatchMng() = default;
 
  public:
   /*!
@@ -45,6 +46,41 @@ class ARCANE_CARTESIANMESH_EXPORT ICartesianMeshAMRPatchMng
    * flag "II_Refine".
    */
   virtual void refine() =0;
+
+  /*!
+   * @brief Méthode permettant de définir les mailles à dé-raffiner.
+   *
+   * Les mailles \a cells_lids sont des mailles filles. Une maille parente
+   * est dé-raffinée uniquement si toutes ses mailles filles sont marquées
+   * et qu'aucune d'elles n'a elle-même de mailles filles.
+   *
+   * @param cells_lids Les localIds des mailles.
+   */
+  virtual void flagCellToCoarsen(Int32ConstArrayView cells_lids) =0;
+
+  /*!
+   * @brief Méthode permettant de supprimer les mailles avec le
+   * flag "II_Coarsen".
+   *
+   * Les fonctions de transport enregistrées via registerCallBack() sont
+   * appelées avec l'opération Restriction sur les mailles parentes avant
+   * la suppression des mailles filles.
+   *
+   * Cette méthode est collective.
+   */
+  virtual void coarsen() =0;
+
+  /*!
+   * @brief Enregistre une fonction de transport des variables.
+   *
+   * La fonction est appelée avec l'opération Prolongation après chaque
+   * raffinement et avec l'opération Restriction avant chaque dé-raffinement.
+   * Dans les deux cas, la liste des mailles est celle des mailles parentes.
+   */
+  virtual void registerCallBack(IAMRTransportFunctor* f) =0;
+
+  //! Supprime l'enregistrement de la fonction de transport \a f.
+  virtual void unRegisterCallBack(IAMRTransportFunctor* f) =0;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ICartesianMeshInternal.h                                    (C) 2000-2023 */
+/* ICartesianMeshInternal.h                                    (C) 2000-2024 */
 /*                                                                           */
 /* Partie interne à Arcane de ICartesianMesh.                                */
 /*---------------------------------------------------------------------------*/
@@ -47,8 +47,25 @@ class ARCANE_CARTESIANMESH_EXPORT ICartesianMeshInternal
    *
    * \a parent_cells_local_id est la liste des localId() des mailles parentes.
    * Les mailles filles de \a parent_cells doivent déjà avoir été créées.
+   *
+   * Retourne le groupe des mailles du patch créé.
+   */
+  virtual CellGroup addPatchFromExistingChildren(ConstArrayView<Int32> parent_cells_local_id) = 0;
+
+  /*!
+   * \brief Supprime le patch dont le groupe des mailles est \a patch_cells.
+   *
+   * Les mailles du patch ne sont pas supprimées. Il faut appeler
+   * ICartesianMesh::computeDirections() pour mettre à jour la liste des patchs.
+   */
+  virtual void removePatch(const CellGroup& patch_cells) = 0;
+
+  /*!
+   * \brief Créé une instance pour recalculer automatiquement les patchs.
+   *
+   * Le maillage doit être de type eMeshAMRKind::PatchCartesianMeshOnly.
    */
-  virtual void addPatchFromExistingChildren(ConstArrayView<Int32> parent_cells_local_id) = 0;
+  virtual Ref<CartesianMeshAMRPatchRegridder> createCartesianMeshAMRPatchRegridder() = 0;
 };
 
 /*---------------------------------------------------------------------------*/
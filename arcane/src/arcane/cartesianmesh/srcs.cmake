@@ -41,6 +41,8 @@ set(ARCANE_SOURCES
   ICartesianMeshAMRPatchMng.h
   CartesianMeshAMRPatchMng.cc
   CartesianMeshAMRPatchMng.h
+  CartesianMeshAMRPatchRegridder.cc
+  CartesianMeshAMRPatchRegridder.h
 
   ICartesianMeshNumberingMng.h
   CartesianMeshNumberingMng.cc
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* AbstractDataVisitor.cc                                      (C) 2000-2023 */
+/* AbstractDataVisitor.cc                                      (C) 2000-2024 */
 /*                                                                           */
 /* Visiteur abstrait pour une donnée.                                        */
 /*---------------------------------------------------------------------------*/
@@ -68,6 +68,13 @@ applyVisitor(IScalarDataT<Real>* data)
   _throwException(DT_Real);
 }
 
+void AbstractScalarDataVisitor::
+applyVisitor(IScalarDataT<Float32>* data)
+{
+  ARCANE_UNUSED(data);
+  _throwException(DT_Float32);
+}
+
 void AbstractScalarDataVisitor::
 applyVisitor(IScalarDataT<Int16>* data)
 {
@@ -149,6 +156,13 @@ applyVisitor(IArrayDataT<Real>* data)
   _throwException(DT_Real);
 }
 
+void AbstractArrayDataVisitor::
+applyVisitor(IArrayDataT<Float32>* data)
+{
+  ARCANE_UNUSED(data);
+  _throwException(DT_Float32);
+}
+
 void AbstractArrayDataVisitor::
 applyVisitor(IArrayDataT<Int16>* data)
 {
@@ -230,6 +244,13 @@ applyVisitor(IArray2DataT<Real>* data)
   _throwException(DT_Real);
 }
 
+void AbstractArray2DataVisitor::
+applyVisitor(IArray2DataT<Float32>* data)
+{
+  ARCANE_UNUSED(data);
+  _throwException(DT_Float32);
+}
+
 void AbstractArray2DataVisitor::
 applyVisitor(IArray2DataT<Int16>* data)
 {
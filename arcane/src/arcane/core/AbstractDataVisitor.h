@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* AbstractDataVisitor.h                                       (C) 2000-2023 */
+/* AbstractDataVisitor.h                                       (C) 2000-2024 */
 /*                                                                           */
 /* Visiteur abstrait pour une donnée.                                        */
 /*---------------------------------------------------------------------------*/
@@ -45,6 +45,7 @@ class ARCANE_CORE_EXPORT AbstractScalarDataVisitor
 
   virtual void applyVisitor(IScalarDataT<Byte>* data);
   virtual void applyVisitor(IScalarDataT<Real>* data);
+  virtual void applyVisitor(IScalarDataT<Float32>* data);
   virtual void applyVisitor(IScalarDataT<Int16>* data);
   virtual void applyVisitor(IScalarDataT<Int32>* data);
   virtual void applyVisitor(IScalarDataT<Int64>* data);
@@ -74,6 +75,7 @@ class ARCANE_CORE_EXPORT AbstractArrayDataVisitor
 
   virtual void applyVisitor(IArrayDataT<Byte>* data);
   virtual void applyVisitor(IArrayDataT<Real>* data);
+  virtual void applyVisitor(IArrayDataT<Float32>* data);
   virtual void applyVisitor(IArrayDataT<Int16>* data);
   virtual void applyVisitor(IArrayDataT<Int32>* data);
   virtual void applyVisitor(IArrayDataT<Int64>* data);
@@ -103,6 +105,7 @@ class ARCANE_CORE_EXPORT AbstractArray2DataVisitor
 
   virtual void applyVisitor(IArray2DataT<Byte>* data);
   virtual void applyVisitor(IArray2DataT<Real>* data);
+  virtual void applyVisitor(IArray2DataT<Float32>* data);
   virtual void applyVisitor(IArray2DataT<Int16>* data);
   virtual void applyVisitor(IArray2DataT<Int32>* data);
   virtual void applyVisitor(IArray2DataT<Int64>* data);
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* Array2Variable.cc                                           (C) 2000-2023 */
+/* Array2Variable.cc                                           (C) 2000-2024 */
 /*                                                                           */
 /* Variable tableau 2D.                                                      */
 /*---------------------------------------------------------------------------*/
@@ -680,6 +680,7 @@ fillShape(ArrayShape& shape_with_item)
 
 template class Array2VariableT<Byte>;
 template class Array2VariableT<Real>;
+template class Array2VariableT<Float32>;
 template class Array2VariableT<Int16>;
 template class Array2VariableT<Int32>;
 template class Array2VariableT<Int64>;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* Concurrency.h                                               (C) 2000-2022 */
+/* Concurrency.h                                               (C) 2000-2024 */
 /*                                                                           */
 /* Classes gérant la concurrence (tâches, boucles parallèles, ...)           */
 /*---------------------------------------------------------------------------*/
@@ -60,6 +60,7 @@ arcaneParallelForeach(const ItemVectorView& items_view, const ForLoopRunInfo& ru
   ForLoopRunInfo adapted_run_info(run_info);
   ParallelLoopOptions loop_opt(run_info.options().value_or(TaskFactory::defaultParallelLoopOptions()));
   loop_opt.setGrainSize(ipf.blockGrainSize());
+  ipf.adaptItemCosts(loop_opt);
   adapted_run_info.addOptions(loop_opt);
 
   ParallelFor1DLoopInfo loop_info(0, ipf.nbBlock(), &ipf, adapted_run_info);
@@ -83,6 +84,7 @@ arcaneParallelForeach(const ItemVectorView& items_view, const ForLoopRunInfo& ru
   ForLoopRunInfo adapted_run_info(run_info);
   ParallelLoopOptions loop_opt(run_info.options().value_or(TaskFactory::defaultParallelLoopOptions()));
   loop_opt.setGrainSize(ipf.blockGrainSize());
+  ipf.adaptItemCosts(loop_opt);
   adapted_run_info.addOptions(loop_opt);
 
   ParallelFor1DLoopInfo loop_info(0, ipf.nbBlock(), &ipf, adapted_run_info);
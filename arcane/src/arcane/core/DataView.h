@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DataView.h                                                  (C) 2000-2023 */
+/* DataView.h                                                  (C) 2000-2024 */
 /*                                                                           */
 /* Vues sur des données des variables.                                       */
 /*---------------------------------------------------------------------------*/
@@ -305,6 +305,137 @@ class DataViewGetterSetter
   constexpr ARCCORE_HOST_DEVICE DataType* _address() const { return m_ptr; }
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Classe pour accéder en écriture à un élément d'une vue avec
+ * conversion de type.
+ *
+ * La valeur est conservée avec le type \a StorageType (par exemple
+ * 'Float32') et est manipulée avec le type \a DataType (par exemple
+ * 'Real'). La conversion est effectuée à chaque écriture. Les calculs des
+ * opérateurs tels que '+=' sont faits avec le type \a DataType.
+ */
+template <typename StorageType, typename DataType>
+class DataViewConvertSetter
+{
+ public:
+
+  using ValueType = StorageType;
+  using ConvertedType = DataType;
+  using AccessorReturnType = DataViewConvertSetter<StorageType, DataType>;
+
+ public:
+
+  explicit ARCCORE_HOST_DEVICE DataViewConvertSetter(StorageType* ptr)
+  : m_ptr(ptr)
+  {}
+  ARCCORE_HOST_DEVICE DataViewConvertSetter(const DataViewConvertSetter& v)
+  : m_ptr(v.m_ptr)
+  {}
+  ARCCORE_HOST_DEVICE DataViewConvertSetter&
+  operator=(const DataType& v)
+  {
+    *m_ptr = static_cast<StorageType>(v);
+    return (*this);
+  }
+  ARCCORE_HOST_DEVICE DataViewConvertSetter&
+  operator=(const DataViewConvertSetter& v)
+  {
+    // Comme pour DataViewSetter, il faut mettre à jour la valeur
+    // et pas le pointeur.
+    *m_ptr = *(v.m_ptr);
+    return (*this);
+  }
+  static ARCCORE_HOST_DEVICE AccessorReturnType build(StorageType* ptr)
+  {
+    return AccessorReturnType(ptr);
+  }
+
+ public:
+
+  ARCCORE_HOST_DEVICE DataViewConvertSetter& operator+=(const DataType& v)
+  {
+    *m_ptr = static_cast<StorageType>(_get() + v);
+    return (*this);
+  }
+  ARCCORE_HOST_DEVICE DataViewConvertSetter& operator-=(const DataType& v)
+  {
+    *m_ptr = static_cast<StorageType>(_get() - v);
+    return (*this);
+  }
+  ARCCORE_HOST_DEVICE DataViewConvertSetter& operator*=(const DataType& v)
+  {
+    *m_ptr = static_cast<StorageType>(_get() * v);
+    return (*this);
+  }
+  ARCCORE_HOST_DEVICE DataViewConvertSetter& operator/=(const DataType& v)
+  {
+    *m_ptr = static_cast<StorageType>(_get() / v);
+    return (*this);
+  }
+
+ protected:
+
+  constexpr ARCCORE_HOST_DEVICE DataType _get() const { return static_cast<DataType>(*m_ptr); }
+
+ private:
+
+  StorageType* m_ptr;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Classe pour accéder en lecture/écriture à un élément d'une vue
+ * avec conversion de type.
+ *
+ * Cette classe étend DataViewConvertSetter en ajoutant la possibilité de
+ * lire la valeur. La conversion vers \a DataType est effectuée à chaque
+ * lecture.
+ */
+template <typename StorageType, typename DataType>
+class DataViewConvertGetterSetter
+: public DataViewConvertSetter<StorageType, DataType>
+{
+  using BaseType = DataViewConvertSetter<StorageType, DataType>;
+
+ public:
+
+  using ValueType = StorageType;
+  using ConvertedType = DataType;
+  using AccessorReturnType = DataViewConvertGetterSetter<StorageType, DataType>;
+
+ public:
+
+  explicit ARCCORE_HOST_DEVICE DataViewConvertGetterSetter(StorageType* ptr)
+  : BaseType(ptr)
+  {}
+  ARCCORE_HOST_DEVICE DataViewConvertGetterSetter(const DataViewConvertGetterSetter& v)
+  : BaseType(v)
+  {}
+  ARCCORE_HOST_DEVICE operator DataType() const
+  {
+    return BaseType::_get();
+  }
+  ARCCORE_HOST_DEVICE DataViewConvertGetterSetter&
+  operator=(const DataViewConvertGetterSetter& v)
+  {
+    BaseType::operator=(v);
+    return (*this);
+  }
+  ARCCORE_HOST_DEVICE DataViewConvertGetterSetter&
+  operator=(const DataType& v)
+  {
+    BaseType::operator=(v);
+    return (*this);
+  }
+  static ARCCORE_HOST_DEVICE AccessorReturnType build(StorageType* ptr)
+  {
+    return AccessorReturnType(ptr);
+  }
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
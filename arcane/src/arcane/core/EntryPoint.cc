@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* EntryPoint.cc                                               (C) 2000-2022 */
+/* EntryPoint.cc                                               (C) 2000-2024 */
 /*                                                                           */
 /* Point d'entrée d'un module.                                               */
 /*---------------------------------------------------------------------------*/
@@ -22,6 +22,8 @@
 #include "arcane/ISubDomain.h"
 #include "arcane/Timer.h"
 
+#include <optional>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -120,6 +122,24 @@ _getAddressForHyoda(void* next_entry_point_address)
 /*---------------------------------------------------------------------------*/
 void EntryPoint::
 executeEntryPoint()
+{
+  _execute(false);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPoint::
+executeEntryPointConcurrently()
+{
+  _execute(true);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPoint::
+_execute(bool is_concurrent)
 {
   // Les points d'entrée de la boucle de calcul ne
   // sont pas appelés si le module n'est pas actif.
@@ -136,7 +156,11 @@ executeEntryPoint()
 #endif
   }
 
-  Trace::Setter mclass(m_sub_domain->traceMng(), m_module->name());
+  // La classe des messages est commune à tous les threads. Elle n'est donc
+  // pas modifiée lorsque plusieurs points d'entrée s'exécutent en même temps.
+  std::optional<Trace::Setter> mclass;
+  if (!is_concurrent)
+    mclass.emplace(m_sub_domain->traceMng(), m_module->name());
 
   {
     Timer::Sentry ts_elapsed(m_elapsed_timer);
@@ -152,6 +176,30 @@ executeEntryPoint()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void EntryPoint::
+addReadVariable(IVariable* var)
+{
+  ARCANE_CHECK_POINTER(var);
+  m_has_declared_variables = true;
+  if (!m_read_variables.contains(var))
+    m_read_variables.add(var);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void EntryPoint::
+addWriteVariable(IVariable* var)
+{
+  ARCANE_CHECK_POINTER(var);
+  m_has_declared_variables = true;
+  if (!m_write_variables.contains(var))
+    m_write_variables.add(var);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 Real EntryPoint::
 lastCPUTime() const
 {
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* EntryPoint.h                                                (C) 2000-2022 */
+/* EntryPoint.h                                                (C) 2000-2024 */
 /*                                                                           */
 /* Point d'entrée d'un module.                                               */
 /*---------------------------------------------------------------------------*/
@@ -16,6 +16,7 @@
 
 #include "arcane/utils/String.h"
 #include "arcane/utils/FunctorWithAddress.h"
+#include "arcane/utils/Array.h"
 #include "arcane/IEntryPoint.h"
 
 /*---------------------------------------------------------------------------*/
@@ -111,6 +112,7 @@ class ARCANE_CORE_EXPORT EntryPoint
   ISubDomain* subDomain() const override { return m_sub_domain; }
   IModule* module() const override { return m_module; }
   void executeEntryPoint() override;
+  void executeEntryPointConcurrently() override;
   Real totalCPUTime() const override;
   Real lastCPUTime() const override;
   Real totalElapsedTime() const override;
@@ -120,6 +122,34 @@ class ARCANE_CORE_EXPORT EntryPoint
   Integer nbCall() const override { return m_nb_call; }
   String where() const override { return m_where; }
   int property() const override { return m_property; }
+  bool hasDeclaredVariables() const override { return m_has_declared_variables; }
+  ConstArrayView<IVariable*> readVariables() const override { return m_read_variables; }
+  ConstArrayView<IVariable*> writeVariables() const override { return m_write_variables; }
+
+ public:
+
+  /*!
+   * \brief Déclare que le point d'entrée lit la variable \a var.
+   *
+   * Si les variables lues et modifiées par les points d'entrée de la
+   * boucle de calcul sont déclarées et que l'exécution concurrente des
+   * points d'entrée est active (variable d'environnement
+   * ARCANE_CONCURRENT_ENTRY_POINTS), le gestionnaire de boucle en temps
+   * exécute en même temps les points d'entrée consécutifs qui ne
+   * modifient pas les variables utilisées par les autres.
+   *
+   * Les déclarations doivent donc être exhaustives et le code du point
+   * d'entrée ne doit pas faire d'opérations collectives ni modifier
+   * d'autres structures partagées (maillage, groupes, ...).
+   */
+  void addReadVariable(IVariable* var);
+
+  /*!
+   * \brief Déclare que le point d'entrée modifie la variable \a var.
+   *
+   * \sa addReadVariable().
+   */
+  void addWriteVariable(IVariable* var);
 
  private:
 
@@ -133,6 +163,9 @@ class ARCANE_CORE_EXPORT EntryPoint
   int m_property = 0; //!< Propriétés du point d'entrée
   Integer m_nb_call = 0; //!< Nombre de fois que le point d'entrée a été exécuté
   bool m_is_destroy_caller = false; //!< Indique si on doit détruire le functor d'appel.
+  bool m_has_declared_variables = false; //!< Indique si les variables utilisées ont été déclarées
+  UniqueArray<IVariable*> m_read_variables; //!< Variables lues
+  UniqueArray<IVariable*> m_write_variables; //!< Variables modifiées
 
  private:
 
@@ -146,6 +179,7 @@ class ARCANE_CORE_EXPORT EntryPoint
  private:
 
   void _getAddressForHyoda(void* =nullptr);
+  void _execute(bool is_concurrent);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -161,14 +195,17 @@ class ARCANE_CORE_EXPORT EntryPoint
  * \param where endroit ou est appelé le point d'entrée
  * \param property propriétés du point d'entrée (voir IEntryPoint)
  * \param name nom de la fonction pour Arcane
+ *
+ * Retourne le point d'entrée créé, ce qui permet par exemple de déclarer
+ * les variables qu'il utilise (voir EntryPoint::addReadVariable()).
  */
-template<typename ModuleType> inline void
+template<typename ModuleType> inline EntryPoint*
 addEntryPoint(ModuleType* module,const char* name,void (ModuleType::*func)(),
               const String& where = IEntryPoint::WComputeLoop,
               int property = IEntryPoint::PNone)
 {
   IFunctorWithAddress* caller = new FunctorWithAddressT<ModuleType>(module,func);
-  EntryPoint::create(EntryPointBuildInfo(module,name,caller,where,property,true));
+  return EntryPoint::create(EntryPointBuildInfo(module,name,caller,where,property,true));
 }
 
 /*---------------------------------------------------------------------------*/
@@ -184,14 +221,17 @@ addEntryPoint(ModuleType* module,const char* name,void (ModuleType::*func)(),
  * \param where endroit ou est appelé le point d'entrée
  * \param property propriétés du point d'entrée (voir IEntryPoint)
  * \param name nom de la fonction pour Arcane
+ *
+ * Retourne le point d'entrée créé, ce qui permet par exemple de déclarer
+ * les variables qu'il utilise (voir EntryPoint::addReadVariable()).
  */
-template<typename ModuleType> inline void
+template<typename ModuleType> inline EntryPoint*
 addEntryPoint(ModuleType* module,const String& name,void (ModuleType::*func)(),
               const String& where = IEntryPoint::WComputeLoop,
               int property = IEntryPoint::PNone)
 {
   IFunctorWithAddress* caller = new FunctorWithAddressT<ModuleType>(module,func);
-  EntryPoint::create(EntryPointBuildInfo(module,name,caller,where,property,true));
+  return EntryPoint::create(EntryPointBuildInfo(module,name,caller,where,property,true));
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IDataVisitor.h                                              (C) 2000-2023 */
+/* IDataVisitor.h                                              (C) 2000-2024 */
 /*                                                                           */
 /* Interface du pattern visitor pour une donnée.                             */
 /*---------------------------------------------------------------------------*/
@@ -69,6 +69,7 @@ class ARCANE_CORE_EXPORT IScalarDataVisitor
 
   virtual void applyVisitor(IScalarDataT<Byte>* data) = 0;
   virtual void applyVisitor(IScalarDataT<Real>* data) = 0;
+  virtual void applyVisitor(IScalarDataT<Float32>* data) = 0;
   virtual void applyVisitor(IScalarDataT<Int16>* data) = 0;
   virtual void applyVisitor(IScalarDataT<Int32>* data) = 0;
   virtual void applyVisitor(IScalarDataT<Int64>* data) = 0;
@@ -94,6 +95,7 @@ class ARCANE_CORE_EXPORT IArrayDataVisitor
 
   virtual void applyVisitor(IArrayDataT<Byte>* data) = 0;
   virtual void applyVisitor(IArrayDataT<Real>* data) = 0;
+  virtual void applyVisitor(IArrayDataT<Float32>* data) = 0;
   virtual void applyVisitor(IArrayDataT<Int16>* data) = 0;
   virtual void applyVisitor(IArrayDataT<Int32>* data) = 0;
   virtual void applyVisitor(IArrayDataT<Int64>* data) = 0;
@@ -119,6 +121,7 @@ class ARCANE_CORE_EXPORT IArray2DataVisitor
 
   virtual void applyVisitor(IArray2DataT<Byte>* data) = 0;
   virtual void applyVisitor(IArray2DataT<Real>* data) = 0;
+  virtual void applyVisitor(IArray2DataT<Float32>* data) = 0;
   virtual void applyVisitor(IArray2DataT<Int16>* data) = 0;
   virtual void applyVisitor(IArray2DataT<Int32>* data) = 0;
   virtual void applyVisitor(IArray2DataT<Int64>* data) = 0;
@@ -145,6 +148,7 @@ class ARCANE_CORE_EXPORT IMultiArray2DataVisitor
 
   virtual void applyVisitor(IMultiArray2DataT<Byte>*) {}
   virtual void applyVisitor(IMultiArray2DataT<Real>*) {}
+  virtual void applyVisitor(IMultiArray2DataT<Float32>*) {}
   virtual void applyVisitor(IMultiArray2DataT<Int16>*) {}
   virtual void applyVisitor(IMultiArray2DataT<Int32>*) {}
   virtual void applyVisitor(IMultiArray2DataT<Int64>*) {}
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IEntryPoint.h                                               (C) 2000-2022 */
+/* IEntryPoint.h                                               (C) 2000-2024 */
 /*                                                                           */
 /* Interface du point d'entrée d'un module.                                  */
 /*---------------------------------------------------------------------------*/
@@ -148,6 +148,32 @@ class ARCANE_CORE_EXPORT IEntryPoint
 
   //! Retourne les propriétés du point d'entrée.
   virtual int property() const = 0;
+
+ public:
+
+  /*!
+   * \brief Indique si les variables utilisées par le point d'entrée ont été déclarées.
+   *
+   * Si c'est le cas, readVariables() et writeVariables() contiennent
+   * l'ensemble des variables lues et modifiées par le point d'entrée et
+   * ce dernier peut être exécuté en concurrence avec d'autres points
+   * d'entrée indépendants (voir EntryPoint::addReadVariable()).
+   */
+  virtual bool hasDeclaredVariables() const = 0;
+
+  //! Liste des variables déclarées comme lues par le point d'entrée
+  virtual ConstArrayView<IVariable*> readVariables() const = 0;
+
+  //! Liste des variables déclarées comme modifiées par le point d'entrée
+  virtual ConstArrayView<IVariable*> writeVariables() const = 0;
+
+  /*!
+   * \brief Appelle le point d'entrée en concurrence avec d'autres points d'entrée.
+   *
+   * Identique à executeEntryPoint() mais ne modifie pas la classe des
+   * messages du gestionnaire de traces, qui est commune à tous les threads.
+   */
+  virtual void executeEntryPointConcurrently() = 0;
 };
 
 /*---------------------------------------------------------------------------*/
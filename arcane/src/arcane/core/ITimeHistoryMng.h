@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ITimeHistoryMng.h                                           (C) 2000-2019 */
+/* ITimeHistoryMng.h                                           (C) 2000-2024 */
 /*                                                                           */
 /* Interface de la classe gérant un historique de valeurs.                   */
 /*---------------------------------------------------------------------------*/
@@ -17,6 +17,8 @@
 #include "arcane/utils/UtilsTypes.h"
 #include "arcane/utils/FatalErrorException.h"
 
+#include "arcane/core/Parallel.h"
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -29,6 +31,33 @@ class ITimeHistoryCurveWriter;
 class ITimeHistoryCurveWriter2;
 class ITimeHistoryTransformer;
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Référence sur une courbe enregistrée via
+ * ITimeHistoryMng::registerCurve().
+ *
+ * Une référence nulle (isNull()) ne correspond à aucune courbe.
+ */
+class TimeHistoryCurveHandle
+{
+ public:
+
+  TimeHistoryCurveHandle() = default;
+  explicit TimeHistoryCurveHandle(Int32 index) : m_index(index) {}
+
+ public:
+
+  //! Indice de la courbe dans le gestionnaire
+  Int32 index() const { return m_index; }
+  //! Indique si la référence est nulle
+  bool isNull() const { return m_index<0; }
+
+ private:
+
+  Int32 m_index = -1;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -62,6 +91,22 @@ class ITimeHistoryTransformer;
 
  Le format de ces fichiers dépend de l'implémentation.
 
+ Lorsqu'on a beaucoup de courbes à mettre à jour à chaque itération, il est
+ préférable d'enregistrer les courbes une fois pour toute via registerCurve()
+ puis d'utiliser addValues() ou addReducedValues() qui prennent en une seule
+ fois les valeurs de toutes les courbes et évitent la recherche par nom.
+
+ \code
+ ITimeHistoryMng* thm = ...;
+ // A l'initialisation
+ UniqueArray<TimeHistoryCurveHandle> handles;
+ handles.add(thm->registerCurve("Mass"));
+ handles.add(thm->registerCurve("Energy"));
+ // A chaque itération
+ RealUniqueArray values = { local_mass, local_energy };
+ thm->addReducedValues(Parallel::ReduceSum,handles,values);
+ \endcode
+
  \since 0.4.38
  */
 class ITimeHistoryMng
@@ -124,6 +169,42 @@ class ITimeHistoryMng
    */
   virtual void addValue(const String& name,Int64ConstArrayView value,bool end_time=true,bool is_local=false) =0;
 
+ public:
+
+  /*!
+   * \brief Enregistre la courbe de réels \a name et retourne une référence dessus.
+   *
+   * \a sub_size est le nombre de valeurs de la courbe par itération.
+   * Les arguments \a end_time et \a is_local ont la même signification
+   * que pour addValue(). Si une courbe de même nom est déjà enregistrée,
+   * retourne la même référence. Cette méthode peut être appelée par tous les
+   * sous-domaines et doit l'être dans le même ordre si on utilise
+   * addReducedValues().
+   */
+  virtual TimeHistoryCurveHandle
+  registerCurve(const String& name,Integer sub_size=1,bool end_time=true,bool is_local=false) =0;
+
+  /*!
+   * \brief Ajoute les valeurs \a values aux courbes référencées par \a handles.
+   *
+   * Les valeurs sont rangées consécutivement dans \a values, dans l'ordre
+   * de \a handles, chaque courbe ayant le nombre de valeurs indiqué lors de son
+   * enregistrement. Le nombre total d'éléments de \a values doit donc être
+   * égal à la somme de ces nombres.
+   */
+  virtual void addValues(ConstArrayView<TimeHistoryCurveHandle> handles,RealConstArrayView values) =0;
+
+  /*!
+   * \brief Réduit les valeurs locales \a values et les ajoute aux courbes
+   * référencées par \a handles.
+   *
+   * Cette méthode est collective. Les valeurs de tous les sous-domaines
+   * sont réduites via l'opération \a rt en une seule opération collective
+   * pour l'ensemble des courbes puis ajoutées comme avec addValues().
+   */
+  virtual void addReducedValues(Parallel::eReduceType rt,ConstArrayView<TimeHistoryCurveHandle> handles,
+                                RealConstArrayView values) =0;
+
  public:
 
   virtual void timeHistoryBegin() = 0;
@@ -217,6 +298,18 @@ class ITimeHistoryMng
    * \brief Positionne le booléen indiquant si l'historique est compressé
    */
   virtual void setShrinkActive(bool is_active) =0;
+
+  /*!
+   * \brief Indique si l'écriture des courbes est asynchrone.
+   *
+   * Si c'est le cas, dumpHistory() copie les valeurs des courbes et leur
+   * écriture par les écrivains est effectuée par un thread en tâche de fond.
+   * Une seule écriture est en cours à un instant donné.
+   */
+  virtual bool isAsyncWrite() const =0;
+
+  //! Positionne le booléen indiquant si l'écriture des courbes est asynchrone.
+  virtual void setAsyncWrite(bool is_async) =0;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -66,6 +66,43 @@ class ITimeStats
   virtual void beginPhase(eTimePhase phase) = 0;
   virtual void endPhase(eTimePhase phase) = 0;
 
+ public:
+
+  /*!
+   * \brief Indique le début d'une section où des actions sont exécutées en concurrence.
+   *
+   * Entre l'appel à cette méthode et celui à endConcurrentActions(), les
+   * appels à beginAction(), endAction(), beginPhase() et endPhase() sont
+   * ignorés, quel que soit le thread qui les effectue. Le temps de
+   * chaque action concurrente doit être mesuré par l'appelant puis ajouté
+   * via addConcurrentActionTime().
+   */
+  virtual void beginConcurrentActions() = 0;
+
+  /*!
+   * \brief Indique la fin d'une section commencée par beginConcurrentActions().
+   *
+   * Le temps écoulé depuis beginConcurrentActions() n'est pas attribué
+   * à l'action courante : il est remplacé par les temps ajoutés
+   * via addConcurrentActionTime().
+   */
+  virtual void endConcurrentActions() = 0;
+
+  /*!
+   * \brief Ajoute un appel d'une action exécutée en concurrence.
+   *
+   * \a action_path contient le nom de l'action et de ses éventuelles
+   * actions parentes, relativement à l'action courante. Le temps
+   * \a elapsed_time (en secondes) est ajouté à la phase \a phase de
+   * cette action.
+   *
+   * Cette méthode doit être appelée en dehors d'une section concurrente.
+   * Comme les actions ajoutées se sont exécutées en même temps, la somme
+   * de leurs temps peut être supérieure au temps écoulé.
+   */
+  virtual void addConcurrentActionTime(ConstArrayView<String> action_path,
+                                       eTimePhase phase, Real elapsed_time) = 0;
+
  public:
 
   /*!
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ItemFunctor.cc                                              (C) 2000-2023 */
+/* ItemFunctor.cc                                              (C) 2000-2024 */
 /*                                                                           */
 /* Fonctor sur les entités.                                                  */
 /*---------------------------------------------------------------------------*/
@@ -13,6 +13,8 @@
 
 #include "arcane/ItemFunctor.h"
 
+#include "arcane/utils/FatalErrorException.h"
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -59,6 +61,41 @@ _view(Integer begin_block,Integer nb_block) const
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void AbstractItemRangeFunctor::
+adaptItemCosts(ParallelLoopOptions& options)
+{
+  if (!options.hasItemCosts())
+    return;
+
+  ConstArrayView<Real> costs = options.itemCosts();
+  ConstArrayView<Real> prefix_sum = options.itemCostPrefixSum();
+  const bool has_costs = !costs.empty();
+  const Integer nb_item = m_items.size();
+  if (has_costs && costs.size()<nb_item)
+    ARCANE_FATAL("Bad size for item costs v={0} expected={1}",costs.size(),nb_item);
+  if (!has_costs && prefix_sum.size()<(nb_item+1))
+    ARCANE_FATAL("Bad size for item cost prefix sum v={0} expected={1}",prefix_sum.size(),nb_item+1);
+
+  m_block_cost_prefix_sum.resize(m_nb_block+1);
+  m_block_cost_prefix_sum[0] = 0.0;
+  Real sum = 0.0;
+  for( Integer block=0; block<m_nb_block; ++block ){
+    Integer begin = block * m_block_size;
+    Integer end = math::min(begin+m_block_size,nb_item);
+    if (has_costs){
+      for( Integer i=begin; i<end; ++i )
+        sum += costs[i];
+    }
+    else
+      sum = prefix_sum[end] - prefix_sum[0];
+    m_block_cost_prefix_sum[block+1] = sum;
+  }
+  options.setItemCostPrefixSum(m_block_cost_prefix_sum);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ItemFunctor.h                                               (C) 2000-2023 */
+/* ItemFunctor.h                                               (C) 2000-2024 */
 /*                                                                           */
 /* Fonctor sur les entités.                                                  */
 /*---------------------------------------------------------------------------*/
@@ -16,6 +16,8 @@
 
 #include "arcane/utils/RangeFunctor.h"
 #include "arcane/utils/Functor.h"
+#include "arcane/utils/Array.h"
+#include "arcane/utils/ParallelLoopOptions.h"
 
 #include "arcane/Item.h"
 #include "arcane/ItemVectorView.h"
@@ -53,6 +55,17 @@ class ARCANE_CORE_EXPORT AbstractItemRangeFunctor
   //! Taille souhaitée d'un intervalle d'itération.
   Integer blockGrainSize() const { return m_block_grain_size; }
 
+  /*!
+   * \brief Adapte les coûts des itérations de \a options aux blocs de l'instance.
+   *
+   * Les coûts positionnés dans \a options (via ParallelLoopOptions::setItemCosts()
+   * ou ParallelLoopOptions::setItemCostPrefixSum()) sont exprimés par entité
+   * de la vue alors que les itérations de l'instance sont des blocs d'entités.
+   * S'il y a des coûts, ils sont remplacés dans \a options par la somme
+   * préfixe des coûts de chaque bloc qui est conservée dans l'instance.
+   */
+  void adaptItemCosts(ParallelLoopOptions& options);
+
  protected:
 
   ItemVectorView m_items;
@@ -65,6 +78,9 @@ class ARCANE_CORE_EXPORT AbstractItemRangeFunctor
   ItemVectorView _view(Integer begin_block,Integer nb_block) const;
 
  private:
+
+  //! Somme préfixe des coûts des blocs (voir adaptItemCosts())
+  UniqueArray<Real> m_block_cost_prefix_sum;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -31,6 +31,7 @@
 #include "arcane/core/VariableCollection.h"
 #include "arcane/core/IVariableSynchronizer.h"
 #include "arcane/core/MeshHandle.h"
+#include "arcane/core/internal/IItemFamilyInternal.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -264,6 +265,7 @@ _dumpStats()
   _dumpCommunicatingRanks();
   _dumpLegacyConnectivityMemoryUsage();
   _dumpIncrementalConnectivityMemoryUsage();
+  _dumpIncrementalConnectivityFragmentation();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -320,6 +322,42 @@ _dumpIncrementalConnectivityMemoryUsage()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Affiche le taux de fragmentation des connectivités incrémentales.
+ *
+ * Pour chaque famille, il s'agit du taux maximal parmi les connectivités
+ * dont elle est la source. Toutes les familles sont traitées dans une
+ * seule réduction.
+ */
+void MeshStats::
+_dumpIncrementalConnectivityFragmentation()
+{
+  UniqueArray<IItemFamily*> families;
+  for( IItemFamily* family : m_mesh->itemFamilies() )
+    families.add(family);
+  const Integer nb_family = families.size();
+  UniqueArray<Real> ratios(nb_family);
+  for( Integer i=0; i<nb_family; ++i )
+    ratios[i] = families[i]->_internalApi()->connectivityFragmentationRatio();
+
+  UniqueArray<Real> min_ratios(nb_family);
+  UniqueArray<Real> max_ratios(nb_family);
+  UniqueArray<Real> sum_ratios(nb_family);
+  UniqueArray<Int32> min_ranks(nb_family);
+  UniqueArray<Int32> max_ranks(nb_family);
+  m_parallel_mng->computeMinMaxSum(ratios,min_ratios,max_ratios,sum_ratios,min_ranks,max_ranks);
+  const Real nb_rank = static_cast<Real>(m_parallel_mng->commSize());
+  for( Integer i=0; i<nb_family; ++i ){
+    info() << String::format("ConnectivityFragmentation: family={0} local={1} min={2}"
+                             " max={3} average={4} max_rank={5}",
+                             families[i]->name(),ratios[i],min_ratios[i],max_ratios[i],
+                             sum_ratios[i]/nb_rank,max_ranks[i]);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void MeshStats::
 _printInfo(const String& name,Int64 nb_local,
            Int64 nb_local_min,Integer min_rank,
@@ -76,6 +76,7 @@ class ARCANE_CORE_EXPORT MeshStats
   void _computeNeighboorsComm();
   void _dumpLegacyConnectivityMemoryUsage();
   void _dumpIncrementalConnectivityMemoryUsage();
+  void _dumpIncrementalConnectivityFragmentation();
   void _dumpCommunicatingRanks();
 };
 
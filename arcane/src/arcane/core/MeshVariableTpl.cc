@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshVariableTpl.cc                                          (C) 2000-2016 */
+/* MeshVariableTpl.cc                                          (C) 2000-2024 */
 /*                                                                           */
 /* Instanciation des classes templates des variables du maillage.            */
 /*---------------------------------------------------------------------------*/
@@ -28,6 +28,7 @@ template class ARCANE_TEMPLATE_EXPORT ItemVariableScalarRefT<Int16>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableScalarRefT<Int32>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableScalarRefT<Int64>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableScalarRefT<Real>;
+template class ARCANE_TEMPLATE_EXPORT ItemVariableScalarRefT<Float32>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableScalarRefT<Real2>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableScalarRefT<Real3>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableScalarRefT<Real2x2>;
@@ -38,6 +39,7 @@ template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableScalarRefT<Int16>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableScalarRefT<Int32>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableScalarRefT<Int64>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableScalarRefT<Real>;
+template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableScalarRefT<Float32>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableScalarRefT<Real2>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableScalarRefT<Real3>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableScalarRefT<Real2x2>;
@@ -64,6 +66,7 @@ ARCANE_INSTANTIATE_MESHVARIABLE_SCALAR(Int16);
 ARCANE_INSTANTIATE_MESHVARIABLE_SCALAR(Int32);
 ARCANE_INSTANTIATE_MESHVARIABLE_SCALAR(Int64);
 ARCANE_INSTANTIATE_MESHVARIABLE_SCALAR(Real);
+ARCANE_INSTANTIATE_MESHVARIABLE_SCALAR(Float32);
 ARCANE_INSTANTIATE_MESHVARIABLE_SCALAR(Real2);
 ARCANE_INSTANTIATE_MESHVARIABLE_SCALAR(Real2x2);
 ARCANE_INSTANTIATE_MESHVARIABLE_SCALAR(Real3);
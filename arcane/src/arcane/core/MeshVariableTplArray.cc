@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshVariableTplArray.cc                                     (C) 2000-2019 */
+/* MeshVariableTplArray.cc                                     (C) 2000-2024 */
 /*                                                                           */
 /* Instanciation des classes templates des variables tableaux du maillage.   */
 /*---------------------------------------------------------------------------*/
@@ -28,6 +28,7 @@ template class ARCANE_TEMPLATE_EXPORT ItemVariableArrayRefT<Int16>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableArrayRefT<Int32>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableArrayRefT<Int64>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableArrayRefT<Real>;
+template class ARCANE_TEMPLATE_EXPORT ItemVariableArrayRefT<Float32>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableArrayRefT<Real2>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableArrayRefT<Real3>;
 template class ARCANE_TEMPLATE_EXPORT ItemVariableArrayRefT<Real2x2>;
@@ -38,6 +39,7 @@ template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableArrayRefT<Int16>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableArrayRefT<Int32>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableArrayRefT<Int64>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableArrayRefT<Real>;
+template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableArrayRefT<Float32>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableArrayRefT<Real2>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableArrayRefT<Real3>;
 template class ARCANE_TEMPLATE_EXPORT ItemPartialVariableArrayRefT<Real2x2>;
@@ -64,6 +66,7 @@ ARCANE_INSTANTIATE_MESHVARIABLE_ARRAY(Int16);
 ARCANE_INSTANTIATE_MESHVARIABLE_ARRAY(Int32);
 ARCANE_INSTANTIATE_MESHVARIABLE_ARRAY(Int64);
 ARCANE_INSTANTIATE_MESHVARIABLE_ARRAY(Real);
+ARCANE_INSTANTIATE_MESHVARIABLE_ARRAY(Float32);
 ARCANE_INSTANTIATE_MESHVARIABLE_ARRAY(Real2);
 ARCANE_INSTANTIATE_MESHVARIABLE_ARRAY(Real2x2);
 ARCANE_INSTANTIATE_MESHVARIABLE_ARRAY(Real3);
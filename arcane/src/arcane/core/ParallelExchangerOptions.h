@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelExchangerOptions.h                                  (C) 2000-2022 */
+/* ParallelExchangerOptions.h                                  (C) 2000-2024 */
 /*                                                                           */
 /* Options pour modifier le comportement de 'IParallelExchanger'.            */
 /*---------------------------------------------------------------------------*/
@@ -61,6 +61,17 @@ class ARCANE_CORE_EXPORT ParallelExchangerOptions
   //! Niveau de verbosité
   Int32 verbosityLevel() const { return m_verbosity_level; };
 
+  /*!
+   * \brief Positionne la taille maximale (en octets) d'un échange collectif.
+   *
+   * En mode EM_Collective, si un rang doit envoyer ou recevoir plus que
+   * cette quantité de données, l'échange est découpé en plusieurs étapes.
+   * La valeur est limitée à 2^31-1, qui est aussi la valeur par défaut.
+   */
+  void setMaxCollectiveMessageSize(Int64 v) { m_max_collective_message_size = v; }
+  //! Taille maximale (en octets) d'un échange collectif
+  Int64 maxCollectiveMessageSize() const { return m_max_collective_message_size; };
+
  private:
 
   //! Mode d'échange.
@@ -71,6 +82,8 @@ class ARCANE_CORE_EXPORT ParallelExchangerOptions
 
   //! Niveau de verbosité
   Int32 m_verbosity_level = 0;
+  //! Taille maximale d'un échange collectif
+  Int64 m_max_collective_message_size = 2147483647;
 };
 
 /*---------------------------------------------------------------------------*/
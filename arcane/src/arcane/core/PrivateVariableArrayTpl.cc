@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* PrivateVariableArrayTpl.cc                                  (C) 2000-2016 */
+/* PrivateVariableArrayTpl.cc                                  (C) 2000-2024 */
 /*                                                                           */
 /* Instanciation des classes templates communes des variables du maillage.   */
 /*---------------------------------------------------------------------------*/
@@ -32,6 +32,7 @@ template class PrivateVariableArrayT<Int16>;
 template class PrivateVariableArrayT<Int32>;  
 template class PrivateVariableArrayT<Int64>; 
 template class PrivateVariableArrayT<Real>; 
+template class PrivateVariableArrayT<Float32>;
 template class PrivateVariableArrayT<Real2>; 
 template class PrivateVariableArrayT<Real2x2>; 
 template class PrivateVariableArrayT<Real3>; 
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* PrivateVariableScalarTpl.cc                                 (C) 2000-2011 */
+/* PrivateVariableScalarTpl.cc                                 (C) 2000-2024 */
 /*                                                                           */
 /* Instanciation des classes templates communes des variables du maillage.   */
 /*---------------------------------------------------------------------------*/
@@ -32,6 +32,7 @@ template class PrivateVariableScalarT<Int16>;
 template class PrivateVariableScalarT<Int32>;
 template class PrivateVariableScalarT<Int64>;
 template class PrivateVariableScalarT<Real>; 
+template class PrivateVariableScalarT<Float32>;
 template class PrivateVariableScalarT<Real2>; 
 template class PrivateVariableScalarT<Real2x2>; 
 template class PrivateVariableScalarT<Real3>; 
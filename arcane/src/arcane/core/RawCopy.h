@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -75,6 +75,14 @@ struct RawCopy<Real> {
   }
 };
 
+template<>
+struct RawCopy<Float32> {
+  typedef Float32 T;
+  inline static void copy(T & dst, const T & src) {
+    reinterpret_cast<Int32&>(dst) = reinterpret_cast<const Int32&>(src);
+  }
+};
+
 template<>
 struct RawCopy<Real2> {
   typedef Real2 T;
@@ -129,6 +137,12 @@ struct RawCopy<Real> {
   inline static void copy(T & dst, const T & src) { dst = src; }
 };
 
+template<>
+struct RawCopy<Float32> {
+  typedef Float32 T;
+  inline static void copy(T & dst, const T & src) { dst = src; }
+};
+
 template<>
 struct RawCopy<Real2> {
   typedef Real2 T;
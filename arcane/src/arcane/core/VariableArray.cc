@@ -689,6 +689,7 @@ value() -> ValueType&
 
 template class VariableArrayT<Byte>;
 template class VariableArrayT<Real>;
+template class VariableArrayT<Float32>;
 template class VariableArrayT<Int16>;
 template class VariableArrayT<Int32>;
 template class VariableArrayT<Int64>;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableDataTypeTraits.h                                    (C) 2000-2023 */
+/* VariableDataTypeTraits.h                                    (C) 2000-2024 */
 /*                                                                           */
 /* Classes spécialisées pour caractériser les types de données.              */
 /*---------------------------------------------------------------------------*/
@@ -196,6 +196,73 @@ class ARCANE_CORE_EXPORT VariableDataTypeTraitsT<Real>
   }
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Spécialisation de VariableDataTypeTraitsT pour le type \c Float32.
+ */
+template <>
+class ARCANE_CORE_EXPORT VariableDataTypeTraitsT<Float32>
+{
+ public:
+
+  //! Type du paramètre template
+  typedef Float32 Type;
+
+  //! Indique si le type peut être sauvé et relu
+  typedef TrueType HasDump;
+
+  //! Indique si le type peut être subir une réduction
+  typedef TrueType HasReduce;
+
+  //! Indique si le type peut être subir une réduction Min/Max
+  typedef TrueType HasReduceMinMax;
+
+  //! Indique si le type est numérique
+  typedef TrueType IsNumeric;
+
+  typedef Float32 BasicType;
+
+  static constexpr Integer nbBasicType() { return 1; }
+
+ public:
+
+  //! Retourne le nom du type de la variable
+  static constexpr const char* typeName() { return "Float32"; }
+  //! Retourne le type de la variable
+  static constexpr eDataType type() { return DT_Float32; }
+  //! Ecrit dans la chaîne \a s la valeur de \a v
+  static void dumpValue(String& s, const Type& v) { builtInDumpValue(s, v); }
+  /*!
+   * \brief Stocke la conversion de la chaîne \a s en le type #Type dans \a v
+   * \retval true en cas d'échec,
+   * \retval false si la conversion est un succès
+   */
+  static bool getValue(Type& v, const String& s) { return builtInGetValue(v, s); }
+
+  static bool verifDifferent(Float32 v1, Float32 v2, Float32& diff, bool is_nan_equal = false)
+  {
+    if (is_nan_equal) {
+      if (std::isnan(v1) && std::isnan(v2))
+        return false;
+    }
+    if (v1 != v2) {
+      if (math::abs(v1) < 1.e-30f)
+        diff = v1 - v2;
+      else
+        diff = (v1 - v2) / v1;
+      return true;
+    }
+    return false;
+  }
+
+  static Float32 normeMax(Float32 v)
+  {
+    return math::abs(v);
+  }
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
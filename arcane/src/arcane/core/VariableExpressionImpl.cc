@@ -15,12 +15,14 @@
 #include "arcane/utils/ArcanePrecomp.h"
 
 #include "arcane/IVariableAccessor.h"
+#include "arcane/IData.h"
 #include "arcane/ISubDomain.h"
 #include "arcane/ArcaneException.h"
 #include "arcane/VariableExpressionImpl.h"
 
 #include "arcane/expr/OperatorMng.h"
 #include "arcane/expr/BadOperationException.h"
+#include "arcane/expr/ExpressionProgram.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -47,6 +49,8 @@ VariableExpressionImpl(IVariable* var)
 void VariableExpressionImpl::
 assign(IExpressionImpl* expr)
 {
+  if (_fusedAssign(expr,nullptr))
+    return;
   ExpressionResult result(m_variable);
   expr->apply(&result);
 }
@@ -57,6 +61,8 @@ assign(IExpressionImpl* expr)
 void VariableExpressionImpl::
 assign(IExpressionImpl* expr, IntegerConstArrayView indices)
 {
+  if (_fusedAssign(expr,&indices))
+    return;
   ExpressionResult result(indices);
   result.allocate(VariantBase::fromDataType(m_variable->dataType()));
   expr->apply(&result);
@@ -75,6 +81,58 @@ apply(ExpressionResult* result)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+bool VariableExpressionImpl::
+compile(ExpressionProgram& program)
+{
+  IArrayDataT<Real>* true_data = _realData();
+  if (!true_data)
+    return false;
+  return program.addArray(true_data->view());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Données de la variable si elle est de type réel et de dimension 1.
+ *
+ * Retourne nullptr sinon.
+ */
+IArrayDataT<Real>* VariableExpressionImpl::
+_realData() const
+{
+  if (m_variable->dataType()!=DT_Real || m_variable->dimension()!=1)
+    return nullptr;
+  return dynamic_cast<IArrayDataT<Real>*>(m_variable->data());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Affecte à la variable l'expression \a expr via un ExpressionProgram.
+ *
+ * Retourne \a false si l'expression ou la variable ne sont pas supportées
+ * et qu'il faut utiliser l'évaluation classique.
+ */
+bool VariableExpressionImpl::
+_fusedAssign(IExpressionImpl* expr, const IntegerConstArrayView* indices)
+{
+  IArrayDataT<Real>* true_data = _realData();
+  if (!true_data)
+    return false;
+  ExpressionProgram program;
+  if (!program.compile(expr))
+    return false;
+  ArrayView<Real> values = true_data->view();
+  if (indices)
+    program.evaluate(values,*indices);
+  else
+    program.evaluate(values);
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 Integer VariableExpressionImpl::
 vectorSize() const
 {
@@ -46,8 +46,12 @@ class VariableExpressionImpl
   virtual void assign(IExpressionImpl* expr);
   virtual void assign(IExpressionImpl*, IntegerConstArrayView indices);
   virtual void apply(ExpressionResult* result);
+  virtual bool compile(ExpressionProgram& program);
   virtual Integer vectorSize() const;
   
+ private:
+  IArrayDataT<Real>* _realData() const;
+  bool _fusedAssign(IExpressionImpl* expr, const IntegerConstArrayView* indices);
  private:
   IVariable* m_variable;
   VariableOperator* m_op;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableInfo.cc                                             (C) 2000-2020 */
+/* VariableInfo.cc                                             (C) 2000-2024 */
 /*                                                                           */
 /* Infos caractérisant une variable.                                         */
 /*---------------------------------------------------------------------------*/
@@ -50,6 +50,10 @@ _internalGetStorageTypeInfo(eDataType data_type,Integer dimension,Integer multi_
      nb_basic = DataTypeTraitsT<Real>::nbBasicType();
      basic_data_type = DataTypeTraitsT<Real>::basicDataType();
      break;
+   case DT_Float32:
+     nb_basic = DataTypeTraitsT<Float32>::nbBasicType();
+     basic_data_type = DataTypeTraitsT<Float32>::basicDataType();
+     break;
    case DT_Real2:
      nb_basic = DataTypeTraitsT<Real2>::nbBasicType();
      basic_data_type = DataTypeTraitsT<Real2>::basicDataType();
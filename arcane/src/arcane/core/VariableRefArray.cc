@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableRefArray.cc                                         (C) 2000-2021 */
+/* VariableRefArray.cc                                         (C) 2000-2024 */
 /*                                                                           */
 /* Référence à une variable tableau 1D.                                      */
 /*---------------------------------------------------------------------------*/
@@ -204,6 +204,7 @@ _internalTrueData()
 
 template class VariableRefArrayT<Byte>;
 template class VariableRefArrayT<Real>;
+template class VariableRefArrayT<Float32>;
 template class VariableRefArrayT<Int16>;
 template class VariableRefArrayT<Int32>;
 template class VariableRefArrayT<Int64>;
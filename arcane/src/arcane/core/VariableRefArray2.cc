@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableRefArray2.cc                                        (C) 2000-2021 */
+/* VariableRefArray2.cc                                        (C) 2000-2024 */
 /*                                                                           */
 /* Classe gérant une référence sur une variable tableau 2D.                  */
 /*---------------------------------------------------------------------------*/
@@ -202,6 +202,7 @@ _internalTrueData()
 
 template class VariableRefArray2T<Byte>;
 template class VariableRefArray2T<Real>;
+template class VariableRefArray2T<Float32>;
 template class VariableRefArray2T<Int16>;
 template class VariableRefArray2T<Int32>;
 template class VariableRefArray2T<Int64>;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableRefScalar.cc                                        (C) 2000-2023 */
+/* VariableRefScalar.cc                                        (C) 2000-2024 */
 /*                                                                           */
 /* Référence à une variable scalaire.                                        */
 /*---------------------------------------------------------------------------*/
@@ -183,6 +183,7 @@ swapValues(VariableRefScalarT<DataType>& rhs)
 
 template class VariableRefScalarT<Byte>;
 template class VariableRefScalarT<Real>;
+template class VariableRefScalarT<Float32>;
 template class VariableRefScalarT<Int16>;
 template class VariableRefScalarT<Int32>;
 template class VariableRefScalarT<Int64>;
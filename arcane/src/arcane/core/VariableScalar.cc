@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableScalar.cc                                           (C) 2000-2023 */
+/* VariableScalar.cc                                           (C) 2000-2024 */
 /*                                                                           */
 /* Variable scalaire.                                                        */
 /*---------------------------------------------------------------------------*/
@@ -351,6 +351,7 @@ swapValues(ThatClass& rhs)
 
 template class VariableScalarT<Byte>;
 template class VariableScalarT<Real>;
+template class VariableScalarT<Float32>;
 template class VariableScalarT<Int16>;
 template class VariableScalarT<Int32>;
 template class VariableScalarT<Int64>;
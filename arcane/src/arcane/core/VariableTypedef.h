@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableTypedef.h                                           (C) 2000-2006 */
+/* VariableTypedef.h                                           (C) 2000-2024 */
 /*                                                                           */
 /* Déclarations des typedefs des variables.                                  */
 /*---------------------------------------------------------------------------*/
@@ -63,6 +63,12 @@ typedef VariableRefScalarT<Real> VariableScalarReal;
 */
 typedef VariableRefScalarT<Int16> VariableScalarInt16;
 
+/*!
+  \ingroup Variable
+  \brief Variable scalaire de type réel simple précision
+*/
+typedef VariableRefScalarT<Float32> VariableScalarFloat32;
+
 /*!
   \ingroup Variable
   \brief Variable scalaire de type entier 32 bits
@@ -139,6 +145,12 @@ typedef VariableRefArrayT<Real> VariableArrayReal;
 */
 typedef VariableRefArrayT<Int16> VariableArrayInt16;
 
+/*!
+  \ingroup Variable
+  \brief Variable tableau de type réels simple précision
+*/
+typedef VariableRefArrayT<Float32> VariableArrayFloat32;
+
 /*!
   \ingroup Variable
   \brief Variable tableau de type entier 32 bits
@@ -221,6 +233,12 @@ typedef VariableRefArray2T<Integer> VariableArray2Integer;
 */
 typedef VariableRefArray2T<Int16> VariableArray2Int16;
 
+/*!
+  \ingroup Variable
+  \brief Variable tableau bi-dimensionnel de type réels simple précision
+*/
+typedef VariableRefArray2T<Float32> VariableArray2Float32;
+
 /*!
   \ingroup Variable
   \brief Variable tableau à deux dimensions de type entier 32 bits
@@ -559,6 +577,50 @@ typedef MeshVariableScalarRefT<Particle,Int16> VariableParticleInt16;
 */
 typedef MeshVariableScalarRefT<DoF,Int16> VariableDoFInt16;
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+  \ingroup Variable
+  \brief Grandeur de type réel simple précision
+*/
+typedef ItemVariableScalarRefT<Float32> VariableItemFloat32;
+
+/*!
+  \ingroup Variable
+  \brief Grandeur au noeud de type réel simple précision
+*/
+typedef MeshVariableScalarRefT<Node,Float32> VariableNodeFloat32;
+
+/*!
+  \ingroup Variable
+  \brief Grandeur aux arêtes de type réel simple précision
+*/
+typedef MeshVariableScalarRefT<Edge,Float32> VariableEdgeFloat32;
+
+/*!
+  \ingroup Variable
+  \brief Grandeur aux faces de type réel simple précision
+*/
+typedef MeshVariableScalarRefT<Face,Float32> VariableFaceFloat32;
+
+/*!
+  \ingroup Variable
+  \brief Grandeur au centre des mailles de type réel simple précision
+*/
+typedef MeshVariableScalarRefT<Cell,Float32> VariableCellFloat32;
+
+/*!
+  \ingroup Variable
+  \brief Grandeur particulaire de type réel simple précision
+*/
+typedef MeshVariableScalarRefT<Particle,Float32> VariableParticleFloat32;
+
+/*!
+  \ingroup Variable
+  \brief Grandeur de DDL de type réel simple précision
+*/
+typedef MeshVariableScalarRefT<DoF,Float32> VariableDoFFloat32;
+
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -988,6 +1050,30 @@ typedef MeshVariableArrayRefT<Cell,Int16> VariableCellArrayInt16;
 */
 typedef MeshVariableArrayRefT<Particle,Int16> VariableParticleArrayInt16;
 
+/*!
+  \ingroup Variable
+  \brief Grandeur au noeud de type tableau de réels simple précision
+*/
+typedef MeshVariableArrayRefT<Node,Float32> VariableNodeArrayFloat32;
+
+/*!
+  \ingroup Variable
+  \brief Grandeur aux faces de type tableau de réels simple précision
+*/
+typedef MeshVariableArrayRefT<Face,Float32> VariableFaceArrayFloat32;
+
+/*!
+  \ingroup Variable
+  \brief Grandeur au centre des mailles de type tableau de réels simple précision
+*/
+typedef MeshVariableArrayRefT<Cell,Float32> VariableCellArrayFloat32;
+
+/*!
+  \ingroup Variable
+  \brief Grandeur particulaire de type tableau de réels simple précision
+*/
+typedef MeshVariableArrayRefT<Particle,Float32> VariableParticleArrayFloat32;
+
 
 /*!
   \ingroup Variable
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DataTypeTraits.h                                            (C) 2000-2020 */
+/* DataTypeTraits.h                                            (C) 2000-2024 */
 /*                                                                           */
 /* Caractéristiques d'un type de donnée.                                     */
 /*---------------------------------------------------------------------------*/
@@ -163,6 +163,45 @@ class DataTypeTraitsT<Real>
   static constexpr Type defaultValue() { return 0.0; }
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Spécialisation de DataTypeTraitsT pour le type \c Float32.
+ */
+template<>
+class DataTypeTraitsT<Float32>
+{
+ public:
+
+  //! Type de donnée
+  typedef Float32 Type;
+
+  //! Type de donnée de base de ce type de donnée
+  typedef Float32 BasicType;
+
+  //! Nombre d'éléments du type de base
+  static constexpr int nbBasicType() { return 1; }
+
+  //! Nom du type de donnée
+  static constexpr const char* name() { return "Float32"; }
+
+  //! Type de donnée
+  static constexpr eDataType type() { return DT_Float32; }
+
+  //! Type de donnée de base.
+  static constexpr eBasicDataType basicDataType() { return eBasicDataType::Float32; }
+
+  //! Type du proxy associé
+  typedef BuiltInProxy<Float32> ProxyType;
+
+  //! Remplit les éléments de \a values avec des Nan.
+  static void fillNan(ArrayView<Type> values);
+
+  //! Valeur par défaut.
+  static constexpr Type defaultValue() { return 0.0f; }
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -232,6 +232,15 @@ fillNan(ArrayView<Type> ptr)
   _fillWithNan(ptr);
 }
 
+void DataTypeTraitsT<Float32>::
+fillNan(ArrayView<Type> ptr)
+{
+  Float32 v = std::numeric_limits<Float32>::signaling_NaN();
+  Integer n = ptr.size();
+  for (Integer i = 0; i < n; ++i)
+    ptr[i] = v;
+}
+
 void DataTypeTraitsT<Real2>::
 fillNan(ArrayView<Type> ptr)
 {
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IDataOperation.h                                            (C) 2000-2020 */
+/* IDataOperation.h                                            (C) 2000-2024 */
 /*                                                                           */
 /* Interface d'une opération sur une donnée.                                 */
 /*---------------------------------------------------------------------------*/
@@ -43,6 +43,7 @@ class IDataOperation
 
   virtual void apply(ByteArrayView output,ByteConstArrayView input) =0;
   virtual void apply(RealArrayView output,RealConstArrayView input) =0;
+  virtual void apply(ArrayView<Float32> output,ConstArrayView<Float32> input) =0;
   virtual void apply(Int16ArrayView output,Int16ConstArrayView input) =0;
   virtual void apply(Int32ArrayView output,Int32ConstArrayView input) =0;
   virtual void apply(Int64ArrayView output,Int64ConstArrayView input) =0;
@@ -53,6 +54,7 @@ class IDataOperation
 
   virtual void applySpan(Span<Byte> output,Span<const Byte> input) =0;
   virtual void applySpan(Span<Real> output,Span<const Real> input) =0;
+  virtual void applySpan(Span<Float32> output,Span<const Float32> input) =0;
   virtual void applySpan(Span<Int16> output,Span<const Int16> input) =0;
   virtual void applySpan(Span<Int32> output,Span<const Int32> input) =0;
   virtual void applySpan(Span<Int64> output,Span<const Int64> input) =0;
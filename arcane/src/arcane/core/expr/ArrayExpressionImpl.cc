@@ -19,6 +19,7 @@
 #include "arcane/expr/ArrayExpressionImpl.h"
 #include "arcane/expr/OperatorMng.h"
 #include "arcane/expr/BadOperationException.h"
+#include "arcane/expr/ExpressionProgram.h"
 
 #include "arcane/MathUtils.h"
 
@@ -134,6 +135,15 @@ ArrayExpressionImpl::
 void ArrayExpressionImpl::
 assign(IExpressionImpl* expr)
 {
+  if (m_variant->type()==VariantBase::TReal){
+    ExpressionProgram program;
+    if (program.compile(expr)){
+      ArrayView<Real> values;
+      m_variant->value(values);
+      program.evaluate(values);
+      return;
+    }
+  }
   ExpressionResult result(m_variant);
   expr->apply(&result);
 }
@@ -144,6 +154,15 @@ assign(IExpressionImpl* expr)
 void ArrayExpressionImpl::
 assign(IExpressionImpl* expr,ConstArrayView<Integer> indices)
 {
+  if (m_variant->type()==VariantBase::TReal){
+    ExpressionProgram program;
+    if (program.compile(expr)){
+      ArrayView<Real> values;
+      m_variant->value(values);
+      program.evaluate(values,indices);
+      return;
+    }
+  }
   ExpressionResult result(indices);
   result.allocate(m_variant->type());
   expr->apply(&result);
@@ -162,6 +181,19 @@ apply(ExpressionResult* result)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+bool ArrayExpressionImpl::
+compile(ExpressionProgram& program)
+{
+  if (m_variant->type()!=VariantBase::TReal)
+    return false;
+  ArrayView<Real> values;
+  m_variant->value(values);
+  return program.addArray(values);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 Integer ArrayExpressionImpl::
 vectorSize() const
 {
@@ -47,6 +47,7 @@ class ArrayExpressionImpl
   virtual void assign(IExpressionImpl* expr);
   virtual void assign(IExpressionImpl*, ConstArrayView<Integer> indices);
   virtual void apply(ExpressionResult* result);
+  virtual bool compile(ExpressionProgram& program);
   virtual Integer vectorSize() const;
   
  private:
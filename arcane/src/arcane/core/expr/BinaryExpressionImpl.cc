@@ -16,6 +16,7 @@
 #include "arcane/expr/BinaryExpressionImpl.h"
 #include "arcane/expr/OperatorMng.h"
 #include "arcane/expr/BadOperationException.h"
+#include "arcane/expr/ExpressionProgram.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -90,6 +91,17 @@ apply(ExpressionResult* result)
   */
 }
 
+
+bool BinaryExpressionImpl::
+compile(ExpressionProgram& program)
+{
+  if (!m_first->compile(program))
+    return false;
+  if (!m_second->compile(program))
+    return false;
+  return program.addBinary(m_operation);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
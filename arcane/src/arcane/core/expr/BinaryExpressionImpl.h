@@ -67,6 +67,7 @@ class BinaryExpressionImpl
   virtual void assign(IExpressionImpl*) {}
   virtual void assign(IExpressionImpl*, IntegerConstArrayView) {}
   virtual void apply(ExpressionResult* result);
+  virtual bool compile(ExpressionProgram& program);
   virtual Integer vectorSize() const { return 0; }
   String operationName() const { return operationName(m_operation); }
   static String operationName(eOperationType type);
@@ -47,6 +47,7 @@ class ARCANE_EXPR_EXPORT ExpressionImpl
   virtual void removeRef();
   virtual void setTrace(bool v){ m_do_trace = v; }
   virtual void dumpIf(IExpressionImpl* test_expr,Array<Expression>& exprs);
+  virtual bool compile(ExpressionProgram&) { return false; }
 
  protected:
 
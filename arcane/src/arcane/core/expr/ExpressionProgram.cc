@@ -0,0 +1,372 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* ExpressionProgram.cc                                        (C) 2000-2024 */
+/*                                                                           */
+/* Évaluation fusionnée d'une expression par blocs.                          */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/expr/ExpressionProgram.h"
+
+#include "arcane/utils/FatalErrorException.h"
+
+#include "arcane/expr/BadOperandException.h"
+#include "arcane/Concurrency.h"
+
+#include <cmath>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace
+{
+
+#define ARCANE_EXPR_UNARY_CASE(name,expression) \
+  case UnaryExpressionImpl::name: \
+    for (Int32 i = 0; i < n; ++i) { \
+      Real x = a[i]; \
+      a[i] = expression; \
+    } \
+    break;
+
+void
+_applyUnary(Int32 op, Real* ARCANE_RESTRICT a, Int32 n)
+{
+  switch (op) {
+    ARCANE_EXPR_UNARY_CASE(UnarySubstract, -x)
+    ARCANE_EXPR_UNARY_CASE(Inverse, 1.0 / x)
+    ARCANE_EXPR_UNARY_CASE(Acos, std::acos(x))
+    ARCANE_EXPR_UNARY_CASE(Asin, std::asin(x))
+    ARCANE_EXPR_UNARY_CASE(Atan, std::atan(x))
+    ARCANE_EXPR_UNARY_CASE(Ceil, std::ceil(x))
+    ARCANE_EXPR_UNARY_CASE(Cos, std::cos(x))
+    ARCANE_EXPR_UNARY_CASE(Cosh, std::cosh(x))
+    ARCANE_EXPR_UNARY_CASE(Exp, std::exp(x))
+    ARCANE_EXPR_UNARY_CASE(Fabs, std::fabs(x))
+    ARCANE_EXPR_UNARY_CASE(Floor, std::floor(x))
+    ARCANE_EXPR_UNARY_CASE(Log, std::log(x))
+    ARCANE_EXPR_UNARY_CASE(Log10, std::log10(x))
+    ARCANE_EXPR_UNARY_CASE(Sin, std::sin(x))
+    ARCANE_EXPR_UNARY_CASE(Sinh, std::sinh(x))
+    ARCANE_EXPR_UNARY_CASE(Sqrt, std::sqrt(x))
+    ARCANE_EXPR_UNARY_CASE(Tan, std::tan(x))
+    ARCANE_EXPR_UNARY_CASE(Tanh, std::tanh(x))
+  default:
+    ARCANE_FATAL("Invalid unary operation '{0}'", op);
+  }
+}
+
+#undef ARCANE_EXPR_UNARY_CASE
+
+// Applique 'a[i] = op(a[i],b(i))' où 'b(i)' vaut soit 'b[i]' soit une constante.
+#define ARCANE_EXPR_BINARY_CASE(name,expression) \
+  case BinaryExpressionImpl::name: \
+    for (Int32 i = 0; i < n; ++i) { \
+      Real x = a[i]; \
+      Real y = b(i); \
+      a[i] = expression; \
+    } \
+    break;
+
+template <typename Getter> void
+_applyBinary(Int32 op, Real* ARCANE_RESTRICT a, const Getter& b, Int32 n)
+{
+  switch (op) {
+    ARCANE_EXPR_BINARY_CASE(Add, x + y)
+    ARCANE_EXPR_BINARY_CASE(Substract, x - y)
+    ARCANE_EXPR_BINARY_CASE(Multiply, x * y)
+    ARCANE_EXPR_BINARY_CASE(Divide, x / y)
+    ARCANE_EXPR_BINARY_CASE(Minimum, (x < y) ? x : y)
+    ARCANE_EXPR_BINARY_CASE(Maximum, (x < y) ? y : x)
+    ARCANE_EXPR_BINARY_CASE(Pow, std::pow(x, y))
+    ARCANE_EXPR_BINARY_CASE(LessThan, (x < y) ? 1.0 : 0.0)
+    ARCANE_EXPR_BINARY_CASE(GreaterThan, (x > y) ? 1.0 : 0.0)
+    ARCANE_EXPR_BINARY_CASE(LessOrEqualThan, (x <= y) ? 1.0 : 0.0)
+    ARCANE_EXPR_BINARY_CASE(GreaterOrEqualThan, (x >= y) ? 1.0 : 0.0)
+    ARCANE_EXPR_BINARY_CASE(Or, (x != 0.0 || y != 0.0) ? 1.0 : 0.0)
+    ARCANE_EXPR_BINARY_CASE(And, (x != 0.0 && y != 0.0) ? 1.0 : 0.0)
+    ARCANE_EXPR_BINARY_CASE(Equal, (x == y) ? 1.0 : 0.0)
+  default:
+    ARCANE_FATAL("Invalid binary operation '{0}'", op);
+  }
+}
+
+#undef ARCANE_EXPR_BINARY_CASE
+
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool ExpressionProgram::
+compile(IExpressionImpl* expr)
+{
+  m_instructions.clear();
+  m_constants.clear();
+  m_arrays.clear();
+  m_is_bool_stack.clear();
+  m_max_depth = 0;
+  m_is_valid = false;
+  if (!expr)
+    return false;
+  if (!expr->compile(*this))
+    return false;
+  // Le résultat doit être une unique valeur réelle.
+  if (m_is_bool_stack.size() != 1 || m_is_bool_stack[0])
+    return false;
+  m_is_valid = true;
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ExpressionProgram::
+_push(bool is_bool)
+{
+  m_is_bool_stack.add(is_bool);
+  m_max_depth = math::max(m_max_depth, m_is_bool_stack.size());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool ExpressionProgram::
+addConstant(Real value)
+{
+  m_instructions.add(Instruction{ OpConstant, 0, m_constants.size() });
+  m_constants.add(value);
+  _push(false);
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool ExpressionProgram::
+addArray(ConstArrayView<Real> values)
+{
+  m_instructions.add(Instruction{ OpLoad, 0, m_arrays.size() });
+  m_arrays.add(values);
+  _push(false);
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool ExpressionProgram::
+addUnary(UnaryExpressionImpl::eOperationType op)
+{
+  if (m_is_bool_stack.empty() || m_is_bool_stack.back())
+    return false;
+  m_instructions.add(Instruction{ OpUnary, op, 0 });
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool ExpressionProgram::
+addBinary(BinaryExpressionImpl::eOperationType op)
+{
+  Int32 depth = m_is_bool_stack.size();
+  if (depth < 2)
+    return false;
+  bool is_bool1 = m_is_bool_stack[depth - 2];
+  bool is_bool2 = m_is_bool_stack[depth - 1];
+  bool is_bool_result = false;
+  switch (op) {
+  case BinaryExpressionImpl::Or:
+  case BinaryExpressionImpl::And:
+    if (!is_bool1 || !is_bool2)
+      return false;
+    is_bool_result = true;
+    break;
+  case BinaryExpressionImpl::LessThan:
+  case BinaryExpressionImpl::GreaterThan:
+  case BinaryExpressionImpl::LessOrEqualThan:
+  case BinaryExpressionImpl::GreaterOrEqualThan:
+  case BinaryExpressionImpl::Equal:
+    is_bool_result = true;
+    [[fallthrough]];
+  default:
+    if (is_bool1 || is_bool2)
+      return false;
+    break;
+  }
+  m_is_bool_stack.popBack();
+  m_is_bool_stack.back() = is_bool_result;
+
+  // Si le second opérande est une constante, l'utilise directement
+  // plutôt que de remplir un bloc de la pile avec sa valeur.
+  Instruction& last = m_instructions.back();
+  if (last.code == OpConstant) {
+    last.code = OpBinaryConstant;
+    last.operation = op;
+    return true;
+  }
+  m_instructions.add(Instruction{ OpBinary, op, 0 });
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool ExpressionProgram::
+addSelect()
+{
+  Int32 depth = m_is_bool_stack.size();
+  if (depth < 3)
+    return false;
+  if (!m_is_bool_stack[depth - 3] || m_is_bool_stack[depth - 2] || m_is_bool_stack[depth - 1])
+    return false;
+  m_is_bool_stack.popBack();
+  m_is_bool_stack.popBack();
+  m_is_bool_stack.back() = false;
+  m_instructions.add(Instruction{ OpSelect, 0, 0 });
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ExpressionProgram::
+evaluate(ArrayView<Real> result) const
+{
+  Integer n = result.size();
+  for (const ConstArrayView<Real>& a : m_arrays)
+    if (a.size() < n)
+      throw BadOperandException("ExpressionProgram::evaluate");
+  _evaluate(n, nullptr, result.data());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ExpressionProgram::
+evaluate(ArrayView<Real> result, ConstArrayView<Integer> indices) const
+{
+  Integer n = result.size();
+  for (const ConstArrayView<Real>& a : m_arrays)
+    n = math::min(n, a.size());
+  for (Integer index : indices)
+    if (index < 0 || index >= n)
+      throw BadOperandException("ExpressionProgram::evaluate");
+  _evaluate(indices.size(), indices.data(), result.data());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ExpressionProgram::
+_evaluate(Integer n, const Integer* indices, Real* result) const
+{
+  if (!m_is_valid)
+    ARCANE_FATAL("Invalid expression program (compile() failed or not called)");
+  if (n == 0)
+    return;
+  const Integer nb_block = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  const Integer stack_size = m_max_depth * BLOCK_SIZE;
+
+  auto func = [=](Integer begin_block, Integer nb_local_block) {
+    UniqueArray<Real> stack(stack_size);
+    for (Integer b = begin_block, end_block = begin_block + nb_local_block; b < end_block; ++b) {
+      Integer first = b * BLOCK_SIZE;
+      Int32 size = static_cast<Int32>(math::min(n - first, static_cast<Integer>(BLOCK_SIZE)));
+      _executeBlock(first, size, indices, result, stack.data());
+    }
+  };
+
+  if (nb_block == 1)
+    func(0, 1);
+  else
+    arcaneParallelFor(0, nb_block, func);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ExpressionProgram::
+_executeBlock(Integer first, Int32 n, const Integer* indices, Real* result, Real* stack) const
+{
+  // Pointeur sur le premier élément libre de la pile.
+  Real* top = stack;
+  for (const Instruction& inst : m_instructions) {
+    switch (inst.code) {
+    case OpConstant: {
+      Real* ARCANE_RESTRICT out = top;
+      const Real v = m_constants[inst.operand];
+      for (Int32 i = 0; i < n; ++i)
+        out[i] = v;
+      top += BLOCK_SIZE;
+    } break;
+    case OpLoad: {
+      Real* ARCANE_RESTRICT out = top;
+      const Real* ARCANE_RESTRICT in = m_arrays[inst.operand].data();
+      if (indices) {
+        const Integer* idx = indices + first;
+        for (Int32 i = 0; i < n; ++i)
+          out[i] = in[idx[i]];
+      }
+      else {
+        in += first;
+        for (Int32 i = 0; i < n; ++i)
+          out[i] = in[i];
+      }
+      top += BLOCK_SIZE;
+    } break;
+    case OpUnary:
+      _applyUnary(inst.operation, top - BLOCK_SIZE, n);
+      break;
+    case OpBinary: {
+      top -= BLOCK_SIZE;
+      const Real* ARCANE_RESTRICT b = top;
+      _applyBinary(inst.operation, top - BLOCK_SIZE, [=](Int32 i) { return b[i]; }, n);
+    } break;
+    case OpBinaryConstant: {
+      const Real v = m_constants[inst.operand];
+      _applyBinary(inst.operation, top - BLOCK_SIZE, [=](Int32) { return v; }, n);
+    } break;
+    case OpSelect: {
+      top -= 2 * BLOCK_SIZE;
+      Real* ARCANE_RESTRICT test = top - BLOCK_SIZE;
+      const Real* ARCANE_RESTRICT iftrue = top;
+      const Real* ARCANE_RESTRICT iffalse = top + BLOCK_SIZE;
+      for (Int32 i = 0; i < n; ++i)
+        test[i] = (test[i] != 0.0) ? iftrue[i] : iffalse[i];
+    } break;
+    }
+  }
+
+  const Real* ARCANE_RESTRICT values = stack;
+  if (indices) {
+    const Integer* idx = indices + first;
+    for (Int32 i = 0; i < n; ++i)
+      result[idx[i]] = values[i];
+  }
+  else {
+    Real* ARCANE_RESTRICT out = result + first;
+    for (Int32 i = 0; i < n; ++i)
+      out[i] = values[i];
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
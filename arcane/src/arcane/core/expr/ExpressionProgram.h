@@ -0,0 +1,155 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* ExpressionProgram.h                                         (C) 2000-2024 */
+/*                                                                           */
+/* Évaluation fusionnée d'une expression par blocs.                          */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_EXPR_EXPRESSIONPROGRAM_H
+#define ARCANE_EXPR_EXPRESSIONPROGRAM_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Array.h"
+
+#include "arcane/expr/UnaryExpressionImpl.h"
+#include "arcane/expr/BinaryExpressionImpl.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Programme d'évaluation fusionnée d'une expression réelle.
+ *
+ * L'évaluation classique d'une expression (via IExpressionImpl::apply())
+ * évalue complètement chaque sous-expression dans un tableau temporaire
+ * de la taille du résultat avant de les combiner. Pour une expression
+ * de N noeuds, cela fait N parcours de la mémoire et N tableaux temporaires.
+ *
+ * Cette classe compile l'arbre d'une expression en une suite
+ * d'instructions pour une machine à pile. Le programme est ensuite
+ * exécuté par blocs de BLOCK_SIZE éléments: chaque instruction est
+ * appliquée sur un bloc avant de passer à la suivante, ce qui permet
+ * de conserver les valeurs intermédiaires dans le cache et de
+ * vectoriser les boucles sur un bloc. Les blocs sont répartis entre
+ * les tâches via arcaneParallelFor().
+ *
+ * Seules les expressions dont les feuilles sont des réels (variables
+ * scalaires, tableaux ou littéraux) sont supportées. Les résultats des
+ * comparaisons sont conservés sous forme de réels valant 0.0 ou 1.0 et
+ * ne peuvent être utilisés que comme argument d'une opération logique
+ * ou comme test d'une expression conditionnelle, comme pour l'évaluation
+ * classique. Si l'expression n'est pas supportée, compile() retourne
+ * \a false et il faut utiliser l'évaluation classique.
+ */
+class ARCANE_EXPR_EXPORT ExpressionProgram
+{
+ public:
+
+  //! Nombre d'éléments traités par bloc
+  static constexpr Int32 BLOCK_SIZE = 512;
+
+ private:
+
+  enum eOpCode
+  {
+    OpConstant,
+    OpLoad,
+    OpUnary,
+    OpBinary,
+    OpBinaryConstant,
+    OpSelect
+  };
+
+  struct Instruction
+  {
+    eOpCode code;
+    Int32 operation;
+    Int32 operand;
+  };
+
+ public:
+
+  /*!
+   * \brief Compile l'expression \a expr.
+   *
+   * Retourne \a false si l'expression ne peut pas être évaluée par ce
+   * programme.
+   */
+  bool compile(IExpressionImpl* expr);
+
+  //! Indique si le programme est valide
+  bool isValid() const { return m_is_valid; }
+
+  //! Nombre d'instructions du programme
+  Int32 nbInstruction() const { return m_instructions.size(); }
+
+  /*!
+   * \brief Évalue le programme pour les éléments de \a result.
+   *
+   * Les tableaux utilisés par le programme doivent avoir au moins
+   * autant d'éléments que \a result.
+   */
+  void evaluate(ArrayView<Real> result) const;
+
+  /*!
+   * \brief Évalue le programme pour les éléments d'indices \a indices.
+   *
+   * Pour chaque \a i, la valeur pour l'indice \a indices[i] est
+   * rangée dans \a result[indices[i]]. Les indices doivent être valides
+   * pour \a result et pour tous les tableaux utilisés par le programme.
+   */
+  void evaluate(ArrayView<Real> result, ConstArrayView<Integer> indices) const;
+
+ public:
+
+  //! \name Construction du programme (utilisé par les IExpressionImpl)
+  //@{
+  //! Empile la constante \a value
+  bool addConstant(Real value);
+  //! Empile les valeurs du tableau \a values
+  bool addArray(ConstArrayView<Real> values);
+  //! Applique l'opération unaire \a op au sommet de la pile
+  bool addUnary(UnaryExpressionImpl::eOperationType op);
+  //! Applique l'opération binaire \a op aux deux valeurs au sommet de la pile
+  bool addBinary(BinaryExpressionImpl::eOperationType op);
+  //! Sélectionne suivant le test en troisième position de la pile une des deux valeurs au sommet
+  bool addSelect();
+  //@}
+
+ private:
+
+  UniqueArray<Instruction> m_instructions;
+  UniqueArray<Real> m_constants;
+  UniqueArray<ConstArrayView<Real>> m_arrays;
+  //! Indique pour chaque valeur de la pile lors de la compilation s'il s'agit d'un booléen
+  UniqueArray<bool> m_is_bool_stack;
+  Int32 m_max_depth = 0;
+  bool m_is_valid = false;
+
+ private:
+
+  void _evaluate(Integer n, const Integer* indices, Real* result) const;
+  void _executeBlock(Integer first, Int32 size, const Integer* indices,
+                     Real* result, Real* stack) const;
+  void _push(bool is_bool);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
@@ -26,6 +26,7 @@ ARCANE_BEGIN_NAMESPACE
 
 class ExpressionResult;
 class Expression;
+class ExpressionProgram;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -52,6 +53,13 @@ class ARCANE_EXPR_EXPORT IExpressionImpl
 
   virtual void dumpIf(IExpressionImpl* test_expr,Array<Expression>& exprs) =0;
   virtual void apply(ExpressionResult* result) = 0;
+  /*!
+   * \brief Ajoute à \a program les instructions pour évaluer cette expression.
+   *
+   * Retourne \a false si l'expression ne peut pas être évaluée
+   * de manière fusionnée.
+   */
+  virtual bool compile(ExpressionProgram& program) = 0;
   virtual void addRef() = 0;
   virtual void removeRef() = 0;
   virtual void setTrace(bool v) =0;
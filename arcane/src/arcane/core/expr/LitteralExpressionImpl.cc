@@ -17,6 +17,7 @@
 #include "arcane/expr/LitteralExpressionImpl.h"
 #include "arcane/expr/OperatorMng.h"
 #include "arcane/expr/BadOperationException.h"
+#include "arcane/expr/ExpressionProgram.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -56,6 +57,17 @@ apply(ExpressionResult* result)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+bool LitteralExpressionImpl::
+compile(ExpressionProgram& program)
+{
+  if (m_value.type()!=ScalarVariant::TReal)
+    return false;
+  return program.addConstant(m_value.asReal());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // End namespace Arcane
 
 /*---------------------------------------------------------------------------*/
@@ -49,6 +49,7 @@ class LitteralExpressionImpl
   virtual void assign(IExpressionImpl*) {}
   virtual void assign(IExpressionImpl*, IntegerConstArrayView) {}
   virtual void apply(ExpressionResult* result);
+  virtual bool compile(ExpressionProgram& program);
   virtual Integer vectorSize() const { return 0; }
 
  private:
@@ -16,6 +16,7 @@
 #include "arcane/expr/UnaryExpressionImpl.h"
 #include "arcane/expr/OperatorMng.h"
 #include "arcane/expr/BadOperationException.h"
+#include "arcane/expr/ExpressionProgram.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -92,6 +93,15 @@ apply(ExpressionResult* result)
   */
 }
 
+
+bool UnaryExpressionImpl::
+compile(ExpressionProgram& program)
+{
+  if (!m_first->compile(program))
+    return false;
+  return program.addUnary(m_operation);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
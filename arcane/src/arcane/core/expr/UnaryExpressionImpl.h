@@ -71,6 +71,7 @@ class ARCANE_EXPR_EXPORT UnaryExpressionImpl
   virtual void assign(IExpressionImpl*) {}
   virtual void assign(IExpressionImpl*, IntegerConstArrayView) {}
   virtual void apply(ExpressionResult* result);
+  virtual bool compile(ExpressionProgram& program);
   virtual Integer vectorSize() const { return 0; }
   String operationName() const { return operationName(m_operation); }
   static String operationName(eOperationType type);
@@ -18,6 +18,7 @@
 #include "arcane/expr/WhereExpressionImpl.h"
 #include "arcane/expr/OperatorMng.h"
 #include "arcane/expr/BadOperationException.h"
+#include "arcane/expr/ExpressionProgram.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -93,6 +94,23 @@ apply(ExpressionResult* result)
   // cerr << "<< END WHERE EXPRESSION [" << *result << "]\n";
 }
 
+
+/*!
+ * Les deux branches sont évaluées pour tous les éléments et le test
+ * sélectionne ensuite la valeur à conserver.
+ */
+bool WhereExpressionImpl::
+compile(ExpressionProgram& program)
+{
+  if (!m_test->compile(program))
+    return false;
+  if (!m_iftrue->compile(program))
+    return false;
+  if (!m_iffalse->compile(program))
+    return false;
+  return program.addSelect();
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
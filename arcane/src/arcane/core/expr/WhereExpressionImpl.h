@@ -47,6 +47,7 @@ class ARCANE_EXPR_EXPORT WhereExpressionImpl
   virtual void assign(IExpressionImpl*) {}
   virtual void assign(IExpressionImpl*, IntegerConstArrayView) {}
   virtual void apply(ExpressionResult* result);
+  virtual bool compile(ExpressionProgram& program);
   virtual Integer vectorSize() const { return 0; }
 
  private:
@@ -88,6 +88,26 @@ class ARCANE_CORE_EXPORT IItemFamilyInternal
 
   virtual void addSourceConnectivity(IIncrementalItemSourceConnectivity* connectivity) = 0;
   virtual void addTargetConnectivity(IIncrementalItemTargetConnectivity* connectivity) = 0;
+
+  /*!
+   * \brief Reconstruit les connectivités dont cette famille est la source.
+   *
+   * Les listes de connectivités sont reconstruites de manière compacte et
+   * rangées dans l'ordre des localId() des entités. Seules les connectivités
+   * dont le taux de fragmentation est strictement supérieur à
+   * \a fragmentation_threshold sont reconstruites. Si \a fragmentation_threshold
+   * est négatif, elles sont toutes reconstruites.
+   *
+   * Cette méthode ne peut être appelée que lorsque la famille n'est pas en
+   * cours de modification, par exemple juste après un endUpdate().
+   */
+  virtual void compactConnectivities(Real fragmentation_threshold) = 0;
+
+  /*!
+   * \brief Taux de fragmentation maximal des connectivités dont
+   * cette famille est la source.
+   */
+  virtual Real connectivityFragmentationRatio() = 0;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,229 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* CellMajorComponentIndex.cc                                  (C) 2000-2024 */
+/*                                                                           */
+/* Index contigu maille -> constituants d'une maille.                        */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/core/materials/CellMajorComponentIndex.h"
+
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/FatalErrorException.h"
+
+#include "arcane/core/IMesh.h"
+#include "arcane/core/IItemFamily.h"
+#include "arcane/core/ItemGroup.h"
+#include "arcane/core/materials/IMeshMaterialMng.h"
+#include "arcane/core/materials/IMeshEnvironment.h"
+#include "arcane/core/materials/IMeshMaterial.h"
+#include "arcane/core/materials/ComponentItemVectorView.h"
+#include "arcane/core/materials/MatItemEnumerator.h"
+#include "arcane/core/materials/IMeshMaterialVariable.h"
+#include "arcane/core/materials/internal/IMeshMaterialVariableInternal.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Materials
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+CellMajorComponentIndex::
+CellMajorComponentIndex(IMeshMaterialMng* mm, MatVarSpace space)
+: m_material_mng(mm)
+, m_space(space)
+, m_cell_offsets(platform::getDefaultDataAllocator())
+, m_matvar_indexes(platform::getDefaultDataAllocator())
+, m_component_ids(platform::getDefaultDataAllocator())
+{
+  if (!mm)
+    ARCANE_FATAL("Null material manager");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CellMajorComponentIndex::
+recompute()
+{
+  IMesh* mesh = m_material_mng->mesh();
+  const Int32 max_local_id = mesh->cellFamily()->maxLocalId();
+  UniqueArray<IMeshComponent*> components = _components();
+
+  // Les entités d'un constituant sont parcourues directement via la liste
+  // de ses MatVarIndex. Les constituants sont parcourus dans l'ordre pour
+  // que ceux d'une maille soient rangés dans le même ordre que pour
+  // ENUMERATE_CELL_ENVCELL.
+
+  // Première passe: calcule le nombre de constituants de chaque maille.
+  m_cell_offsets.resize(max_local_id + 1);
+  m_cell_offsets.fill(0);
+  for (IMeshComponent* component : components) {
+    ComponentItemVectorView view = component->view();
+    for (Int32 cell_lid : view._internalLocalIds())
+      ++m_cell_offsets[cell_lid + 1];
+  }
+
+  // Calcule les positions de début de chaque maille.
+  for (Int32 i = 0; i < max_local_id; ++i)
+    m_cell_offsets[i + 1] += m_cell_offsets[i];
+  const Int32 nb_value = m_cell_offsets[max_local_id];
+  m_matvar_indexes.resize(nb_value);
+  m_component_ids.resize(nb_value);
+
+  // Deuxième passe: remplit les indices et les identifiants des constituants.
+  UniqueArray<Int32> positions(m_cell_offsets.subConstView(0, max_local_id));
+  for (IMeshComponent* component : components) {
+    ComponentItemVectorView view = component->view();
+    ConstArrayView<Int32> cells_local_id = view._internalLocalIds();
+    ConstArrayView<MatVarIndex> matvar_indexes = view._matvarIndexes();
+    const Int32 component_id = component->id();
+    for (Int32 i = 0, n = cells_local_id.size(); i < n; ++i) {
+      Int32 pos = positions[cells_local_id[i]]++;
+      m_matvar_indexes[pos] = matvar_indexes[i];
+      m_component_ids[pos] = component_id;
+    }
+  }
+
+  m_modified_components.clear();
+  m_need_recompute = false;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CellMajorComponentIndex::
+notifyComponentModified(IMeshComponent* component, bool is_nb_component_changed)
+{
+  ARCANE_CHECK_POINTER(component);
+  const bool use_material = (m_space == MatVarSpace::MaterialAndEnvironment);
+  if (use_material != component->isMaterial())
+    return;
+  if (is_nb_component_changed)
+    m_need_recompute = true;
+  if (!m_modified_components.contains(component))
+    m_modified_components.add(component);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CellMajorComponentIndex::
+update()
+{
+  const Int32 max_local_id = m_material_mng->mesh()->cellFamily()->maxLocalId();
+  if (m_need_recompute || m_cell_offsets.size() != (max_local_id + 1)) {
+    recompute();
+    return;
+  }
+  for (IMeshComponent* component : m_modified_components) {
+    if (!_updateComponent(component)) {
+      // Les constituants d'une maille ne correspondent plus à l'index.
+      recompute();
+      return;
+    }
+  }
+  m_modified_components.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Met à jour les valeurs de l'index pour le constituant \a component.
+ *
+ * Retourne \a false si une maille du constituant n'a pas d'emplacement
+ * pour ce constituant dans l'index.
+ */
+bool CellMajorComponentIndex::
+_updateComponent(IMeshComponent* component)
+{
+  ComponentItemVectorView view = component->view();
+  ConstArrayView<Int32> cells_local_id = view._internalLocalIds();
+  ConstArrayView<MatVarIndex> matvar_indexes = view._matvarIndexes();
+  const Int32 component_id = component->id();
+  for (Int32 i = 0, n = cells_local_id.size(); i < n; ++i) {
+    const Int32 cell_lid = cells_local_id[i];
+    const Int32 end = m_cell_offsets[cell_lid + 1];
+    Int32 pos = m_cell_offsets[cell_lid];
+    while (pos < end && m_component_ids[pos] != component_id)
+      ++pos;
+    if (pos == end)
+      return false;
+    m_matvar_indexes[pos] = matvar_indexes[i];
+  }
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Liste des constituants de l'index dans l'ordre de rangement.
+ */
+UniqueArray<IMeshComponent*> CellMajorComponentIndex::
+_components() const
+{
+  const bool use_material = (m_space == MatVarSpace::MaterialAndEnvironment);
+  UniqueArray<IMeshComponent*> components;
+  for (IMeshEnvironment* env : m_material_mng->environments()) {
+    if (use_material) {
+      for (IMeshMaterial* mat : env->materials())
+        components.add(mat);
+    }
+    else
+      components.add(env);
+  }
+  return components;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CellMajorComponentIndex::
+copyFromVariable(IMeshMaterialVariable* var, Span<std::byte> bytes, RunQueue* queue) const
+{
+  _checkVariable(var, bytes.size());
+  var->_internalApi()->copyToBuffer(matVarIndexes(), bytes, queue);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CellMajorComponentIndex::
+copyToVariable(IMeshMaterialVariable* var, Span<const std::byte> bytes, RunQueue* queue) const
+{
+  _checkVariable(var, bytes.size());
+  var->_internalApi()->copyFromBuffer(matVarIndexes(), bytes, queue);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CellMajorComponentIndex::
+_checkVariable(IMeshMaterialVariable* var, Int64 nb_byte) const
+{
+  if (!var)
+    ARCANE_FATAL("Null variable");
+  if (m_space == MatVarSpace::MaterialAndEnvironment && var->space() != MatVarSpace::MaterialAndEnvironment)
+    ARCANE_FATAL("Variable '{0}' has no values on materials", var->name());
+  Int64 data_size = var->_internalApi()->dataTypeSize();
+  Int64 expected_nb_byte = data_size * nbValue();
+  if (nb_byte != expected_nb_byte)
+    ARCANE_FATAL("Bad buffer size for variable '{0}' v={1} expected={2} (index changed ?)",
+                 var->name(), nb_byte, expected_nb_byte);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::Materials
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
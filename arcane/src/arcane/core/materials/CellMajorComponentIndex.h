@@ -0,0 +1,246 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* CellMajorComponentIndex.h                                   (C) 2000-2024 */
+/*                                                                           */
+/* Index contigu maille -> constituants d'une maille.                        */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_CORE_MATERIALS_CELLMAJORCOMPONENTINDEX_H
+#define ARCANE_CORE_MATERIALS_CELLMAJORCOMPONENTINDEX_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Array.h"
+
+#include "arcane/core/ItemLocalId.h"
+#include "arcane/core/materials/MaterialsCoreGlobal.h"
+#include "arcane/core/materials/MatVarIndex.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Materials
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue sur un CellMajorComponentIndex.
+ *
+ * Cette vue est utilisable sur accélérateur.
+ */
+class CellMajorComponentIndexView
+{
+ public:
+
+  CellMajorComponentIndexView() = default;
+  CellMajorComponentIndexView(SmallSpan<const Int32> cell_offsets,
+                              SmallSpan<const MatVarIndex> matvar_indexes,
+                              SmallSpan<const Int32> component_ids)
+  : m_cell_offsets(cell_offsets)
+  , m_matvar_indexes(matvar_indexes)
+  , m_component_ids(component_ids)
+  {}
+
+ public:
+
+  //! Indice de la première valeur de la maille \a cell
+  ARCCORE_HOST_DEVICE Int32 begin(CellLocalId cell) const { return m_cell_offsets[cell.localId()]; }
+  //! Indice suivant la dernière valeur de la maille \a cell
+  ARCCORE_HOST_DEVICE Int32 end(CellLocalId cell) const { return m_cell_offsets[cell.localId() + 1]; }
+  //! Nombre de constituants de la maille \a cell
+  ARCCORE_HOST_DEVICE Int32 nbComponent(CellLocalId cell) const { return end(cell) - begin(cell); }
+  //! Indice dans la variable matériau de la \a i-ème valeur
+  ARCCORE_HOST_DEVICE MatVarIndex matVarIndex(Int32 i) const { return m_matvar_indexes[i]; }
+  //! Identifiant du constituant de la \a i-ème valeur
+  ARCCORE_HOST_DEVICE Int32 componentId(Int32 i) const { return m_component_ids[i]; }
+  //! Nombre total de valeurs
+  ARCCORE_HOST_DEVICE Int32 nbValue() const { return m_matvar_indexes.size(); }
+
+ private:
+
+  SmallSpan<const Int32> m_cell_offsets;
+  SmallSpan<const MatVarIndex> m_matvar_indexes;
+  SmallSpan<const Int32> m_component_ids;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Enumérateur sur les constituants d'une maille via un CellMajorComponentIndexView.
+ *
+ * Cet énumérateur est utilisé par la macro ENUMERATE_CELL_COMPONENT_INDEX()
+ * et est utilisable sur accélérateur.
+ */
+class CellMajorComponentIndexEnumerator
+{
+ public:
+
+  ARCCORE_HOST_DEVICE CellMajorComponentIndexEnumerator(CellLocalId cell,
+                                                        const CellMajorComponentIndexView& view)
+  : m_index(view.begin(cell))
+  , m_end(view.end(cell))
+  , m_view(view)
+  {}
+
+ public:
+
+  ARCCORE_HOST_DEVICE void operator++() { ++m_index; }
+  ARCCORE_HOST_DEVICE bool hasNext() const { return m_index < m_end; }
+
+  //! Indice de la valeur courante dans les variables matériaux
+  ARCCORE_HOST_DEVICE ComponentItemLocalId operator*() const
+  {
+    return ComponentItemLocalId(m_view.matVarIndex(m_index));
+  }
+  //! Indice de la valeur courante dans les variables matériaux
+  ARCCORE_HOST_DEVICE MatVarIndex _varIndex() const { return m_view.matVarIndex(m_index); }
+  //! Identifiant du constituant courant
+  ARCCORE_HOST_DEVICE Int32 componentId() const { return m_view.componentId(m_index); }
+  //! Position de la valeur courante dans l'index (voir CellMajorMaterialVariableScalar)
+  ARCCORE_HOST_DEVICE Int32 index() const { return m_index; }
+
+ private:
+
+  Int32 m_index = 0;
+  Int32 m_end = 0;
+  CellMajorComponentIndexView m_view;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Macro pour itérer sur les constituants d'une maille via un index contigu.
+ *
+ * Equivalent de ENUMERATE_CELL_ENVCELL() qui ne parcourt que des tableaux
+ * contigus et est donc utilisable dans une RUNCOMMAND.
+ *
+ * \param iname nom de l'itérateur, de type CellMajorComponentIndexEnumerator.
+ * \param cell_id identifiant de la maille (de type CellLocalId).
+ * \param index_view vue sur l'index (de type CellMajorComponentIndexView).
+ */
+#define ENUMERATE_CELL_COMPONENT_INDEX(iname, cell_id, index_view) \
+  for (::Arcane::Materials::CellMajorComponentIndexEnumerator iname(cell_id, index_view); iname.hasNext(); ++iname)
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \ingroup ArcaneMaterials
+ * \brief Index contigu des constituants de chaque maille.
+ *
+ * Cette classe range de manière contiguë, maille par maille, la liste
+ * des constituants présents dans chaque maille ainsi que l'indice
+ * (MatVarIndex) de la valeur associée dans les variables matériaux.
+ * Les constituants d'une maille sont donc consécutifs en mémoire, ce qui
+ * permet de parcourir les valeurs de tous les milieux (ou matériaux)
+ * d'une maille sans indirection supplémentaire.
+ *
+ * Si l'espace est MatVarSpace::Environment, les constituants sont les
+ * milieux. Si l'espace est MatVarSpace::MaterialAndEnvironment, il s'agit
+ * des matériaux.
+ *
+ * Les tableaux sont alloués avec l'allocateur par défaut des données
+ * et sont donc accessibles sur accélérateur via view().
+ *
+ * \warning L'index doit être reconstruit via recompute() ou update() à chaque
+ * modification des matériaux ou milieux des mailles. L'instance gérée
+ * par IMeshMaterialMng::cellToAllEnvCellIndex() est mise à jour
+ * automatiquement.
+ */
+class ARCANE_CORE_EXPORT CellMajorComponentIndex
+{
+ public:
+
+  CellMajorComponentIndex(IMeshMaterialMng* mm, MatVarSpace space);
+
+ public:
+
+  //! Reconstruit l'index
+  void recompute();
+
+  /*!
+   * \brief Indique que le constituant \a component a été modifié.
+   *
+   * Si \a is_nb_component_changed est faux, seuls les MatVarIndex du
+   * constituant ont changé et le nombre de constituants de chaque maille
+   * est inchangé. Les notifications sur des constituants qui ne sont pas
+   * dans l'espace de l'index sont ignorées.
+   */
+  void notifyComponentModified(IMeshComponent* component, bool is_nb_component_changed);
+
+  /*!
+   * \brief Met à jour l'index suite aux modifications notifiées.
+   *
+   * Si le nombre de constituants des mailles n'a pas changé, seules les
+   * valeurs des constituants modifiés sont mises à jour. Sinon, l'index
+   * est entièrement reconstruit.
+   */
+  void update();
+
+  //! Espace de définition de l'index
+  MatVarSpace space() const { return m_space; }
+
+  //! Nombre total de valeurs (somme sur les mailles du nombre de constituants)
+  Int32 nbValue() const { return m_matvar_indexes.size(); }
+
+  //! Position dans l'index de la première valeur de chaque maille (taille nbCell()+1)
+  SmallSpan<const Int32> cellOffsets() const { return m_cell_offsets.constView(); }
+
+  //! Indice dans la variable matériau de chaque valeur
+  SmallSpan<const MatVarIndex> matVarIndexes() const { return m_matvar_indexes.constView(); }
+
+  //! Identifiant du constituant de chaque valeur
+  SmallSpan<const Int32> componentIds() const { return m_component_ids.constView(); }
+
+  /*!
+   * \brief Recopie dans \a bytes les valeurs de \a var dans l'ordre de l'index.
+   *
+   * \a bytes doit avoir pour taille nbValue() multiplié par la taille
+   * d'une valeur de \a var. \a queue peut être nul.
+   */
+  void copyFromVariable(IMeshMaterialVariable* var, Span<std::byte> bytes, RunQueue* queue) const;
+
+  /*!
+   * \brief Recopie dans \a var les valeurs de \a bytes rangées dans l'ordre de l'index.
+   *
+   * \a bytes doit avoir pour taille nbValue() multiplié par la taille
+   * d'une valeur de \a var. \a queue peut être nul.
+   */
+  void copyToVariable(IMeshMaterialVariable* var, Span<const std::byte> bytes, RunQueue* queue) const;
+
+  //! Vue sur l'index utilisable sur accélérateur
+  CellMajorComponentIndexView view() const
+  {
+    return { cellOffsets(), matVarIndexes(), componentIds() };
+  }
+
+ private:
+
+  void _checkVariable(IMeshMaterialVariable* var, Int64 nb_byte) const;
+  UniqueArray<IMeshComponent*> _components() const;
+  bool _updateComponent(IMeshComponent* component);
+
+ private:
+
+  IMeshMaterialMng* m_material_mng = nullptr;
+  MatVarSpace m_space = MatVarSpace::Environment;
+  UniqueArray<Int32> m_cell_offsets;
+  UniqueArray<MatVarIndex> m_matvar_indexes;
+  UniqueArray<Int32> m_component_ids;
+  UniqueArray<IMeshComponent*> m_modified_components;
+  bool m_need_recompute = true;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::Materials
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
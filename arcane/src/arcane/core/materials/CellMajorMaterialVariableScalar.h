@@ -0,0 +1,175 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* CellMajorMaterialVariableScalar.h                           (C) 2000-2024 */
+/*                                                                           */
+/* Stockage contigu par maille des valeurs d'une variable matériau.          */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_CORE_MATERIALS_CELLMAJORMATERIALVARIABLESCALAR_H
+#define ARCANE_CORE_MATERIALS_CELLMAJORMATERIALVARIABLESCALAR_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/PlatformUtils.h"
+
+#include "arcane/core/materials/CellMajorComponentIndex.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Materials
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue sur les valeurs d'un CellMajorMaterialVariableScalar.
+ *
+ * Si \a DataType est constant, la vue est en lecture seule.
+ * Cette vue est utilisable sur accélérateur.
+ */
+template <typename DataType>
+class CellMajorMaterialVariableScalarView
+{
+ public:
+
+  CellMajorMaterialVariableScalarView(const CellMajorComponentIndexView& index,
+                                      SmallSpan<DataType> values)
+  : m_index(index)
+  , m_values(values)
+  {}
+
+ public:
+
+  //! Nombre de constituants de la maille \a cell
+  ARCCORE_HOST_DEVICE Int32 nbComponent(CellLocalId cell) const { return m_index.nbComponent(cell); }
+  //! Indice de la première valeur de la maille \a cell
+  ARCCORE_HOST_DEVICE Int32 begin(CellLocalId cell) const { return m_index.begin(cell); }
+  //! Indice suivant la dernière valeur de la maille \a cell
+  ARCCORE_HOST_DEVICE Int32 end(CellLocalId cell) const { return m_index.end(cell); }
+  //! Identifiant du constituant de la \a i-ème valeur
+  ARCCORE_HOST_DEVICE Int32 componentId(Int32 i) const { return m_index.componentId(i); }
+  //! \a i-ème valeur
+  ARCCORE_HOST_DEVICE DataType& operator[](Int32 i) const { return m_values[i]; }
+  //! Valeur du \a k-ème constituant de la maille \a cell
+  ARCCORE_HOST_DEVICE DataType& operator()(CellLocalId cell, Int32 k) const
+  {
+    return m_values[m_index.begin(cell) + k];
+  }
+
+ private:
+
+  CellMajorComponentIndexView m_index;
+  SmallSpan<DataType> m_values;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \ingroup ArcaneMaterials
+ * \brief Stockage contigu par maille des valeurs d'une variable matériau.
+ *
+ * Les variables matériaux conservent leurs valeurs par constituant
+ * (une zone mémoire pour les valeurs globales puis une par milieu ou
+ * matériau). Pour les algorithmes qui parcourent pour chaque maille
+ * l'ensemble de ses constituants (mélanges, fermetures...), cela
+ * implique un accès mémoire dispersé.
+ *
+ * Cette classe conserve une copie des valeurs rangées maille par maille
+ * suivant l'ordre défini par un CellMajorComponentIndex. Les valeurs des
+ * constituants d'une maille sont donc contiguës. La copie est explicite:
+ * gather() recopie les valeurs de la variable dans ce stockage et
+ * scatter() effectue l'opération inverse. Si une file d'exécution est
+ * spécifiée, les copies se font sur cette file (et donc éventuellement
+ * sur accélérateur).
+ *
+ * Il s'agit d'un miroir et non d'un changement du stockage de la variable:
+ * la variable reste la référence pour les autres opérations (synchronisations,
+ * accesseurs ENUMERATE_*, modifications des matériaux). Ce mode n'est
+ * intéressant que si le coût de gather() et scatter() est amorti sur
+ * plusieurs calculs utilisant la copie.
+ *
+ * Le choix du stockage se fait variable par variable: seules les variables
+ * pour lesquelles une instance de cette classe est créée utilisent le
+ * stockage contigu. Dans un même noyau de calcul, on peut accéder à ces
+ * variables via CellMajorComponentIndexEnumerator::index() et aux autres
+ * directement via CellMajorComponentIndexEnumerator::operator*(), en
+ * utilisant le même CellMajorComponentIndex. Ce choix est indépendant de
+ * IMeshMaterialMng::enableCellToAllEnvCellForRunCommand(), qui ne concerne
+ * que l'accès direct via CellToAllEnvCellAccessor.
+ *
+ * \code
+ * CellMajorComponentIndex index(mm, MatVarSpace::Environment);
+ * index.recompute();
+ * CellMajorMaterialVariableScalar<Real> packed_density(index);
+ * packed_density.gather(m_density.materialVariable(), &queue);
+ * // Calcul sur packed_density via viewIn()/viewOut()
+ * packed_density.scatter(m_density.materialVariable(), &queue);
+ * \endcode
+ *
+ * \warning L'index doit rester valide pendant toute la durée de vie
+ * de l'instance.
+ */
+template <typename DataType>
+class CellMajorMaterialVariableScalar
+{
+ public:
+
+  explicit CellMajorMaterialVariableScalar(const CellMajorComponentIndex& index)
+  : m_index(&index)
+  , m_values(platform::getDefaultDataAllocator())
+  {}
+
+ public:
+
+  //! Recopie les valeurs de \a var dans ce stockage.
+  void gather(IMeshMaterialVariable* var, RunQueue* queue = nullptr)
+  {
+    m_values.resize(m_index->nbValue());
+    m_index->copyFromVariable(var, asWritableBytes(m_values.span()), queue);
+  }
+
+  //! Recopie les valeurs de ce stockage dans \a var.
+  void scatter(IMeshMaterialVariable* var, RunQueue* queue = nullptr) const
+  {
+    m_index->copyToVariable(var, asBytes(m_values.constSpan()), queue);
+  }
+
+  //! Index associé
+  const CellMajorComponentIndex& index() const { return *m_index; }
+
+  //! Valeurs
+  SmallSpan<DataType> values() { return m_values.view(); }
+  //! Valeurs
+  SmallSpan<const DataType> values() const { return m_values.constView(); }
+
+  //! Vue en lecture sur les valeurs
+  CellMajorMaterialVariableScalarView<const DataType> constView() const
+  {
+    return { m_index->view(), values() };
+  }
+  //! Vue en lecture/écriture sur les valeurs
+  CellMajorMaterialVariableScalarView<DataType> view()
+  {
+    return { m_index->view(), values() };
+  }
+
+ private:
+
+  const CellMajorComponentIndex* m_index = nullptr;
+  UniqueArray<DataType> m_values;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::Materials
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif  
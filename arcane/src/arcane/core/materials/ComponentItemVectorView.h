@@ -57,6 +57,7 @@ class ARCANE_CORE_EXPORT ComponentItemVectorView
   friend Arcane::Accelerator::impl::MatCommandContainerBase;
   friend ArcaneTest::MeshMaterialTesterModule;
   friend ArcaneTest::MaterialHeatTestModule;
+  friend class CellMajorComponentIndex;
   template <typename ViewType, typename LambdaType>
   friend class LambdaMatItemRangeFunctorT;
   template <typename DataType> friend class
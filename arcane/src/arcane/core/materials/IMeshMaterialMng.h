@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IMeshMaterialMng.h                                          (C) 2000-2023 */
+/* IMeshMaterialMng.h                                          (C) 2000-2024 */
 /*                                                                           */
 /* Interface du gestionnaire des matériaux d'un maillage.                    */
 /*---------------------------------------------------------------------------*/
@@ -425,6 +425,22 @@ class ARCANE_CORE_EXPORT IMeshMaterialMng
   virtual void enableCellToAllEnvCellForRunCommand(bool is_enable, bool force_create=false) =0;
   virtual bool isCellToAllEnvCellForRunCommand() const =0;
 
+  /*!
+   * \brief Active ou désactive l'index contigu maille -> milieux.
+   *
+   * Si actif, l'index est mis à jour à chaque modification des matériaux
+   * (de manière incrémentale si possible) et est accessible via
+   * cellToAllEnvCellIndex(). Il permet de parcourir les milieux d'une maille
+   * sur accélérateur via ENUMERATE_CELL_COMPONENT_INDEX().
+   *
+   * On peut activer également par la variable d'environnement ARCANE_ALLENVCELL_INDEX.
+   * L'index est aussi actif si ARCANE_ALLENVCELL_FOR_RUNCOMMAND est positionnée.
+   */
+  virtual void enableCellToAllEnvCellIndex(bool is_enable) =0;
+
+  //! Index contigu maille -> milieux ou nullptr s'il n'est pas actif.
+  virtual const CellMajorComponentIndex* cellToAllEnvCellIndex() const =0;
+
   /*!
    * \brief Indique si on utilise la valeur matériau ou milieu lorsqu'on transforme une maille
    * partielle en maille pure.
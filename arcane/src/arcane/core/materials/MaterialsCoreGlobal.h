@@ -90,6 +90,7 @@ class IMeshMaterialModifierImpl;
 class CellToAllEnvCellConverter;
 class IMeshMaterialVariableSynchronizer;
 class AllCellToAllEnvCell;
+class CellMajorComponentIndex;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
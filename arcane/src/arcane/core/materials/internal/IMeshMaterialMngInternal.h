@@ -106,6 +106,15 @@ class ARCANE_CORE_EXPORT IMeshMaterialMngInternal
    * La valeur de \a level doit être LEVEL_MATERIAL ou LEVEL_ENVIRONMENT
    */
   virtual ComponentItemSharedInfo* componentItemSharedInfo(Int32 level) const = 0;
+
+  /*!
+   * \brief File d'exécution utilisée pour les modifications des constituants.
+   *
+   * Si non nul, les transformations des mailles pures/partielles et les
+   * recopies des valeurs associées lors des modifications incrémentales sont
+   * effectuées via des commandes sur cette file.
+   */
+  virtual RunQueue* runQueue() const = 0;
 };
 
 /*---------------------------------------------------------------------------*/
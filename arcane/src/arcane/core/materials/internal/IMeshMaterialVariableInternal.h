@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IMeshMaterialVariableInternal.h                             (C) 2000-2023 */
+/* IMeshMaterialVariableInternal.h                             (C) 2000-2024 */
 /*                                                                           */
 /* API interne Arcane de 'IMeshMaterialVariable'.                            */
 /*---------------------------------------------------------------------------*/
@@ -75,14 +75,31 @@ class ARCANE_CORE_EXPORT IMeshMaterialVariableInternal
   //! \internal
   virtual void restoreData(IMeshComponent* component,IData* data,Integer data_index,Int32ConstArrayView ids,bool allow_null_id) =0;
 
-  //! \internal
-  virtual void copyGlobalToPartial(Int32 var_index,Int32ConstArrayView local_ids,Int32ConstArrayView indexes_in_multiple) =0;
+  /*!
+   * \internal
+   * \brief Copie les valeurs globales des mailles \a local_ids dans les valeurs partielles.
+   *
+   * \a queue peut être nul.
+   */
+  virtual void copyGlobalToPartial(Int32 var_index, Int32ConstArrayView local_ids,
+                                   Int32ConstArrayView indexes_in_multiple, RunQueue* queue) = 0;
 
-  //! \internal
-  virtual void copyPartialToGlobal(Int32 var_index,Int32ConstArrayView local_ids,Int32ConstArrayView indexes_in_multiple) =0;
+  /*!
+   * \internal
+   * \brief Copie les valeurs partielles dans les valeurs globales des mailles \a local_ids.
+   *
+   * \a queue peut être nul.
+   */
+  virtual void copyPartialToGlobal(Int32 var_index, Int32ConstArrayView local_ids,
+                                   Int32ConstArrayView indexes_in_multiple, RunQueue* queue) = 0;
 
-  //! \internal
-  virtual void initializeNewItems(const ComponentItemListBuilder& list_builder) =0;
+  /*!
+   * \internal
+   * \brief Initialise les valeurs des nouvelles entités de \a list_builder.
+   *
+   * \a queue peut être nul.
+   */
+  virtual void initializeNewItems(const ComponentItemListBuilder& list_builder, RunQueue* queue) = 0;
 };
 
 /*---------------------------------------------------------------------------*/
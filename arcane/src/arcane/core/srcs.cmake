@@ -2,6 +2,9 @@
 
 set(ARCANE_MATERIALS_SOURCES
   materials/CellToAllEnvCellConverter.h
+  materials/CellMajorComponentIndex.cc
+  materials/CellMajorComponentIndex.h
+  materials/CellMajorMaterialVariableScalar.h
   materials/MaterialsCoreGlobal.h
   materials/MaterialsCoreGlobal.cc
   materials/MatItem.h
@@ -695,6 +698,8 @@ set(ARCANE_ORIGINAL_SOURCES
   expr/ExpressionResult.h
   expr/ExpressionImpl.cc
   expr/ExpressionImpl.h
+  expr/ExpressionProgram.cc
+  expr/ExpressionProgram.h
   expr/UnaryExpressionImpl.cc
   expr/UnaryExpressionImpl.h
   expr/LitteralExpressionImpl.cc
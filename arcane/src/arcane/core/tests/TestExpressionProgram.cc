@@ -0,0 +1,174 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "arcane/utils/Array.h"
+
+#include "arcane/core/expr/ExpressionProgram.h"
+#include "arcane/core/expr/BadOperandException.h"
+
+#include <cmath>
+#include <functional>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+using namespace Arcane;
+
+namespace
+{
+//! Expression dont la compilation est effectuée par une fonction.
+class FunctorExpressionImpl
+: public IExpressionImpl
+{
+ public:
+
+  explicit FunctorExpressionImpl(const std::function<bool(ExpressionProgram&)>& f)
+  : m_functor(f)
+  {}
+  ~FunctorExpressionImpl() override = default;
+
+ public:
+
+  void assign(IExpressionImpl*) override {}
+  void assign(IExpressionImpl*, IntegerConstArrayView) override {}
+  Integer vectorSize() const override { return 0; }
+  void dumpIf(IExpressionImpl*, Array<Expression>&) override {}
+  void apply(ExpressionResult*) override {}
+  bool compile(ExpressionProgram& program) override { return m_functor(program); }
+  void addRef() override {}
+  void removeRef() override {}
+  void setTrace(bool) override {}
+
+ private:
+
+  std::function<bool(ExpressionProgram&)> m_functor;
+};
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TEST(ArcaneExpression, Program)
+{
+  for (Integer n : { 0, 1, 7, 512, 513, 5000 }) {
+    UniqueArray<Real> a(n);
+    UniqueArray<Real> b(n);
+    for (Integer i = 0; i < n; ++i) {
+      a[i] = 1.0 + i * 0.5;
+      b[i] = 200.0 - i * 0.25;
+    }
+    // where(a<b, sqrt(a)*2.0+b, max(a,b)-3.0)
+    FunctorExpressionImpl expr([&](ExpressionProgram& p) {
+      p.addArray(a);
+      p.addArray(b);
+      p.addBinary(BinaryExpressionImpl::LessThan);
+      p.addArray(a);
+      p.addUnary(UnaryExpressionImpl::Sqrt);
+      p.addConstant(2.0);
+      p.addBinary(BinaryExpressionImpl::Multiply);
+      p.addArray(b);
+      p.addBinary(BinaryExpressionImpl::Add);
+      p.addArray(a);
+      p.addArray(b);
+      p.addBinary(BinaryExpressionImpl::Maximum);
+      p.addConstant(3.0);
+      p.addBinary(BinaryExpressionImpl::Substract);
+      return p.addSelect();
+    });
+    ExpressionProgram program;
+    ASSERT_TRUE(program.compile(&expr));
+
+    UniqueArray<Real> result(n);
+    program.evaluate(result);
+    for (Integer i = 0; i < n; ++i) {
+      Real ref = (a[i] < b[i]) ? std::sqrt(a[i]) * 2.0 + b[i] : std::max(a[i], b[i]) - 3.0;
+      ASSERT_EQ(result[i], ref) << "i=" << i << " n=" << n;
+    }
+
+    UniqueArray<Integer> indices;
+    for (Integer i = 0; i < n; i += 3)
+      indices.add(i);
+    UniqueArray<Real> result2(n);
+    result2.fill(-1.0);
+    program.evaluate(result2, indices);
+    for (Integer i = 0; i < n; ++i) {
+      Real ref = ((i % 3) == 0) ? result[i] : -1.0;
+      ASSERT_EQ(result2[i], ref) << "i=" << i << " n=" << n;
+    }
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TEST(ArcaneExpression, ProgramBadTypes)
+{
+  UniqueArray<Real> a(4);
+  ExpressionProgram program;
+
+  // Le résultat ne peut pas être un booléen.
+  FunctorExpressionImpl expr1([&](ExpressionProgram& p) {
+    p.addArray(a);
+    p.addArray(a);
+    return p.addBinary(BinaryExpressionImpl::LessThan);
+  });
+  ASSERT_FALSE(program.compile(&expr1));
+
+  // Un booléen ne peut pas être utilisé dans une opération arithmétique.
+  FunctorExpressionImpl expr2([&](ExpressionProgram& p) {
+    p.addArray(a);
+    p.addArray(a);
+    p.addBinary(BinaryExpressionImpl::LessThan);
+    p.addConstant(1.0);
+    return p.addBinary(BinaryExpressionImpl::Add);
+  });
+  ASSERT_FALSE(program.compile(&expr2));
+  ASSERT_FALSE(program.isValid());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TEST(ArcaneExpression, ProgramBadSizes)
+{
+  UniqueArray<Real> a(10);
+  a.fill(1.0);
+  FunctorExpressionImpl expr([&](ExpressionProgram& p) {
+    p.addArray(a);
+    p.addConstant(2.0);
+    return p.addBinary(BinaryExpressionImpl::Add);
+  });
+  ExpressionProgram program;
+  ASSERT_TRUE(program.compile(&expr));
+
+  // Résultat plus grand que l'opérande.
+  UniqueArray<Real> result(20);
+  ASSERT_THROW(program.evaluate(result), BadOperandException);
+
+  // Indice valide pour le résultat mais pas pour l'opérande.
+  UniqueArray<Integer> indices = { 0, 5, 15 };
+  ASSERT_THROW(program.evaluate(result, indices), BadOperandException);
+
+  // Indice invalide pour le résultat.
+  UniqueArray<Real> small_result(4);
+  UniqueArray<Integer> indices2 = { 0, 5 };
+  ASSERT_THROW(program.evaluate(small_result, indices2), BadOperandException);
+
+  // Indice négatif.
+  UniqueArray<Integer> indices3 = { -1 };
+  ASSERT_THROW(program.evaluate(result, indices3), BadOperandException);
+
+  UniqueArray<Integer> indices4 = { 1, 9 };
+  program.evaluate(result, indices4);
+  ASSERT_EQ(result[1], 3.0);
+  ASSERT_EQ(result[9], 3.0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
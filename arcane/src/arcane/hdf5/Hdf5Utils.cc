@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* Hdf5Utils.cc                                                (C) 2000-2023 */
+/* Hdf5Utils.cc                                                (C) 2000-2024 */
 /*                                                                           */
 /* Utilitaires HDF5.                                                         */
 /*---------------------------------------------------------------------------*/
@@ -827,6 +827,7 @@ saveType(eDataType sd) const
   switch(sd){
   case DT_Byte: return saveType(Byte());
   case DT_Real: return saveType(Real());
+  case DT_Float32: return saveType(Float32());
   case DT_Real2: return saveType(Real2());
   case DT_Real2x2: return saveType(Real2x2());
   case DT_Real3: return saveType(Real3());
@@ -848,6 +849,7 @@ nativeType(eDataType sd) const
   switch(sd){
   case DT_Byte: return nativeType(Byte());
   case DT_Real: return nativeType(Real());
+  case DT_Float32: return nativeType(Float32());
   case DT_Real2: return nativeType(Real2());
   case DT_Real2x2: return nativeType(Real2x2());
   case DT_Real3: return nativeType(Real3());
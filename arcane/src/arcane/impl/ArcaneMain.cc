@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ArcaneMain.cc                                               (C) 2000-2023 */
+/* ArcaneMain.cc                                               (C) 2000-2024 */
 /*                                                                           */
 /* Classe gérant l'exécution.                                                */
 /*---------------------------------------------------------------------------*/
@@ -1296,6 +1296,8 @@ execute()
 void ArcaneMain::
 doAbort()
 {
+  // Écrit les traces éventuellement en attente dans les tampons asynchrones.
+  Arccore::arccoreFlushAsyncTraces();
   ::abort();
 }
 
@@ -1543,6 +1545,11 @@ arcaneSignalHandler(int val)
 #endif
   }
 
+  // Écrit les traces éventuellement en attente dans les tampons asynchrones.
+  // La méthode utilisée n'utilise pas de verrou et peut donc être appelée
+  // dans un gestionnaire de signal.
+  Arccore::arccoreWriteAsyncTracesSignalSafe(2);
+
   cerr << "Signal Caught !!! number=" << val << " name=" << signal_str << ".\n";
 #ifdef ARCANE_DEBUG
   //arcaneDebugPause("SIGNAL");
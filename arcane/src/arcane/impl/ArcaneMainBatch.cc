@@ -1009,6 +1009,8 @@ finalize()
 void ArcaneMainBatch::
 doAbort()
 {
+  // Écrit les traces éventuellement en attente dans les tampons asynchrones.
+  Arccore::arccoreFlushAsyncTraces();
   if (m_session)
     m_session->doAbort();
   else{
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* Array2Data.cc                                               (C) 2000-2023 */
+/* Array2Data.cc                                               (C) 2000-2024 */
 /*                                                                           */
 /* Donnée du type 'Array2'.                                                  */
 /*---------------------------------------------------------------------------*/
@@ -409,7 +409,6 @@ serialize(ISerializer* sbuf,IDataOperation* operation)
 {
   Integer nb_count = DataTypeTraitsT<DataType>::nbBasicType();
   typedef typename DataTypeTraitsT<DataType>::BasicType BasicType;
-  eDataType data_type = DataTypeTraitsT<BasicType>::type();
 
   ISerializer::eMode mode = sbuf->mode();
   if (mode==ISerializer::ModeReserve){
@@ -421,7 +420,8 @@ serialize(ISerializer* sbuf,IDataOperation* operation)
     sbuf->reserveSpan(DT_Int64,4);
     // Réserve la mémoire pour les valeurs
     Int64 total_nb_element = m_value.totalNbElement();
-    sbuf->reserveSpan(data_type,total_nb_element*nb_count);
+    const BasicType* bt = reinterpret_cast<const BasicType*>(m_value.to1DSpan().data());
+    sbuf->reserveSpan(Span<const BasicType>(bt,total_nb_element*nb_count));
   }
   else if (mode==ISerializer::ModePut){
     Int64 count = m_value.dim1Size();
@@ -485,7 +485,6 @@ serialize(ISerializer* sbuf,Int32ConstArrayView ids,IDataOperation* operation)
 {
   Integer nb_count = DataTypeTraitsT<DataType>::nbBasicType();
   typedef typename DataTypeTraitsT<DataType>::BasicType BasicType;
-  eDataType data_type = DataTypeTraitsT<BasicType>::type();
 
   ISerializer::eMode mode = sbuf->mode();
   if (mode==ISerializer::ModeReserve){
@@ -497,7 +496,7 @@ serialize(ISerializer* sbuf,Int32ConstArrayView ids,IDataOperation* operation)
     sbuf->reserveSpan(DT_Int64,4);
     // Réserve la mémoire pour les valeurs
     Int64 total_nb_value = ((Int64)ids.size()) * ((Int64)m_value.dim2Size());
-    sbuf->reserveSpan(data_type,total_nb_value*nb_count);
+    sbuf->reserveSpan(Span<const BasicType>(nullptr,total_nb_value*nb_count));
     
   }
   else if (mode==ISerializer::ModePut){
@@ -726,6 +725,7 @@ registerArray2DataFactory(IDataFactoryMng* dfm)
 {
   DataStorageFactory<Array2DataT<Byte>>::registerDataFactory(dfm);
   DataStorageFactory<Array2DataT<Real>>::registerDataFactory(dfm);
+  DataStorageFactory<Array2DataT<Float32>>::registerDataFactory(dfm);
   DataStorageFactory<Array2DataT<Int16>>::registerDataFactory(dfm);
   DataStorageFactory<Array2DataT<Int32>>::registerDataFactory(dfm);
   DataStorageFactory<Array2DataT<Int64>>::registerDataFactory(dfm);
@@ -740,6 +740,7 @@ registerArray2DataFactory(IDataFactoryMng* dfm)
 
 template class Array2DataT<Byte>;
 template class Array2DataT<Real>;
+template class Array2DataT<Float32>;
 template class Array2DataT<Int16>;
 template class Array2DataT<Int32>;
 template class Array2DataT<Int64>;
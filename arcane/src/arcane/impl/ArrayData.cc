@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ArrayData.cc                                                (C) 2000-2023 */
+/* ArrayData.cc                                                (C) 2000-2024 */
 /*                                                                           */
 /* Donnée du type 'Array'.                                                   */
 /*---------------------------------------------------------------------------*/
@@ -386,7 +386,9 @@ serialize(ISerializer* sbuf,IDataOperation* operation)
                                   << dataTypeName(data_type)
                                   << " ids=" << nb_value << " totalsize=" << total_size;
       sbuf->reserve(DT_Int64,2); // 1 pour magic number et 1 pour la taille
-      sbuf->reserveSpan(data_type,total_size);
+      // Utilise la surcharge typée car les valeurs de eDataType et de
+      // ISerializer::eDataType ne sont pas les mêmes pour tous les types.
+      sbuf->reserveSpan(Span<const BasicType>(reinterpret_cast<const BasicType*>(m_value.data()),total_size));
     }
     break;
   case ISerializer::ModePut:
@@ -493,7 +495,8 @@ _serialize(ISerializer* sbuf,Span<const Int32> ids,IDataOperation* operation)
                                   << dataTypeName(data_type)
                                   << " ids=" << nb_value << " totalsize=" << total_size;
       sbuf->reserve(DT_Int64,2);
-      sbuf->reserveSpan(data_type,total_size);
+      // Seule la taille est utilisée lors de la réservation.
+      sbuf->reserveSpan(Span<const BasicType>(nullptr,total_size));
     }
     break;
   case ISerializer::ModePut:
@@ -700,6 +703,7 @@ registerArrayDataFactory(IDataFactoryMng* dfm)
 {
   DataStorageFactory<ArrayDataT<Byte>>::registerDataFactory(dfm);
   DataStorageFactory<ArrayDataT<Real>>::registerDataFactory(dfm);
+  DataStorageFactory<ArrayDataT<Float32>>::registerDataFactory(dfm);
   DataStorageFactory<ArrayDataT<Int16>>::registerDataFactory(dfm);
   DataStorageFactory<ArrayDataT<Int32>>::registerDataFactory(dfm);
   DataStorageFactory<ArrayDataT<Int64>>::registerDataFactory(dfm);
@@ -714,6 +718,7 @@ registerArrayDataFactory(IDataFactoryMng* dfm)
 
 template class ArrayDataT<Byte>;
 template class ArrayDataT<Real>;
+template class ArrayDataT<Float32>;
 template class ArrayDataT<Int16>;
 template class ArrayDataT<Int32>;
 template class ArrayDataT<Int64>;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DataOperation.h                                             (C) 2000-2021 */
+/* DataOperation.h                                             (C) 2000-2024 */
 /*                                                                           */
 /* Opération sur une donnée.                                                 */
 /*---------------------------------------------------------------------------*/
@@ -56,6 +56,11 @@ class DataOperationT
     for( Integer i=0, n=input.size(); i<n; ++i )
       output[i] = m_operator(output[i],input[i]);
   }
+  void apply(ArrayView<Float32> output,ConstArrayView<Float32> input) override
+  {
+    for( Integer i=0, n=input.size(); i<n; ++i )
+      output[i] = m_operator(output[i],input[i]);
+  }
   void apply(Int32ArrayView output,Int32ConstArrayView input) override
   {
     for( Integer i=0, n=input.size(); i<n; ++i )
@@ -106,6 +111,10 @@ class DataOperationT
   {
     _applySpan(output,input);
   }
+  void applySpan(Span<Float32> output,Span<const Float32> input) override
+  {
+    _applySpan(output,input);
+  }
   void applySpan(Span<Int16> output,Span<const Int16> input) override
   {
     _applySpan(output,input);
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DefaultBackwardMng.cc                                       (C) 2000-2016 */
+/* DefaultBackwardMng.cc                                       (C) 2000-2024 */
 /*                                                                           */
 /* Implémentation par défaut d'une stratégie de retour-arrière.              */
 /*---------------------------------------------------------------------------*/
@@ -21,8 +21,12 @@
 #include "arcane/CommonVariables.h"
 #include "arcane/Timer.h"
 #include "arcane/VariableCollection.h"
+#include "arcane/ServiceBuilder.h"
 
 #include "arcane/utils/ITraceMng.h"
+#include "arcane/utils/ValueConvert.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/IDataCompressor.h"
 
 #include "arcane/impl/MemoryDataReaderWriter.h"
 
@@ -86,6 +90,30 @@ DefaultBackwardMng::
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void DefaultBackwardMng::
+init()
+{
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_BACKWARD_INCREMENTAL", true))
+    m_data_io->setIncremental(v.value()!=0);
+
+  String compressor_name = platform::getEnvironmentVariable("ARCANE_BACKWARD_COMPRESSOR");
+  if (!compressor_name.null()){
+    ServiceBuilder<IDataCompressor> sb(m_sub_domain->application());
+    Ref<IDataCompressor> compressor = sb.createReference(compressor_name,SB_AllowNull);
+    if (compressor.get())
+      m_data_io->setDataCompressor(compressor);
+    else
+      m_trace->warning() << "Can not create data compressor service '" << compressor_name
+                         << "' for backward: data will not be compressed";
+  }
+
+  m_trace->info(4) << "BackwardMng incremental=" << m_data_io->isIncremental()
+                   << " compressor=" << compressor_name;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void DefaultBackwardMng::
 clear()
 {
@@ -184,6 +212,8 @@ _save()
 
   m_sub_domain->variableMng()->writeVariables(m_data_io,m_filter);
 
+  m_trace->info(4) << "Number of variables copied for backward: " << m_data_io->nbCopiedVariable();
+
   m_sequence = SEQNothing;
 
   m_backward_time = -1.;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DefaultBackwardMng.h                                        (C) 2000-2016 */
+/* DefaultBackwardMng.h                                        (C) 2000-2024 */
 /*                                                                           */
 /* Implémentation par défaut d'une stratégie de retour-arrière.              */
 /*---------------------------------------------------------------------------*/
@@ -25,12 +25,21 @@ ARCANE_BEGIN_NAMESPACE
 /*---------------------------------------------------------------------------*/
 
 class IVariableFilter;
-class IDataReaderWriter;
+class MemoryDataReaderWriter;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
  * \Implémentation par défaut d'une stratégie de retour-arrière.
+ *
+ * Les variables sont sauvegardées en mémoire via MemoryDataReaderWriter.
+ * Les variables d'environnement suivantes permettent de modifier le
+ * comportement de la sauvegarde:
+ * - ARCANE_BACKWARD_INCREMENTAL: si non nul, ne recopie que les variables
+ *   modifiées depuis la dernière sauvegarde (au sens de IVariable::modifiedTime()).
+ *   Les variables scalaires sont toujours recopiées.
+ * - ARCANE_BACKWARD_COMPRESSOR: nom du service de compression (implémentant
+ *   IDataCompressor) utilisé pour compresser les sauvegardes.
  */
 class ARCANE_IMPL_EXPORT DefaultBackwardMng
 : public IBackwardMng
@@ -56,7 +65,7 @@ class ARCANE_IMPL_EXPORT DefaultBackwardMng
   DefaultBackwardMng(ITraceMng* trace,ISubDomain* sub_domain);
   ~DefaultBackwardMng();
 
-  void init() override {}
+  void init() override;
 
   void beginAction() override;
 
@@ -87,7 +96,7 @@ class ARCANE_IMPL_EXPORT DefaultBackwardMng
   ITraceMng* m_trace;
   ISubDomain* m_sub_domain;
   IVariableFilter* m_filter;
-  IDataReaderWriter* m_data_io;
+  MemoryDataReaderWriter* m_data_io;
 
   //! Temps du dernier retour demandé
   Real m_backward_time;
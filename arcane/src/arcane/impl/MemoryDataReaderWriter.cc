@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MemoryDataReaderWriter.cc                                   (C) 2000-2009 */
+/* MemoryDataReaderWriter.cc                                   (C) 2000-2024 */
 /*                                                                           */
 /* Lecture/ecriture des données en mémoire.                                  */
 /*---------------------------------------------------------------------------*/
@@ -17,13 +17,18 @@
 #include "arcane/utils/FatalErrorException.h"
 #include "arcane/utils/TraceInfo.h"
 #include "arcane/utils/Ref.h"
+#include "arcane/utils/IDataCompressor.h"
 
 #include "arcane/IData.h"
 #include "arcane/IVariable.h"
 #include "arcane/VariableCollection.h"
+#include "arcane/Concurrency.h"
+#include "arcane/core/internal/IDataInternal.h"
 
 #include "arcane/impl/MemoryDataReaderWriter.h"
 
+#include <set>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -32,6 +37,26 @@ ARCANE_BEGIN_NAMESPACE
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+struct MemoryDataReaderWriter::VarData
+{
+ public:
+
+  //! Copie de la donnée (vide si les valeurs sont compressées)
+  Ref<IData> data;
+  //! Donnée source à recopier lors de endWrite()
+  IData* source_data = nullptr;
+  //! Valeur de IVariable::modifiedTime() lors de la dernière copie
+  Int64 modified_time = -1;
+  //! Valeur de IVariable::nbElement() lors de la dernière copie
+  Integer nb_element = -1;
+  //! Indique si les valeurs sont dans \a m_data_buffer
+  bool is_compressed = false;
+  DataCompressionBuffer m_data_buffer;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 MemoryDataReaderWriter::
 ~MemoryDataReaderWriter()
 {
@@ -44,7 +69,22 @@ MemoryDataReaderWriter::
 void MemoryDataReaderWriter::
 free()
 {
+  for( const auto& iter : m_vars_to_data )
+    delete iter.second;
   m_vars_to_data.clear();
+  m_pending_copies.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MemoryDataReaderWriter::
+setDataCompressor(Ref<IDataCompressor> compressor)
+{
+  // Les données déjà compressées le sont avec l'ancien compresseur.
+  // Il faut donc tout supprimer.
+  free();
+  m_compressor = compressor;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -53,37 +93,92 @@ free()
 void MemoryDataReaderWriter::
 beginWrite(const VariableCollection& vars)
 {
-  // Copie la table courante et enlève toutes les références aux variables
-  // que l'on va sauver. Une fois ceci terminé, il ne reste que des
-  // références à des variables plus utilisées. On libère donc
-  // le IData correspondant.
-  VarToDataMap vars_to_data = m_vars_to_data;
+  // Supprime les données des variables qui ne sont pas dans \a vars.
+  // Il ne reste alors que des références à des variables plus utilisées.
+  // On libère donc le IData correspondant.
+  std::set<String> var_names;
   for( VariableCollection::Enumerator ivar(vars); ++ivar; ){
     IVariable* var = *ivar;
-    VarToDataMap::iterator i = vars_to_data.find(var->fullName());
-    if (i!=vars_to_data.end())
-      vars_to_data.erase(i);
+    var_names.insert(var->fullName());
   }
 
-  for( VarToDataMap::iterator i=vars_to_data.begin(); i!=vars_to_data.end(); ++i ){
-    // Supprime la référence à la table courante et détruit la donnée
-    m_vars_to_data.erase(i->first);
+  for( auto i=m_vars_to_data.begin(); i!=m_vars_to_data.end(); ){
+    if (var_names.find(i->first)==var_names.end()){
+      delete i->second;
+      i = m_vars_to_data.erase(i);
+    }
+    else
+      ++i;
   }
+  m_pending_copies.clear();
 }
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
-
+/*!
+ * \brief Enregistre la donnée \a data de la variable \a var.
+ *
+ * La copie effective n'est faite que dans endWrite().
+ */
 void MemoryDataReaderWriter::
 write(IVariable* var,IData* data)
 {
-  Ref<IData> cdata = _findData(var);
-  if (!cdata.get()){
-    cdata = data->cloneRef();
-    m_vars_to_data.insert(std::make_pair(var->fullName(),cdata));
+  VarData* vd = _findData(var);
+  if (!vd){
+    vd = new VarData();
+    m_vars_to_data.insert(std::make_pair(var->fullName(),vd));
   }
-  else{
-    cdata->copy(data);
+  Int64 modified_time = var->modifiedTime();
+  Integer nb_element = var->nbElement();
+  // Les variables scalaires (par exemple l'itération ou le temps courant)
+  // sont en général modifiées sans appel à setUpToDate(). Elles sont peu
+  // coûteuses à recopier et le sont donc toujours.
+  bool is_scalar = (var->dimension()==0);
+  if (m_is_incremental && !is_scalar && vd->modified_time==modified_time && vd->nb_element==nb_element)
+    return;
+  vd->modified_time = modified_time;
+  vd->nb_element = nb_element;
+  vd->source_data = data;
+  m_pending_copies.add(vd);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MemoryDataReaderWriter::
+endWrite()
+{
+  // Les copies sont indépendantes et peuvent donc être faites en parallèle.
+  // Chaque variable pouvant être de taille très différente, on traite
+  // les variables une par une.
+  ParallelLoopOptions loop_options;
+  loop_options.setGrainSize(1);
+  arcaneParallelFor(0,m_pending_copies.size(),loop_options,[&](Integer begin,Integer size){
+    for( Integer i=begin, n=begin+size; i<n; ++i )
+      _copyData(m_pending_copies[i]);
+  });
+  m_nb_copied_variable = m_pending_copies.size();
+  m_pending_copies.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MemoryDataReaderWriter::
+_copyData(VarData* vd)
+{
+  IData* source_data = vd->source_data;
+  vd->source_data = nullptr;
+  if (!vd->data.get())
+    vd->data = source_data->cloneRef();
+  else
+    vd->data->copy(source_data);
+  vd->is_compressed = false;
+
+  IDataCompressor* compressor = m_compressor.get();
+  if (compressor){
+    vd->m_data_buffer.m_compressor = compressor;
+    vd->is_compressed = vd->data->_commonInternal()->compressAndClear(vd->m_data_buffer);
   }
 }
 
@@ -93,25 +188,39 @@ write(IVariable* var,IData* data)
 void MemoryDataReaderWriter::
 read(IVariable* var,IData* data)
 {
-  Ref<IData> cdata = _findData(var);
-  if (!cdata.get()){
+  VarData* vd = _findData(var);
+  if (!vd || !vd->data.get()){
     warning() << A_FUNCNAME << ": "
               << String::format("can not find data for variable '{0}': variable will not be restored",
                                 var->fullName());
     return;
   }
-  data->copy(cdata.get());
+  // Décompresse les données si nécessaire. Elles restent ensuite
+  // décompressées jusqu'à la prochaine écriture.
+  if (vd->is_compressed){
+    vd->data->_commonInternal()->decompressAndFill(vd->m_data_buffer);
+    vd->m_data_buffer.m_buffer.clear();
+    vd->is_compressed = false;
+  }
+  data->copy(vd->data.get());
+  // Les valeurs ont changé : il faut l'indiquer pour que les mécanismes
+  // qui utilisent le temps de modification (dépendances, synchronisations)
+  // ne considèrent pas la variable comme à jour avec les anciennes valeurs.
+  // Comme la sauvegarde correspond maintenant aux valeurs de la variable,
+  // il n'est pas nécessaire de la recopier lors de la prochaine écriture.
+  var->setUpToDate();
+  vd->modified_time = var->modifiedTime();
 }
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
-Ref<IData> MemoryDataReaderWriter::
+MemoryDataReaderWriter::VarData* MemoryDataReaderWriter::
 _findData(IVariable* var)
 {
   auto i = m_vars_to_data.find(var->fullName());
   if (i==m_vars_to_data.end())
-    return {};
+    return nullptr;
   return i->second;
 }
 
@@ -122,4 +231,3 @@ ARCANE_END_NAMESPACE
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
-
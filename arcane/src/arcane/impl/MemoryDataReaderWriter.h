@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MemoryDataReaderWriter.h                                    (C) 2000-2009 */
+/* MemoryDataReaderWriter.h                                    (C) 2000-2024 */
 /*                                                                           */
 /* Lecture/ecriture des données en mémoire.                                  */
 /*---------------------------------------------------------------------------*/
@@ -15,6 +15,8 @@
 /*---------------------------------------------------------------------------*/
 
 #include "arcane/utils/TraceAccessor.h"
+#include "arcane/utils/Array.h"
+#include "arcane/utils/Ref.h"
 #include "arcane/IDataReaderWriter.h"
 
 #include <map>
@@ -29,6 +31,7 @@ ARCANE_BEGIN_NAMESPACE
 
 class IVariable;
 class IData;
+class IDataCompressor;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -38,6 +41,19 @@ class IData;
  *
  * Cette classe sert par exemple pour sauvegarder et restaurer les données
  * pour le retour-arrière.
+ *
+ * Les copies des données sont effectuées lors de l'appel à endWrite() et
+ * sont faites en parallèle si le mécanisme des tâches est actif.
+ *
+ * Si le mode incrémental est actif (setIncremental()), seules les variables
+ * dont IVariable::modifiedTime() ou IVariable::nbElement() ont changé depuis
+ * la dernière écriture sont recopiées. Ce mode suppose que les variables
+ * modifiées appellent IVariable::setUpToDate(). Les variables scalaires
+ * (de dimension 0) sont toujours recopiées.
+ *
+ * Si un compresseur est spécifié (setDataCompressor()), les données
+ * sauvegardées sont conservées sous forme compressée et ne sont
+ * décompressées que lors de la lecture.
  */
 class  ARCANE_IMPL_EXPORT MemoryDataReaderWriter
 : public TraceAccessor
@@ -45,7 +61,8 @@ class  ARCANE_IMPL_EXPORT MemoryDataReaderWriter
 {
  private:
 
-  typedef std::map<String,Ref<IData>> VarToDataMap;
+  struct VarData;
+  typedef std::map<String,VarData*> VarToDataMap;
 
  public:
 
@@ -58,7 +75,7 @@ class  ARCANE_IMPL_EXPORT MemoryDataReaderWriter
  public:
   
   virtual void beginWrite(const VariableCollection& vars);
-  virtual void endWrite(){}
+  virtual void endWrite();
   virtual void setMetaData(const String& meta_data) { m_meta_data = meta_data; }
   virtual void write(IVariable* var,IData* data);
 
@@ -69,14 +86,32 @@ class  ARCANE_IMPL_EXPORT MemoryDataReaderWriter
 
   void free();
 
+ public:
+
+  //! Positionne le mode incrémental
+  void setIncremental(bool v) { m_is_incremental = v; }
+  bool isIncremental() const { return m_is_incremental; }
+
+  //! Positionne le compresseur (nullptr si aucun)
+  void setDataCompressor(Ref<IDataCompressor> compressor);
+  Ref<IDataCompressor> dataCompressor() const { return m_compressor; }
+
+  //! Nombre de variables recopiées lors de la dernière écriture
+  Integer nbCopiedVariable() const { return m_nb_copied_variable; }
+
  private:
 
-  Ref<IData> _findData(IVariable* var);
+  VarData* _findData(IVariable* var);
+  void _copyData(VarData* vd);
 
  private:
 
   String m_meta_data;
   VarToDataMap m_vars_to_data;
+  UniqueArray<VarData*> m_pending_copies;
+  Ref<IDataCompressor> m_compressor;
+  bool m_is_incremental = false;
+  Integer m_nb_copied_variable = 0;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelExchanger.cc                                        (C) 2000-2022 */
+/* ParallelExchanger.cc                                        (C) 2000-2024 */
 /*                                                                           */
 /* Echange d'informations entre processeurs.                                 */
 /*---------------------------------------------------------------------------*/
@@ -229,7 +229,7 @@ _processExchange(const ParallelExchangerOptions& options)
   }
 
   if (use_all_to_all)
-    _processExchangeCollective();
+    _processExchangeCollective(options.maxCollectiveMessageSize());
   else{
     Int32 max_pending = options.maxPendingMessage();
     if (max_pending>0)
@@ -251,102 +251,136 @@ _processExchange(const ParallelExchangerOptions& options)
 /*---------------------------------------------------------------------------*/
 
 void ParallelExchanger::
-_processExchangeCollective()
+_processExchangeCollective(Int64 max_message_size)
 {
   info() << "Using collective exchange in ParallelExchanger";
 
   IParallelMng* pm = m_parallel_mng.get();
   Int32 nb_rank = pm->commSize();
 
-  Int32UniqueArray send_counts(nb_rank,0);
-  Int32UniqueArray send_indexes(nb_rank,0);
-  Int32UniqueArray recv_counts(nb_rank,0);
-  Int32UniqueArray recv_indexes(nb_rank,0);
- 
+  // Les nombres d'éléments et les index de allToAllVariable() sont de type
+  // Int32. La taille de chaque échange ne peut donc pas dépasser 2^31.
+  Int64 max_size = math::min(max_message_size,static_cast<Int64>(INT32_MAX));
+  if (max_size<=0)
+    ARCANE_FATAL("Invalid max collective message size '{0}'",max_message_size);
+
   // D'abord, détermine pour chaque proc le nombre d'octets à envoyer
+  Int64UniqueArray send_sizes(nb_rank,0);
+  Int64UniqueArray recv_sizes(nb_rank,0);
   for( SerializeMessage* comm : m_send_serialize_infos ){
     auto* sbuf = comm->trueSerializer();
-    Span<Byte> val_buf = sbuf->globalBuffer();
-    Int32 rank = comm->destRank();
-    send_counts[rank] = arcaneCheckArraySize(val_buf.size());
+    send_sizes[comm->destRank()] = sbuf->globalBuffer().size();
   }
 
   // Fait un AllToAll pour connaitre combien de valeurs je dois recevoir des autres.
   {
     Timer::SimplePrinter sp(traceMng(),"ParallelExchanger: sending sizes with AllToAll");
-    pm->allToAll(send_counts,recv_counts,1);
+    pm->allToAll(send_sizes,recv_sizes,1);
   }
 
-  // Détermine le nombre total d'infos à envoyer et recevoir
-
-  // TODO: En cas débordement, il faudrait le faire en plusieurs morceaux
-  // ou alors revenir aux échanges point à point.
-  Int32 total_send = 0;
-  Int32 total_recv = 0;
-  Int64 int64_total_send = 0;
-  Int64 int64_total_recv = 0;
+  Int64 total_send = 0;
+  Int64 total_recv = 0;
+  Int64 max_pair_size = 0;
   for( Integer i=0; i<nb_rank; ++i ){
-    send_indexes[i] = total_send;
-    recv_indexes[i] = total_recv;
-    total_send += send_counts[i];
-    total_recv += recv_counts[i];
-    int64_total_send += send_counts[i];
-    int64_total_recv += recv_counts[i];
+    total_send += send_sizes[i];
+    total_recv += recv_sizes[i];
+    max_pair_size = math::max(max_pair_size,send_sizes[i]);
+  }
+
+  // Si un des rangs a trop de données à envoyer ou recevoir, l'échange est
+  // découpé en plusieurs étapes. A chaque étape, on échange au plus
+  // 'chunk_size' octets entre deux rangs, ce qui garantit que la taille
+  // totale d'une étape ne dépasse pas 'max_size'. Le découpage ne dépend
+  // que de la taille de chaque message et est donc le même pour l'envoyeur et
+  // le receveur.
+  Int64 chunk_size = max_size;
+  Int64 nb_step = 1;
+  bool need_split = (total_send>max_size || total_recv>max_size);
+  if (pm->reduce(Parallel::ReduceMax,(need_split) ? 1 : 0)!=0){
+    chunk_size = math::max(max_size / nb_rank,static_cast<Int64>(1));
+    max_pair_size = pm->reduce(Parallel::ReduceMax,max_pair_size);
+    nb_step = math::max((max_pair_size + chunk_size - 1) / chunk_size,static_cast<Int64>(1));
+    info() << "ParallelExchanger: split collective exchange in " << nb_step << " steps"
+           << " total_send=" << total_send << " total_recv=" << total_recv
+           << " max_size=" << max_size;
   }
 
-  // Vérifie qu'on ne déborde pas.
-  if (int64_total_send!=total_send)
-    ARCANE_FATAL("Message to send is too big size={0} max=2^31",int64_total_send);
-  if (int64_total_recv!=total_recv)
-    ARCANE_FATAL("Message to receive is too big size={0} max=2^31",int64_total_recv);
+  // Alloue les buffers de réception.
+  for( SerializeMessage* comm : m_recv_serialize_infos )
+    comm->trueSerializer()->preallocate(recv_sizes[comm->destRank()]);
 
-  ByteUniqueArray send_buf(total_send);
-  ByteUniqueArray recv_buf(total_recv);
+  Int32UniqueArray send_counts(nb_rank,0);
+  Int32UniqueArray send_indexes(nb_rank,0);
+  Int32UniqueArray recv_counts(nb_rank,0);
+  Int32UniqueArray recv_indexes(nb_rank,0);
+  ByteUniqueArray send_buf;
+  ByteUniqueArray recv_buf;
   bool is_verbose = (m_verbosity_level>=1);
-  if (m_verbosity_level>=2){
+
+  for( Int64 step=0; step<nb_step; ++step ){
+    // Position dans les messages du morceau à échanger pour cette étape.
+    Int64 offset = step * chunk_size;
+    auto step_count = [&](Int64 size) -> Int32 {
+      return static_cast<Int32>(math::min(math::max(size-offset,static_cast<Int64>(0)),chunk_size));
+    };
+    Int32 step_total_send = 0;
+    Int32 step_total_recv = 0;
     for( Integer i=0; i<nb_rank; ++i ){
-      if (send_counts[i]!=0 || recv_counts[i]!=0)
-        info() << "INFOS: rank=" << i << " send_count=" << send_counts[i]
-               << " send_idx=" << send_indexes[i]
-               << " recv_count=" << recv_counts[i]
-               << " recv_idx=" << recv_indexes[i];
+      send_counts[i] = step_count(send_sizes[i]);
+      recv_counts[i] = step_count(recv_sizes[i]);
+      send_indexes[i] = step_total_send;
+      recv_indexes[i] = step_total_recv;
+      step_total_send += send_counts[i];
+      step_total_recv += recv_counts[i];
     }
-  }
+    send_buf.resize(step_total_send);
+    recv_buf.resize(step_total_recv);
 
-  // Copie dans send_buf les infos des sérialisers.
-  for( SerializeMessage* comm : m_send_serialize_infos ){
-    auto* sbuf = comm->trueSerializer();
-    Span<Byte> val_buf = sbuf->globalBuffer();
-    Int32 rank = comm->destRank();
-    if (is_verbose)
-      info() << "SEND rank=" << rank << " size=" << send_counts[rank]
-             << " idx=" << send_indexes[rank]
-             << " buf_size=" << val_buf.size();
-    ByteArrayView dest_buf(send_counts[rank],&send_buf[send_indexes[rank]]);
-    dest_buf.copy(val_buf);
-  }
+    if (m_verbosity_level>=2){
+      for( Integer i=0; i<nb_rank; ++i ){
+        if (send_counts[i]!=0 || recv_counts[i]!=0)
+          info() << "INFOS: step=" << step << " rank=" << i << " send_count=" << send_counts[i]
+                 << " send_idx=" << send_indexes[i]
+                 << " recv_count=" << recv_counts[i]
+                 << " recv_idx=" << recv_indexes[i];
+      }
+    }
 
-  if (is_verbose)
-    info() << "AllToAllVariable total_send=" << total_send
-           << " total_recv=" << total_recv;
+    // Copie dans send_buf les infos des sérialisers.
+    for( SerializeMessage* comm : m_send_serialize_infos ){
+      auto* sbuf = comm->trueSerializer();
+      Int32 rank = comm->destRank();
+      Span<const Byte> val_buf = sbuf->globalBuffer().subSpan(offset,send_counts[rank]);
+      if (is_verbose)
+        info() << "SEND rank=" << rank << " size=" << send_counts[rank]
+               << " idx=" << send_indexes[rank]
+               << " buf_size=" << send_sizes[rank];
+      send_buf.span().subSpan(send_indexes[rank],send_counts[rank]).copy(val_buf);
+    }
 
-  {
-    Timer::SimplePrinter sp(traceMng(),"ParallelExchanger: sending values with AllToAll");
-    pm->allToAllVariable(send_buf,send_counts,send_indexes,recv_buf,recv_counts,recv_indexes);
-  }
-  // Recopie les données reçues dans le message correspondant.
-  for( SerializeMessage* comm : m_recv_serialize_infos ){
-    auto* sbuf = comm->trueSerializer();
-    Int32 rank = comm->destRank();
     if (is_verbose)
-      info() << "RECV rank=" << rank << " size=" << recv_counts[rank]
-             << " idx=" << recv_indexes[rank];
-    ByteArrayView orig_buf(recv_counts[rank],&recv_buf[recv_indexes[rank]]);
+      info() << "AllToAllVariable step=" << step << " total_send=" << step_total_send
+             << " total_recv=" << step_total_recv;
+
+    {
+      Timer::SimplePrinter sp(traceMng(),"ParallelExchanger: sending values with AllToAll");
+      pm->allToAllVariable(send_buf,send_counts,send_indexes,recv_buf,recv_counts,recv_indexes);
+    }
 
-    sbuf->preallocate(orig_buf.size());
-    sbuf->globalBuffer().copy(orig_buf);
-    sbuf->setFromSizes();
+    // Recopie les données reçues dans le message correspondant.
+    for( SerializeMessage* comm : m_recv_serialize_infos ){
+      auto* sbuf = comm->trueSerializer();
+      Int32 rank = comm->destRank();
+      if (is_verbose)
+        info() << "RECV rank=" << rank << " size=" << recv_counts[rank]
+               << " idx=" << recv_indexes[rank];
+      Span<const Byte> orig_buf = recv_buf.span().subSpan(recv_indexes[rank],recv_counts[rank]);
+      sbuf->globalBuffer().subSpan(offset,recv_counts[rank]).copy(orig_buf);
+    }
   }
+
+  for( SerializeMessage* comm : m_recv_serialize_infos )
+    comm->trueSerializer()->setFromSizes();
 }
 
 /*---------------------------------------------------------------------------*/
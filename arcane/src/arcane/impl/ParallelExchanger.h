@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelExchanger.h                                         (C) 2000-2022 */
+/* ParallelExchanger.h                                         (C) 2000-2024 */
 /*                                                                           */
 /* Echange d'informations entre processeurs.                                 */
 /*---------------------------------------------------------------------------*/
@@ -123,7 +123,7 @@ class ARCANE_IMPL_EXPORT ParallelExchanger
  private:
 
   void _initializeCommunicationsMessages();
-  void _processExchangeCollective();
+  void _processExchangeCollective(Int64 max_message_size);
   void _processExchangeWithControl(Int32 max_pending_message);
   void _processExchange(const ParallelExchangerOptions& options);
 };
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ScalarData.cc                                               (C) 2000-2023 */
+/* ScalarData.cc                                               (C) 2000-2024 */
 /*                                                                           */
 /* Donnée de type scalaire.                                                  */
 /*---------------------------------------------------------------------------*/
@@ -270,14 +270,13 @@ serialize(ISerializer* sbuf, IDataOperation*)
 {
   Integer nb_count = DataTypeTraitsT<DataType>::nbBasicType();
   typedef typename DataTypeTraitsT<DataType>::BasicType BasicType;
-  eDataType data_type = DataTypeTraitsT<BasicType>::type();
 
   DataType ttmp = m_value;
   ArrayView<BasicType> vtmp(1 * nb_count, reinterpret_cast<BasicType*>(&ttmp));
 
   ISerializer::eMode mode = sbuf->mode();
   if (mode == ISerializer::ModeReserve)
-    sbuf->reserveSpan(data_type, vtmp.size());
+    sbuf->reserveSpan(Span<const BasicType>(vtmp));
   else if (mode == ISerializer::ModePut)
     sbuf->putSpan(vtmp);
   else if (mode == ISerializer::ModeGet)
@@ -421,6 +420,7 @@ registerScalarDataFactory(IDataFactoryMng* dfm)
 {
   DataStorageFactory<ScalarDataT<Byte>>::registerDataFactory(dfm);
   DataStorageFactory<ScalarDataT<Real>>::registerDataFactory(dfm);
+  DataStorageFactory<ScalarDataT<Float32>>::registerDataFactory(dfm);
   DataStorageFactory<ScalarDataT<Int16>>::registerDataFactory(dfm);
   DataStorageFactory<ScalarDataT<Int32>>::registerDataFactory(dfm);
   DataStorageFactory<ScalarDataT<Int64>>::registerDataFactory(dfm);
@@ -435,6 +435,7 @@ registerScalarDataFactory(IDataFactoryMng* dfm)
 
 template class ScalarDataT<Byte>;
 template class ScalarDataT<Real>;
+template class ScalarDataT<Float32>;
 template class ScalarDataT<Int16>;
 template class ScalarDataT<Int32>;
 template class ScalarDataT<Int64>;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* TimeHistoryMng2.cc                                          (C) 2000-2023 */
+/* TimeHistoryMng2.cc                                          (C) 2000-2024 */
 /*                                                                           */
 /* Module gérant un historique de valeurs (Version 2).                       */
 /*---------------------------------------------------------------------------*/
@@ -18,6 +18,8 @@
 #include "arcane/utils/ITraceMng.h"
 #include "arcane/utils/PlatformUtils.h"
 #include "arcane/utils/OStringStream.h"
+#include "arcane/utils/ValueConvert.h"
+#include "arcane/utils/Exception.h"
 
 #include "arcane/ITimeHistoryMng.h"
 #include "arcane/IIOMng.h"
@@ -40,9 +42,14 @@
 
 #include "arcane/datatype/DataTypeTraits.h"
 
+#include <atomic>
+#include <exception>
 #include <map>
 #include <set>
 #include <variant>
+#include <thread>
+#include <memory>
+#include <vector>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -128,6 +135,15 @@ class TimeHistoryValue2
   virtual void applyTransformation(ITraceMng* msg,
                                    ITimeHistoryTransformer* v) =0;
 
+  /*!
+   * \brief Remplit \a iterations et \a values avec les valeurs à écrire.
+   *
+   * Seules les itérations strictement inférieures à \a max_iter sont
+   * conservées. Retourne \a false si la courbe ne doit pas être écrite.
+   */
+  virtual bool fillValuesToWrite(Integer max_iter,Int32Array& iterations,
+                                 RealArray& values) const =0;
+
   //! Retourne le nombre d'éléments dans le tableau.
   virtual Integer size() const =0;
 
@@ -253,14 +269,23 @@ class TimeHistoryValue2T
   {
     ARCANE_UNUSED(msg);
  
-    // Pour l'instant, on ne fait rien
-    if (m_shrink_history==true)
-      return;
     // Pour vérifier qu'on ne sauve pas plus d'itérations qu'il y en
     // a actuellement (ce qui peut arriver en cas de retour arrière).
     Integer max_iter = infos.times().size();
     RealUniqueArray values_to_write;
     Int32UniqueArray iterations_to_write;
+    if (!fillValuesToWrite(max_iter,iterations_to_write,values_to_write))
+      return;
+    TimeHistoryCurveInfo curve_info(name(),iterations_to_write,values_to_write,subSize());
+    writer->writeCurve(curve_info);
+  }
+
+  bool fillValuesToWrite(Integer max_iter,Int32Array& iterations_to_write,
+                         RealArray& values_to_write) const override
+  {
+    // Pour l'instant, on ne fait rien
+    if (m_shrink_history==true)
+      return false;
     Integer nb_iteration = m_iterations.size();
     iterations_to_write.reserve(nb_iteration);
     Integer sub_size = subSize();
@@ -273,8 +298,7 @@ class TimeHistoryValue2T
         iterations_to_write.add(iter);
       }
     }
-    TimeHistoryCurveInfo curve_info(name(),iterations_to_write,values_to_write,sub_size);
-    writer->writeCurve(curve_info);
+    return true;
   }
 
   void applyTransformation(ITraceMng* msg,ITimeHistoryTransformer* v) override
@@ -390,6 +414,52 @@ class GnuplotTimeHistoryCurveWriter2
   Directory m_gnuplot_path;
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Copie des courbes pour une écriture en tâche de fond.
+ *
+ * Cette instance contient une copie des temps et des valeurs des courbes
+ * au moment de l'appel à TimeHistoryMng2::dumpHistory(). Elle peut donc
+ * être écrite par un autre thread pendant que la boucle en temps continue
+ * à modifier les historiques.
+ */
+class TimeHistoryDumpSnapshot
+{
+ public:
+
+  struct Curve
+  {
+    String m_name;
+    Int32UniqueArray m_iterations;
+    RealUniqueArray m_values;
+    Integer m_sub_size = 0;
+  };
+
+ public:
+
+  //! Ecrit les courbes avec l'ensemble des écrivains.
+  void write()
+  {
+    TimeHistoryCurveWriterInfo infos(m_path,m_times.constView());
+    for( ITimeHistoryCurveWriter2* writer : m_writers ){
+      writer->beginWrite(infos);
+      for( const Curve& c : m_curves ){
+        TimeHistoryCurveInfo curve_info(c.m_name,c.m_iterations,c.m_values,c.m_sub_size);
+        writer->writeCurve(curve_info);
+      }
+      writer->endWrite();
+    }
+  }
+
+ public:
+
+  String m_path;
+  RealUniqueArray m_times;
+  std::vector<ITimeHistoryCurveWriter2*> m_writers;
+  std::vector<Curve> m_curves;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -413,6 +483,17 @@ class TimeHistoryMng2
   typedef HistoryList::const_iterator HistoryListConstIterator;
   typedef std::set<AnyRef<ITimeHistoryCurveWriter2>> CurveWriter2List;
 
+  //! Informations sur une courbe enregistrée via registerCurve()
+  struct CurveHandleInfo
+  {
+    String m_name;
+    Integer m_sub_size = 1;
+    bool m_end_time = true;
+    bool m_is_local = false;
+    //! Historique associé (créé lors du premier ajout de valeur)
+    TimeHistoryValue2T<Real>* m_value = nullptr;
+  };
+
  public:
 	
   TimeHistoryMng2(const ModuleBuildInfo& cb, bool add_entry_points=true);
@@ -452,6 +533,13 @@ class TimeHistoryMng2
     _addHistoryValue(name,values,end_time,is_local);
   }
 
+ public:
+
+  TimeHistoryCurveHandle registerCurve(const String& name,Integer sub_size,bool end_time,bool is_local) override;
+  void addValues(ConstArrayView<TimeHistoryCurveHandle> handles,RealConstArrayView values) override;
+  void addReducedValues(Parallel::eReduceType rt,ConstArrayView<TimeHistoryCurveHandle> handles,
+                        RealConstArrayView values) override;
+
  public:
 
   void timeHistoryBegin() override;
@@ -467,6 +555,7 @@ class TimeHistoryMng2
   void addCurveWriter(ITimeHistoryCurveWriter2* writer) override;
   void removeCurveWriter(ITimeHistoryCurveWriter2* writer) override
   {
+    _waitAsyncWrite();
     m_curve_writers2.erase(writer);
   }
   void removeCurveWriter(const String& name) override;
@@ -485,6 +574,16 @@ class TimeHistoryMng2
   bool isShrinkActive() const override { return m_is_shrink_active; }
   void setShrinkActive(bool is_active) override { m_is_shrink_active = is_active; }
 
+  bool isAsyncWrite() const override { return m_is_async_write; }
+  void setAsyncWrite(bool is_async) override
+  {
+    if (!is_async){
+      _waitAsyncWrite();
+      _checkAsyncWriteError();
+    }
+    m_is_async_write = is_async;
+  }
+
   void applyTransformation(ITimeHistoryTransformer* v) override;
 
  private:
@@ -494,6 +593,7 @@ class TimeHistoryMng2
   bool m_is_active; //!< Indique si le service est actif.
   bool m_is_dump_active; //!< Indique si les dump sont actifs
   bool m_is_shrink_active; //!< Indique si la compression de l'historique est active
+  bool m_is_async_write = false; //!< Indique si l'écriture des courbes est asynchrone
   String m_output_path;
   ObserverPool m_observer_pool;
   HistoryList m_history_list; //!< Liste des historiques
@@ -501,16 +601,30 @@ class TimeHistoryMng2
   VariableScalarString m_th_meta_data; //!< Infos des historiques
   VariableArrayReal m_th_global_time; //!< Tableau des instants de temps
   CurveWriter2List m_curve_writers2;
+  UniqueArray<CurveHandleInfo> m_curve_handles; //!< Courbes enregistrées
+  std::map<String,Int32> m_curve_handle_indexes; //!< Indice dans m_curve_handles d'une courbe
+  RealUniqueArray m_reduce_buffer; //!< Tampon pour addReducedValues()
+  std::thread m_async_write_thread; //!< Thread d'écriture asynchrone
+  std::exception_ptr m_async_write_error; //!< Première erreur de l'écriture asynchrone
+  std::atomic<bool> m_has_async_write_error = false; //!< Indique si m_async_write_error est positionné
 
  private:
 
   template<class DataType> void
   _addHistoryValue(const String& name,ConstArrayView<DataType> value,bool end_time,bool is_local);
+  template<class DataType> TimeHistoryValue2T<DataType>*
+  _findOrCreateHistoryValue(const String& name,Integer sub_size);
+  Integer _iteration(bool end_time);
+  void _checkHandles(ConstArrayView<TimeHistoryCurveHandle> handles,Integer nb_value);
   void _addCurveWriter(AnyRef<ITimeHistoryCurveWriter2> writer);
   void _removeCurveWriter(AnyRef<ITimeHistoryCurveWriter2> writer)
   {
+    _waitAsyncWrite();
     m_curve_writers2.erase(writer);
   }
+  void _dumpCurvesAsync(const String& path);
+  void _waitAsyncWrite();
+  void _checkAsyncWriteError();
 
   void _writeVariablesNotify();
   void _readVariables();
@@ -569,6 +683,8 @@ TimeHistoryMng2::
 void TimeHistoryMng2::
 _destroyAll()
 {
+  _waitAsyncWrite();
+
   for( ConstIterT<HistoryList> i(m_history_list); i(); ++i ){
     TimeHistoryValue2* v = i->second;
     delete v;
@@ -658,6 +774,8 @@ timeHistoryInit()
   m_is_master_io = sd->allReplicaParallelMng()->isMasterIO();
   info(4) << "TimeHistory is MasterIO ? " << m_is_master_io;
   m_enable_non_io_master_curves = ! platform::getEnvironmentVariable("ARCANE_ENABLE_NON_IO_MASTER_CURVES").null() ;
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TIME_HISTORY_ASYNC_WRITE", true))
+    m_is_async_write = (v.value()!=0);
 
   if (!m_is_master_io && !m_enable_non_io_master_curves)
     return;
@@ -706,6 +824,7 @@ void TimeHistoryMng2::
 _addCurveWriter(AnyRef<ITimeHistoryCurveWriter2> writer)
 {
   info() << "Add CurveWriter2 name=" << writer->name();
+  _waitAsyncWrite();
   if(m_is_master_io || m_enable_non_io_master_curves)
     m_curve_writers2.insert(writer);
 }
@@ -866,7 +985,11 @@ dumpHistory(bool is_verbose)
 
   if (is_verbose)
     info() << "Writing of the history of values path=" << out_dir.path();
-  if (m_is_master_io || m_enable_non_io_master_curves) {
+  if (m_is_async_write){
+    info() << "Begin asynchronous output history: " << platform::getCurrentDateTime();
+    _dumpCurvesAsync(out_dir.path());
+  }
+  else if (m_is_master_io || m_enable_non_io_master_curves) {
     info() << "Begin output history: " << platform::getCurrentDateTime();
 
     // Ecriture via version 2 des curve writers
@@ -938,6 +1061,8 @@ dumpCurves(ITimeHistoryCurveWriter2* writer)
 {
   if (!m_is_master_io && !m_enable_non_io_master_curves)
     return;
+  _waitAsyncWrite();
+  _checkAsyncWriteError();
   ITraceMng* tm = traceMng();
   TimeHistoryCurveWriterInfo infos(m_output_path,m_global_times.constView());
   writer->beginWrite(infos);
@@ -969,27 +1094,17 @@ applyTransformation(ITimeHistoryTransformer* v)
 template<class DataType> void TimeHistoryMng2::
 _addHistoryValue(const String& name,ConstArrayView<DataType> values,bool end_time,bool is_local)
 {
+  _checkAsyncWriteError();
+
   if (!m_is_master_io && !(m_enable_non_io_master_curves && is_local))
     return;
 
   if (!m_is_active)
     return;
 
-  Integer iteration = globalIteration();
-  
-  if (!end_time && iteration!=0)
-    --iteration;
+  Integer iteration = _iteration(end_time);
 
-  auto hl = m_history_list.find(name);
-  TimeHistoryValue2T<DataType>* th = nullptr;
-  // Trouvé, on le retourne.
-  if (hl!=m_history_list.end())
-    th = dynamic_cast< TimeHistoryValue2T<DataType>* >(hl->second);
-  else{
-    th = new TimeHistoryValue2T<DataType>(this,name,(Integer)m_history_list.size(),
-                                          values.size(),isShrinkActive());
-    m_history_list.insert(HistoryValueType(name,th));
-  }
+  TimeHistoryValue2T<DataType>* th = _findOrCreateHistoryValue<DataType>(name,values.size());
   if (!th)
     return;
   if (values.size()!=th->subSize()){
@@ -999,6 +1114,232 @@ _addHistoryValue(const String& name,ConstArrayView<DataType> values,bool end_tim
   th->addValue(values,iteration);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Retourne l'historique de nom \a name en le créant si besoin.
+ *
+ * Retourne nullptr si un historique de même nom mais d'un type différent
+ * existe déjà.
+ */
+template<class DataType> TimeHistoryValue2T<DataType>* TimeHistoryMng2::
+_findOrCreateHistoryValue(const String& name,Integer sub_size)
+{
+  auto hl = m_history_list.find(name);
+  // Trouvé, on le retourne.
+  if (hl!=m_history_list.end())
+    return dynamic_cast< TimeHistoryValue2T<DataType>* >(hl->second);
+  auto* th = new TimeHistoryValue2T<DataType>(this,name,(Integer)m_history_list.size(),
+                                              sub_size,isShrinkActive());
+  m_history_list.insert(HistoryValueType(name,th));
+  return th;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Integer TimeHistoryMng2::
+_iteration(bool end_time)
+{
+  Integer iteration = globalIteration();
+  if (!end_time && iteration!=0)
+    --iteration;
+  return iteration;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TimeHistoryCurveHandle TimeHistoryMng2::
+registerCurve(const String& name,Integer sub_size,bool end_time,bool is_local)
+{
+  if (name.null())
+    ARCANE_FATAL("null name for curve");
+  if (sub_size<=0)
+    ARCANE_FATAL("Invalid sub_size '{0}' for curve '{1}'",sub_size,name);
+
+  auto x = m_curve_handle_indexes.find(name);
+  if (x!=m_curve_handle_indexes.end()){
+    Int32 index = x->second;
+    const CurveHandleInfo& chi = m_curve_handles[index];
+    if (chi.m_sub_size!=sub_size)
+      ARCANE_FATAL("Bad subsize for curve '{0}' current={1} old={2}",
+                   name,sub_size,chi.m_sub_size);
+    return TimeHistoryCurveHandle(index);
+  }
+
+  Int32 index = m_curve_handles.size();
+  CurveHandleInfo chi;
+  chi.m_name = name;
+  chi.m_sub_size = sub_size;
+  chi.m_end_time = end_time;
+  chi.m_is_local = is_local;
+  m_curve_handles.add(chi);
+  m_curve_handle_indexes.insert(std::make_pair(name,index));
+  return TimeHistoryCurveHandle(index);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TimeHistoryMng2::
+_checkHandles(ConstArrayView<TimeHistoryCurveHandle> handles,Integer nb_value)
+{
+  Int32 nb_handle = m_curve_handles.size();
+  Integer total_size = 0;
+  for( TimeHistoryCurveHandle h : handles ){
+    Int32 index = h.index();
+    if (index<0 || index>=nb_handle)
+      ARCANE_FATAL("Invalid curve handle index={0} nb_registered={1}",index,nb_handle);
+    total_size += m_curve_handles[index].m_sub_size;
+  }
+  if (total_size!=nb_value)
+    ARCANE_FATAL("Bad number of values for curves expected={0} given={1}",
+                 total_size,nb_value);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TimeHistoryMng2::
+addValues(ConstArrayView<TimeHistoryCurveHandle> handles,RealConstArrayView values)
+{
+  _checkAsyncWriteError();
+  _checkHandles(handles,values.size());
+
+  if (!m_is_active)
+    return;
+
+  Integer iteration_end = _iteration(true);
+  Integer iteration_begin = _iteration(false);
+  Integer pos = 0;
+  for( TimeHistoryCurveHandle h : handles ){
+    CurveHandleInfo& chi = m_curve_handles[h.index()];
+    Integer sub_size = chi.m_sub_size;
+    RealConstArrayView curve_values = values.subView(pos,sub_size);
+    pos += sub_size;
+    if (!m_is_master_io && !(m_enable_non_io_master_curves && chi.m_is_local))
+      continue;
+    if (!chi.m_value){
+      chi.m_value = _findOrCreateHistoryValue<Real>(chi.m_name,sub_size);
+      if (!chi.m_value)
+        ARCANE_FATAL("Curve '{0}' already exists with a non 'Real' data type",chi.m_name);
+      if (chi.m_value->subSize()!=sub_size)
+        ARCANE_FATAL("Bad subsize for curve '{0}' current={1} old={2}",
+                     chi.m_name,sub_size,chi.m_value->subSize());
+    }
+    chi.m_value->addValue(curve_values,(chi.m_end_time) ? iteration_end : iteration_begin);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TimeHistoryMng2::
+addReducedValues(Parallel::eReduceType rt,ConstArrayView<TimeHistoryCurveHandle> handles,
+                 RealConstArrayView values)
+{
+  _checkHandles(handles,values.size());
+
+  // La réduction est collective et doit donc être faite même si
+  // l'instance n'est pas active.
+  m_reduce_buffer.resize(values.size());
+  m_reduce_buffer.copy(values);
+  parallelMng()->reduce(rt,m_reduce_buffer.view());
+
+  addValues(handles,m_reduce_buffer);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Copie les courbes et lance leur écriture dans un thread.
+ *
+ * On attend la fin de l'écriture précédente avant d'en lancer une
+ * nouvelle, ce qui garantit que les écrivains ne sont pas utilisés
+ * simultanément par plusieurs threads. Une exception levée lors de
+ * l'écriture est conservée et signalée par _checkAsyncWriteError().
+ */
+void TimeHistoryMng2::
+_dumpCurvesAsync(const String& path)
+{
+  _waitAsyncWrite();
+  _checkAsyncWriteError();
+
+  auto snapshot = std::make_shared<TimeHistoryDumpSnapshot>();
+  snapshot->m_path = path;
+  snapshot->m_times = m_global_times;
+  Integer max_iter = m_global_times.size();
+  for( auto& cw_ref : m_curve_writers2 )
+    snapshot->m_writers.push_back(cw_ref.get());
+  if (snapshot->m_writers.empty())
+    return;
+  snapshot->m_curves.reserve(m_history_list.size());
+  for( ConstIterT<HistoryList> i(m_history_list); i(); ++i ){
+    const TimeHistoryValue2& th = *(i->second);
+    TimeHistoryDumpSnapshot::Curve c;
+    if (!th.fillValuesToWrite(max_iter,c.m_iterations,c.m_values))
+      continue;
+    c.m_name = th.name();
+    c.m_sub_size = th.subSize();
+    snapshot->m_curves.push_back(std::move(c));
+  }
+
+  m_async_write_thread = std::thread([this,snapshot]() {
+    try{
+      snapshot->write();
+    }
+    catch(...){
+      m_async_write_error = std::current_exception();
+      m_has_async_write_error = true;
+    }
+  });
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TimeHistoryMng2::
+_waitAsyncWrite()
+{
+  if (m_async_write_thread.joinable())
+    m_async_write_thread.join();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Signale l'erreur éventuelle de la dernière écriture asynchrone.
+ *
+ * Si l'écriture a échoué, attend la fin du thread d'écriture et lève une
+ * exception contenant le message de l'erreur initiale. L'erreur n'est
+ * signalée qu'une seule fois.
+ */
+void TimeHistoryMng2::
+_checkAsyncWriteError()
+{
+  if (!m_has_async_write_error.load())
+    return;
+  _waitAsyncWrite();
+  std::exception_ptr ex = m_async_write_error;
+  m_async_write_error = nullptr;
+  m_has_async_write_error = false;
+  String message;
+  try{
+    std::rethrow_exception(ex);
+  }
+  catch(const Exception& e){
+    message = e.message();
+  }
+  catch(const std::exception& e){
+    message = e.what();
+  }
+  catch(...){
+    message = "Unknown exception";
+  }
+  ARCANE_FATAL("Error during asynchronous write of time history curves: {0}",message);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* TimeLoopMng.cc                                              (C) 2000-2023 */
+/* TimeLoopMng.cc                                              (C) 2000-2024 */
 /*                                                                           */
 /* Gestionnaire de la boucle en temps.                                       */
 /*---------------------------------------------------------------------------*/
@@ -26,6 +26,7 @@
 #include "arcane/utils/OStringStream.h"
 #include "arcane/utils/FloatingPointExceptionSentry.h"
 #include "arcane/utils/JSONWriter.h"
+#include "arcane/utils/ParallelLoopOptions.h"
 
 #include "arcane/core/IApplication.h"
 #include "arcane/core/IServiceLoader.h"
@@ -73,6 +74,7 @@
 #include "arcane/core/parallel/IStat.h"
 #include "arcane/core/IVariableSynchronizer.h"
 #include "arcane/core/IVariableSynchronizerMng.h"
+#include "arcane/core/Concurrency.h"
 
 #include "arcane/accelerator/core/IAcceleratorMng.h"
 #include "arcane/accelerator/core/Runner.h"
@@ -80,7 +82,10 @@
 #include "arcane/impl/DefaultBackwardMng.h"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <map>
+#include <vector>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -304,6 +309,9 @@ class TimeLoopMng
   //! Pour test, point d'entrée spécifique à appeler
   String m_specific_entry_point_name;
 
+  //! Indique si on exécute en concurrence les points d'entrée indépendants
+  bool m_use_concurrent_entry_points = false;
+
  private:
 
   void _execOneEntryPoint(IEntryPoint* ic, Integer index_value = 0, bool do_verif = false);
@@ -316,6 +324,10 @@ class TimeLoopMng
   void _fillModuleFactoryMap();
   void _createSingletonServices(IServiceLoader* service_loader);
   void _callSpecificEntryPoint();
+  bool _isConcurrentEntryPointsActive();
+  void _execLoopEntryPointsConcurrently();
+  void _execConcurrentEntryPoints(ConstArrayView<IEntryPoint*> entry_points);
+  static bool _isIndependent(IEntryPoint* ep1, IEntryPoint* ep2);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -370,6 +382,10 @@ TimeLoopMng(ISubDomain* sd)
     if (!s.null())
       m_verif_same_parallel = true;
   }
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_CONCURRENT_ENTRY_POINTS", true))
+    m_use_concurrent_entry_points = (v.value() != 0);
+  if (m_use_concurrent_entry_points)
+    info() << "Use concurrent execution of independent entry points";
 
   m_observables.add(eTimeLoopEventType::BeginEntryPoint);
   m_observables.add(eTimeLoopEventType::EndEntryPoint);
@@ -924,22 +940,26 @@ doOneIteration()
     Integer index =0;
     sd->timeStats()->notifyNewIterationLoop();
     Timer::Action ts_action(sd,"LoopEntryPoints");
-    for( EntryPointList::Enumerator i(m_loop_entry_points); ++i; ++index ){
-      IEntryPoint* ep = *i;
-      IModule* mod = ep->module();
-      if (mod && mod->disabled()){
-        continue;
-        //warning() << "MODULE " << mod->name() << " is disabled";
-      }
-      try{
-        _execOneEntryPoint(*i, index, true);
-      } catch(const GoBackwardException&){
-        m_backward_mng->goBackward();
-      } catch(...){ // On remonte toute autre exception
-        throw;
-      }
-      if (m_backward_mng->isBackwardEnabled()){
-        break;
+    if (_isConcurrentEntryPointsActive())
+      _execLoopEntryPointsConcurrently();
+    else{
+      for( EntryPointList::Enumerator i(m_loop_entry_points); ++i; ++index ){
+        IEntryPoint* ep = *i;
+        IModule* mod = ep->module();
+        if (mod && mod->disabled()){
+          continue;
+          //warning() << "MODULE " << mod->name() << " is disabled";
+        }
+        try{
+          _execOneEntryPoint(*i, index, true);
+        } catch(const GoBackwardException&){
+          m_backward_mng->goBackward();
+        } catch(...){ // On remonte toute autre exception
+          throw;
+        }
+        if (m_backward_mng->isBackwardEnabled()){
+          break;
+        }
       }
     }
     if (!m_verification_at_entry_point && !m_verification_only_at_exit)
@@ -973,6 +993,199 @@ doOneIteration()
   return 0;
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Indique si on peut exécuter en concurrence les points d'entrée.
+ *
+ * Ce mode n'est pas utilisé si les tâches ne sont pas actives ou si
+ * des traitements doivent être effectués avant et après chaque point
+ * d'entrée (vérifications ou observateurs).
+ */
+bool TimeLoopMng::
+_isConcurrentEntryPointsActive()
+{
+  if (!m_use_concurrent_entry_points)
+    return false;
+  if (!TaskFactory::isActive())
+    return false;
+  if (m_verification_at_entry_point && !m_verification_only_at_exit)
+    return false;
+  if (m_observables[eTimeLoopEventType::BeginEntryPoint]->hasObservers())
+    return false;
+  if (m_observables[eTimeLoopEventType::EndEntryPoint]->hasObservers())
+    return false;
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Indique si \a ep1 et \a ep2 peuvent être exécutés en concurrence.
+ *
+ * C'est le cas si aucun des deux ne modifie une variable utilisée par
+ * l'autre.
+ */
+bool TimeLoopMng::
+_isIndependent(IEntryPoint* ep1, IEntryPoint* ep2)
+{
+  ConstArrayView<IVariable*> write1 = ep1->writeVariables();
+  ConstArrayView<IVariable*> write2 = ep2->writeVariables();
+  for (IVariable* var : write1)
+    if (write2.contains(var) || ep2->readVariables().contains(var))
+      return false;
+  for (IVariable* var : write2)
+    if (ep1->readVariables().contains(var))
+      return false;
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécute les points d'entrée de la boucle de calcul suivant leur
+ * graphe de dépendance.
+ *
+ * Le graphe contient un arc entre deux points d'entrée actifs si le
+ * second est après le premier dans la boucle en temps et qu'ils ne sont
+ * pas indépendants (au sens de _isIndependent()). Un point d'entrée qui
+ * n'a pas déclaré ses variables dépend de tous ceux qui le précèdent et
+ * tous ceux qui le suivent dépendent de lui.
+ *
+ * Chaque point d'entrée est associé à un niveau égal à la longueur du plus
+ * long chemin qui y mène dans le graphe. Les niveaux sont exécutés les uns
+ * après les autres et les points d'entrée d'un même niveau, qui sont
+ * indépendants deux à deux, sont exécutés en concurrence. Deux points
+ * d'entrée indépendants peuvent donc être exécutés ensemble même s'ils
+ * ne sont pas consécutifs dans la boucle en temps. L'ordre entre deux
+ * points d'entrée dépendants est conservé.
+ *
+ * Les vérifications éventuelles sont faites à la fin de chaque niveau,
+ * dans l'ordre de la boucle en temps.
+ */
+void TimeLoopMng::
+_execLoopEntryPointsConcurrently()
+{
+  // Points d'entrée actifs et leur indice dans la boucle en temps, pour
+  // que les vérifications utilisent le même indice qu'en séquentiel.
+  UniqueArray<IEntryPoint*> entry_points;
+  UniqueArray<Integer> entry_point_indexes;
+  {
+    Integer index = 0;
+    for( EntryPointList::Enumerator i(m_loop_entry_points); ++i; ++index ){
+      IEntryPoint* ep = *i;
+      IModule* mod = ep->module();
+      if (mod && mod->disabled())
+        continue;
+      entry_points.add(ep);
+      entry_point_indexes.add(index);
+    }
+  }
+
+  // Calcule le niveau de chaque point d'entrée dans le graphe.
+  Integer nb_entry_point = entry_points.size();
+  UniqueArray<Integer> levels(nb_entry_point);
+  Integer nb_level = 0;
+  // Plus petit niveau possible, qui est après le dernier point d'entrée
+  // n'ayant pas déclaré ses variables.
+  Integer min_level = 0;
+  for( Integer i=0; i<nb_entry_point; ++i ){
+    IEntryPoint* ep = entry_points[i];
+    Integer level = min_level;
+    if (ep->hasDeclaredVariables()){
+      for( Integer j=0; j<i; ++j )
+        if (levels[j]>=level && !_isIndependent(entry_points[j],ep))
+          level = levels[j] + 1;
+    }
+    else{
+      level = nb_level;
+      min_level = level + 1;
+    }
+    levels[i] = level;
+    nb_level = math::max(nb_level,level+1);
+  }
+
+  bool do_verif = m_verification_at_entry_point && !m_verification_only_at_exit;
+  UniqueArray<IEntryPoint*> group;
+  UniqueArray<Integer> group_indexes;
+  for( Integer level=0; level<nb_level; ++level ){
+    group.clear();
+    group_indexes.clear();
+    for( Integer i=0; i<nb_entry_point; ++i )
+      if (levels[i]==level){
+        group.add(entry_points[i]);
+        group_indexes.add(entry_point_indexes[i]);
+      }
+    if (group.size()==1){
+      try{
+        _execOneEntryPoint(group[0], group_indexes[0], true);
+      } catch(const GoBackwardException&){
+        m_backward_mng->goBackward();
+      }
+    }
+    else{
+      _execConcurrentEntryPoints(group);
+      if (do_verif)
+        for( Integer i=0, n=group.size(); i<n; ++i )
+          _checkVerif(group[i]->name(),group_indexes[i],true);
+    }
+    if (m_backward_mng->isBackwardEnabled())
+      break;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécute en concurrence les points d'entrée \a entry_points.
+ *
+ * Les statistiques temporelles ne pouvant pas être mises à jour par
+ * plusieurs threads, le temps de chaque point d'entrée est ajouté
+ * une fois qu'ils sont tous terminés. Si un des points d'entrée lève
+ * une exception, elle est relancée après la fin de tous les autres.
+ */
+void TimeLoopMng::
+_execConcurrentEntryPoints(ConstArrayView<IEntryPoint*> entry_points)
+{
+  ITimeStats* time_stats = m_sub_domain->timeStats();
+  bool is_gathering = time_stats->isGathering();
+  Integer nb_entry_point = entry_points.size();
+  std::vector<std::exception_ptr> exceptions(nb_entry_point);
+  std::atomic<bool> has_go_backward = false;
+
+  if (is_gathering)
+    time_stats->beginConcurrentActions();
+  {
+    ParallelLoopOptions options;
+    options.setGrainSize(1);
+    arcaneParallelFor(0,nb_entry_point,options,[&](Integer begin,Integer size){
+      for( Integer i=begin; i<(begin+size); ++i ){
+        try{
+          entry_points[i]->executeEntryPointConcurrently();
+        } catch(const GoBackwardException&){
+          has_go_backward = true;
+        } catch(...){
+          exceptions[i] = std::current_exception();
+        }
+      }
+    });
+  }
+  if (is_gathering){
+    time_stats->endConcurrentActions();
+    for( IEntryPoint* ep : entry_points ){
+      String action_path[2] = { ep->module()->name(), ep->name() };
+      time_stats->addConcurrentActionTime(ConstArrayView<String>(2,action_path),
+                                          TP_Computation,ep->lastElapsedTime());
+    }
+  }
+
+  for( const std::exception_ptr& ex : exceptions )
+    if (ex)
+      std::rethrow_exception(ex);
+  if (has_go_backward)
+    m_backward_mng->goBackward();
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -330,6 +330,8 @@ findOrCreateSubAction(const String& name)
 void TimeStats::
 beginAction(const String& action_name)
 {
+  if (m_is_in_concurrent_actions)
+    return;
   _checkGathering();
   Action* current_action = _currentAction();
   current_action->addPhaseValue(_currentPhaseValue());
@@ -347,6 +349,8 @@ void TimeStats::
 endAction(const String& action_name,bool print_time)
 {
   ARCANE_UNUSED(action_name);
+  if (m_is_in_concurrent_actions)
+    return;
   _checkGathering();
   m_need_compute_elapsed_time = true;
   TimeStats::PhaseValue pv = _currentPhaseValue();
@@ -367,6 +371,8 @@ endAction(const String& action_name,bool print_time)
 void TimeStats::
 beginPhase(eTimePhase phase_type)
 {
+  if (m_is_in_concurrent_actions)
+    return;
   _checkGathering();
   TimeStats::PhaseValue pv = _currentPhaseValue();
   m_current_action->addPhaseValue(pv);
@@ -381,6 +387,8 @@ void TimeStats::
 endPhase(eTimePhase phase_type)
 {
   ARCANE_UNUSED(phase_type);
+  if (m_is_in_concurrent_actions)
+    return;
   _checkGathering();
   m_need_compute_elapsed_time = true;
   TimeStats::PhaseValue pv = _currentPhaseValue();
@@ -395,6 +403,52 @@ endPhase(eTimePhase phase_type)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void TimeStats::
+beginConcurrentActions()
+{
+  _checkGathering();
+  if (m_is_in_concurrent_actions)
+    ARCANE_FATAL("Already in a concurrent section");
+  _currentAction()->addPhaseValue(_currentPhaseValue());
+  m_is_in_concurrent_actions = true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TimeStats::
+endConcurrentActions()
+{
+  _checkGathering();
+  if (!m_is_in_concurrent_actions)
+    ARCANE_FATAL("Not in a concurrent section");
+  m_is_in_concurrent_actions = false;
+  // Le temps écoulé depuis beginConcurrentActions() n'est attribué à
+  // aucune action car il sera remplacé par celui des actions concurrentes.
+  _currentPhaseValue();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TimeStats::
+addConcurrentActionTime(ConstArrayView<String> action_path, eTimePhase phase, Real elapsed_time)
+{
+  _checkGathering();
+  if (m_is_in_concurrent_actions)
+    ARCANE_FATAL("Can not add action time in a concurrent section");
+  m_need_compute_elapsed_time = true;
+  Action* action = _currentAction();
+  for (const String& name : action_path) {
+    action = action->findOrCreateSubAction(name);
+    action->addNbCalled();
+  }
+  action->addPhaseValue(PhaseValue(phase, elapsed_time, elapsed_time));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 Real TimeStats::
 elapsedTime(eTimePhase phase)
 {
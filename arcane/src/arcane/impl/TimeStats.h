@@ -20,6 +20,7 @@
 
 #include "arcane/core/ITimeStats.h"
 
+#include <atomic>
 #include <stack>
 
 /*---------------------------------------------------------------------------*/
@@ -115,6 +116,13 @@ class TimeStats
   void beginPhase(eTimePhase phase_type) override;
   void endPhase(eTimePhase phase_type) override;
 
+ public:
+
+  void beginConcurrentActions() override;
+  void endConcurrentActions() override;
+  void addConcurrentActionTime(ConstArrayView<String> action_path,
+                               eTimePhase phase, Real elapsed_time) override;
+
  public:
   
   Real elapsedTime(eTimePhase phase) override;
@@ -157,6 +165,8 @@ class TimeStats
   bool m_need_compute_elapsed_time = false;
   std::ostringstream m_full_stats_str;
   bool m_full_stats = false;
+  //! Indique si on est dans une section avec des actions concurrentes
+  std::atomic<bool> m_is_in_concurrent_actions = false;
   String m_name;
   ITimeMetricCollector* m_metric_collector = nullptr;
 
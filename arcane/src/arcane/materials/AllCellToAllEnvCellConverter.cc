@@ -17,6 +17,7 @@
 #include "arcane/core/IItemFamily.h"
 #include "arcane/core/ItemEnumerator.h"
 #include "arcane/core/ItemGroup.h"
+#include "arcane/core/materials/CellMajorComponentIndex.h"
 #include "arcane/core/materials/internal/IMeshMaterialMngInternal.h"
 
 /*---------------------------------------------------------------------------*/
@@ -66,6 +67,15 @@ maxNbEnvPerCell() const
   // 1. runcmd_enum_cell pour remplir un array de max env de size max cell id
   // 2. runcmd_loop sur le array avec un reducer max
   // A voir si c'est interessant...
+  // Si l'index maille -> milieux est disponible, le nombre de milieux
+  // de chaque maille se déduit directement de ses positions.
+  if (const CellMajorComponentIndex* index = _validIndex()) {
+    SmallSpan<const Int32> offsets = index->cellOffsets();
+    Int32 max_nb_env(0);
+    for (Int32 i = 0, n = offsets.size() - 1; i < n; ++i)
+      max_nb_env = std::max(max_nb_env, offsets[i + 1] - offsets[i]);
+    return max_nb_env;
+  }
   CellToAllEnvCellConverter allenvcell_converter(m_material_mng);
   Int32 max_nb_env(0);
   ENUMERATE_CELL(icell, m_material_mng->mesh()->allCells()) {
@@ -102,22 +112,7 @@ create(IMeshMaterialMng* mm, IMemoryAllocator* alloc)
   _instance->m_mem_pool = reinterpret_cast<ComponentItemLocalId*>(alloc->allocate(sizeof(ComponentItemLocalId) * pool_size));
   std::fill_n(_instance->m_mem_pool, pool_size, ComponentItemLocalId());
 
-  CellToAllEnvCellConverter all_env_cell_converter(mm);
-  ENUMERATE_CELL (icell, mm->mesh()->allCells()) {
-    Int32 cid = icell->itemLocalId();
-    AllEnvCell all_env_cell = all_env_cell_converter[CellLocalId(cid)];
-    Integer nb_env(all_env_cell.nbEnvironment());
-    if (nb_env) {
-      Integer i(0);
-      Integer offset(cid * _instance->m_current_max_nb_env);
-      ENUMERATE_CELL_ENVCELL (ienvcell, all_env_cell) {
-        EnvCell ev = *ienvcell;
-        _instance->m_mem_pool[offset + i] = ComponentItemLocalId(ev._varIndex());
-        ++i;
-      }
-      _instance->m_allcell_allenvcell[cid] = Span<ComponentItemLocalId>(_instance->m_mem_pool+offset, nb_env);
-    }
-  }
+  _instance->_fillValues();
   return _instance;
 }
 
@@ -156,23 +151,71 @@ bruteForceUpdate()
       std::fill_n(m_mem_pool, pool_size, ComponentItemLocalId());
     }
     // mise a jour des valeurs
-    CellToAllEnvCellConverter all_env_cell_converter(m_material_mng);
-    ENUMERATE_CELL (icell, m_material_mng->mesh()->allCells()) {
-      Int32 cid = icell->itemLocalId();
-      AllEnvCell all_env_cell = all_env_cell_converter[CellLocalId(cid)];
-      Integer nb_env(all_env_cell.nbEnvironment());
+    _fillValues();
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Retourne l'index maille -> milieux du gestionnaire s'il est
+ * actif et à jour pour le nombre courant de mailles.
+ */
+const CellMajorComponentIndex* AllCellToAllEnvCell::
+_validIndex() const
+{
+  const CellMajorComponentIndex* index = m_material_mng->cellToAllEnvCellIndex();
+  if (index && index->cellOffsets().size() == (m_size + 1))
+    return index;
+  return nullptr;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Remplit la table à partir des milieux de chaque maille.
+ *
+ * Le pool mémoire doit avoir été alloué avec m_current_max_nb_env valeurs
+ * par maille. Si l'index maille -> milieux est disponible, la table est
+ * remplie par simple recopie de cet index.
+ */
+void AllCellToAllEnvCell::
+_fillValues()
+{
+  if (const CellMajorComponentIndex* index = _validIndex()) {
+    SmallSpan<const Int32> offsets = index->cellOffsets();
+    SmallSpan<const MatVarIndex> matvar_indexes = index->matVarIndexes();
+    for (Int32 cid = 0; cid < m_size; ++cid) {
+      const Int32 begin = offsets[cid];
+      const Int32 nb_env = offsets[cid + 1] - begin;
       if (nb_env) {
-        Integer i(0);
-        Integer offset(cid * m_current_max_nb_env);
-        ENUMERATE_CELL_ENVCELL (ienvcell, all_env_cell) {
-          EnvCell ev = *ienvcell;
-          m_mem_pool[offset+i] = ComponentItemLocalId(ev._varIndex());
-          ++i;
-        }
-        m_allcell_allenvcell[cid] = Span<ComponentItemLocalId>(m_mem_pool+offset, nb_env);
-      } else {
+        const Int32 offset = cid * m_current_max_nb_env;
+        for (Int32 i = 0; i < nb_env; ++i)
+          m_mem_pool[offset + i] = ComponentItemLocalId(matvar_indexes[begin + i]);
+        m_allcell_allenvcell[cid] = Span<ComponentItemLocalId>(m_mem_pool + offset, nb_env);
+      }
+      else
         m_allcell_allenvcell[cid] = Span<ComponentItemLocalId>();
+    }
+    return;
+  }
+
+  CellToAllEnvCellConverter all_env_cell_converter(m_material_mng);
+  ENUMERATE_CELL (icell, m_material_mng->mesh()->allCells()) {
+    Int32 cid = icell->itemLocalId();
+    AllEnvCell all_env_cell = all_env_cell_converter[CellLocalId(cid)];
+    Integer nb_env(all_env_cell.nbEnvironment());
+    if (nb_env) {
+      Integer i(0);
+      Integer offset(cid * m_current_max_nb_env);
+      ENUMERATE_CELL_ENVCELL (ienvcell, all_env_cell) {
+        EnvCell ev = *ienvcell;
+        m_mem_pool[offset+i] = ComponentItemLocalId(ev._varIndex());
+        ++i;
       }
+      m_allcell_allenvcell[cid] = Span<ComponentItemLocalId>(m_mem_pool+offset, nb_env);
+    } else {
+      m_allcell_allenvcell[cid] = Span<ComponentItemLocalId>();
     }
   }
 }
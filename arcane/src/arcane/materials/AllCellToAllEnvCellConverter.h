@@ -103,6 +103,8 @@ class ARCANE_MATERIALS_EXPORT AllCellToAllEnvCell
 
  private:
   void reset();
+  void _fillValues();
+  const CellMajorComponentIndex* _validIndex() const;
 
  private:
   IMeshMaterialMng* m_material_mng = nullptr;
@@ -416,6 +416,16 @@ forceRecompute(bool compute_all)
   if (arcaneIsCheck())
     _checkLocalIdsCoherency();
 
+  // Met à jour l'index maille -> milieux s'il est actif. Lors d'une
+  // modification incrémentale, seuls les milieux notifiés par
+  // IncrementalComponentModifier sont mis à jour.
+  if (CellMajorComponentIndex* index = m_material_mng->_cellToAllEnvCellIndex()) {
+    if (compute_all)
+      index->recompute();
+    else
+      index->update();
+  }
+
   // Met à jour le AllCellToAllEnvCell s'il a été initialisé si la fonctionnalité est activé
   if (m_material_mng->isCellToAllEnvCellForRunCommand()) {
     auto* all_cell_to_all_env_cell(m_material_mng->_internalApi()->getAllCellToAllEnvCell());
@@ -475,7 +485,8 @@ _printAllEnvCells(CellVectorView ids)
 void AllEnvData::
 _copyBetweenPartialsAndGlobals(Int32ConstArrayView pure_local_ids,
                                Int32ConstArrayView partial_indexes,
-                               Int32 indexer_index, bool is_add_operation)
+                               Int32 indexer_index, bool is_add_operation,
+                               RunQueue* queue)
 {
   if (pure_local_ids.empty())
     return;
@@ -486,9 +497,9 @@ _copyBetweenPartialsAndGlobals(Int32ConstArrayView pure_local_ids,
   //Integer indexer_index = indexer->index();
   auto func = [=](IMeshMaterialVariable* mv) {
     if (is_add_operation)
-      mv->_internalApi()->copyGlobalToPartial(indexer_index, pure_local_ids, partial_indexes);
+      mv->_internalApi()->copyGlobalToPartial(indexer_index, pure_local_ids, partial_indexes, queue);
     else
-      mv->_internalApi()->copyPartialToGlobal(indexer_index, pure_local_ids, partial_indexes);
+      mv->_internalApi()->copyPartialToGlobal(indexer_index, pure_local_ids, partial_indexes, queue);
   };
   functor::apply(m_material_mng, &MeshMaterialMng::visitVariables, func);
 }
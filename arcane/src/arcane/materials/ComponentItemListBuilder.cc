@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ComponentItemListBuilder.cc                                 (C) 2000-2023 */
+/* ComponentItemListBuilder.cc                                 (C) 2000-2024 */
 /*                                                                           */
 /* Classe d'aide à la construction d'une liste de ComponentItem.             */
 /*---------------------------------------------------------------------------*/
@@ -14,6 +14,8 @@
 #include "arcane/materials/internal/ComponentItemListBuilder.h"
 #include "arcane/materials/internal/MeshMaterialVariableIndexer.h"
 
+#include "arcane/utils/PlatformUtils.h"
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -28,6 +30,9 @@ ComponentItemListBuilder(MeshMaterialVariableIndexer* var_indexer,
                          Integer begin_index_in_partial)
 : m_component_index(var_indexer->index()+1)
 , m_index_in_partial(begin_index_in_partial)
+, m_pure_matvar_indexes(platform::getAcceleratorHostMemoryAllocator())
+, m_partial_matvar_indexes(platform::getAcceleratorHostMemoryAllocator())
+, m_partial_local_ids(platform::getAcceleratorHostMemoryAllocator())
 , m_indexer(var_indexer)
 {
   Integer reserve_size = 4000;
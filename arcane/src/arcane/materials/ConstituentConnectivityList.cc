@@ -13,6 +13,8 @@
 
 #include "arcane/materials/internal/ConstituentConnectivityList.h"
 
+#include "arcane/utils/PlatformUtils.h"
+
 #include "arcane/core/IItemFamily.h"
 #include "arcane/core/MeshUtils.h"
 #include "arcane/core/internal/IDataInternal.h"
@@ -205,6 +207,7 @@ ConstituentConnectivityList(MeshMaterialMng* mm)
 : TraceAccessor(mm->traceMng())
 , m_material_mng(mm)
 , m_container(new Container(mm->meshHandle(), String("ComponentEnviroment") + mm->name()))
+, m_environment_for_materials(platform::getAcceleratorHostMemoryAllocator())
 {
 }
 
@@ -385,6 +388,21 @@ cellNbMaterial(CellLocalId cell_id, Int16 env_id) const
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+ConstituentConnectivityList::CellNbMaterialView ConstituentConnectivityList::
+cellNbMaterialView() const
+{
+  CellNbMaterialView view;
+  const ConstituentContainer& material = m_container->m_material;
+  view.m_nb_material = material.m_nb_component_as_array.view();
+  view.m_material_index = material.m_component_index_as_array.view();
+  view.m_material_list = material.m_component_list_as_array.view();
+  view.m_environment_for_materials = m_environment_for_materials.view();
+  return view;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void ConstituentConnectivityList::
 notifySourceFamilyLocalIdChanged([[maybe_unused]] Int32ConstArrayView new_to_old_ids)
 {
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ConstituentModifierWorkInfo.h                               (C) 2000-2023 */
+/* ConstituentModifierWorkInfo.h                               (C) 2000-2024 */
 /*                                                                           */
 /* Structure de travail utilisée lors de la modification des constituants.   */
 /*---------------------------------------------------------------------------*/
@@ -15,6 +15,8 @@
 
 #include "arcane/materials/internal/MaterialModifierOperation.h"
 
+#include "arcane/utils/PlatformUtils.h"
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -24,6 +26,20 @@ namespace Arcane::Materials
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+ConstituentModifierWorkInfo::
+ConstituentModifierWorkInfo()
+: pure_local_ids(platform::getAcceleratorHostMemoryAllocator())
+, partial_indexes(platform::getAcceleratorHostMemoryAllocator())
+, cells_changed_in_env(platform::getAcceleratorHostMemoryAllocator())
+, cells_unchanged_in_env(platform::getAcceleratorHostMemoryAllocator())
+, m_removed_local_ids_filter(platform::getAcceleratorHostMemoryAllocator())
+, m_cells_to_transform(platform::getAcceleratorHostMemoryAllocator())
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void ConstituentModifierWorkInfo::
 initialize(Int32 max_local_id)
 {
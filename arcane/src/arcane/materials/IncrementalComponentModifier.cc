@@ -40,6 +40,7 @@ IncrementalComponentModifier(AllEnvData* all_env_data)
 : TraceAccessor(all_env_data->traceMng())
 , m_all_env_data(all_env_data)
 , m_material_mng(all_env_data->m_material_mng)
+, m_queue(m_material_mng->_internalApi()->runQueue())
 {
 }
 
@@ -96,23 +97,27 @@ apply(MaterialModifierOperation* operation)
     UniqueArray<Int32>& cells_changed_in_env = m_work_info.cells_changed_in_env;
     UniqueArray<Int32>& cells_unchanged_in_env = m_work_info.cells_unchanged_in_env;
     const Int32 nb_id = ids.size();
-    cells_unchanged_in_env.clear();
-    cells_unchanged_in_env.reserve(nb_id);
-    cells_changed_in_env.clear();
-    cells_changed_in_env.reserve(nb_id);
     const Int32 ref_nb_mat = is_add ? 0 : 1;
     const Int16 env_id = true_env->componentId();
     info(4) << "Using optimisation updateMaterialDirect is_add?=" << is_add;
 
-    for (Integer i = 0; i < nb_id; ++i) {
-      Int32 lid = ids[i];
-      Int32 current_cell_nb_mat = connectivity->cellNbMaterial(CellLocalId(lid), env_id);
-      if (current_cell_nb_mat != ref_nb_mat) {
-        info(5) << "CELL i=" << i << " lid=" << lid << " unchanged in environment nb_mat=" << current_cell_nb_mat;
-        cells_unchanged_in_env.add(lid);
-      }
-      else {
-        cells_changed_in_env.add(lid);
+    if (m_queue)
+      _computeCellsChangedInEnvironmentWithQueue(env_id, ref_nb_mat, ids);
+    else {
+      cells_unchanged_in_env.clear();
+      cells_unchanged_in_env.reserve(nb_id);
+      cells_changed_in_env.clear();
+      cells_changed_in_env.reserve(nb_id);
+      for (Integer i = 0; i < nb_id; ++i) {
+        Int32 lid = ids[i];
+        Int32 current_cell_nb_mat = connectivity->cellNbMaterial(CellLocalId(lid), env_id);
+        if (current_cell_nb_mat != ref_nb_mat) {
+          info(5) << "CELL i=" << i << " lid=" << lid << " unchanged in environment nb_mat=" << current_cell_nb_mat;
+          cells_unchanged_in_env.add(lid);
+        }
+        else {
+          cells_changed_in_env.add(lid);
+        }
       }
     }
 
@@ -162,6 +167,14 @@ apply(MaterialModifierOperation* operation)
   info(4) << "Transform PartialPure for environment name=" << env->name();
   _switchCellsForEnvironments(env, orig_ids);
 
+  // Indique à l'index maille -> milieux les milieux à mettre à jour.
+  // Seul le milieu modifié peut changer de nombre de mailles mais la
+  // transformation pure/partielle modifie les MatVarIndex des autres milieux.
+  if (CellMajorComponentIndex* index = m_material_mng->_cellToAllEnvCellIndex()) {
+    for (MeshEnvironment* other_env : m_material_mng->trueEnvironments())
+      index->notifyComponentModified(other_env, (other_env == true_env && !ids.empty()));
+  }
+
   // Si je suis mono-mat, alors mat->cells()<=>env->cells() et il ne faut
   // mettre à jour que l'un des deux groupes.
   bool need_update_env = (nb_mat != 1);
@@ -214,14 +227,14 @@ _switchCellsForMaterials(const MeshMaterial* modified_mat,
       info(4) << "TransformCells (V3) is_add?=" << is_add << " indexer=" << indexer->name();
 
       _computeCellsToTransformForMaterial(mat, ids);
-      indexer->transformCellsV2(m_work_info);
-      m_work_info.resetTransformedCells(ids);
+      _transformCells(indexer);
+      _resetTransformedCells(ids);
 
       info(4) << "NB_MAT_TRANSFORM=" << m_work_info.pure_local_ids.size() << " name=" << mat->name();
 
       m_all_env_data->_copyBetweenPartialsAndGlobals(m_work_info.pure_local_ids,
                                                      m_work_info.partial_indexes,
-                                                     indexer->index(), is_add);
+                                                     indexer->index(), is_add, m_queue);
     }
   }
 }
@@ -265,8 +278,8 @@ _switchCellsForEnvironments(const IMeshEnvironment* modified_env,
     info(4) << "TransformCells (V2) is_add?=" << is_add << " indexer=" << indexer->name();
 
     _computeCellsToTransformForEnvironments(ids);
-    indexer->transformCellsV2(m_work_info);
-    m_work_info.resetTransformedCells(ids);
+    _transformCells(indexer);
+    _resetTransformedCells(ids);
 
     info(4) << "NB_ENV_TRANSFORM=" << m_work_info.pure_local_ids.size()
             << " name=" << env->name();
@@ -274,7 +287,7 @@ _switchCellsForEnvironments(const IMeshEnvironment* modified_env,
     if (is_copy)
       m_all_env_data->_copyBetweenPartialsAndGlobals(m_work_info.pure_local_ids,
                                                      m_work_info.partial_indexes,
-                                                     indexer->index(), is_add);
+                                                     indexer->index(), is_add, m_queue);
   }
 }
 
@@ -286,6 +299,11 @@ _switchCellsForEnvironments(const IMeshEnvironment* modified_env,
 void IncrementalComponentModifier::
 _computeCellsToTransformForMaterial(const MeshMaterial* mat, ConstArrayView<Int32> ids)
 {
+  if (m_queue) {
+    _computeCellsToTransformWithQueue(mat, ids);
+    return;
+  }
+
   const MeshEnvironment* env = mat->trueEnvironment();
   const Int16 env_id = env->componentId();
   CellGroup all_cells = m_material_mng->mesh()->allCells();
@@ -325,6 +343,11 @@ _computeCellsToTransformForMaterial(const MeshMaterial* mat, ConstArrayView<Int3
 void IncrementalComponentModifier::
 _computeCellsToTransformForEnvironments(ConstArrayView<Int32> ids)
 {
+  if (m_queue) {
+    _computeCellsToTransformWithQueue(nullptr, ids);
+    return;
+  }
+
   ConstituentConnectivityList* connectivity = m_all_env_data->componentConnectivityList();
   ConstArrayView<Int16> cells_nb_env = connectivity->cellsNbEnvironment();
   CellGroup all_cells = m_material_mng->mesh()->allCells();
@@ -342,6 +365,32 @@ _computeCellsToTransformForEnvironments(ConstArrayView<Int32> ids)
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Transforme les mailles pures/partielles de \a indexer.
+ */
+void IncrementalComponentModifier::
+_transformCells(MeshMaterialVariableIndexer* indexer)
+{
+  if (m_queue)
+    _transformCellsWithQueue(indexer);
+  else
+    indexer->transformCellsV2(m_work_info);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void IncrementalComponentModifier::
+_resetTransformedCells(ConstArrayView<Int32> ids)
+{
+  if (m_queue)
+    _resetTransformedCellsWithQueue(ids);
+  else
+    m_work_info.resetTransformedCells(ids);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -456,7 +505,7 @@ _addItemsToIndexer(MeshEnvironment* env, MeshMaterialVariableIndexer* var_indexe
   {
     IMeshMaterialMng* mm = m_material_mng;
     functor::apply(mm, &IMeshMaterialMng::visitVariables,
-                   [&](IMeshMaterialVariable* mv) { mv->_internalApi()->initializeNewItems(list_builder); });
+                   [&](IMeshMaterialVariable* mv) { mv->_internalApi()->initializeNewItems(list_builder, m_queue); });
   }
 }
 
@@ -0,0 +1,238 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* IncrementalComponentModifier_Accelerator.cc                 (C) 2000-2024 */
+/*                                                                           */
+/* Modification incrémentale des constituants sur accélérateur.              */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/materials/internal/IncrementalComponentModifier.h"
+
+#include "arcane/utils/PlatformUtils.h"
+
+#include "arcane/materials/internal/MeshMaterialMng.h"
+#include "arcane/materials/internal/ConstituentConnectivityList.h"
+#include "arcane/materials/internal/AllEnvData.h"
+
+#include "arcane/accelerator/core/RunQueue.h"
+#include "arcane/accelerator/RunCommandLoop.h"
+#include "arcane/accelerator/Filter.h"
+#include "arcane/accelerator/Scan.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Materials
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule les mailles de \a ids qui changent ou non de milieu.
+ *
+ * Les mailles dont le nombre de matériaux dans le milieu \a env_id vaut
+ * \a ref_nb_mat sont rangées dans m_work_info.cells_changed_in_env et les
+ * autres dans m_work_info.cells_unchanged_in_env. L'ordre des mailles
+ * est conservé.
+ */
+void IncrementalComponentModifier::
+_computeCellsChangedInEnvironmentWithQueue(Int16 env_id, Int32 ref_nb_mat, ConstArrayView<Int32> ids)
+{
+  UniqueArray<Int32>& cells_changed_in_env = m_work_info.cells_changed_in_env;
+  UniqueArray<Int32>& cells_unchanged_in_env = m_work_info.cells_unchanged_in_env;
+  const Int32 nb_id = ids.size();
+  // Le filtre nécessite que la sortie ait au moins la taille de l'entrée.
+  cells_changed_in_env.resize(nb_id);
+  cells_unchanged_in_env.resize(nb_id);
+
+  ConstituentConnectivityList::CellNbMaterialView nb_mat_view = m_all_env_data->componentConnectivityList()->cellNbMaterialView();
+  SmallSpan<const Int32> in_ids(ids.data(), nb_id);
+
+  {
+    auto select_lambda = [=] ARCCORE_HOST_DEVICE(Int32 lid) -> bool {
+      return nb_mat_view.cellNbMaterial(CellLocalId(lid), env_id) == ref_nb_mat;
+    };
+    Accelerator::Filterer<Int32> filterer(m_queue);
+    filterer.applyIf(in_ids, cells_changed_in_env.view(), select_lambda);
+    cells_changed_in_env.resize(filterer.nbOutputElement());
+  }
+  {
+    auto select_lambda = [=] ARCCORE_HOST_DEVICE(Int32 lid) -> bool {
+      return nb_mat_view.cellNbMaterial(CellLocalId(lid), env_id) != ref_nb_mat;
+    };
+    Accelerator::Filterer<Int32> filterer(m_queue);
+    filterer.applyIf(in_ids, cells_unchanged_in_env.view(), select_lambda);
+    cells_unchanged_in_env.resize(filterer.nbOutputElement());
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule les mailles de \a ids à transformer.
+ *
+ * Si \a mat est nul, le calcul est fait pour les milieux (voir
+ * _computeCellsToTransformForEnvironments()), sinon pour le
+ * matériau \a mat (voir _computeCellsToTransformForMaterial()).
+ */
+void IncrementalComponentModifier::
+_computeCellsToTransformWithQueue(const MeshMaterial* mat, ConstArrayView<Int32> ids)
+{
+  ConstituentConnectivityList* connectivity = m_all_env_data->componentConnectivityList();
+  ConstituentConnectivityList::CellNbMaterialView nb_mat_view = connectivity->cellNbMaterialView();
+  SmallSpan<const Int16> cells_nb_env = connectivity->cellsNbEnvironment();
+  SmallSpan<bool> transformed_cells = m_work_info.transformedCells();
+  SmallSpan<const Int32> in_ids(ids.data(), ids.size());
+  const bool is_add = m_work_info.isAdd();
+  const bool is_material = (mat != nullptr);
+  const Int16 env_id = (mat) ? mat->trueEnvironment()->componentId() : -1;
+  const Int32 nb_id = in_ids.size();
+
+  auto command = makeCommand(m_queue);
+  command << RUNCOMMAND_LOOP1(iter, nb_id)
+  {
+    auto [i] = iter();
+    const Int32 local_id = in_ids[i];
+    const Int16 nb_env = cells_nb_env[local_id];
+    bool do_transform = false;
+    // Voir les versions hôte pour la signification des tests.
+    if (is_add) {
+      do_transform = (nb_env > 1);
+      if (is_material && !do_transform)
+        do_transform = nb_mat_view.cellNbMaterial(CellLocalId(local_id), env_id) > 1;
+    }
+    else {
+      do_transform = (nb_env == 1);
+      if (is_material && do_transform)
+        do_transform = nb_mat_view.cellNbMaterial(CellLocalId(local_id), env_id) == 1;
+    }
+    transformed_cells[local_id] = do_transform;
+  };
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void IncrementalComponentModifier::
+_resetTransformedCellsWithQueue(ConstArrayView<Int32> ids)
+{
+  SmallSpan<bool> transformed_cells = m_work_info.transformedCells();
+  SmallSpan<const Int32> in_ids(ids.data(), ids.size());
+  const Int32 nb_id = in_ids.size();
+
+  auto command = makeCommand(m_queue);
+  command << RUNCOMMAND_LOOP1(iter, nb_id)
+  {
+    auto [i] = iter();
+    transformed_cells[in_ids[i]] = false;
+  };
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Transforme les mailles pures/partielles de \a indexer.
+ *
+ * Cette méthode est l'équivalent de MeshMaterialVariableIndexer::transformCellsV2().
+ * Le nombre de mailles transformées et leur position dans les listes
+ * sont calculés par un scan exclusif, ce qui garantit le même ordre
+ * et donc les mêmes index que la version séquentielle.
+ */
+void IncrementalComponentModifier::
+_transformCellsWithQueue(MeshMaterialVariableIndexer* indexer)
+{
+  const Int32 nb_item = indexer->nbItem();
+  if (nb_item == 0)
+    return;
+
+  const bool is_add = m_work_info.isAdd();
+  SmallSpan<const bool> transformed_cells = m_work_info.transformedCells();
+  SmallSpan<MatVarIndex> matvar_indexes = indexer->m_matvar_indexes.view();
+  SmallSpan<const Int32> local_ids = indexer->m_local_ids.view();
+
+  UniqueArray<Int32> transform_flags(platform::getAcceleratorHostMemoryAllocator());
+  UniqueArray<Int32> transform_positions(platform::getAcceleratorHostMemoryAllocator());
+  transform_flags.resize(nb_item);
+  transform_positions.resize(nb_item);
+  SmallSpan<Int32> flags = transform_flags.view();
+  SmallSpan<Int32> positions = transform_positions.view();
+
+  // Calcule les entités à transformer
+  {
+    auto command = makeCommand(m_queue);
+    command << RUNCOMMAND_LOOP1(iter, nb_item)
+    {
+      auto [i] = iter();
+      MatVarIndex mvi = matvar_indexes[i];
+      bool do_transform = false;
+      if (is_add)
+        // Comme la maille est pure, le localId() est dans \a mvi
+        do_transform = (mvi.arrayIndex() == 0) && transformed_cells[mvi.valueIndex()];
+      else
+        do_transform = (mvi.arrayIndex() != 0) && transformed_cells[local_ids[i]];
+      flags[i] = (do_transform) ? 1 : 0;
+    };
+  }
+
+  {
+    Accelerator::Scanner<Int32> scanner;
+    scanner.exclusiveSum(m_queue, flags, positions);
+  }
+  m_queue->barrier();
+  const Int32 nb_transformed = positions[nb_item - 1] + flags[nb_item - 1];
+  if (nb_transformed == 0)
+    return;
+
+  Array<Int32>& pure_local_ids_array = m_work_info.pure_local_ids;
+  Array<Int32>& partial_indexes_array = m_work_info.partial_indexes;
+  const Int32 pure_offset = pure_local_ids_array.size();
+  const Int32 partial_offset = partial_indexes_array.size();
+  pure_local_ids_array.resize(pure_offset + nb_transformed);
+  partial_indexes_array.resize(partial_offset + nb_transformed);
+  SmallSpan<Int32> pure_local_ids = pure_local_ids_array.view().subView(pure_offset, nb_transformed);
+  SmallSpan<Int32> partial_indexes = partial_indexes_array.view().subView(partial_offset, nb_transformed);
+
+  const Int32 var_array_index = indexer->index() + 1;
+  const Int32 first_index = indexer->m_max_index_in_multiple_array + 1;
+
+  {
+    auto command = makeCommand(m_queue);
+    command << RUNCOMMAND_LOOP1(iter, nb_item)
+    {
+      auto [i] = iter();
+      if (flags[i] == 0)
+        return;
+      const Int32 pos = positions[i];
+      if (is_add) {
+        const Int32 local_id = matvar_indexes[i].valueIndex();
+        const Int32 current_index = first_index + pos;
+        pure_local_ids[pos] = local_id;
+        partial_indexes[pos] = current_index;
+        matvar_indexes[i] = MatVarIndex(var_array_index, current_index);
+      }
+      else {
+        const Int32 local_id = local_ids[i];
+        pure_local_ids[pos] = local_id;
+        partial_indexes[pos] = matvar_indexes[i].valueIndex();
+        matvar_indexes[i] = MatVarIndex(0, local_id);
+      }
+    };
+  }
+  m_queue->barrier();
+
+  if (is_add)
+    indexer->m_max_index_in_multiple_array += nb_transformed;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::Materials
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MaterialModifierOperation.cc                                (C) 2000-2023 */
+/* MaterialModifierOperation.cc                                (C) 2000-2024 */
 /*                                                                           */
 /* Opération d'ajout/suppression de mailles d'un matériau.                   */
 /*---------------------------------------------------------------------------*/
@@ -166,7 +166,7 @@ filterIds()
   Integer nb_error = _checkMaterialPresence(this);
   if (nb_error != 0) {
     if (filter_invalid) {
-      UniqueArray<Int32> filtered_ids;
+      UniqueArray<Int32> filtered_ids(platform::getAcceleratorHostMemoryAllocator());
       _filterValidIds(this, filtered_ids);
       m_ids.swap(filtered_ids);
     }
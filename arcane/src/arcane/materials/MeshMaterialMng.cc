@@ -29,6 +29,8 @@
 #include "arcane/core/IVariableMng.h"
 #include "arcane/core/Properties.h"
 #include "arcane/core/ObserverPool.h"
+#include "arcane/core/IParallelMng.h"
+#include "arcane/core/internal/IParallelMngInternal.h"
 #include "arcane/core/materials/IMeshMaterialVariableFactoryMng.h"
 #include "arcane/core/materials/IMeshMaterialVariable.h"
 #include "arcane/core/materials/MeshMaterialVariableRef.h"
@@ -112,6 +114,11 @@ MeshMaterialMng(const MeshHandle& mesh_handle,const String& name)
   String s = platform::getEnvironmentVariable("ARCANE_ALLENVCELL_FOR_RUNCOMMAND");
   if (!s.null())
     m_is_allcell_2_allenvcell = true;
+  if (m_is_allcell_2_allenvcell || !platform::getEnvironmentVariable("ARCANE_ALLENVCELL_INDEX").null())
+    enableCellToAllEnvCellIndex(true);
+
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_MATERIALMNG_USE_QUEUE", true))
+    m_is_use_queue_for_modification = (v.value() != 0);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -423,6 +430,12 @@ endCreate(bool is_continue)
 
   m_modifier->initOptimizationFlags();
 
+  // Utilise la file par défaut du gestionnaire de parallélisme pour
+  // les modifications des constituants.
+  if (m_is_use_queue_for_modification)
+    m_run_queue = mesh()->parallelMng()->_internalApi()->defaultQueue();
+  info() << "Use RunQueue for constituent modification ? = " << (m_run_queue != nullptr);
+
   m_all_env_data->endCreate(is_continue);
 
   auto synchronizer = mesh()->cellFamily()->allItemsSynchronizer();
@@ -588,6 +601,25 @@ _endUpdate()
   m_all_env_data->forceRecompute(true);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialMng::
+enableCellToAllEnvCellIndex(bool is_enable)
+{
+  if (!is_enable) {
+    m_cell_to_all_env_cell_index.reset();
+    return;
+  }
+  if (m_cell_to_all_env_cell_index)
+    return;
+  m_cell_to_all_env_cell_index = std::make_unique<CellMajorComponentIndex>(this, MatVarSpace::Environment);
+  // Si les milieux sont déjà créés, il faut calculer l'index tout de suite.
+  // Sinon, il le sera lors de la prochaine mise à jour des milieux.
+  if (m_is_end_create)
+    m_cell_to_all_env_cell_index->recompute();
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshMaterialVariable.cc                                     (C) 2000-2023 */
+/* MeshMaterialVariable.cc                                     (C) 2000-2024 */
 /*                                                                           */
 /* Variable sur un matériau du maillage.                                     */
 /*---------------------------------------------------------------------------*/
@@ -45,6 +45,9 @@
 #include "arcane/materials/IMeshMaterialVariableSynchronizer.h"
 #include "arcane/materials/internal/MeshMaterialVariablePrivate.h"
 #include "arcane/materials/internal/MeshMaterialVariableIndexer.h"
+#include "arcane/materials/internal/ComponentItemListBuilder.h"
+
+#include "arcane/accelerator/core/RunQueue.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -145,9 +148,9 @@ restoreData(IMeshComponent* component,IData* data,Integer data_index,
 
 void MeshMaterialVariablePrivate::
 copyGlobalToPartial(Int32 var_index,Int32ConstArrayView local_ids,
-                    Int32ConstArrayView indexes_in_multiple)
+                    Int32ConstArrayView indexes_in_multiple,RunQueue* queue)
 {
-  m_variable->_copyGlobalToPartial(var_index,local_ids,indexes_in_multiple);
+  m_variable->_copyGlobalToPartial(var_index,local_ids,indexes_in_multiple,queue);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -155,18 +158,18 @@ copyGlobalToPartial(Int32 var_index,Int32ConstArrayView local_ids,
 
 void MeshMaterialVariablePrivate::
 copyPartialToGlobal(Int32 var_index,Int32ConstArrayView local_ids,
-                    Int32ConstArrayView indexes_in_multiple)
+                    Int32ConstArrayView indexes_in_multiple,RunQueue* queue)
 {
-  m_variable->_copyPartialToGlobal(var_index,local_ids,indexes_in_multiple);
+  m_variable->_copyPartialToGlobal(var_index,local_ids,indexes_in_multiple,queue);
 }
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
 void MeshMaterialVariablePrivate::
-initializeNewItems(const ComponentItemListBuilder& list_builder)
+initializeNewItems(const ComponentItemListBuilder& list_builder,RunQueue* queue)
 {
-  m_variable->_initializeNewItems(list_builder);
+  m_variable->_initializeNewItems(list_builder,queue);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -504,6 +507,84 @@ _copyFromBuffer(SmallSpan<const MatVarIndex> matvar_indexes,
   destination_view.copyFromIndexes(source_buffer,indexes,queue);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Recopie via \a queue des valeurs entre la partie globale et la
+ * partie partielle d'indice \a var_index.
+ *
+ * Les valeurs sont d'abord rassemblées dans un tampon intermédiaire puis
+ * dispersées dans la destination.
+ */
+void MeshMaterialVariable::
+_copyBetweenGlobalAndPartial(Int32 var_index,SmallSpan<const Int32> local_ids,
+                             SmallSpan<const Int32> indexes_in_multiple,
+                             bool is_global_to_partial,RunQueue* queue)
+{
+  ARCANE_CHECK_POINTER(queue);
+  const Int32 one_data_size = dataTypeSize();
+  const Int32 nb_item = local_ids.size();
+  if (nb_item==0)
+    return;
+
+  Span<std::byte> global_bytes = m_views_as_bytes[0];
+  Span<std::byte> partial_bytes = m_views_as_bytes[var_index+1];
+  MutableMemoryView global_view(makeMutableMemoryView(global_bytes.data(),one_data_size,global_bytes.size()/one_data_size));
+  MutableMemoryView partial_view(makeMutableMemoryView(partial_bytes.data(),one_data_size,partial_bytes.size()/one_data_size));
+
+  UniqueArray<std::byte> buffer(MemoryUtils::getDefaultDataAllocator());
+  buffer.resize((Int64)one_data_size * nb_item);
+  MutableMemoryView buffer_view(makeMutableMemoryView(buffer.data(),one_data_size,nb_item));
+
+  if (is_global_to_partial){
+    ConstMemoryView(global_view).copyToIndexes(buffer_view,local_ids,queue);
+    partial_view.copyFromIndexes(ConstMemoryView(buffer_view),indexes_in_multiple,queue);
+  }
+  else{
+    ConstMemoryView(partial_view).copyToIndexes(buffer_view,indexes_in_multiple,queue);
+    global_view.copyFromIndexes(ConstMemoryView(buffer_view),local_ids,queue);
+  }
+  // Le tampon est détruit en sortie de la méthode.
+  queue->barrier();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Initialise via \a queue les valeurs partielles des entités
+ * ajoutées par \a list_builder.
+ *
+ * Si \a init_with_zero est vrai, les valeurs sont mises à zéro. Sinon
+ * elles prennent la valeur globale de la maille associée.
+ */
+void MeshMaterialVariable::
+_initializeNewItemsWithQueue(const ComponentItemListBuilder& list_builder,
+                             bool init_with_zero,RunQueue* queue)
+{
+  ARCANE_CHECK_POINTER(queue);
+  const Int32 one_data_size = dataTypeSize();
+  SmallSpan<const MatVarIndex> partial_matvar(list_builder.partialMatVarIndexes());
+  const Int32 nb_partial = partial_matvar.size();
+  if (nb_partial==0)
+    return;
+
+  MutableMultiMemoryView destination_view(m_views_as_bytes.view(),one_data_size);
+  SmallSpan<const Int32> indexes(_toInt32Indexes(partial_matvar));
+
+  // Suppose que la valeur par défaut du type de donnée a tous ses octets nuls
+  // comme le fait 'setFillValue()' pour les types numériques.
+  UniqueArray<std::byte> buffer(MemoryUtils::getDefaultDataAllocator());
+  buffer.resize((Int64)one_data_size * nb_partial,std::byte{0});
+  MutableMemoryView buffer_view(makeMutableMemoryView(buffer.data(),one_data_size,nb_partial));
+  if (!init_with_zero){
+    Span<const std::byte> global_bytes = m_views_as_bytes[0];
+    ConstMemoryView global_view(makeConstMemoryView(global_bytes.data(),one_data_size,global_bytes.size()/one_data_size));
+    global_view.copyToIndexes(buffer_view,list_builder.partialLocalIds(),queue);
+  }
+  destination_view.copyFromIndexes(ConstMemoryView(buffer_view),indexes,queue);
+  queue->barrier();
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
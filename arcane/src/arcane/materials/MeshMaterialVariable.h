@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshMaterialVariable.h                                      (C) 2000-2023 */
+/* MeshMaterialVariable.h                                      (C) 2000-2024 */
 /*                                                                           */
 /* Variable sur un matériau du maillage.                                     */
 /*---------------------------------------------------------------------------*/
@@ -150,10 +150,16 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariable
   virtual void _restoreData(IMeshComponent* component,IData* data,Integer data_index,
                             Int32ConstArrayView ids,bool allow_null_id) =0;
   virtual void _copyGlobalToPartial(Int32 var_index,Int32ConstArrayView local_ids,
-                                    Int32ConstArrayView indexes_in_multiple) =0;
+                                    Int32ConstArrayView indexes_in_multiple,RunQueue* queue) =0;
   virtual void _copyPartialToGlobal(Int32 var_index,Int32ConstArrayView local_ids,
-                                    Int32ConstArrayView indexes_in_multiple) =0;
-  virtual void _initializeNewItems(const ComponentItemListBuilder& list_builder) =0;
+                                    Int32ConstArrayView indexes_in_multiple,RunQueue* queue) =0;
+  virtual void _initializeNewItems(const ComponentItemListBuilder& list_builder,RunQueue* queue) =0;
+
+  void _copyBetweenGlobalAndPartial(Int32 var_index,SmallSpan<const Int32> local_ids,
+                                    SmallSpan<const Int32> indexes_in_multiple,
+                                    bool is_global_to_partial,RunQueue* queue);
+  void _initializeNewItemsWithQueue(const ComponentItemListBuilder& list_builder,
+                                    bool init_with_zero,RunQueue* queue);
 
  private:
 
@@ -310,12 +316,12 @@ class ItemMaterialVariableBase
                     Int32ConstArrayView ids,bool allow_null_id) override;
   ARCANE_MATERIALS_EXPORT
   void _copyGlobalToPartial(Int32 var_index,Int32ConstArrayView local_ids,
-                            Int32ConstArrayView indexes_in_multiple) override;
+                            Int32ConstArrayView indexes_in_multiple,RunQueue* queue) override;
   ARCANE_MATERIALS_EXPORT
   void _copyPartialToGlobal(Int32 var_index,Int32ConstArrayView local_ids,
-                            Int32ConstArrayView indexes_in_multiple) override;
+                            Int32ConstArrayView indexes_in_multiple,RunQueue* queue) override;
   ARCANE_MATERIALS_EXPORT
-  void _initializeNewItems(const ComponentItemListBuilder& list_builder) override;
+  void _initializeNewItems(const ComponentItemListBuilder& list_builder,RunQueue* queue) override;
 
   ARCANE_MATERIALS_EXPORT void fillPartialValuesWithGlobalValues() override;
   ARCANE_MATERIALS_EXPORT void
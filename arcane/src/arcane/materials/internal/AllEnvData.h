@@ -89,7 +89,8 @@ class AllEnvData
   void _computeNbEnvAndNbMatPerCell();
   void _copyBetweenPartialsAndGlobals(Int32ConstArrayView pure_local_ids,
                                       Int32ConstArrayView partial_indexes,
-                                      Int32 indexer_index, bool is_add_operation);
+                                      Int32 indexer_index, bool is_add_operation,
+                                      RunQueue* queue);
   void _computeAndResizeEnvItemsInternal();
   bool _isFullVerbose() const;
   void _rebuildMaterialsAndEnvironmentsFromGroups();
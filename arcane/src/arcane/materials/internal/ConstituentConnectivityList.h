@@ -45,6 +45,42 @@ class ConstituentConnectivityList
   class ConstituentContainer;
   class Container;
 
+ public:
+
+  /*!
+   * \brief Vue sur le nombre de matériaux par milieu des mailles.
+   *
+   * Cette vue est utilisable sur accélérateur et n'est valide que tant
+   * que la liste des constituants n'est pas modifiée.
+   */
+  class CellNbMaterialView
+  {
+    friend ConstituentConnectivityList;
+
+   public:
+
+    //! Nombre de matériaux de la maille \a cell_id pour le milieu d'indice \a env_id
+    ARCCORE_HOST_DEVICE Int16 cellNbMaterial(CellLocalId cell_id, Int16 env_id) const
+    {
+      const Int32 lid = cell_id.localId();
+      const Int16 n = m_nb_material[lid];
+      const Int32 index = m_material_index[lid];
+      Int16 nb_mat = 0;
+      for (Int16 i = 0; i < n; ++i) {
+        if (m_environment_for_materials[m_material_list[index + i]] == env_id)
+          ++nb_mat;
+      }
+      return nb_mat;
+    }
+
+   private:
+
+    SmallSpan<const Int16> m_nb_material;
+    SmallSpan<const Int32> m_material_index;
+    SmallSpan<const Int16> m_material_list;
+    SmallSpan<const Int16> m_environment_for_materials;
+  };
+
  public:
 
   explicit ConstituentConnectivityList(MeshMaterialMng* mm);
@@ -75,6 +111,9 @@ class ConstituentConnectivityList
   //! Nombre de matériaux de la maille \a cell_id pour le milieu d'indice \a env_id
   Int16 cellNbMaterial(CellLocalId cell_id, Int16 env_id) const;
 
+  //! Vue pour calculer le nombre de matériaux par milieu sur accélérateur
+  CellNbMaterialView cellNbMaterialView() const;
+
   //! Supprime toutes les entités connectées
   void removeAllConnectivities();
 
@@ -51,6 +51,10 @@ class ARCANE_MATERIALS_EXPORT ConstituentModifierWorkInfo
   //! Liste des mailles d'un milieu qui sont déjà présentes dans un milieu lors d'une opération
   UniqueArray<Int32> cells_unchanged_in_env;
 
+ public:
+
+  ConstituentModifierWorkInfo();
+
  public:
 
   //! Initialise l'instance.
@@ -76,6 +80,9 @@ class ARCANE_MATERIALS_EXPORT ConstituentModifierWorkInfo
     for( Int32 x : local_ids )
       m_cells_to_transform[x] = false;
   }
+  //! Filtre des mailles à transformer, utilisable sur accélérateur.
+  SmallSpan<bool> transformedCells() { return m_cells_to_transform.view(); }
+
   //! Indique si la maille \a local_id est supprimée du matériaux pour l'opération courante.
   bool isRemovedCell(Int32 local_id) const { return m_removed_local_ids_filter[local_id]; }
 
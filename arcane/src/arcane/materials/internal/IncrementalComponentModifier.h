@@ -54,6 +54,8 @@ class ARCANE_MATERIALS_EXPORT IncrementalComponentModifier
   AllEnvData* m_all_env_data = nullptr;
   MeshMaterialMng* m_material_mng = nullptr;
   ConstituentModifierWorkInfo m_work_info;
+  //! File pour les opérations sur accélérateur (peut être nulle)
+  RunQueue* m_queue = nullptr;
 
  private:
 
@@ -63,12 +65,23 @@ class ARCANE_MATERIALS_EXPORT IncrementalComponentModifier
                                 ConstArrayView<Int32> ids);
   void _computeCellsToTransformForMaterial(const MeshMaterial* mat, ConstArrayView<Int32> ids);
   void _computeCellsToTransformForEnvironments(ConstArrayView<Int32> ids);
+  void _transformCells(MeshMaterialVariableIndexer* indexer);
+  void _resetTransformedCells(ConstArrayView<Int32> ids);
   void _removeItemsFromEnvironment(MeshEnvironment* env, MeshMaterial* mat,
                                    Int32ConstArrayView local_ids, bool update_env_indexer);
   void _addItemsToEnvironment(MeshEnvironment* env, MeshMaterial* mat,
                               Int32ConstArrayView local_ids, bool update_env_indexer);
   void _addItemsToIndexer(MeshEnvironment* env, MeshMaterialVariableIndexer* var_indexer,
                           Int32ConstArrayView local_ids);
+
+ public:
+
+  // Les méthodes suivantes utilisent m_queue et doivent être publiques
+  // pour pouvoir être compilées sur accélérateur.
+  void _computeCellsChangedInEnvironmentWithQueue(Int16 env_id, Int32 ref_nb_mat, ConstArrayView<Int32> ids);
+  void _computeCellsToTransformWithQueue(const MeshMaterial* mat, ConstArrayView<Int32> ids);
+  void _transformCellsWithQueue(MeshMaterialVariableIndexer* indexer);
+  void _resetTransformedCellsWithQueue(ConstArrayView<Int32> ids);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MaterialModifierOperation.h                                 (C) 2000-2023 */
+/* MaterialModifierOperation.h                                 (C) 2000-2024 */
 /*                                                                           */
 /* Opération d'ajout/suppression de mailles d'un matériau.                   */
 /*---------------------------------------------------------------------------*/
@@ -15,6 +15,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "arcane/utils/Array.h"
+#include "arcane/utils/PlatformUtils.h"
 
 #include "arcane/materials/MaterialsGlobal.h"
 #include "arcane/materials/internal/IMeshMaterialModifierImpl.h"
@@ -41,8 +42,11 @@ class MaterialModifierOperation
   MaterialModifierOperation(IMeshMaterial* mat, Int32ConstArrayView ids, bool is_add)
   : m_mat(mat)
   , m_is_add(is_add)
-  , m_ids(ids)
+  , m_ids(platform::getAcceleratorHostMemoryAllocator())
   {
+    // Les identifiants doivent être accessibles sur accélérateur
+    // pour les modifications incrémentales.
+    m_ids.copy(ids);
   }
 
  public:
@@ -22,6 +22,7 @@
 
 #include "arcane/core/materials/IMeshMaterialMng.h"
 #include "arcane/core/materials/MatItemEnumerator.h"
+#include "arcane/core/materials/CellMajorComponentIndex.h"
 #include "arcane/core/materials/internal/IMeshMaterialMngInternal.h"
 
 #include "arcane/materials/MeshBlock.h"
@@ -107,6 +108,10 @@ class MeshMaterialMng
     {
       return m_material_mng->componentItemSharedInfo(level);
     }
+    RunQueue* runQueue() const override
+    {
+      return m_material_mng->m_run_queue;
+    }
 
    private:
 
@@ -258,6 +263,9 @@ class MeshMaterialMng
       createAllCellToAllEnvCell(platform::getDefaultDataAllocator());
   }
   bool isCellToAllEnvCellForRunCommand() const override { return m_is_allcell_2_allenvcell; }
+  void enableCellToAllEnvCellIndex(bool is_enable) override;
+  const CellMajorComponentIndex* cellToAllEnvCellIndex() const override { return m_cell_to_all_env_cell_index.get(); }
+  CellMajorComponentIndex* _cellToAllEnvCellIndex() { return m_cell_to_all_env_cell_index.get(); }
 
   IMeshMaterialMngInternal* _internalApi() const override { return m_internal_api.get(); }
 
@@ -326,7 +334,10 @@ class MeshMaterialMng
   String m_data_compressor_service_name;
 
   AllCellToAllEnvCell* m_allcell_2_allenvcell = nullptr;
+  std::unique_ptr<CellMajorComponentIndex> m_cell_to_all_env_cell_index;
   bool m_is_allcell_2_allenvcell = false;
+  bool m_is_use_queue_for_modification = false;
+  RunQueue* m_run_queue = nullptr;
 
 
  private:
@@ -92,6 +92,7 @@
 #include "arcane/mesh/MeshRefinement.h"
 #include "arcane/mesh/FaceReorienter.h"
 #include "arcane/mesh/NewItemOwnerBuilder.h"
+#include "arcane/mesh/ItemLocalitySortFunction.h"
 
 #include "arcane/mesh/IncrementalItemConnectivity.h"
 
@@ -428,9 +429,46 @@ build()
        // Voir dans CartesianMesh.cc.
      }
     }
+    _setLocalityOrdering();
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Positionne les fonctions de tri pour la localité mémoire.
+ *
+ * Si la variable d'environnement ARCANE_MESH_LOCALITY_ORDERING est
+ * positionnée, les entités sont renumérotées lors des compactages triés
+ * pour que les entités proches dans le maillage aient des numéros locaux
+ * proches (voir ItemLocalitySortFunction).
+ */
+void DynamicMesh::
+_setLocalityOrdering()
+{
+  String ordering_str = platform::getEnvironmentVariable("ARCANE_MESH_LOCALITY_ORDERING");
+  if (ordering_str.null())
+    return;
+  eItemLocalityOrdering ordering = eItemLocalityOrdering::None;
+  if (ItemLocalitySortFunction::parseOrdering(ordering_str, ordering))
+    ARCANE_FATAL("Invalid value '{0}' for environment variable ARCANE_MESH_LOCALITY_ORDERING."
+                 " Valid values are 'None', 'Hilbert' or 'RCM'", ordering_str);
+  if (ordering == eItemLocalityOrdering::None)
+    return;
+  // Avec l'AMR, l'ordre des entités suit la hiérarchie des raffinements.
+  if (m_is_amr_activated) {
+    info() << "Locality ordering '" << ordering_str << "' is disabled because AMR is active";
+    return;
+  }
+  info() << "Use locality ordering '" << ordering_str << "' for mesh '" << name() << "'";
+  // Le rang des mailles est partagé entre les familles pour n'être calculé
+  // qu'une seule fois par compactage (voir _compactItems()).
+  m_locality_cells_rank = std::make_shared<ItemLocalityCellsRank>(this, ordering);
+  IItemFamily* families[4] = { m_node_family, m_edge_family, m_face_family, m_cell_family };
+  for (IItemFamily* family : families)
+    family->setItemSortFunction(new ItemLocalitySortFunction(family, m_locality_cells_rank));
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -2675,6 +2713,13 @@ _compactItems(bool do_sort,bool compact_variables_and_groups)
 
   IMeshCompacter* compacter = m_mesh_compact_mng->beginCompact();
 
+  // Les familles sont toutes triées avant que les numéros locaux ne soient
+  // modifiés. Le rang des mailles pour la localité peut donc être calculé
+  // une seule fois et partagé entre les familles pendant ce compactage.
+  bool keep_cells_rank = (do_sort && m_locality_cells_rank);
+  if (keep_cells_rank)
+    m_locality_cells_rank->setKeepResult(true);
+
   try{
     compacter->setSorted(do_sort);
     compacter->_setCompactVariablesAndGroups(compact_variables_and_groups);
@@ -2682,9 +2727,13 @@ _compactItems(bool do_sort,bool compact_variables_and_groups)
     compacter->doAllActions();
   }
   catch(...){
+    if (keep_cells_rank)
+      m_locality_cells_rank->setKeepResult(false);
     m_mesh_compact_mng->endCompact();
     throw;
   }
+  if (keep_cells_rank)
+    m_locality_cells_rank->setKeepResult(false);
   m_mesh_compact_mng->endCompact();
 
   if (do_sort){
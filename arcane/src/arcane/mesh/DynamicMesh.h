@@ -68,6 +68,7 @@ class ItemMemoryReferenceMng;
 class MeshTiedInterface;
 class TiedInterface;
 class MeshPartitionConstraintMng;
+class ItemLocalityCellsRank;
 class TiedInterfaceMng;
 class NodeFamily;
 class EdgeFamily;
@@ -611,6 +612,9 @@ public:
 
   MeshEventsImpl m_mesh_events;
 
+  //! Rang des mailles partagé par les fonctions de tri pour la localité
+  std::shared_ptr<ItemLocalityCellsRank> m_locality_cells_rank;
+
  private:
 
   void _printMesh(std::ostream& ostr);
@@ -643,6 +647,7 @@ public:
   void _finalizeMeshChanged();
   void _compactItemInternalReferences();
   void _compactItems(bool do_sort,bool compact_variables_and_groups);
+  void _setLocalityOrdering();
   void _checkValidItem(ItemInternal* item);
 
   void _computeSynchronizeInfos();
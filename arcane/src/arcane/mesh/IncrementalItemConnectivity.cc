@@ -15,6 +15,8 @@
 
 #include "arcane/utils/StringBuilder.h"
 #include "arcane/utils/ArgumentException.h"
+#include "arcane/utils/CheckedConvert.h"
+#include "arcane/utils/Math.h"
 
 #include "arcane/IMesh.h"
 #include "arcane/IItemFamily.h"
@@ -24,11 +26,14 @@
 #include "arcane/ObserverPool.h"
 #include "arcane/Properties.h"
 #include "arcane/IndexedItemConnectivityView.h"
+#include "arcane/Concurrency.h"
 #include "arcane/mesh/IndexedItemConnectivityAccessor.h"
 
 #include "arcane/core/internal/IDataInternal.h"
 #include "arcane/core/internal/IItemFamilyInternal.h"
 
+#include <limits>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -590,7 +595,7 @@ addConnectedItem(ItemLocalId source_item,ItemLocalId target_item)
 /*---------------------------------------------------------------------------*/
 
 Integer IncrementalItemConnectivity::
-_computeAllocSize(Integer nb_item)
+_computeAllocSize(Integer nb_item) const
 {
   if (m_pre_allocated_size!=0){
     // Alloue un multiple de \a m_pre_allocated_size
@@ -760,7 +765,8 @@ dumpStats(std::ostream& out) const
       << " list_size=" << m_connectivity_list.size()
       << " index_size=" << m_connectivity_index.size()
       << " nb_item_size=" << m_connectivity_nb_item.size()
-      << " allocated_size=" << allocated_size;
+      << " allocated_size=" << allocated_size
+      << " fragmentation_ratio=" << fragmentationRatio();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -788,13 +794,17 @@ _checkAddNullItem()
 /*!
  * \brief Compacte la liste des connectivités.
  *
- * L'implémentation actuelle est assez simple:
- * - Copie la liste actuelle dans un tableau temporaire.
- * - Vide la liste actuelle.
- * - Recopie dans la liste les valeurs utiles du tableau temporaire.
+ * La liste est entièrement reconstruite de manière à ce que les connectivités
+ * soient contigües et rangées dans l'ordre des localId() des entités sources.
+ * La reconstruction se fait en trois phases:
+ * - calcul en parallèle, par bloc d'entités, de la taille nécessaire pour
+ *   chaque entité et pour chaque bloc,
+ * - calcul séquentiel de la position de début de chaque bloc (scan),
+ * - recopie en parallèle des connectivités dans la nouvelle liste.
  *
  * \note L'appel à cette méthode suppose que les entités de la famille
- * source soient compactées.
+ * source soient compactées. Si ce n'est pas le cas, les connectivités des
+ * entités supprimées sont conservées.
  */
 void IncrementalItemConnectivity::
 compactConnectivityList()
@@ -802,45 +812,75 @@ compactConnectivityList()
   info(4) << "Begin Compacting IncrementalItemConnectivity name=" << name()
           << " new_size=" << m_connectivity_list.size()
           << " prealloc_size=" << m_pre_allocated_size;
-  // TODO: essayer de trouver un moyen de ne faire le compactage que si
-  // cela est nécessaire. Une facon serait de compter le nombre d'appel à
-  // _increaseIndexList() depuis le dernier compactage.
+
+  // Taille des blocs d'entités traités par une tâche.
+  const Int32 block_size = 4096;
+
   UniqueArray<Int32> old_connectivity_list(m_connectivity_list);
   Integer old_size = old_connectivity_list.size();
-  Integer nb_item = m_connectivity_nb_item.size();
-  m_p->m_connectivity_list_array.clear();
-  _notifyConnectivityListChanged();
-  _checkAddNullItem();
-  Integer new_pos_in_list = m_p->m_connectivity_list_array.size();
-  Int32 pre_allocated_size = m_pre_allocated_size;
-  for( Integer i=0; i<nb_item; ++i ){
-    Int32 lid = i;
-    Int32 nb = m_connectivity_nb_item[lid];
-    if (nb==0){
-      m_connectivity_index[lid] = 0;
-      continue;
-    }
-    Int32 index = m_connectivity_index[lid];
-    Int32ConstArrayView con_list(nb,old_connectivity_list.data()+index);
-    Integer alloc_size = _computeAllocSize(nb);
-    m_connectivity_index[lid] = new_pos_in_list;
-    new_pos_in_list += alloc_size;
-    //info() << "NEW_POS_IN_LIST=" << new_pos_in_list << " nb=" << nb << " alloc_size=" << alloc_size;
-    // Vérifie que la position est bien un multiple de pre_allocated_size.
-    if (pre_allocated_size!=0){
-      Int32 pos_modulo = new_pos_in_list % pre_allocated_size;
-      if (pos_modulo!=0)
-        ARCANE_FATAL("Bad position i={0} pos={1} pre_alloc_size={2} modulo={3}",
-                     i,new_pos_in_list,pre_allocated_size,pos_modulo);
+  const Int32 nb_item = m_connectivity_nb_item.size();
+  const Int32 nb_block = (nb_item + block_size - 1) / block_size;
+
+  // Phase 1: position de chaque entité relativement au début de son bloc
+  // et taille de chaque bloc.
+  UniqueArray<Int32> positions_in_block(nb_item);
+  UniqueArray<Int64> block_offsets(nb_block+1);
+  arcaneParallelFor(0,nb_block,[&](Integer begin_block,Integer nb_block_in_range){
+    for( Integer b=begin_block, n=begin_block+nb_block_in_range; b<n; ++b ){
+      const Int32 begin = b * block_size;
+      const Int32 end = math::min(begin+block_size,nb_item);
+      Int64 block_alloc_size = 0;
+      for( Int32 lid=begin; lid<end; ++lid ){
+        positions_in_block[lid] = CheckedConvert::toInt32(block_alloc_size);
+        Int32 nb = m_connectivity_nb_item[lid];
+        if (nb!=0)
+          block_alloc_size += _computeAllocSize(nb);
+      }
+      block_offsets[b] = block_alloc_size;
     }
-    m_p->m_connectivity_list_array.addRange(con_list);
-    // Si préallocation, complète le reste des éléments avec l'entité nulle..
-    if (alloc_size!=nb)
-      m_p->m_connectivity_list_array.addRange(NULL_ITEM_LOCAL_ID,alloc_size-nb);
-    if (m_pre_allocated_size==0 && nb==0)
-      m_connectivity_index[lid] = 0;
+  });
+
+  // Phase 2: position de début de chaque bloc. La liste commence toujours
+  // par l'entité nulle (voir _checkAddNullItem()).
+  Int64 new_size = _nullItemAllocSize();
+  for( Int32 b=0; b<nb_block; ++b ){
+    Int64 block_alloc_size = block_offsets[b];
+    block_offsets[b] = new_size;
+    new_size += block_alloc_size;
   }
+  block_offsets[nb_block] = new_size;
+  if (new_size>std::numeric_limits<Int32>::max())
+    ARCANE_FATAL("Connectivity list is too big name={0} size={1}",name(),new_size);
+
+  m_p->m_connectivity_list_array.resize(new_size);
   _notifyConnectivityListChanged();
+  Int32ArrayView new_list(m_connectivity_list);
+  new_list.subView(0,_nullItemAllocSize()).fill(NULL_ITEM_LOCAL_ID);
+
+  // Phase 3: recopie des connectivités à leur nouvel emplacement.
+  arcaneParallelFor(0,nb_block,[&](Integer begin_block,Integer nb_block_in_range){
+    for( Integer b=begin_block, n=begin_block+nb_block_in_range; b<n; ++b ){
+      const Int32 begin = b * block_size;
+      const Int32 end = math::min(begin+block_size,nb_item);
+      const Int64 block_offset = block_offsets[b];
+      for( Int32 lid=begin; lid<end; ++lid ){
+        Int32 nb = m_connectivity_nb_item[lid];
+        if (nb==0){
+          m_connectivity_index[lid] = 0;
+          continue;
+        }
+        Int32 new_pos_in_list = static_cast<Int32>(block_offset + positions_in_block[lid]);
+        Integer alloc_size = _computeAllocSize(nb);
+        Int32ConstArrayView con_list(nb,old_connectivity_list.data()+m_connectivity_index[lid]);
+        new_list.subView(new_pos_in_list,nb).copy(con_list);
+        // Si préallocation, complète le reste des éléments avec l'entité nulle.
+        if (alloc_size!=nb)
+          new_list.subView(new_pos_in_list+nb,alloc_size-nb).fill(NULL_ITEM_LOCAL_ID);
+        m_connectivity_index[lid] = new_pos_in_list;
+      }
+    }
+  });
+
   _computeMaxNbConnectedItem();
   info(4) << "Compacting IncrementalItemConnectivity name=" << name()
           << " nb_item=" << nb_item << " old_size=" << old_size
@@ -851,6 +891,24 @@ compactConnectivityList()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+Real IncrementalItemConnectivity::
+fragmentationRatio() const
+{
+  Int64 list_size = m_connectivity_list.size();
+  if (list_size==0)
+    return 0.0;
+  Int64 used_size = _nullItemAllocSize();
+  for( Int32 nb : m_connectivity_nb_item )
+    if (nb!=0)
+      used_size += _computeAllocSize(nb);
+  if (used_size>=list_size)
+    return 0.0;
+  return static_cast<Real>(list_size-used_size) / static_cast<Real>(list_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -1047,7 +1105,8 @@ dumpStats(std::ostream& out) const
       << " list_size=" << m_connectivity_list.size()
       << " index_size=" << m_connectivity_index.size()
       << " nb_item_size=" << m_connectivity_nb_item.size()
-      << " allocated_size=" << allocated_size;
+      << " allocated_size=" << allocated_size
+      << " fragmentation_ratio=" << fragmentationRatio();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -223,6 +223,15 @@ class ARCANE_MESH_EXPORT IncrementalItemConnectivity
 
   void compactConnectivityList();
 
+  /*!
+   * \brief Taux de fragmentation de la liste des connectivités.
+   *
+   * Il s'agit de la proportion des éléments de la liste des connectivités
+   * qui ne sont utilisés par aucune entité. Une valeur de 0.0 indique que
+   * la liste est compacte.
+   */
+  Real fragmentationRatio() const;
+
  private:
 
   Int64 m_nb_add     = 0;
@@ -235,7 +244,8 @@ class ARCANE_MESH_EXPORT IncrementalItemConnectivity
   inline void _increaseIndexList(Int32 lid,Integer size,Int32 target_lid);
   inline Integer _increaseConnectivityList(Int32 new_lid);
   inline Integer _increaseConnectivityList(Int32 new_lid,Integer nb_value);
-  inline Integer _computeAllocSize(Integer nb_item);
+  inline Integer _computeAllocSize(Integer nb_item) const;
+  Integer _nullItemAllocSize() const { return (m_pre_allocated_size>0) ? m_pre_allocated_size : 1; }
   void _checkAddNullItem();
   void _resetConnectivityList();
 };
@@ -283,6 +293,9 @@ class ARCANE_MESH_EXPORT OneItemIncrementalItemConnectivity
 
   void compactConnectivityList();
 
+  //! Taux de fragmentation (toujours nul pour cette connectivité)
+  Real fragmentationRatio() const { return 0.0; }
+
  private:
 
   inline void _checkResizeConnectivityList();
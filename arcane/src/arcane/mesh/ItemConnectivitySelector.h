@@ -71,6 +71,8 @@ class ARCANE_MESH_EXPORT ItemConnectivitySelector
   virtual void updateItemConnectivityList(Int32ConstArrayView) const {}
   virtual void checkValidConnectivityList() const =0;
   virtual void compactConnectivities() =0;
+  //! Taux de fragmentation de la liste des connectivités
+  virtual Real fragmentationRatio() const =0;
 
  public:
 
@@ -139,6 +141,13 @@ class ARCANE_MESH_EXPORT ItemConnectivitySelectorT
       m_custom_connectivity->compactConnectivityList();
   }
 
+  Real fragmentationRatio() const override
+  {
+    if (m_custom_connectivity)
+      return m_custom_connectivity->fragmentationRatio();
+    return 0.0;
+  }
+
  public:
 
   void addConnectedItem(ItemLocalId item_lid,ItemLocalId sub_item_lid)
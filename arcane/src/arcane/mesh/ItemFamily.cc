@@ -20,6 +20,8 @@
 #include "arcane/utils/ArgumentException.h"
 #include "arcane/utils/CheckedConvert.h"
 #include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/ValueConvert.h"
+#include "arcane/utils/Math.h"
 
 #include "arcane/core/IParallelMng.h"
 #include "arcane/core/ISubDomain.h"
@@ -146,6 +148,14 @@ class ItemFamily::InternalApi
   {
     return m_family->_resizeVariables(force_resize);
   }
+  void compactConnectivities(Real fragmentation_threshold) override
+  {
+    m_family->_compactConnectivities(fragmentation_threshold);
+  }
+  Real connectivityFragmentationRatio() override
+  {
+    return m_family->_connectivityFragmentationRatio();
+  }
 
  private:
 
@@ -370,6 +380,8 @@ build()
       m_use_legacy_compact_item = true;
     }
   }
+  if (auto v = Convert::Type<Real>::tryParseFromEnvironment("ARCANE_CONNECTIVITY_COMPACT_THRESHOLD", true))
+    m_connectivity_compact_threshold = v.value();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -585,6 +597,12 @@ _endUpdate(bool need_check_remove)
           << " nb_group=" << m_item_groups.count();
 
   _updateGroups(need_check_remove);
+
+  // Les modifications successives (ajout/suppression de connectivités)
+  // laissent des trous dans les listes de connectivités. Si ces listes
+  // sont trop fragmentées, on les reconstruit.
+  if (m_connectivity_compact_threshold>=0.0)
+    _compactConnectivities(m_connectivity_compact_threshold);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2408,6 +2426,36 @@ _checkValidConnectivity()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void ItemFamily::
+_compactConnectivities(Real fragmentation_threshold)
+{
+  for( ItemConnectivitySelector* ics : m_connectivity_selector_list ){
+    if (fragmentation_threshold>=0.0){
+      Real ratio = ics->fragmentationRatio();
+      if (ratio<=fragmentation_threshold)
+        continue;
+      info(4) << "Compacting connectivity family=" << fullName()
+              << " fragmentation_ratio=" << ratio;
+    }
+    ics->compactConnectivities();
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Real ItemFamily::
+_connectivityFragmentationRatio() const
+{
+  Real max_ratio = 0.0;
+  for( ItemConnectivitySelector* ics : m_connectivity_selector_list )
+    max_ratio = math::max(max_ratio,ics->fragmentationRatio());
+  return max_ratio;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void ItemFamily::
 _addConnectivitySelector(ItemConnectivitySelector* selector)
 {
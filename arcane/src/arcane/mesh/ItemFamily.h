@@ -401,6 +401,8 @@ class ARCANE_MESH_EXPORT ItemFamily
 
   void _addConnectivitySelector(ItemConnectivitySelector* selector);
   void _buildConnectivitySelectors();
+  void _compactConnectivities(Real fragmentation_threshold);
+  Real _connectivityFragmentationRatio() const;
   void _preAllocate(Int32 nb_item,bool pre_alloc_connectivity);
   ItemInternalConnectivityList* _unstructuredItemInternalConnectivityList()
   {
@@ -460,6 +462,11 @@ class ARCANE_MESH_EXPORT ItemFamily
 
   UniqueArray<ItemConnectivitySelector*> m_connectivity_selector_list_by_item_kind;
   bool m_use_legacy_compact_item = false;
+  /*!
+   * \brief Taux de fragmentation à partir duquel les connectivités
+   * sont reconstruites lors d'un endUpdate() (négatif si jamais).
+   */
+  Real m_connectivity_compact_threshold = 0.5;
 
  private:
 
@@ -0,0 +1,447 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* ItemLocalitySortFunction.cc                                 (C) 2000-2024 */
+/*                                                                           */
+/* Fonction de tri des entités pour améliorer la localité mémoire.           */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/mesh/ItemLocalitySortFunction.h"
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/Real3.h"
+#include "arcane/utils/Math.h"
+
+#include "arcane/core/IMesh.h"
+#include "arcane/core/IItemFamily.h"
+#include "arcane/core/ItemGroup.h"
+#include "arcane/core/ItemEnumerator.h"
+#include "arcane/core/ItemInternal.h"
+#include "arcane/core/MeshVariableScalarRef.h"
+
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::mesh
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace
+{
+
+  /*!
+   * \brief Indice sur la courbe de Hilbert de dimension \a dim du point \a x.
+   *
+   * Chaque composante de \a x a \a nb_bit bits. L'algorithme utilisé est
+   * celui de J. Skilling ("Programming the Hilbert curve", 2004). Le
+   * tableau \a x est modifié.
+   */
+  UInt64 _hilbertIndex(UInt32* x, Int32 nb_bit, Int32 dim)
+  {
+    const UInt32 m = 1U << (nb_bit - 1);
+    // Inverse les rotations
+    for (UInt32 q = m; q > 1; q >>= 1) {
+      UInt32 p = q - 1;
+      for (Int32 i = 0; i < dim; ++i) {
+        if (x[i] & q)
+          x[0] ^= p;
+        else {
+          UInt32 t = (x[0] ^ x[i]) & p;
+          x[0] ^= t;
+          x[i] ^= t;
+        }
+      }
+    }
+    // Codage de Gray
+    for (Int32 i = 1; i < dim; ++i)
+      x[i] ^= x[i - 1];
+    UInt32 t = 0;
+    for (UInt32 q = m; q > 1; q >>= 1)
+      if (x[dim - 1] & q)
+        t ^= q - 1;
+    for (Int32 i = 0; i < dim; ++i)
+      x[i] ^= t;
+
+    // Entrelace les bits des composantes
+    UInt64 index = 0;
+    for (Int32 b = nb_bit - 1; b >= 0; --b)
+      for (Int32 i = 0; i < dim; ++i)
+        index = (index << 1) | ((x[i] >> b) & 1);
+    return index;
+  }
+
+  /*!
+   * \brief Trie les mailles de \a cells suivant la courbe de Hilbert
+   * passant par leur centre.
+   */
+  void _computeHilbertOrder(IMesh* mesh, CellGroup cells, Array<Int32>& sorted_cells)
+  {
+    VariableNodeReal3& nodes_coord = mesh->nodesCoordinates();
+    Int32 nb_cell = cells.size();
+    Int32 dim = math::max(mesh->dimension(), 1);
+    UniqueArray<Real3> centers(nb_cell);
+    UniqueArray<Int64> uids(nb_cell);
+    const Real max_value = std::numeric_limits<Real>::max();
+    Real3 min_coord(max_value, max_value, max_value);
+    Real3 max_coord(-max_value, -max_value, -max_value);
+    ENUMERATE_ (Cell, icell, cells) {
+      Cell cell = *icell;
+      Real3 center;
+      for (Node node : cell.nodes())
+        center += nodes_coord[node];
+      Int32 nb_node = cell.nbNode();
+      if (nb_node != 0)
+        center /= static_cast<Real>(nb_node);
+      Int32 index = icell.index();
+      centers[index] = center;
+      uids[index] = cell.uniqueId();
+      sorted_cells[index] = cell.localId();
+      min_coord.x = math::min(min_coord.x, center.x);
+      min_coord.y = math::min(min_coord.y, center.y);
+      min_coord.z = math::min(min_coord.z, center.z);
+      max_coord.x = math::max(max_coord.x, center.x);
+      max_coord.y = math::max(max_coord.y, center.y);
+      max_coord.z = math::max(max_coord.z, center.z);
+    }
+    if (nb_cell == 0)
+      return;
+
+    // Utilise la même échelle dans toutes les directions pour conserver
+    // l'isotropie de la courbe.
+    const Int32 nb_bit = (dim == 3) ? 21 : 31;
+    Real3 extent = max_coord - min_coord;
+    Real max_extent = math::max(extent.x, math::max(extent.y, extent.z));
+    if (max_extent <= 0.0)
+      max_extent = 1.0;
+    const Real scale = static_cast<Real>((UInt64(1) << nb_bit) - 1) / max_extent;
+
+    UniqueArray<UInt64> keys(nb_cell);
+    for (Int32 i = 0; i < nb_cell; ++i) {
+      Real3 p = (centers[i] - min_coord) * scale;
+      UInt32 x[3] = { static_cast<UInt32>(p.x), static_cast<UInt32>(p.y), static_cast<UInt32>(p.z) };
+      keys[i] = (dim == 1) ? x[0] : _hilbertIndex(x, nb_bit, dim);
+    }
+
+    UniqueArray<Int32> indexes(nb_cell);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    std::sort(indexes.begin(), indexes.end(), [&](Int32 a, Int32 b) {
+      if (keys[a] != keys[b])
+        return keys[a] < keys[b];
+      return uids[a] < uids[b];
+    });
+    UniqueArray<Int32> cells_local_id(sorted_cells);
+    for (Int32 i = 0; i < nb_cell; ++i)
+      sorted_cells[i] = cells_local_id[indexes[i]];
+  }
+
+  /*!
+   * \brief Trie les mailles de \a cells avec l'algorithme de Cuthill-McKee
+   * inverse sur le graphe dual (deux mailles sont voisines si elles
+   * partagent une face).
+   *
+   * Pour chaque composante connexe, la racine est un sommet
+   * pseudo-périphérique obtenu par l'algorithme de George-Liu.
+   */
+  void _computeRCMOrder(IMesh* mesh, CellGroup cells, Array<Int32>& sorted_cells)
+  {
+    Int32 nb_cell = cells.size();
+    UniqueArray<Int32> lid_to_index(mesh->cellFamily()->maxLocalId());
+    lid_to_index.fill(-1);
+    UniqueArray<Int64> uids(nb_cell);
+    UniqueArray<Int32> index_to_lid(nb_cell);
+    ENUMERATE_ (Cell, icell, cells) {
+      Int32 index = icell.index();
+      lid_to_index[icell.itemLocalId()] = index;
+      index_to_lid[index] = icell.itemLocalId();
+      uids[index] = (*icell).uniqueId();
+    }
+
+    // Construit le graphe dual au format CSR
+    UniqueArray<Int32> offsets(nb_cell + 1);
+    UniqueArray<Int32> neighbours;
+    neighbours.reserve(nb_cell * 6);
+    ENUMERATE_ (Cell, icell, cells) {
+      Cell cell = *icell;
+      offsets[icell.index()] = neighbours.size();
+      for (Face face : cell.faces()) {
+        for (Cell opposite_cell : face.cells()) {
+          if (opposite_cell.localId() == cell.localId())
+            continue;
+          Int32 index = lid_to_index[opposite_cell.localId()];
+          if (index >= 0)
+            neighbours.add(index);
+        }
+      }
+    }
+    offsets[nb_cell] = neighbours.size();
+
+    UniqueArray<Int32> degrees(nb_cell);
+    for (Int32 i = 0; i < nb_cell; ++i)
+      degrees[i] = offsets[i + 1] - offsets[i];
+    auto is_before = [&](Int32 a, Int32 b) {
+      if (degrees[a] != degrees[b])
+        return degrees[a] < degrees[b];
+      return uids[a] < uids[b];
+    };
+    // Trie les voisins par degré croissant
+    for (Int32 i = 0; i < nb_cell; ++i)
+      std::sort(neighbours.begin() + offsets[i], neighbours.begin() + offsets[i + 1], is_before);
+
+    // Parcours en largeur à partir de \a root. Retourne l'excentricité de
+    // \a root et le sommet de plus petit degré du dernier niveau.
+    UniqueArray<Int32> marks(nb_cell);
+    marks.fill(-1);
+    UniqueArray<Int32> levels(nb_cell);
+    UniqueArray<Int32> queue;
+    queue.reserve(nb_cell);
+    Int32 current_mark = 0;
+    auto bfs = [&](Int32 root) -> std::pair<Int32, Int32> {
+      ++current_mark;
+      queue.clear();
+      queue.add(root);
+      marks[root] = current_mark;
+      levels[root] = 0;
+      for (Int32 pos = 0; pos < queue.size(); ++pos) {
+        Int32 v = queue[pos];
+        for (Int32 k = offsets[v], kn = offsets[v + 1]; k < kn; ++k) {
+          Int32 w = neighbours[k];
+          if (marks[w] != current_mark) {
+            marks[w] = current_mark;
+            levels[w] = levels[v] + 1;
+            queue.add(w);
+          }
+        }
+      }
+      Int32 eccentricity = levels[queue.back()];
+      Int32 candidate = queue.back();
+      for (Int32 v : queue)
+        if (levels[v] == eccentricity && is_before(v, candidate))
+          candidate = v;
+      return { eccentricity, candidate };
+    };
+
+    UniqueArray<Int32> roots(nb_cell);
+    std::iota(roots.begin(), roots.end(), 0);
+    std::sort(roots.begin(), roots.end(), is_before);
+
+    UniqueArray<bool> is_numbered(nb_cell, false);
+    UniqueArray<Int32> order;
+    order.reserve(nb_cell);
+    for (Int32 start : roots) {
+      if (is_numbered[start])
+        continue;
+
+      // Recherche d'un sommet pseudo-périphérique
+      Int32 root = start;
+      auto [eccentricity, candidate] = bfs(root);
+      for (;;) {
+        auto [candidate_eccentricity, next_candidate] = bfs(candidate);
+        if (candidate_eccentricity <= eccentricity)
+          break;
+        root = candidate;
+        eccentricity = candidate_eccentricity;
+        candidate = next_candidate;
+      }
+
+      // Cuthill-McKee
+      Int32 begin = order.size();
+      order.add(root);
+      is_numbered[root] = true;
+      for (Int32 pos = begin; pos < order.size(); ++pos) {
+        Int32 v = order[pos];
+        for (Int32 k = offsets[v], kn = offsets[v + 1]; k < kn; ++k) {
+          Int32 w = neighbours[k];
+          if (!is_numbered[w]) {
+            is_numbered[w] = true;
+            order.add(w);
+          }
+        }
+      }
+    }
+
+    if (order.size() != nb_cell)
+      ARCANE_FATAL("Internal error in RCM ordering: nb_ordered={0} nb_cell={1}", order.size(), nb_cell);
+    for (Int32 i = 0; i < nb_cell; ++i)
+      sorted_cells[i] = index_to_lid[order[nb_cell - 1 - i]];
+  }
+
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ConstArrayView<Int32> ItemLocalityCellsRank::
+cellsRank()
+{
+  if (!m_is_computed) {
+    ItemLocalitySortFunction::computeCellsRank(m_mesh, m_ordering, m_cells_rank);
+    ++m_nb_compute;
+    m_is_computed = m_is_keep_result;
+  }
+  return m_cells_rank;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemLocalityCellsRank::
+setKeepResult(bool v)
+{
+  m_is_keep_result = v;
+  m_is_computed = false;
+  if (!v)
+    m_cells_rank.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ItemLocalitySortFunction::
+ItemLocalitySortFunction(IItemFamily* family, eItemLocalityOrdering ordering)
+: ItemLocalitySortFunction(family, std::make_shared<ItemLocalityCellsRank>(family->mesh(), ordering))
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ItemLocalitySortFunction::
+ItemLocalitySortFunction(IItemFamily* family, std::shared_ptr<ItemLocalityCellsRank> cells_rank)
+: m_family(family)
+, m_cells_rank(cells_rank)
+{
+  switch (m_cells_rank->ordering()) {
+  case eItemLocalityOrdering::None:
+    m_name = "LocalityNone";
+    break;
+  case eItemLocalityOrdering::Hilbert:
+    m_name = "LocalityHilbert";
+    break;
+  case eItemLocalityOrdering::ReverseCuthillMcKee:
+    m_name = "LocalityRCM";
+    break;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool ItemLocalitySortFunction::
+parseOrdering(const String& str, eItemLocalityOrdering& ordering)
+{
+  if (str == "None")
+    ordering = eItemLocalityOrdering::None;
+  else if (str == "Hilbert")
+    ordering = eItemLocalityOrdering::Hilbert;
+  else if (str == "RCM")
+    ordering = eItemLocalityOrdering::ReverseCuthillMcKee;
+  else
+    return true;
+  return false;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemLocalitySortFunction::
+computeCellsRank(IMesh* mesh, eItemLocalityOrdering ordering, Array<Int32>& cells_rank)
+{
+  CellGroup all_cells = mesh->allCells();
+  Int32 nb_cell = all_cells.size();
+  UniqueArray<Int32> sorted_cells(nb_cell);
+
+  switch (ordering) {
+  case eItemLocalityOrdering::Hilbert:
+    _computeHilbertOrder(mesh, all_cells, sorted_cells);
+    break;
+  case eItemLocalityOrdering::ReverseCuthillMcKee:
+    _computeRCMOrder(mesh, all_cells, sorted_cells);
+    break;
+  case eItemLocalityOrdering::None: {
+    UniqueArray<Int64> uids(nb_cell);
+    ENUMERATE_ (Cell, icell, all_cells) {
+      sorted_cells[icell.index()] = icell.itemLocalId();
+      uids[icell.index()] = (*icell).uniqueId();
+    }
+    UniqueArray<Int32> indexes(nb_cell);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    std::sort(indexes.begin(), indexes.end(), [&](Int32 a, Int32 b) { return uids[a] < uids[b]; });
+    UniqueArray<Int32> cells_local_id(sorted_cells);
+    for (Int32 i = 0; i < nb_cell; ++i)
+      sorted_cells[i] = cells_local_id[indexes[i]];
+  } break;
+  }
+
+  cells_rank.resize(mesh->cellFamily()->maxLocalId());
+  cells_rank.fill(-1);
+  for (Int32 i = 0; i < nb_cell; ++i)
+    cells_rank[sorted_cells[i]] = i;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemLocalitySortFunction::
+sortItems(ItemInternalMutableArrayView items)
+{
+  ConstArrayView<Int32> cells_rank = m_cells_rank->cellsRank();
+
+  // Calcule la clé de tri de chaque entité. Pour les mailles, il s'agit de
+  // leur rang. Pour les autres entités, il s'agit du plus petit rang des
+  // mailles connectées.
+  const bool is_cell = (m_family->itemKind() == IK_Cell);
+  const Int32 no_rank = std::numeric_limits<Int32>::max();
+  UniqueArray<Int32> keys(m_family->maxLocalId());
+  keys.fill(no_rank);
+  for (ItemInternal* item : items) {
+    if (item->isSuppressed())
+      continue;
+    Int32 lid = item->localId();
+    if (is_cell) {
+      keys[lid] = cells_rank[lid];
+      continue;
+    }
+    Int32 key = no_rank;
+    for (Int32 i = 0, n = item->nbCell(); i < n; ++i) {
+      Int32 rank = cells_rank[item->cellId(i)];
+      if (rank >= 0)
+        key = math::min(key, rank);
+    }
+    keys[lid] = key;
+  }
+
+  auto compare = [&](const ItemInternal* item1, const ItemInternal* item2) {
+    // Il faut mettre les entités détruites en fin de liste
+    bool s1 = item1->isSuppressed();
+    bool s2 = item2->isSuppressed();
+    if (s1 != s2)
+      return s2;
+    if (!s1) {
+      Int32 k1 = keys[item1->localId()];
+      Int32 k2 = keys[item2->localId()];
+      if (k1 != k2)
+        return k1 < k2;
+    }
+    return item1->uniqueId() < item2->uniqueId();
+  };
+  std::sort(std::begin(items), std::end(items), compare);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::mesh
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
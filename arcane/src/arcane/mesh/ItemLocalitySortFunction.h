@@ -0,0 +1,164 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* ItemLocalitySortFunction.h                                  (C) 2000-2024 */
+/*                                                                           */
+/* Fonction de tri des entités pour améliorer la localité mémoire.           */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_MESH_ITEMLOCALITYSORTFUNCTION_H
+#define ARCANE_MESH_ITEMLOCALITYSORTFUNCTION_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/String.h"
+#include "arcane/utils/Array.h"
+
+#include "arcane/core/ItemTypes.h"
+#include "arcane/core/IItemInternalSortFunction.h"
+
+#include "arcane/mesh/MeshGlobal.h"
+
+#include <memory>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::mesh
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+//! Méthode de numérotation des entités pour la localité mémoire
+enum class eItemLocalityOrdering
+{
+  //! Pas de renumérotation (tri par uniqueId())
+  None,
+  //! Tri des mailles suivant la courbe de Hilbert passant par leur centre
+  Hilbert,
+  //! Tri des mailles par Cuthill-McKee inverse sur le graphe dual
+  ReverseCuthillMcKee
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Rang des mailles pour la localité mémoire.
+ *
+ * Le rang des mailles ne dépend pas de la famille triée. Une instance peut
+ * donc être partagée entre les fonctions de tri des différentes familles
+ * d'un maillage. Si setKeepResult(true) a été appelé, le rang calculé lors
+ * du premier appel à cellsRank() est conservé pour les appels suivants.
+ * Cela n'est valide que tant que les mailles et leurs numéros locaux ne
+ * changent pas, ce qui est le cas pendant la phase de tri d'un compactage
+ * (voir DynamicMesh::_compactItems()). Sinon, le rang est recalculé à
+ * chaque appel.
+ */
+class ARCANE_MESH_EXPORT ItemLocalityCellsRank
+{
+ public:
+
+  ItemLocalityCellsRank(IMesh* mesh, eItemLocalityOrdering ordering)
+  : m_mesh(mesh)
+  , m_ordering(ordering)
+  {}
+
+ public:
+
+  eItemLocalityOrdering ordering() const { return m_ordering; }
+
+  /*!
+   * \brief Rang des mailles indicé par leur localId().
+   *
+   * Voir ItemLocalitySortFunction::computeCellsRank().
+   */
+  ConstArrayView<Int32> cellsRank();
+
+  //! Indique si le rang calculé est conservé entre deux appels à cellsRank()
+  void setKeepResult(bool v);
+
+  //! Nombre de fois où le rang des mailles a été calculé
+  Int32 nbCompute() const { return m_nb_compute; }
+
+ private:
+
+  IMesh* m_mesh = nullptr;
+  eItemLocalityOrdering m_ordering = eItemLocalityOrdering::None;
+  UniqueArray<Int32> m_cells_rank;
+  bool m_is_keep_result = false;
+  bool m_is_computed = false;
+  Int32 m_nb_compute = 0;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Fonction de tri des entités pour améliorer la localité mémoire.
+ *
+ * Cette fonction est utilisée lors du compactage des familles (voir
+ * IItemFamily::setItemSortFunction()). Les mailles sont d'abord ordonnées
+ * suivant la méthode \a ordering. Pour les autres familles (noeuds, arêtes
+ * et faces), les entités sont ordonnées suivant le plus petit rang des
+ * mailles auxquelles elles sont connectées. Ainsi, les noeuds et les faces
+ * d'une maille ont des numéros locaux proches de ceux de la maille, ce qui
+ * limite les défauts de cache lors des accès indirects.
+ *
+ * En cas d'égalité, les entités sont triées par uniqueId(). Comme avec le
+ * tri par défaut, les entités détruites sont placées en fin de liste.
+ *
+ * Le résultat ne dépend que de la géométrie (pour eItemLocalityOrdering::Hilbert)
+ * ou de la topologie (pour eItemLocalityOrdering::ReverseCuthillMcKee) et
+ * des uniqueId() et pas de la numérotation locale courante.
+ */
+class ARCANE_MESH_EXPORT ItemLocalitySortFunction
+: public IItemInternalSortFunction
+{
+ public:
+
+  ItemLocalitySortFunction(IItemFamily* family, eItemLocalityOrdering ordering);
+  //! Fonction de tri utilisant le rang des mailles partagé \a cells_rank
+  ItemLocalitySortFunction(IItemFamily* family, std::shared_ptr<ItemLocalityCellsRank> cells_rank);
+
+ public:
+
+  const String& name() const override { return m_name; }
+  void sortItems(ItemInternalMutableArrayView items) override;
+
+ public:
+
+  /*!
+   * \brief Calcule le rang des mailles de \a mesh suivant \a ordering.
+   *
+   * En retour, \a cells_rank est indicé par le localId() des mailles et
+   * contient le rang de chaque maille (ou -1 pour les localId() non utilisés).
+   */
+  static void computeCellsRank(IMesh* mesh, eItemLocalityOrdering ordering, Array<Int32>& cells_rank);
+
+  /*!
+   * \brief Analyse \a str pour retrouver la méthode de numérotation.
+   *
+   * Les valeurs valides sont 'None', 'Hilbert' et 'RCM'.
+   *
+   * \retval true en cas d'erreur.
+   */
+  static bool parseOrdering(const String& str, eItemLocalityOrdering& ordering);
+
+ private:
+
+  IItemFamily* m_family = nullptr;
+  std::shared_ptr<ItemLocalityCellsRank> m_cells_rank;
+  String m_name;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::mesh
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
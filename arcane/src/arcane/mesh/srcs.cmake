@@ -58,6 +58,8 @@ set( ARCANE_SOURCES
   ItemFamilyPolicyMng.h
   ItemFamilyCompactPolicy.cc
   ItemFamilyCompactPolicy.h
+  ItemLocalitySortFunction.cc
+  ItemLocalitySortFunction.h
   ItemInternalMap.cc
   ItemInternalMap.h
   ItemSharedInfoList.cc
@@ -184,6 +186,7 @@ set( ARCANE_SOURCES
   ItemFamily.h
   ItemFamilyPolicyMng.h
   ItemFamilyCompactPolicy.h
+  ItemLocalitySortFunction.h
   ItemInternalMap.h
   ItemSharedInfoList.h
   ItemTools.h
@@ -0,0 +1,342 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* MpiPersistentVariableSynchronizeDispatcher.cc               (C) 2000-2024 */
+/*                                                                           */
+/* Synchronisations des variables via des requêtes MPI persistantes.         */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/MemoryView.h"
+
+#include "arcane/parallel/mpi/MpiParallelMng.h"
+#include "arcane/parallel/mpi/MpiAdapter.h"
+#include "arcane/parallel/mpi/MpiDatatypeList.h"
+#include "arcane/parallel/mpi/MpiDatatype.h"
+#include "arcane/parallel/mpi/MpiTimeInterval.h"
+#include "arcane/parallel/IStat.h"
+
+#include "arcane/impl/IDataSynchronizeBuffer.h"
+#include "arcane/impl/IDataSynchronizeImplementation.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*
+ * Cette implémentation utilise des requêtes persistantes (MPI_Send_init et
+ * MPI_Recv_init) qui sont démarrées via MPI_Startall() à chaque
+ * synchronisation. Le schéma de communication (rangs, tailles) et les
+ * adresses des buffers étant en général les mêmes entre deux appels à
+ * compute(), cela évite de créer et de détruire des requêtes MPI à
+ * chaque synchronisation.
+ *
+ * Les requêtes sont reconstruites si compute() est appelé ou si un des
+ * buffers d'envoi ou de réception a changé (adresse ou taille). C'est
+ * par exemple le cas lorsqu'on synchronise successivement des variables
+ * de types différents.
+ *
+ * Les requêtes persistantes ne passent pas par MpiAdapter et ne sont donc
+ * pas prises en compte dans la vérification des requêtes de ce dernier.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation de la synchronisation via des requêtes persistantes.
+ */
+class MpiPersistentVariableSynchronizeDispatcher
+: public AbstractDataSynchronizeImplementation
+{
+  //! Informations sur un buffer associé à une requête
+  struct BufferInfo
+  {
+    bool operator==(const BufferInfo& rhs) const
+    {
+      return m_data == rhs.m_data && m_size == rhs.m_size && m_rank == rhs.m_rank;
+    }
+    bool operator!=(const BufferInfo& rhs) const { return !operator==(rhs); }
+
+    std::byte* m_data = nullptr;
+    Int64 m_size = 0;
+    Int32 m_rank = -1;
+  };
+
+ public:
+
+  class Factory;
+  explicit MpiPersistentVariableSynchronizeDispatcher(Factory* f);
+  ~MpiPersistentVariableSynchronizeDispatcher() override;
+
+ protected:
+
+  void compute() override { _freeRequests(); }
+  void beginSynchronize(IDataSynchronizeBuffer* ds_buf) override;
+  void endSynchronize(IDataSynchronizeBuffer* ds_buf) override;
+
+ private:
+
+  MpiParallelMng* m_mpi_parallel_mng;
+  UniqueArray<BufferInfo> m_send_infos;
+  UniqueArray<BufferInfo> m_receive_infos;
+  UniqueArray<MPI_Request> m_send_requests;
+  UniqueArray<MPI_Request> m_receive_requests;
+  //! Indice dans 'IDataSynchronizeBuffer' de chaque requête de réception
+  UniqueArray<Int32> m_receive_indexes;
+  UniqueArray<int> m_done_indexes;
+  bool m_is_valid = false;
+
+ private:
+
+  bool _isSameBuffers(IDataSynchronizeBuffer* ds_buf);
+  void _buildRequests(IDataSynchronizeBuffer* ds_buf);
+  void _freeRequests();
+  static int _toMessageSize(Int64 size);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class MpiPersistentVariableSynchronizeDispatcher::Factory
+: public IDataSynchronizeImplementationFactory
+{
+ public:
+
+  explicit Factory(MpiParallelMng* mpi_pm)
+  : m_mpi_parallel_mng(mpi_pm)
+  {}
+
+  Ref<IDataSynchronizeImplementation> createInstance() override
+  {
+    auto* x = new MpiPersistentVariableSynchronizeDispatcher(this);
+    return makeRef<IDataSynchronizeImplementation>(x);
+  }
+
+ public:
+
+  MpiParallelMng* m_mpi_parallel_mng = nullptr;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateMpiPersistentVariableSynchronizerFactory(MpiParallelMng* mpi_pm)
+{
+  auto* x = new MpiPersistentVariableSynchronizeDispatcher::Factory(mpi_pm);
+  return makeRef<IDataSynchronizeImplementationFactory>(x);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiPersistentVariableSynchronizeDispatcher::
+MpiPersistentVariableSynchronizeDispatcher(Factory* f)
+: m_mpi_parallel_mng(f->m_mpi_parallel_mng)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiPersistentVariableSynchronizeDispatcher::
+~MpiPersistentVariableSynchronizeDispatcher()
+{
+  // Il n'est plus possible de libérer les requêtes si MPI est finalisé.
+  int is_finalized = 0;
+  MPI_Finalized(&is_finalized);
+  if (!is_finalized)
+    _freeRequests();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+int MpiPersistentVariableSynchronizeDispatcher::
+_toMessageSize(Int64 size)
+{
+  if (size > INT32_MAX)
+    ARCANE_FATAL("Message size '{0}' is too large for persistent requests", size);
+  return static_cast<int>(size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiPersistentVariableSynchronizeDispatcher::
+_freeRequests()
+{
+  for (MPI_Request& r : m_send_requests)
+    if (r != MPI_REQUEST_NULL)
+      MPI_Request_free(&r);
+  for (MPI_Request& r : m_receive_requests)
+    if (r != MPI_REQUEST_NULL)
+      MPI_Request_free(&r);
+  m_send_requests.clear();
+  m_receive_requests.clear();
+  m_receive_indexes.clear();
+  m_send_infos.clear();
+  m_receive_infos.clear();
+  m_is_valid = false;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Indique si les buffers de \a ds_buf sont les mêmes que ceux
+ * utilisés pour construire les requêtes.
+ */
+bool MpiPersistentVariableSynchronizeDispatcher::
+_isSameBuffers(IDataSynchronizeBuffer* ds_buf)
+{
+  if (!m_is_valid)
+    return false;
+  Int32 nb_message = ds_buf->nbRank();
+  if (nb_message != m_send_infos.size())
+    return false;
+  for (Int32 i = 0; i < nb_message; ++i) {
+    Int32 rank = ds_buf->targetRank(i);
+    auto sbuf = ds_buf->sendBuffer(i).bytes();
+    if (m_send_infos[i] != BufferInfo{ sbuf.data(), sbuf.size(), rank })
+      return false;
+    auto rbuf = ds_buf->receiveBuffer(i).bytes();
+    if (m_receive_infos[i] != BufferInfo{ rbuf.data(), rbuf.size(), rank })
+      return false;
+  }
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiPersistentVariableSynchronizeDispatcher::
+_buildRequests(IDataSynchronizeBuffer* ds_buf)
+{
+  _freeRequests();
+
+  constexpr int serialize_tag = 523;
+  MpiParallelMng* pm = m_mpi_parallel_mng;
+  const MPI_Datatype mpi_dt = pm->datatypes()->datatype(Byte())->datatype();
+
+  Int32 nb_message = ds_buf->nbRank();
+  m_send_infos.resize(nb_message);
+  m_receive_infos.resize(nb_message);
+
+  for (Int32 i = 0; i < nb_message; ++i) {
+    Int32 rank = ds_buf->targetRank(i);
+    auto sbuf = ds_buf->sendBuffer(i).bytes();
+    auto rbuf = ds_buf->receiveBuffer(i).bytes();
+    m_send_infos[i] = BufferInfo{ sbuf.data(), sbuf.size(), rank };
+    m_receive_infos[i] = BufferInfo{ rbuf.data(), rbuf.size(), rank };
+    // Il n'est pas nécessaire d'envoyer ou de recevoir des messages vides.
+    if (!rbuf.empty()) {
+      MPI_Request request = MPI_REQUEST_NULL;
+      MPI_Recv_init(rbuf.data(), _toMessageSize(rbuf.size()), mpi_dt, rank, serialize_tag,
+                    pm->communicator(), &request);
+      m_receive_requests.add(request);
+      m_receive_indexes.add(i);
+    }
+    if (!sbuf.empty()) {
+      MPI_Request request = MPI_REQUEST_NULL;
+      MPI_Send_init(sbuf.data(), _toMessageSize(sbuf.size()), mpi_dt, rank, serialize_tag,
+                    pm->communicator(), &request);
+      m_send_requests.add(request);
+    }
+  }
+  m_done_indexes.resize(m_receive_requests.size());
+  m_is_valid = true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiPersistentVariableSynchronizeDispatcher::
+beginSynchronize(IDataSynchronizeBuffer* ds_buf)
+{
+  MpiParallelMng* pm = m_mpi_parallel_mng;
+
+  double prepare_time = 0.0;
+  {
+    MpiTimeInterval tit(&prepare_time);
+
+    if (!_isSameBuffers(ds_buf))
+      _buildRequests(ds_buf);
+
+    // Poste les messages de réception
+    if (!m_receive_requests.empty())
+      MPI_Startall(m_receive_requests.size(), m_receive_requests.data());
+
+    // Recopie les valeurs à envoyer dans les buffers d'envoi.
+    ds_buf->copyAllSend();
+
+    // Poste les messages d'envoi
+    if (!m_send_requests.empty())
+      MPI_Startall(m_send_requests.size(), m_send_requests.data());
+  }
+  pm->stat()->add("SyncPrepare", prepare_time, ds_buf->totalSendSize());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiPersistentVariableSynchronizeDispatcher::
+endSynchronize(IDataSynchronizeBuffer* ds_buf)
+{
+  MpiParallelMng* pm = m_mpi_parallel_mng;
+
+  double copy_time = 0.0;
+  double wait_time = 0.0;
+
+  // Recopie les messages dès qu'ils arrivent. Une fois terminée, une
+  // requête persistante devient inactive et MPI_Waitsome l'ignore.
+  // MPI_Waitsome retourne MPI_UNDEFINED lorsque toutes les requêtes
+  // sont inactives.
+  int nb_request = m_receive_requests.size();
+  while (nb_request > 0) {
+    int nb_done = 0;
+    {
+      MpiTimeInterval tit(&wait_time);
+      MPI_Waitsome(nb_request, m_receive_requests.data(), &nb_done,
+                   m_done_indexes.data(), MPI_STATUSES_IGNORE);
+    }
+    if (nb_done == MPI_UNDEFINED)
+      break;
+    MpiTimeInterval tit(&copy_time);
+    for (int i = 0; i < nb_done; ++i)
+      ds_buf->copyReceiveAsync(m_receive_indexes[m_done_indexes[i]]);
+  }
+
+  // Attend que les envois se terminent pour pouvoir réutiliser les buffers.
+  {
+    MpiTimeInterval tit(&wait_time);
+    if (!m_send_requests.empty())
+      MPI_Waitall(m_send_requests.size(), m_send_requests.data(), MPI_STATUSES_IGNORE);
+  }
+
+  // S'assure que les copies des buffers sont bien terminées
+  ds_buf->barrier();
+
+  Int64 total_ghost_size = ds_buf->totalReceiveSize();
+  Int64 total_share_size = ds_buf->totalSendSize();
+  Int64 total_size = total_ghost_size + total_share_size;
+  pm->stat()->add("SyncCopy", copy_time, total_ghost_size);
+  pm->stat()->add("SyncWait", wait_time, total_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -19,6 +19,7 @@ set( ARCANE_SOURCES
   MpiBlockVariableSynchronizeDispatcher.cc
   MpiDirectSendrecvVariableSynchronizeDispatcher.cc
   MpiLegacyVariableSynchronizeDispatcher.cc
+  MpiPersistentVariableSynchronizeDispatcher.cc
   MpiSerializeMessage.h
   MpiSerializeMessageList.h
   MpiTimerMng.cc
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* TBBTaskImplementation.cc                                    (C) 2000-2023 */
+/* TBBTaskImplementation.cc                                    (C) 2000-2024 */
 /*                                                                           */
 /* Implémentation des tâches utilisant TBB (Intel Threads Building Blocks).  */
 /*---------------------------------------------------------------------------*/
@@ -21,9 +21,12 @@
 #include "arcane/utils/PlatformUtils.h"
 #include "arcane/utils/Profiling.h"
 #include "arcane/utils/MemoryAllocator.h"
+#include "arcane/utils/Array.h"
+#include "arcane/utils/Math.h"
 
 #include "arcane/FactoryService.h"
 
+#include <algorithm>
 #include <new>
 #include <stack>
 
@@ -69,6 +72,8 @@
 
 #endif // ARCANE_USE_ONETBB
 
+#include "arcane/parallel/thread/internal/TBBCostBlockedRange.h"
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -895,6 +900,30 @@ class TBBDeterministicParallelFor
   Integer m_nb_block_per_thread;
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécuteur pour une boucle 1D découpée en fonction du coût des itérations.
+ */
+class TBBCostParallelFor
+{
+ public:
+
+  explicit TBBCostParallelFor(const TBBParallelFor& tbb_for) : m_tbb_for(tbb_for){}
+
+ public:
+
+  void operator()(TBBCostBlockedRange& range) const
+  {
+    tbb::blocked_range<Integer> r(range.begin(),range.end());
+    m_tbb_for(r);
+  }
+
+ private:
+
+  const TBBParallelFor& m_tbb_for;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -931,9 +960,57 @@ class TBBTaskImplementation::ParallelForExecute
       TBBDeterministicParallelFor dpf(m_impl,pf,m_begin,m_size,gsize,nb_thread);
       tbb::parallel_for(range2,dpf);
     }
+    else if (m_options.partitioner()==ParallelLoopOptions::Partitioner::Weighted && m_options.hasItemCosts()){
+      _executeWeighted(pf,nb_thread,gsize);
+    }
     else
       tbb::parallel_for(range,pf);
   }
+
+ private:
+
+  /*!
+   * \brief Exécute la boucle en découpant l'intervalle en fonction du coût
+   * des itérations.
+   *
+   * Le découpage est fait à la demande par les TBB (auto_partitioner) : un
+   * intervalle n'est coupé que si un thread est inoccupé. Pour limiter le
+   * surcoût, un intervalle n'est plus découpé si son coût est inférieur à
+   * une fraction du coût total dépendant du nombre de threads.
+   */
+  void _executeWeighted(const TBBParallelFor& pf,Integer nb_thread,Integer gsize) const
+  {
+    ConstArrayView<Real> prefix_sum = m_options.itemCostPrefixSum();
+    UniqueArray<Real> computed_prefix_sum;
+    if (prefix_sum.empty()){
+      ConstArrayView<Real> costs = m_options.itemCosts();
+      if (costs.size()<m_size)
+        ARCANE_FATAL("Bad size for item costs v={0} expected={1}",costs.size(),m_size);
+      computed_prefix_sum.resize(m_size+1);
+      Real sum = 0.0;
+      computed_prefix_sum[0] = sum;
+      for( Integer i=0; i<m_size; ++i ){
+        sum += costs[i];
+        computed_prefix_sum[i+1] = sum;
+      }
+      prefix_sum = computed_prefix_sum.constView();
+    }
+    if (prefix_sum.size()<(m_size+1))
+      ARCANE_FATAL("Bad size for item cost prefix sum v={0} expected={1}",prefix_sum.size(),m_size+1);
+
+    // Nombre de blocs minimum par thread pour permettre l'équilibrage.
+    const Real nb_block_per_thread = 8.0;
+    Real total_cost = prefix_sum[m_size] - prefix_sum[0];
+    Real min_cost = total_cost / (nb_block_per_thread * math::max(nb_thread,1));
+    if (TaskFactory::verboseLevel()>=1)
+      std::cout << "TBB: ParallelForExecute weighted total_cost=" << total_cost
+                << " min_cost=" << min_cost << '\n';
+
+    TBBCostBlockedRange cost_range(m_begin,m_begin+m_size,m_begin,prefix_sum.data(),min_cost,gsize);
+    TBBCostParallelFor cpf(pf);
+    tbb::parallel_for(cost_range,cpf,tbb::auto_partitioner());
+  }
+
  private:
   TBBTaskImplementation* m_impl = nullptr;
   Integer m_begin;
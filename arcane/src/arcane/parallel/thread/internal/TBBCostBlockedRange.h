@@ -0,0 +1,116 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* TBBCostBlockedRange.h                                       (C) 2000-2024 */
+/*                                                                           */
+/* Intervalle d'itération TBB découpé en fonction du coût des itérations.    */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_PARALLEL_THREAD_INTERNAL_TBBCOSTBLOCKEDRANGE_H
+#define ARCANE_PARALLEL_THREAD_INTERNAL_TBBCOSTBLOCKEDRANGE_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Math.h"
+
+#include <tbb/blocked_range.h>
+
+#include <algorithm>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Intervalle d'itération découpé en fonction du coût des itérations.
+ *
+ * Cette classe respecte le concept 'Range' des TBB. Lors d'un découpage,
+ * l'intervalle est coupé de sorte que les deux parties aient le même coût,
+ * ce dernier étant calculé à partir de la somme préfixe \a m_prefix_sum
+ * (indexée à partir de \a m_base_index). Un intervalle n'est plus découpé
+ * si son coût est inférieur à \a m_min_cost ou si son nombre d'itérations
+ * est inférieur ou égal à \a m_grain_size.
+ *
+ * La somme préfixe doit être croissante (voir ParallelLoopOptions::setItemCosts()).
+ */
+class TBBCostBlockedRange
+{
+ public:
+
+  TBBCostBlockedRange(Integer begin,Integer end,Integer base_index,
+                      const Real* prefix_sum,Real min_cost,Integer grain_size)
+  : m_begin(begin), m_end(end), m_base_index(base_index), m_prefix_sum(prefix_sum)
+  , m_min_cost(min_cost), m_grain_size(math::max(grain_size,1)){}
+
+  //! Découpe \a r en deux. \a r contient la première moitié et l'instance la seconde.
+  TBBCostBlockedRange(TBBCostBlockedRange& r,tbb::split)
+  : TBBCostBlockedRange(r)
+  {
+    Integer middle = r._costMiddle();
+    r.m_end = middle;
+    m_begin = middle;
+  }
+
+ public:
+
+  bool empty() const { return m_end<=m_begin; }
+  bool is_divisible() const
+  {
+    return ((m_end-m_begin)>m_grain_size) && (cost()>m_min_cost);
+  }
+  Integer begin() const { return m_begin; }
+  Integer end() const { return m_end; }
+  //! Coût de l'intervalle
+  Real cost() const { return _cost(m_begin,m_end); }
+
+ private:
+
+  Real _cost(Integer begin,Integer end) const
+  {
+    return m_prefix_sum[end-m_base_index] - m_prefix_sum[begin-m_base_index];
+  }
+
+  //! Indice coupant l'intervalle en deux parties de même coût.
+  Integer _costMiddle() const
+  {
+    const Real* first = m_prefix_sum + (m_begin-m_base_index);
+    const Real* last = m_prefix_sum + (m_end-m_base_index);
+    Real half_cost = (*first + *last) * 0.5;
+    Integer offset = static_cast<Integer>(std::lower_bound(first,last,half_cost) - first);
+    // L'itération qui contient le coût médian est placée dans la partie
+    // qui équilibre le mieux les coûts.
+    if (offset>0 && (half_cost-first[offset-1])<(first[offset]-half_cost))
+      --offset;
+    Integer middle = m_begin + offset;
+    // Garantit que chaque partie contient au moins une itération.
+    return math::min(math::max(middle,m_begin+1),m_end-1);
+  }
+
+ private:
+
+  Integer m_begin;
+  Integer m_end;
+  Integer m_base_index;
+  const Real* m_prefix_sum;
+  Real m_min_cost;
+  Integer m_grain_size;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
@@ -0,0 +1,413 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* AsyncPostProcessor.cc                                       (C) 2000-2024 */
+/*                                                                           */
+/* Post-processeur effectuant les écritures en tâche de fond.                */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Event.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/MemoryView.h"
+#include "arcane/utils/List.h"
+
+#include "arcane/core/PostProcessorWriterBase.h"
+#include "arcane/core/IDataWriter.h"
+#include "arcane/core/IData.h"
+#include "arcane/core/IVariable.h"
+#include "arcane/core/IMesh.h"
+#include "arcane/core/IParallelMng.h"
+#include "arcane/core/ItemGroup.h"
+#include "arcane/core/VariableCollection.h"
+#include "arcane/core/MeshEvents.h"
+#include "arcane/core/internal/IDataInternal.h"
+
+#include "arcane/std/internal/AsyncWriteQueue.h"
+#include "arcane/std/AsyncPostProcessor_axl.h"
+
+#include "arcane_packages.h"
+
+#include <memory>
+
+#ifdef ARCANE_HAS_PACKAGE_HDF5
+#include <hdf5.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Post-processeur effectuant les écritures en tâche de fond.
+ *
+ * Ce service délègue les écritures au post-processeur spécifié par l'option
+ * 'post-processor'. Les appels à ce dernier qui accèdent au maillage
+ * (notifyBeginWrite(), IDataWriter::beginWrite() et
+ * IDataWriter::setMetaData(), qui écrivent en général les coordonnées,
+ * les connectivités et les groupes) sont faits par le thread appelant.
+ * Seule l'écriture des valeurs des variables (IDataWriter::write()) est
+ * faite par un thread dédié à partir d'une copie de ces valeurs. La mémoire
+ * utilisée par les copies en attente d'écriture est bornée par l'option
+ * 'max-staging-memory'.
+ *
+ * Le thread d'écriture ne doit pas accéder au maillage ni aux groupes qui
+ * peuvent être modifiés par le thread appelant pendant l'écriture. Il n'est
+ * donc utilisé que pour les post-processeurs dont IDataWriter::write()
+ * n'utilise que la copie des valeurs, les propriétés invariantes de la
+ * variable (nom, genre, type de données) et les informations préparées
+ * dans IDataWriter::beginWrite() (voir _isAsyncWriter()). Pour les autres
+ * post-processeurs, l'écriture est faite par le thread appelant. Les
+ * variables partielles sont toujours écrites par le thread appelant car
+ * leur écriture utilise la table d'index de leur groupe. Les
+ * post-processeurs utilisant HDF5 ne sont utilisés en tâche de fond que si
+ * la bibliothèque HDF5 est compilée avec le support des threads.
+ *
+ * Les appels à IDataWriter::endWrite() et notifyEndWrite() du
+ * post-processeur sont faits par le thread appelant une fois les valeurs
+ * écrites, c'est-à-dire au début de la sortie suivante, avant un compactage
+ * du maillage (évènement eMeshEventType::BeginPrepareDump) ou lors de
+ * l'appel à close().
+ *
+ * La plupart des post-processeurs effectuent des communications collectives
+ * entre les sous-domaines. Ces communications ne peuvent pas être faites
+ * par un autre thread que le thread principal. Par défaut, lorsqu'il y a
+ * plusieurs sous-domaines, l'écriture est donc faite par le thread appelant.
+ * L'option 'async-in-parallel' permet d'utiliser le thread d'écriture dans
+ * ce cas si le post-processeur n'effectue pas de communications lors de
+ * l'écriture des valeurs.
+ *
+ * Les valeurs sont écrites telles quelles : ce service ne fait ni
+ * conversion en simple précision ni sous-échantillonnage. La seule
+ * réduction possible est la sélection des groupes via l'option 'group'.
+ */
+class AsyncPostProcessor
+: public ArcaneAsyncPostProcessorObject
+{
+  //! Ecrivain qui transmet les valeurs des variables au thread d'écriture
+  class StagingDataWriter
+  : public IDataWriter
+  {
+   public:
+
+    explicit StagingDataWriter(AsyncPostProcessor* pp)
+    : m_post_processor(pp)
+    {}
+
+   public:
+
+    void beginWrite(const VariableCollection& vars) override
+    {
+      m_post_processor->_beginWrite(vars);
+    }
+    void endWrite() override {}
+    void setMetaData(const String& meta_data) override
+    {
+      m_post_processor->_setMetaData(meta_data);
+    }
+    void write(IVariable* var, IData* data) override
+    {
+      m_post_processor->_addValue(var, data);
+    }
+
+   private:
+
+    AsyncPostProcessor* m_post_processor;
+  };
+
+ public:
+
+  explicit AsyncPostProcessor(const ServiceBuildInfo& sbi)
+  : ArcaneAsyncPostProcessorObject(sbi)
+  , m_data_writer(this)
+  {
+  }
+
+  ~AsyncPostProcessor() override
+  {
+    // Le destructeur de la file attend la fin des écritures en cours.
+    m_queue.reset();
+  }
+
+ public:
+
+  void build() override {}
+  IDataWriter* dataWriter() override { return &m_data_writer; }
+  void notifyBeginWrite() override;
+  void notifyEndWrite() override;
+  void close() override;
+
+ private:
+
+  StagingDataWriter m_data_writer;
+  std::unique_ptr<impl::AsyncWriteQueue> m_queue;
+  //! Ecrivain du post-processeur pour la sortie courante
+  IDataWriter* m_inner_data_writer = nullptr;
+  bool m_is_writing = false;
+  bool m_has_pending_end_write = false;
+  bool m_is_init = false;
+  EventObserverPool m_event_pool;
+
+ private:
+
+  void _init();
+  bool _isAsyncWriter(String* reason);
+  void _checkWriting();
+  void _beginWrite(const VariableCollection& vars);
+  void _setMetaData(const String& meta_data);
+  void _addValue(IVariable* var, IData* data);
+  void _endWrite();
+  void _finishPendingWrite();
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncPostProcessor::
+_init()
+{
+  if (m_is_init)
+    return;
+  m_is_init = true;
+
+  String reason;
+  if (_isAsyncWriter(&reason)) {
+    Int64 max_size = options()->maxStagingMemory();
+    if (max_size <= 0)
+      ARCANE_FATAL("Invalid value '{0}' for option 'max-staging-memory'", max_size);
+    Int64 max_staging_size = max_size * 1024 * 1024;
+    info() << "Use asynchronous post-processing max_staging_size=" << max_staging_size;
+    m_queue = std::make_unique<impl::AsyncWriteQueue>(max_staging_size);
+  }
+  else
+    info() << "Asynchronous post-processing is disabled: " << reason;
+
+  // Le compactage modifie les numéros locaux des entités. Il faut donc que
+  // les écritures en cours soient terminées.
+  auto f = [this](const MeshEventArgs&) { _finishPendingWrite(); };
+  mesh()->eventObservable(eMeshEventType::BeginPrepareDump).attach(m_event_pool, f);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Indique si les valeurs peuvent être écrites par le thread d'écriture.
+ *
+ * Si ce n'est pas le cas, \a reason contient la raison.
+ */
+bool AsyncPostProcessor::
+_isAsyncWriter(String* reason)
+{
+  bool is_parallel = mesh()->parallelMng()->isParallel();
+  if (is_parallel && !options()->asyncInParallel()) {
+    *reason = "there are several sub-domains. Use option 'async-in-parallel' to enable it";
+    return false;
+  }
+
+  // Post-processeurs dont IDataWriter::write() n'utilise pas le maillage.
+  // Ensight7PostProcessor utilise les listes d'entités calculées dans
+  // beginWrite() et les post-processeurs VTK HDF les offsets calculés
+  // dans beginWrite().
+  struct AsyncWriterInfo
+  {
+    const char* name;
+    bool use_hdf5;
+  };
+  const AsyncWriterInfo async_writers[] = {
+    { "Ensight7PostProcessor", false },
+    { "VtkHdfPostProcessor", true },
+    { "VtkHdfV2PostProcessor", true }
+  };
+  String service_name = options()->postProcessor.serviceName();
+  for (const AsyncWriterInfo& w : async_writers) {
+    if (service_name != w.name)
+      continue;
+    if (!w.use_hdf5)
+      return true;
+    // Le post-processeur appelle HDF5 depuis le thread d'écriture alors que
+    // le thread appelant peut aussi l'utiliser (par exemple pour les
+    // protections). Il faut donc que HDF5 supporte les threads.
+    bool is_thread_safe = false;
+#ifdef ARCANE_HAS_PACKAGE_HDF5
+    hbool_t hdf5_thread_safe = 0;
+    if (H5is_library_threadsafe(&hdf5_thread_safe) >= 0)
+      is_thread_safe = hdf5_thread_safe;
+#endif
+    if (is_thread_safe)
+      return true;
+    *reason = String::format("post-processor '{0}' uses HDF5 which is not thread-safe", service_name);
+    return false;
+  }
+  *reason = String::format("post-processor '{0}' may access the mesh during the write of the values", service_name);
+  return false;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncPostProcessor::
+_checkWriting()
+{
+  if (!m_is_writing)
+    ARCANE_FATAL("Write is not in progress (notifyBeginWrite() has not been called)");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncPostProcessor::
+notifyBeginWrite()
+{
+  _init();
+  // Le post-processeur ne peut effectuer qu'une sortie à la fois.
+  _finishPendingWrite();
+
+  IPostProcessorWriter* writer = options()->postProcessor();
+  writer->setBaseDirectoryName(baseDirectoryName());
+  writer->setTimes(times());
+  writer->setVariables(variables());
+
+  ItemGroupList selected_groups;
+  Integer nb_group = options()->group.size();
+  for (ItemGroupCollection::Enumerator igroup(groups()); ++igroup;) {
+    ItemGroup group = *igroup;
+    bool is_selected = (nb_group == 0);
+    for (Integer i = 0; i < nb_group && !is_selected; ++i)
+      is_selected = (group.name() == options()->group[i]);
+    if (is_selected)
+      selected_groups.add(group);
+  }
+  writer->setGroups(selected_groups);
+
+  writer->notifyBeginWrite();
+  m_inner_data_writer = writer->dataWriter();
+  m_is_writing = true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncPostProcessor::
+_beginWrite(const VariableCollection& vars)
+{
+  _checkWriting();
+  if (m_inner_data_writer)
+    m_inner_data_writer->beginWrite(vars);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncPostProcessor::
+_setMetaData(const String& meta_data)
+{
+  _checkWriting();
+  if (m_inner_data_writer)
+    m_inner_data_writer->setMetaData(meta_data);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncPostProcessor::
+_addValue(IVariable* var, IData* data)
+{
+  _checkWriting();
+  IDataWriter* data_writer = m_inner_data_writer;
+  if (!data_writer)
+    return;
+  if (!m_queue) {
+    data_writer->write(var, data);
+    return;
+  }
+  // L'écriture d'une variable partielle utilise la table d'index de son
+  // groupe qui peut être modifiée par le thread appelant. Elle est donc faite
+  // par ce dernier, après les écritures en attente sur le même écrivain.
+  if (var->isPartial()) {
+    m_queue->wait();
+    data_writer->write(var, data);
+    return;
+  }
+
+  Ref<IData> cloned_data = data->cloneRef();
+  Int64 size = 0;
+  INumericDataInternal* num_data = cloned_data->_commonInternal()->numericData();
+  if (num_data) {
+    MutableMemoryView mem_view = num_data->memoryView();
+    size = mem_view.nbElement() * mem_view.datatypeSize();
+  }
+  m_queue->add([data_writer, var, cloned_data]() { data_writer->write(var, cloned_data.get()); }, size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncPostProcessor::
+notifyEndWrite()
+{
+  _checkWriting();
+  m_is_writing = false;
+  if (m_queue)
+    m_has_pending_end_write = true;
+  else
+    _endWrite();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncPostProcessor::
+_endWrite()
+{
+  if (m_inner_data_writer)
+    m_inner_data_writer->endWrite();
+  options()->postProcessor()->notifyEndWrite();
+  m_inner_data_writer = nullptr;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Attend la fin de l'écriture des valeurs et termine la sortie.
+ */
+void AsyncPostProcessor::
+_finishPendingWrite()
+{
+  if (!m_has_pending_end_write)
+    return;
+  m_has_pending_end_write = false;
+  m_queue->wait();
+  _endWrite();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncPostProcessor::
+close()
+{
+  _finishPendingWrite();
+  options()->postProcessor()->close();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_SERVICE_ASYNCPOSTPROCESSOR(AsyncPostProcessor,
+                                           AsyncPostProcessor);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,128 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* AsyncWriteQueue.cc                                          (C) 2000-2024 */
+/*                                                                           */
+/* File d'opérations d'écriture exécutées par un thread en tâche de fond.    */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/std/internal/AsyncWriteQueue.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+AsyncWriteQueue::
+AsyncWriteQueue(Int64 max_staging_size)
+: m_max_staging_size(max_staging_size)
+{
+  m_thread = std::thread([this]() { _run(); });
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+AsyncWriteQueue::
+~AsyncWriteQueue()
+{
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_is_stopping = true;
+  }
+  m_condition.notify_all();
+  m_thread.join();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncWriteQueue::
+add(std::function<void()> func, Int64 size)
+{
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // On accepte toujours au moins une opération même si sa taille
+    // dépasse la taille maximale.
+    m_condition.wait(lock, [&]() {
+      return m_staged_size == 0 || (m_staged_size + size) <= m_max_staging_size;
+    });
+    m_items.push_back(Item{ std::move(func), size });
+    m_staged_size += size;
+    ++m_nb_pending;
+  }
+  m_condition.notify_all();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncWriteQueue::
+wait()
+{
+  std::exception_ptr ex;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [&]() { return m_nb_pending == 0; });
+    std::swap(ex, m_exception);
+  }
+  if (ex)
+    std::rethrow_exception(ex);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void AsyncWriteQueue::
+_run()
+{
+  for (;;) {
+    Item item;
+    bool has_error = false;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_condition.wait(lock, [&]() { return !m_items.empty() || m_is_stopping; });
+      if (m_items.empty())
+        return;
+      item = std::move(m_items.front());
+      m_items.pop_front();
+      has_error = static_cast<bool>(m_exception);
+    }
+    std::exception_ptr ex;
+    if (!has_error) {
+      try {
+        item.m_function();
+      }
+      catch (...) {
+        ex = std::current_exception();
+      }
+    }
+    // Libère les valeurs avant de signaler la fin de l'opération
+    item.m_function = {};
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (ex && !m_exception)
+        m_exception = ex;
+      m_staged_size -= item.m_size;
+      --m_nb_pending;
+    }
+    m_condition.notify_all();
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
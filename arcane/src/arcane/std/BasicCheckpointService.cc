@@ -17,6 +17,8 @@
 #include "arcane/utils/StringBuilder.h"
 #include "arcane/utils/OStringStream.h"
 #include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/ValueConvert.h"
+#include "arcane/utils/Exception.h"
 
 #include "arcane/core/IXmlDocumentHolder.h"
 #include "arcane/core/IParallelMng.h"
@@ -72,6 +74,10 @@ class ArcaneBasicCheckpointService
   , m_writer(nullptr)
   , m_reader(nullptr)
   {}
+  ~ArcaneBasicCheckpointService() override
+  {
+    arcaneCallFunctionAndCatchException([&]() { _waitPendingWriter(); });
+  }
   IDataWriter* dataWriter() override { return m_writer; }
   IDataReader* dataReader() override { return m_reader; }
 
@@ -87,9 +93,21 @@ class ArcaneBasicCheckpointService
   Integer m_write_index;
   BasicWriter* m_writer;
   BasicReader* m_reader;
+  //! Ecrivain dont l'écriture asynchrone est en cours
+  BasicWriter* m_pending_writer = nullptr;
 
  private:
 
+  void _waitPendingWriter()
+  {
+    if (!m_pending_writer)
+      return;
+    std::unique_ptr<BasicWriter> writer(m_pending_writer);
+    m_pending_writer = nullptr;
+    info() << "Waiting for the end of the asynchronous checkpoint write";
+    writer->waitAsyncWrite();
+  }
+
   String _defaultFileName()
   {
     info() << "USE DEFAULT FILE NAME index=" << currentIndex();
@@ -134,6 +152,9 @@ class ArcaneBasic2CheckpointService
 void ArcaneBasicCheckpointService::
 notifyBeginRead()
 {
+  // Il faut que la protection précédente soit entièrement écrite.
+  _waitPendingWriter();
+
   String meta_data_str = readerMetaData();
   MetaData md = MetaData::parse(meta_data_str, traceMng());
 
@@ -172,6 +193,9 @@ notifyEndRead()
 void ArcaneBasicCheckpointService::
 notifyBeginWrite()
 {
+  // Attend la fin de l'écriture asynchrone de la protection précédente.
+  _waitPendingWriter();
+
   auto open_mode = BasicReaderWriterCommon::OpenModeAppend;
   Integer write_index = checkpointTimes().size();
   --write_index;
@@ -188,6 +212,8 @@ notifyBeginWrite()
 
   Int32 version = 2;
   Ref<IDataCompressor> data_compressor;
+  bool is_async_write = false;
+  Int64 async_max_staging_memory = 1024;
   if (options()) {
     version = options()->formatVersion();
     // N'utilise la compression qu'à partir de la version 3 car cela est
@@ -195,7 +221,11 @@ notifyBeginWrite()
     if (version >= 3) {
       data_compressor = options()->dataCompressor.instanceRef();
     }
+    is_async_write = options()->asyncWrite();
+    async_max_staging_memory = options()->asyncMaxStagingMemory();
   }
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_CHECKPOINT_ASYNC_WRITE", true))
+    is_async_write = (v.value() != 0);
 
   info() << "Writing checkpoint with 'ArcaneBasicCheckpointService'"
          << " version=" << version
@@ -209,6 +239,8 @@ notifyBeginWrite()
   want_parallel = false;
   m_writer = new BasicWriter(app, pm, filename, open_mode, version, want_parallel);
   m_writer->setDataCompressor(data_compressor);
+  if (is_async_write)
+    m_writer->setAsyncWrite(true, async_max_staging_memory * 1024 * 1024);
   m_writer->initialize();
 }
 
@@ -225,7 +257,12 @@ notifyEndWrite()
   ostr() << "/>\n";
   setReaderMetaData(ostr.str());
   ++m_write_index;
-  delete m_writer;
+  // Si l'écriture est asynchrone, l'écrivain est conservé jusqu'à la
+  // prochaine protection ou la destruction du service.
+  if (m_writer->isAsyncWrite())
+    m_pending_writer = m_writer;
+  else
+    delete m_writer;
   m_writer = nullptr;
 }
 
@@ -26,6 +26,7 @@
 #include "arcane/utils/ITraceMng.h"
 
 #include "arcane/ArcaneException.h"
+#include "arcane/core/Concurrency.h"
 
 #include "arcane/std/internal/TextReader2.h"
 #include "arcane/std/internal/TextWriter2.h"
@@ -287,6 +288,8 @@ class BasicReaderWriterDatabaseCommon
 
   std::map<String, DataInfo> m_data_infos;
   Ref<IDataCompressor> m_data_compressor;
+  //! Taille (en octet) des blocs compressés indépendamment (0 si pas de découpage)
+  Int64 m_compression_chunk_size = 0;
   Ref<IHashAlgorithm> m_hash_algorithm;
   Ref<IHashDatabase> m_hash_database;
 };
@@ -340,6 +343,7 @@ class KeyValueTextWriter::Impl
  private:
 
   void _write2(const String& key, Span<const std::byte> values);
+  void _writeChunked(const String& key, Span<const std::byte> values);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -402,6 +406,8 @@ _writeEpilog()
       jsw.write("Extents", x.second.m_extents.view());
     }
     jsw.endArray();
+    if (m_compression_chunk_size > 0)
+      jsw.write("CompressionChunkSize", m_compression_chunk_size);
   }
 
   std::ostream& stream = m_writer.stream();
@@ -465,6 +471,10 @@ write(const String& key, Span<const std::byte> values)
   IDataCompressor* d = m_data_compressor.get();
   Int64 len = values.size();
   if (d && len > d->minCompressSize()) {
+    if (m_compression_chunk_size > 0 && m_version >= 3) {
+      _writeChunked(key, values);
+      return;
+    }
     UniqueArray<std::byte> compressed_values;
     m_data_compressor->compress(values, compressed_values);
     Int64 compressed_size = compressed_values.largeSize();
@@ -475,6 +485,66 @@ write(const String& key, Span<const std::byte> values)
     _write2(key, values);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Écriture compressée par blocs.
+ *
+ * Les valeurs sont découpées en blocs de taille m_compression_chunk_size
+ * qui sont compressés indépendamment les uns des autres et en parallèle.
+ * Le format est le suivant:
+ * - le nombre de blocs (Int64),
+ * - pour chaque bloc la taille compressée (Int64),
+ * - les blocs compressés les uns à la suite des autres.
+ *
+ * Ce format permet de décompresser en parallèle et de ne relire
+ * qu'une partie des valeurs (voir KeyValueTextReader::readPart()).
+ */
+void KeyValueTextWriter::Impl::
+_writeChunked(const String& key, Span<const std::byte> values)
+{
+  IDataCompressor* d = m_data_compressor.get();
+  const Int64 len = values.size();
+  const Int64 chunk_size = m_compression_chunk_size;
+  const Int32 nb_chunk = CheckedConvert::toInt32((len + chunk_size - 1) / chunk_size);
+
+  UniqueArray<UniqueArray<std::byte>> compressed_chunks(nb_chunk);
+  ParallelLoopOptions loop_options;
+  loop_options.setGrainSize(1);
+  arcaneParallelFor(0, nb_chunk, loop_options, [&](Integer begin, Integer size) {
+    for (Integer i = begin; i < (begin + size); ++i) {
+      Int64 offset = chunk_size * i;
+      Int64 current_size = math::min(chunk_size, len - offset);
+      d->compress(values.subSpan(offset, current_size), compressed_chunks[i]);
+    }
+  });
+
+  // Index des blocs
+  UniqueArray<Int64> chunk_index(1 + nb_chunk);
+  chunk_index[0] = nb_chunk;
+  Int64 total_compressed_size = 0;
+  for (Int32 i = 0; i < nb_chunk; ++i) {
+    Int64 s = compressed_chunks[i].largeSize();
+    chunk_index[1 + i] = s;
+    total_compressed_size += s;
+  }
+  m_writer.write(asBytes(chunk_index.span()));
+
+  // Avec une base de hash, il faut écrire les blocs en une seule fois
+  // pour n'avoir qu'une seule clé.
+  if (m_hash_database.get()) {
+    UniqueArray<std::byte> all_chunks;
+    all_chunks.reserve(total_compressed_size);
+    for (Int32 i = 0; i < nb_chunk; ++i)
+      all_chunks.addRange(compressed_chunks[i]);
+    _write2(key, all_chunks);
+  }
+  else {
+    for (Int32 i = 0; i < nb_chunk; ++i)
+      m_writer.write(compressed_chunks[i]);
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -532,6 +602,26 @@ dataCompressor() const
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void KeyValueTextWriter::
+setCompressionChunkSize(Int64 v)
+{
+  if (v < 0)
+    ARCANE_FATAL("Invalid negative compression chunk size '{0}'", v);
+  m_p->m_compression_chunk_size = v;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int64 KeyValueTextWriter::
+compressionChunkSize() const
+{
+  return m_p->m_compression_chunk_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void KeyValueTextWriter::
 setHashAlgorithm(Ref<IHashAlgorithm> v)
 {
@@ -629,6 +719,7 @@ class KeyValueTextReader::Impl
 
   void readIntegers(const String& key, Span<Integer> values);
   void read(const String& key, Span<std::byte> values);
+  void readPart(const String& key, Int64 full_size, Int64 offset, Span<std::byte> values);
 
  public:
 
@@ -637,6 +728,12 @@ class KeyValueTextReader::Impl
   void _readDirect(Int64 offset, Span<std::byte> bytes);
   void _setFileOffset(const String& key_name);
   void _read2(const String& key_name, Span<std::byte> values);
+  void _readChunked(const String& key, Int64 full_size, Int64 offset, Span<std::byte> values);
+  bool _isCompressed(Int64 full_size) const
+  {
+    IDataCompressor* d = m_data_compressor.get();
+    return (d && full_size > d->minCompressSize());
+  }
 
  public:
 
@@ -738,6 +835,10 @@ _readJSON()
     json_doc.parse(json_bytes);
     JSONValue root = json_doc.root();
     JSONValue data = root.child("Data");
+    // Ce champ n'existe que si la compression par blocs est utilisée
+    JSONValue chunk_size = root.child("CompressionChunkSize");
+    if (!chunk_size.null())
+      m_compression_chunk_size = chunk_size.valueAsInt64();
     UniqueArray<Int64> extents;
     extents.reserve(12);
     for (JSONValue v : data.valueAsArray()) {
@@ -809,9 +910,12 @@ read(const String& key, Span<std::byte> values)
 {
   _setFileOffset(key);
 
-  IDataCompressor* d = m_data_compressor.get();
   Int64 len = values.size();
-  if (d && len > d->minCompressSize()) {
+  if (_isCompressed(len)) {
+    if (m_compression_chunk_size > 0 && m_version >= 3) {
+      _readChunked(key, len, 0, values);
+      return;
+    }
     UniqueArray<std::byte> compressed_values;
     Int64 compressed_size = 0;
     m_reader.read(asWritableBytes(Span<Int64>(&compressed_size, 1)));
@@ -824,6 +928,118 @@ read(const String& key, Span<std::byte> values)
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Lit la partie [offset,offset+values.size()[ d'une valeur
+ * dont la taille totale non compressée est \a full_size.
+ *
+ * Pour les valeurs compressées par blocs, seuls les blocs contenant
+ * la partie demandée sont lus et décompressés.
+ */
+void KeyValueTextReader::Impl::
+readPart(const String& key, Int64 full_size, Int64 offset, Span<std::byte> values)
+{
+  if (m_version < 3)
+    ARCANE_FATAL("Partial read is only supported for version 3 or more (version={0})", m_version);
+  Int64 len = values.size();
+  if (offset < 0 || (offset + len) > full_size)
+    ARCANE_FATAL("Invalid range offset={0} size={1} full_size={2}", offset, len, full_size);
+
+  if (!_isCompressed(full_size)) {
+    if (!m_hash_database.get()) {
+      Impl::DataInfo& data = findData(key);
+      _readDirect(data.m_file_offset + offset, values);
+      return;
+    }
+  }
+  else if (m_compression_chunk_size > 0) {
+    _readChunked(key, full_size, offset, values);
+    return;
+  }
+  // Cas général: lit toute la valeur et recopie la partie demandée.
+  UniqueArray<std::byte> full_values(full_size);
+  read(key, full_values);
+  values.copy(full_values.span().subSpan(offset, len));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Lecture d'une valeur compressée par blocs.
+ *
+ * Voir KeyValueTextWriter::Impl::_writeChunked() pour le format.
+ * Seuls les blocs couvrant [offset,offset+values.size()[ sont décompressés
+ * et la décompression est faite en parallèle.
+ */
+void KeyValueTextReader::Impl::
+_readChunked(const String& key, Int64 full_size, Int64 offset, Span<std::byte> values)
+{
+  IDataCompressor* d = m_data_compressor.get();
+  const Int64 chunk_size = m_compression_chunk_size;
+  const Int64 len = values.size();
+  if (len == 0)
+    return;
+
+  Impl::DataInfo& data = findData(key);
+  Int64 nb_chunk = 0;
+  _readDirect(data.m_file_offset, asWritableBytes(Span<Int64>(&nb_chunk, 1)));
+  Int64 expected_nb_chunk = (full_size + chunk_size - 1) / chunk_size;
+  if (nb_chunk != expected_nb_chunk)
+    ARCANE_FATAL("Bad number of chunk for key '{0}' n={1} expected={2}", key, nb_chunk, expected_nb_chunk);
+
+  UniqueArray<Int64> chunk_sizes(nb_chunk);
+  m_reader.read(asWritableBytes(chunk_sizes.span()));
+  const Int64 data_offset = data.m_file_offset + (1 + nb_chunk) * static_cast<Int64>(sizeof(Int64));
+
+  // Position de chaque bloc dans les données compressées
+  UniqueArray<Int64> chunk_offsets(nb_chunk + 1);
+  chunk_offsets[0] = 0;
+  for (Int64 i = 0; i < nb_chunk; ++i)
+    chunk_offsets[i + 1] = chunk_offsets[i] + chunk_sizes[i];
+
+  const Int32 first_chunk = CheckedConvert::toInt32(offset / chunk_size);
+  const Int32 last_chunk = CheckedConvert::toInt32((offset + len - 1) / chunk_size);
+
+  // Lit les blocs compressés nécessaires. Avec une base de hash, il
+  // faut relire l'ensemble des blocs.
+  UniqueArray<std::byte> compressed_values;
+  Int64 compressed_base = 0;
+  if (m_hash_database.get()) {
+    m_reader.setFileOffset(data_offset);
+    compressed_values.resize(chunk_offsets[nb_chunk]);
+    _read2(key, compressed_values);
+  }
+  else {
+    compressed_base = chunk_offsets[first_chunk];
+    compressed_values.resize(chunk_offsets[last_chunk + 1] - compressed_base);
+    _readDirect(data_offset + compressed_base, compressed_values);
+  }
+
+  // Décompresse en parallèle. Les blocs entièrement inclus dans la partie
+  // demandée sont décompressés directement dans \a values.
+  ParallelLoopOptions loop_options;
+  loop_options.setGrainSize(1);
+  Span<const std::byte> compressed_span(compressed_values);
+  arcaneParallelFor(first_chunk, last_chunk + 1 - first_chunk, loop_options, [&](Integer begin, Integer size) {
+    UniqueArray<std::byte> tmp_values;
+    for (Integer i = begin; i < (begin + size); ++i) {
+      Int64 chunk_begin = chunk_size * i;
+      Int64 current_size = math::min(chunk_size, full_size - chunk_begin);
+      auto compressed_chunk = compressed_span.subSpan(chunk_offsets[i] - compressed_base, chunk_sizes[i]);
+      Int64 copy_begin = math::max(chunk_begin, offset);
+      Int64 copy_end = math::min(chunk_begin + current_size, offset + len);
+      if (copy_begin == chunk_begin && copy_end == (chunk_begin + current_size))
+        d->decompress(compressed_chunk, values.subSpan(chunk_begin - offset, current_size));
+      else {
+        tmp_values.resize(current_size);
+        d->decompress(compressed_chunk, tmp_values);
+        values.subSpan(copy_begin - offset, copy_end - copy_begin).copy(tmp_values.span().subSpan(copy_begin - chunk_begin, copy_end - copy_begin));
+      }
+    }
+  });
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -939,6 +1155,24 @@ read(const String& key, Span<std::byte> values)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void KeyValueTextReader::
+readPart(const String& key, Int64 full_size, Int64 offset, Span<std::byte> values)
+{
+  m_p->readPart(key, full_size, offset, values);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int64 KeyValueTextReader::
+compressionChunkSize() const
+{
+  return m_p->m_compression_chunk_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // End namespace Arcane::impl
 
 /*---------------------------------------------------------------------------*/
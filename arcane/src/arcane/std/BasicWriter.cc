@@ -21,15 +21,19 @@
 #include "arcane/utils/MemoryView.h"
 #include "arcane/utils/Ref.h"
 #include "arcane/utils/IHashAlgorithm.h"
+#include "arcane/utils/Exception.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include "arcane/core/IParallelMng.h"
 #include "arcane/core/ItemGroup.h"
 #include "arcane/core/IVariable.h"
 #include "arcane/core/IItemFamily.h"
 #include "arcane/core/IData.h"
+#include "arcane/core/ISerializedData.h"
 #include "arcane/core/internal/IVariableInternal.h"
 
 #include "arcane/std/internal/ParallelDataWriter.h"
+#include "arcane/std/internal/AsyncWriteQueue.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -52,6 +56,26 @@ BasicWriter(IApplication* app, IParallelMng* pm, const String& path,
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+BasicWriter::
+~BasicWriter()
+{
+  arcaneCallFunctionAndCatchException([&]() { waitAsyncWrite(); });
+  m_async_queue.reset();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void BasicWriter::
+waitAsyncWrite()
+{
+  if (m_async_queue)
+    m_async_queue->wait();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void BasicWriter::
 initialize()
 {
@@ -79,6 +103,16 @@ initialize()
     }
   }
 
+  // Compression par blocs indépendants (en Ko). Cela permet de compresser
+  // et décompresser en parallèle les grosses variables.
+  if (m_data_compressor.get() && m_version >= 3) {
+    if (auto v = Convert::Type<Int64>::tryParseFromEnvironment("ARCANE_DEFLATER_CHUNK_SIZE", true)) {
+      Int64 chunk_size = v.value() * 1024;
+      info() << "Use chunked compression from environment variable ARCANE_DEFLATER_CHUNK_SIZE chunk_size=" << chunk_size;
+      m_text_writer->setCompressionChunkSize(chunk_size);
+    }
+  }
+
   // Idem pour le service de calcul de hash
   if (!m_hash_algorithm.get()) {
     String hash_algorithm_name = platform::getEnvironmentVariable("ARCANE_HASHALGORITHM");
@@ -104,6 +138,10 @@ initialize()
   }
 
   m_global_writer = new BasicGenericWriter(m_application, m_version, m_text_writer);
+  if (m_is_async_write) {
+    info() << "Use asynchronous write max_staging_size=" << m_async_max_staging_size;
+    m_async_queue = std::make_unique<AsyncWriteQueue>(m_async_max_staging_size);
+  }
   if (m_verbose_level > 0)
     info() << "** OPEN MODE = " << m_open_mode;
 }
@@ -163,17 +201,47 @@ _directWriteVal(IVariable* var, IData* data)
       const String& gname = group.name();
       String group_full_name = item_family->fullName() + "_" + gname;
       _fillUniqueIds(group, wanted_unique_ids);
-      if (m_is_save_values)
-        m_global_writer->writeItemGroup(group_full_name, written_unique_ids, wanted_unique_ids.view());
+      if (m_is_save_values) {
+        if (m_async_queue) {
+          Int64UniqueArray written_ids(written_unique_ids);
+          Int64 size = (written_ids.size() + wanted_unique_ids.size()) * sizeof(Int64);
+          auto func = [this, group_full_name, written_ids, wanted_ids = std::move(wanted_unique_ids)]() {
+            m_global_writer->writeItemGroup(group_full_name, written_ids.view(), wanted_ids.view());
+          };
+          m_async_queue->add(std::move(func), size);
+        }
+        else
+          m_global_writer->writeItemGroup(group_full_name, written_unique_ids, wanted_unique_ids.view());
+      }
       m_written_groups.insert(group);
     }
   }
 
-  Ref<ISerializedData> sdata(write_data->createSerializedDataRef(false));
   String compare_hash;
   if (is_mesh_variable) {
     compare_hash = _computeCompareHash(var, write_data);
   }
+
+  if (m_async_queue) {
+    // Copie les valeurs pour pouvoir continuer à modifier la variable
+    // pendant l'écriture. Si on a déjà une copie triée, on l'utilise directement.
+    Ref<IData> staged_data = allocated_write_data;
+    if (!staged_data.get())
+      staged_data = write_data->cloneRef();
+    Ref<ISerializedData> sdata(staged_data->createSerializedDataRef(false));
+    Int64 size = sdata->memorySize();
+    String var_full_name = var->fullName();
+    bool is_save_values = m_is_save_values;
+    // Il faut conserver une référence sur 'staged_data' car 'sdata' peut
+    // utiliser directement sa mémoire.
+    auto func = [this, staged_data, sdata, var_full_name, compare_hash, is_save_values]() {
+      m_global_writer->writeData(var_full_name, sdata.get(), compare_hash, is_save_values);
+    };
+    m_async_queue->add(std::move(func), size);
+    return;
+  }
+
+  Ref<ISerializedData> sdata(write_data->createSerializedDataRef(false));
   m_global_writer->writeData(var->fullName(), sdata.get(), compare_hash, m_is_save_values);
 }
 
@@ -225,8 +293,15 @@ setMetaData(const String& meta_data)
     Span<const Byte> bytes = meta_data.utf8();
     Int64 length = bytes.length();
     String key_name = "Global:CheckpointMetadata";
-    m_text_writer->setExtents(key_name, Int64ConstArrayView(1, &length));
-    m_text_writer->write(key_name, asBytes(bytes));
+    auto func = [this, key_name, meta_data, length]() {
+      m_text_writer->setExtents(key_name, Int64ConstArrayView(1, &length));
+      Span<const Byte> meta_data_bytes = meta_data.utf8();
+      m_text_writer->write(key_name, asBytes(meta_data_bytes));
+    };
+    if (m_async_queue)
+      m_async_queue->add(std::move(func), length);
+    else
+      func();
   }
   else {
     Int32 my_rank = m_parallel_mng->commRank();
@@ -321,7 +396,10 @@ endWrite()
       ofile << nb_part << '\n';
     }
   }
-  m_global_writer->endWrite();
+  if (m_async_queue)
+    m_async_queue->add([this]() { m_global_writer->endWrite(); }, 0);
+  else
+    m_global_writer->endWrite();
 }
 
 /*---------------------------------------------------------------------------*/
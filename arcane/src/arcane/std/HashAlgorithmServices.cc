@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* HashAlgorithmServices.h                                     (C) 2000-2023 */
+/* HashAlgorithmServices.h                                     (C) 2000-2024 */
 /*                                                                           */
 /* Services de calcul de Hashs.                                              */
 /*---------------------------------------------------------------------------*/
@@ -17,6 +17,7 @@
 #include "arcane/utils/SHA3HashAlgorithm.h"
 #include "arcane/utils/SHA1HashAlgorithm.h"
 #include "arcane/utils/MD5HashAlgorithm.h"
+#include "arcane/utils/XXH3HashAlgorithm.h"
 
 #include "arcane/core/AbstractService.h"
 #include "arcane/core/ServiceBuildInfo.h"
@@ -62,6 +63,8 @@ using SHA3_384HashAlgorithmService = GenericHashAlgorithmService<SHA3_384HashAlg
 using SHA3_512HashAlgorithmService = GenericHashAlgorithmService<SHA3_512HashAlgorithm>;
 using MD5HashAlgorithmService = GenericHashAlgorithmService<MD5HashAlgorithm>;
 using SHA1HashAlgorithmService = GenericHashAlgorithmService<SHA1HashAlgorithm>;
+using XXH3_64HashAlgorithmService = GenericHashAlgorithmService<XXH3_64HashAlgorithm>;
+using XXH3_64TreeHashAlgorithmService = GenericHashAlgorithmService<XXH3_64TreeHashAlgorithm>;
 
 ARCANE_REGISTER_SERVICE(SHA3_256HashAlgorithmService,
                         ServiceProperty("SHA3_256HashAlgorithm", ST_Application | ST_CaseOption),
@@ -87,6 +90,14 @@ ARCANE_REGISTER_SERVICE(SHA1HashAlgorithmService,
                         ServiceProperty("SHA1HashAlgorithm", ST_Application | ST_CaseOption),
                         ARCANE_SERVICE_INTERFACE(IHashAlgorithm));
 
+ARCANE_REGISTER_SERVICE(XXH3_64HashAlgorithmService,
+                        ServiceProperty("XXH3_64HashAlgorithm", ST_Application | ST_CaseOption),
+                        ARCANE_SERVICE_INTERFACE(IHashAlgorithm));
+
+ARCANE_REGISTER_SERVICE(XXH3_64TreeHashAlgorithmService,
+                        ServiceProperty("XXH3_64TreeHashAlgorithm", ST_Application | ST_CaseOption),
+                        ARCANE_SERVICE_INTERFACE(IHashAlgorithm));
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VtkHdfV2PostProcessor.cc                                    (C) 2000-2023 */
+/* VtkHdfV2PostProcessor.cc                                    (C) 2000-2024 */
 /*                                                                           */
 /* Pos-traitement au format VTK HDF.                                         */
 /*---------------------------------------------------------------------------*/
@@ -480,6 +480,13 @@ namespace
     static hid_t hdfType() { return H5T_NATIVE_DOUBLE; }
   };
 
+  template <> class HDFTraits<float>
+  {
+   public:
+
+    static hid_t hdfType() { return H5T_NATIVE_FLOAT; }
+  };
+
   template <> class HDFTraits<unsigned char>
   {
    public:
@@ -899,6 +906,9 @@ write(IVariable* var, IData* data)
   case DT_Real:
     _writeBasicTypeDataset<Real>(data_info, data);
     break;
+  case DT_Float32:
+    _writeBasicTypeDataset<Float32>(data_info, data);
+    break;
   case DT_Int64:
     _writeBasicTypeDataset<Int64>(data_info, data);
     break;
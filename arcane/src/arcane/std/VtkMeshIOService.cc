@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VtkMeshIOService.cc                                         (C) 2000-2023 */
+/* VtkMeshIOService.cc                                         (C) 2000-2024 */
 /*                                                                           */
 /* Lecture/Ecriture d'un maillage au format Vtk historique (legacy).         */
 /*---------------------------------------------------------------------------*/
@@ -18,6 +18,10 @@
 #include "arcane/utils/ITraceMng.h"
 #include "arcane/utils/Iostream.h"
 #include "arcane/utils/OStringStream.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/ConcurrencyUtils.h"
+#include "arcane/utils/ParallelLoopOptions.h"
+#include "arcane/utils/Math.h"
 #include "arcane/utils/ScopedPtr.h"
 #include "arcane/utils/StdHeader.h"
 #include "arcane/utils/String.h"
@@ -46,6 +50,19 @@
 #include "arcane/std/internal/VtkCellTypes.h"
 #include "arcane/core/UnstructuredMeshAllocateBuildInfo.h"
 
+#include <atomic>
+#include <cstring>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+
+#if defined(ARCANE_OS_LINUX)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -158,6 +175,7 @@ class VtkMeshIOService
   void _readFacesMesh(IMesh* mesh, const String& file_name,
                       const String& dir_name, bool use_internal_partition);
   bool _readMetadata(IMesh* mesh, VtkFile& vtk_file);
+  eMeshType _readHeader(VtkFile& vtk_file, String& mesh_type_str);
 
  private:
 
@@ -170,22 +188,130 @@ class VtkMeshIOService
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Contenu d'un fichier VTK.
+ *
+ * Sous Linux, le fichier est projeté en mémoire (mmap) ce qui évite de
+ * recopier son contenu. Sinon, ou si la projection échoue, le fichier est
+ * lu entièrement en mémoire.
+ */
+class VtkFileContent
+{
+ public:
+
+  VtkFileContent() = default;
+  ~VtkFileContent();
+  VtkFileContent(const VtkFileContent&) = delete;
+  VtkFileContent& operator=(const VtkFileContent&) = delete;
+
+ public:
+
+  //! Ouvre le fichier \a file_name. Retourne \a false en cas d'erreur.
+  bool open(const String& file_name);
+  Span<const Byte> bytes() const { return m_bytes; }
+
+ private:
+
+  Span<const Byte> m_bytes;
+  UniqueArray<Byte> m_buffer;
+  void* m_mapped_address = nullptr;
+  size_t m_mapped_size = 0;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+VtkFileContent::
+~VtkFileContent()
+{
+#if defined(ARCANE_OS_LINUX)
+  if (m_mapped_address)
+    ::munmap(m_mapped_address, m_mapped_size);
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool VtkFileContent::
+open(const String& file_name)
+{
+#if defined(ARCANE_OS_LINUX)
+  int fd = ::open(file_name.localstr(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0) {
+    ::close(fd);
+    return false;
+  }
+  size_t size = static_cast<size_t>(file_stat.st_size);
+  if (size == 0) {
+    ::close(fd);
+    m_bytes = {};
+    return true;
+  }
+  void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (address != MAP_FAILED) {
+    ::madvise(address, size, MADV_SEQUENTIAL);
+    m_mapped_address = address;
+    m_mapped_size = size;
+    m_bytes = Span<const Byte>(static_cast<const Byte*>(address), static_cast<Int64>(size));
+    return true;
+  }
+#endif
+  if (platform::readAllFile(file_name, true, m_buffer))
+    return false;
+  m_bytes = m_buffer;
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Lecture séquentielle du contenu d'un fichier VTK.
+ *
+ * Les lignes d'en-tête sont lues une par une via getNextLine(). Les blocs
+ * de valeurs numériques doivent être lus via getInts() ou getReals().
+ *
+ * En ASCII, un bloc est d'abord découpé en paquets de valeurs consécutives
+ * puis chaque paquet est converti en concurrence via TaskFactory. En
+ * binaire, les valeurs (au format big endian) sont converties directement
+ * depuis le contenu du fichier sans copie intermédiaire.
+ */
 class VtkFile
 {
  public:
 
   static const int BUFSIZE = 10000;
 
+  //! Nombre par défaut de valeurs d'un paquet pour la conversion ASCII en concurrence
+  static const Int64 ASCII_CHUNK_SIZE = 1 << 16;
+
+  //! Type des valeurs d'un bloc
+  enum class eDataType
+  {
+    Int,
+    Float,
+    Double
+  };
+
  public:
 
-  explicit VtkFile(std::istream* stream)
-  : m_stream(stream)
+  explicit VtkFile(Span<const Byte> bytes)
+  : m_bytes(bytes)
   , m_is_init(false)
   , m_need_reread_current_line(false)
-  , m_is_eof(false)
+  , m_is_eof(bytes.empty())
   , m_is_binary_file(false)
   , m_buf{}
-  {}
+  {
+    // Permet de réduire la taille des intervalles pour tester la conversion
+    // en concurrence sur des petits fichiers.
+    if (auto v = Convert::Type<Int64>::tryParseFromEnvironment("ARCANE_VTK_ASCII_CHUNK_SIZE", true))
+      m_ascii_chunk_size = math::max(v.value(), static_cast<Int64>(1));
+  }
 
   const char* getCurrentLine();
   bool isEmptyNextLine();
@@ -197,6 +323,7 @@ class VtkFile
                    const String& expected_value2);
 
   static bool isEqualString(const String& current_value, const String& expected_value);
+  static eDataType dataType(const String& type_name);
 
   void reReadSameLine() { m_need_reread_current_line = true; }
 
@@ -208,12 +335,20 @@ class VtkFile
   double getDouble();
   int getInt();
 
+  //! Lit un bloc de \a values.size() valeurs de type 'int'
+  void getInts(Span<Int32> values);
+  //! Lit un bloc de \a values.size() valeurs de type \a data_type
+  void getReals(Span<Real> values, eDataType data_type);
+
   void setIsBinaryFile(bool new_val) { m_is_binary_file = new_val; }
 
  private:
 
-  //! Le stream.
-  std::istream* m_stream = nullptr;
+  //! Le contenu du fichier.
+  Span<const Byte> m_bytes;
+
+  //! Position courante dans le fichier.
+  Int64 m_position = 0;
 
   //! Y'a-t-il eu au moins une ligne lue.
   bool m_is_init;
@@ -227,13 +362,211 @@ class VtkFile
   //! Est-ce un fichier contenant des données en binaire.
   bool m_is_binary_file;
 
+  //! Taille (en octets) des intervalles pour la conversion ASCII en concurrence
+  Int64 m_ascii_chunk_size = ASCII_CHUNK_SIZE;
+
   //! Le buffer contenant la ligne lue.
   char m_buf[BUFSIZE];
+
+ private:
+
+  bool _readLine();
+  Span<const char> _nextToken(const char* func_name);
+  template <typename FileDataType, typename DataType>
+  void _readBinaryValues(Span<DataType> values);
+  template <typename DataType, typename ConverterType>
+  void _readAsciiValues(Span<DataType> values, const ConverterType& converter);
 };
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+namespace
+{
+  //! Indique si \a c est un séparateur (même définition que isspace() en locale "C")
+  inline bool _isSpace(char c)
+  {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+  }
+
+  //! Convertit les caractères de [begin,end) en entier.
+  bool _parseInt(const char* begin, const char* end, Int64& value)
+  {
+    bool is_negative = false;
+    if (begin != end && (*begin == '-' || *begin == '+')) {
+      is_negative = (*begin == '-');
+      ++begin;
+    }
+    // Au delà de 18 chiffres, il peut y avoir un débordement.
+    if (begin == end || (end - begin) > 18)
+      return false;
+    Int64 v = 0;
+    for (; begin != end; ++begin) {
+      unsigned int digit = static_cast<unsigned char>(*begin) - '0';
+      if (digit > 9)
+        return false;
+      v = v * 10 + digit;
+    }
+    value = (is_negative) ? -v : v;
+    return true;
+  }
+
+  /*!
+   * \brief Convertit les caractères de [begin,end) en réel.
+   *
+   * Les nombres ayant au plus 15 chiffres significatifs et un exposant
+   * décimal compris entre -22 et 22 sont convertis directement avec un
+   * arrondi correct (méthode de Clinger). Les autres sont convertis via
+   * std::strtod().
+   */
+  bool _parseReal(const char* begin, const char* end, double& value)
+  {
+    static const double powers_of_ten[] = {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const char* p = begin;
+    bool is_negative = false;
+    if (p != end && (*p == '-' || *p == '+')) {
+      is_negative = (*p == '-');
+      ++p;
+    }
+    UInt64 mantissa = 0;
+    Int32 nb_digit = 0;
+    Int64 exponent = 0;
+    bool has_digit = false;
+    bool use_fast_path = true;
+    for (; p != end; ++p) {
+      unsigned int digit = static_cast<unsigned char>(*p) - '0';
+      if (digit > 9)
+        break;
+      has_digit = true;
+      if (mantissa == 0 && digit == 0)
+        continue;
+      if (nb_digit < 19) {
+        mantissa = mantissa * 10 + digit;
+        ++nb_digit;
+      }
+      else
+        use_fast_path = false;
+    }
+    if (p != end && *p == '.') {
+      ++p;
+      for (; p != end; ++p) {
+        unsigned int digit = static_cast<unsigned char>(*p) - '0';
+        if (digit > 9)
+          break;
+        has_digit = true;
+        if (mantissa == 0 && digit == 0) {
+          --exponent;
+          continue;
+        }
+        if (nb_digit < 19) {
+          mantissa = mantissa * 10 + digit;
+          ++nb_digit;
+          --exponent;
+        }
+        else
+          use_fast_path = false;
+      }
+    }
+    if (has_digit && p != end && (*p == 'e' || *p == 'E')) {
+      ++p;
+      bool is_negative_exponent = false;
+      if (p != end && (*p == '-' || *p == '+')) {
+        is_negative_exponent = (*p == '-');
+        ++p;
+      }
+      if (p == end)
+        has_digit = false;
+      Int64 e = 0;
+      for (; p != end; ++p) {
+        unsigned int digit = static_cast<unsigned char>(*p) - '0';
+        if (digit > 9)
+          break;
+        if (e < 100000)
+          e = e * 10 + digit;
+      }
+      exponent += (is_negative_exponent) ? -e : e;
+    }
+    if (has_digit && p == end && use_fast_path && nb_digit <= 15) {
+      double v = static_cast<double>(mantissa);
+      if (mantissa == 0 || exponent == 0) {
+        value = (is_negative) ? -v : v;
+        return true;
+      }
+      if (exponent > 0 && exponent <= 22) {
+        v *= powers_of_ten[exponent];
+        value = (is_negative) ? -v : v;
+        return true;
+      }
+      if (exponent < 0 && exponent >= -22) {
+        v /= powers_of_ten[-exponent];
+        value = (is_negative) ? -v : v;
+        return true;
+      }
+    }
+    // Cas général (y compris 'nan' ou 'inf').
+    char buf[128];
+    Int64 len = end - begin;
+    if (len <= 0 || len >= 128)
+      return false;
+    std::memcpy(buf, begin, len);
+    buf[len] = '\0';
+    char* conv_end = nullptr;
+    value = std::strtod(buf, &conv_end);
+    return conv_end == (buf + len);
+  }
+
+  //! Retourne la valeur de type \a T stockée au format big endian à l'adresse \a ptr
+  template <typename T> inline T
+  _readBigEndian(const Byte* ptr)
+  {
+    constexpr size_t sizeofT = sizeof(T);
+    Byte little_endian[sizeofT];
+    for (size_t i = 0; i < sizeofT; i++)
+      little_endian[sizeofT - 1 - i] = ptr[i];
+    T value;
+    std::memcpy(&value, little_endian, sizeofT);
+    return value;
+  }
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*!
+ * \brief Lit la prochaine ligne du fichier et la conserve dans le buffer.
+ *
+ * Comme std::istream::getline(), seules les lignes terminées par
+ * un retour à la ligne sont prises en compte.
+ *
+ * \return false si on est arrivé à la fin du fichier.
+ */
+bool VtkFile::
+_readLine()
+{
+  const Int64 size = m_bytes.size();
+  if (m_position >= size)
+    return false;
+  const Byte* begin = m_bytes.data() + m_position;
+  const void* end_of_line = std::memchr(begin, '\n', size - m_position);
+  if (!end_of_line) {
+    m_position = size;
+    return false;
+  }
+  Int64 len = static_cast<const Byte*>(end_of_line) - begin;
+  if (len >= (BUFSIZE - 1))
+    throw IOException("VtkFile::getNextLine()", "Line is too long");
+  std::memcpy(m_buf, begin, len);
+  m_buf[len] = '\0';
+  m_position += len + 1;
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 /*!
  * \brief Permet de retourner la ligne présente dans le buffer.
  *
@@ -275,63 +608,56 @@ isEmptyNextLine()
     throw IOException("VtkFile::isEmptyNextLine()", "Unexpected EndOfFile");
   }
 
-  if (m_stream->good()) {
-    // Le getline s'arrete (par défaut) au char '\n' et ne l'inclus pas dans le buf
-    // mais le remplace par '\0'.
-    m_stream->getline(m_buf, sizeof(m_buf) - 1);
+  // La ligne lue ne contient pas le '\n' final.
+  // Si on arrive au bout du fichier, on return true (pour dire oui, il y a une ligne vide,
+  // à l'appelant de gérer ça).
+  if (!_readLine()) {
+    m_is_eof = true;
+    return true;
+  }
 
-    // Si on arrive au bout du fichier, on return true (pour dire oui, il y a une ligne vide,
-    // à l'appelant de gérer ça).
-    if (m_stream->eof()) {
-      m_is_eof = true;
-      return true;
-    }
+  // Sous Windows, une ligne vide commence par \r.
+  if (m_buf[0] == '\r' || m_buf[0] == '\0') {
+    getNextLine();
 
-    // Sous Windows, une ligne vide commence par \r.
-    // getline remplace \n par \0, que ce soit sous Windows ou Linux.
-    if (m_buf[0] == '\r' || m_buf[0] == '\0') {
-      getNextLine();
+    // On demande à ce que le prochain appel à getNextLine renvoie la ligne
+    // qui vient tout juste d'être bufferisée.
+    m_need_reread_current_line = true;
+    return true;
+  }
+  else {
+    bool is_comment = true;
 
-      // On demande à ce que le prochain appel à getNextLine renvoie la ligne
-      // qui vient tout juste d'être bufferisée.
-      m_need_reread_current_line = true;
-      return true;
+    // On retire le commentaire, s'il y en a un, en remplaçant '#' par '\0'.
+    for (int i = 0; i < BUFSIZE && m_buf[i] != '\0'; ++i) {
+      if (!isspace(m_buf[i]) && m_buf[i] != '#' && is_comment) {
+        is_comment = false;
+      }
+      if (m_buf[i] == '#') {
+        m_buf[i] = '\0';
+        break;
+      }
     }
-    else {
-      bool is_comment = true;
 
-      // On retire le commentaire, s'il y en a un, en remplaçant '#' par '\0'.
+    // Si ce n'est pas un commentaire, on supprime juste le '\r' final (si windows).
+    if (!is_comment) {
+      // Supprime le '\r' final
       for (int i = 0; i < BUFSIZE && m_buf[i] != '\0'; ++i) {
-        if (!isspace(m_buf[i]) && m_buf[i] != '#' && is_comment) {
-          is_comment = false;
-        }
-        if (m_buf[i] == '#') {
+        if (m_buf[i] == '\r') {
           m_buf[i] = '\0';
           break;
         }
       }
+    }
 
-      // Si ce n'est pas un commentaire, on supprime juste le '\r' final (si windows).
-      if (!is_comment) {
-        // Supprime le '\r' final
-        for (int i = 0; i < BUFSIZE && m_buf[i] != '\0'; ++i) {
-          if (m_buf[i] == '\r') {
-            m_buf[i] = '\0';
-            break;
-          }
-        }
-      }
-
-      // Si c'était un commentaire, on recherche la prochaine ligne "valide"
-      // en appelant getNextLine.
-      else {
-        getNextLine();
-      }
+    // Si c'était un commentaire, on recherche la prochaine ligne "valide"
+    // en appelant getNextLine.
+    else {
+      getNextLine();
     }
-    m_need_reread_current_line = true;
-    return false;
   }
-  throw IOException("VtkFile::isEmptyNextLine()", "Not Good");
+  m_need_reread_current_line = true;
+  return false;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -359,13 +685,11 @@ getNextLine()
     throw IOException("VtkFile::isEmptyNextLine()", "Unexpected EndOfFile");
   }
 
-  while (m_stream->good()) {
-    // Le getline s'arrete (par défaut) au char '\n' et ne l'inclus pas dans le buf mais le remplace par '\0'.
-    m_stream->getline(m_buf, sizeof(m_buf) - 1);
-
+  for (;;) {
+    // La ligne lue ne contient pas le '\n' final.
     // Si on arrive au bout du fichier, on return le buffer avec \0 au début (c'est à l'appelant d'appeler
     // isEof() pour savoir si le fichier est fini ou non).
-    if (m_stream->eof()) {
+    if (!_readLine()) {
       m_is_eof = true;
       m_buf[0] = '\0';
       return m_buf;
@@ -374,7 +698,6 @@ getNextLine()
     bool is_comment = true;
 
     // Sous Windows, une ligne vide commence par \r.
-    // getline remplace \n par \0, que ce soit sous Windows ou Linux.
     if (m_buf[0] == '\0' || m_buf[0] == '\r')
       continue;
 
@@ -401,7 +724,29 @@ getNextLine()
       return m_buf;
     }
   }
-  throw IOException("VtkFile::getNextLine()", "Not good");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*!
+ * \brief Retourne le prochain mot (suite de caractères sans séparateur).
+ */
+Span<const char> VtkFile::
+_nextToken(const char* func_name)
+{
+  const char* data = reinterpret_cast<const char*>(m_bytes.data());
+  const Int64 size = m_bytes.size();
+  Int64 pos = m_position;
+  while (pos < size && _isSpace(data[pos]))
+    ++pos;
+  Int64 begin = pos;
+  while (pos < size && !_isSpace(data[pos]))
+    ++pos;
+  if (pos == begin)
+    throw IOException(func_name, "Unexpected EndOfFile");
+  m_position = pos;
+  return { data + begin, pos - begin };
 }
 
 /*---------------------------------------------------------------------------*/
@@ -420,10 +765,10 @@ getFloat()
     getBinary(v);
     return v;
   }
-  (*m_stream) >> ws >> v;
-
-  if (m_stream->good())
-    return v;
+  Span<const char> token = _nextToken("VtkFile::getFloat()");
+  double dv = 0.0;
+  if (_parseReal(token.data(), token.data() + token.size(), dv))
+    return static_cast<float>(dv);
 
   throw IOException("VtkFile::getFloat()", "Bad float");
 }
@@ -444,9 +789,8 @@ getDouble()
     getBinary(v);
     return v;
   }
-  (*m_stream) >> ws >> v;
-
-  if (m_stream->good())
+  Span<const char> token = _nextToken("VtkFile::getDouble()");
+  if (_parseReal(token.data(), token.data() + token.size(), v))
     return v;
 
   throw IOException("VtkFile::getDouble()", "Bad double");
@@ -468,10 +812,10 @@ getInt()
     getBinary(v);
     return v;
   }
-  (*m_stream) >> ws >> v;
-
-  if (m_stream->good())
-    return v;
+  Span<const char> token = _nextToken("VtkFile::getInt()");
+  Int64 iv = 0;
+  if (_parseInt(token.data(), token.data() + token.size(), iv))
+    return static_cast<int>(iv);
 
   throw IOException("VtkFile::getInt()", "Bad int");
 }
@@ -488,23 +832,260 @@ template <class T>
 void VtkFile::
 getBinary(T& value)
 {
-  constexpr size_t sizeofT = sizeof(T);
+  constexpr Int64 sizeofT = sizeof(T);
+  if ((m_position + sizeofT) > m_bytes.size())
+    throw IOException("VtkFile::getBinary()", "Unexpected EndOfFile");
 
   // Le fichier VTK est en big endian et les CPU actuels sont en little endian.
-  Byte big_endian[sizeofT];
-  Byte little_endian[sizeofT];
+  value = _readBigEndian<T>(m_bytes.data() + m_position);
+  m_position += sizeofT;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*!
+ * \brief Lit un bloc de valeurs binaires de type \a FileDataType.
+ *
+ * Les valeurs sont lues directement depuis le contenu du fichier.
+ */
+template <typename FileDataType, typename DataType>
+void VtkFile::
+_readBinaryValues(Span<DataType> values)
+{
+  constexpr Int64 sizeofT = sizeof(FileDataType);
+  const Int64 n = values.size();
+  if ((m_position + n * sizeofT) > m_bytes.size())
+    throw IOException("VtkFile::_readBinaryValues()", "Unexpected EndOfFile");
+  const Byte* ptr = m_bytes.data() + m_position;
+  for (Int64 i = 0; i < n; ++i)
+    values[i] = static_cast<DataType>(_readBigEndian<FileDataType>(ptr + i * sizeofT));
+  m_position += n * sizeofT;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*!
+ * \brief Lit un bloc de valeurs ASCII.
+ *
+ * Le contenu du fichier à partir de la position courante est découpé en
+ * intervalles d'environ m_ascii_chunk_size octets. La fin de chaque
+ * intervalle est décalée jusqu'au séparateur suivant pour qu'aucune valeur
+ * ne soit coupée. Le nombre de valeurs de chaque intervalle est compté en
+ * concurrence et une somme préfixe donne l'indice de la première valeur de
+ * chaque intervalle. Les intervalles sont ensuite convertis en concurrence
+ * via \a converter.
+ *
+ * La taille du bloc en octets n'étant pas connue, les intervalles sont
+ * ajoutés par fenêtres de taille croissante jusqu'à avoir trouvé
+ * \a values.size() valeurs.
+ */
+template <typename DataType, typename ConverterType>
+void VtkFile::
+_readAsciiValues(Span<DataType> values, const ConverterType& converter)
+{
+  const char* func_name = "VtkFile::_readAsciiValues()";
+  const char* data = reinterpret_cast<const char*>(m_bytes.data());
+  const Int64 size = m_bytes.size();
+  const Int64 n = values.size();
+  if (n == 0)
+    return;
 
-  // On lit les 'sizeofT' prochains octets que l'on met dans big_endian.
-  m_stream->read((char*)big_endian, sizeofT);
+  ParallelLoopOptions options;
+  options.setGrainSize(1);
+  auto parallel_for = [&](Int32 begin, Int32 nb_range, auto& func) {
+    if (nb_range <= 1)
+      func(begin, nb_range);
+    else {
+      LambdaRangeFunctorT<std::remove_reference_t<decltype(func)>> functor(func);
+      TaskFactory::executeParallelFor(begin, nb_range, options, &functor);
+    }
+  };
 
-  // On transforme le big_endian en little_endian.
-  for (size_t i = 0; i < sizeofT; i++) {
-    little_endian[sizeofT - 1 - i] = big_endian[i];
+  // Bornes des intervalles (l'intervalle i est [range_bounds[i],range_bounds[i+1][)
+  // et nombre de valeurs de chacun d'eux.
+  UniqueArray<Int64> range_bounds;
+  UniqueArray<Int64> range_counts;
+  range_bounds.add(m_position);
+  Int64 nb_found = 0;
+  // Une valeur occupe au moins deux octets (avec le séparateur).
+  Int64 window_size = math::max(n * 2, m_ascii_chunk_size);
+  while (nb_found < n && range_bounds.back() < size) {
+    const Int64 window_end = math::min(range_bounds.back() + window_size, size);
+    const Int32 first_range = range_counts.size();
+    for (Int64 pos = range_bounds.back(); pos < window_end;) {
+      Int64 bound = math::min(pos + m_ascii_chunk_size, size);
+      while (bound < size && !_isSpace(data[bound]))
+        ++bound;
+      range_bounds.add(bound);
+      pos = bound;
+    }
+    const Int32 nb_new_range = range_bounds.size() - 1 - first_range;
+    range_counts.resize(first_range + nb_new_range);
+    auto count_func = [&](Integer begin, Integer nb_range) {
+      for (Integer r = begin; r < (begin + nb_range); ++r) {
+        const Int64 range_begin = range_bounds[r];
+        const Int64 range_end = range_bounds[r + 1];
+        Int64 nb_token = 0;
+        bool is_in_token = false;
+        for (Int64 p = range_begin; p < range_end; ++p) {
+          bool is_space = _isSpace(data[p]);
+          if (!is_space && !is_in_token)
+            ++nb_token;
+          is_in_token = !is_space;
+        }
+        range_counts[r] = nb_token;
+      }
+    };
+    parallel_for(first_range, nb_new_range, count_func);
+    for (Int32 r = first_range; r < range_counts.size(); ++r)
+      nb_found += range_counts[r];
+    window_size *= 2;
   }
+  if (nb_found < n)
+    throw IOException(func_name, String::format("Unexpected EndOfFile (expected {0} values, found {1})", n, nb_found));
+
+  // Somme préfixe pour avoir l'indice de la première valeur de chaque
+  // intervalle. Les intervalles après celui contenant la dernière valeur
+  // ne font pas partie du bloc.
+  UniqueArray<Int64> range_first_index;
+  range_first_index.reserve(range_counts.size());
+  Int64 index = 0;
+  for (Int64 count : range_counts) {
+    if (index >= n)
+      break;
+    range_first_index.add(index);
+    index += count;
+  }
+  const Int32 nb_range = range_first_index.size();
+
+  // Convertit les intervalles. En cas d'erreur, on conserve l'indice de la
+  // première valeur invalide.
+  std::atomic<Int64> first_invalid_index = n;
+  Int64 end_position = m_position;
+  auto func = [&](Integer begin, Integer nb) {
+    for (Integer r = begin; r < (begin + nb); ++r) {
+      Int64 p = range_bounds[r];
+      const Int64 range_end = range_bounds[r + 1];
+      const Int64 last = math::min(range_first_index[r] + range_counts[r], n);
+      for (Int64 i = range_first_index[r]; i < last; ++i) {
+        while (_isSpace(data[p]))
+          ++p;
+        Int64 token_begin = p;
+        while (p < range_end && !_isSpace(data[p]))
+          ++p;
+        if (!converter(data + token_begin, data + p, values[i])) {
+          Int64 current = first_invalid_index.load();
+          while (i < current && !first_invalid_index.compare_exchange_weak(current, i)) {
+          }
+          break;
+        }
+      }
+      // Seul l'intervalle contenant la dernière valeur positionne la fin du bloc.
+      if (last == n)
+        end_position = p;
+    }
+  };
+  parallel_for(0, nb_range, func);
+  if (first_invalid_index.load() != n)
+    throw IOException(func_name, String::format("Bad value at index {0}", first_invalid_index.load()));
+  m_position = end_position;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
 
-  // On 'cast' la liste d'octet en type 'T'.
-  T* conv = new (little_endian) T;
-  value = *conv;
+void VtkFile::
+getInts(Span<Int32> values)
+{
+  if (m_is_binary_file) {
+    _readBinaryValues<Int32>(values);
+    return;
+  }
+  // Les valeurs hors de l'intervalle des Int32 sont signalées après la
+  // lecture car le convertisseur est appelé en concurrence.
+  std::atomic<bool> has_out_of_range = false;
+  std::atomic<Int64> out_of_range_value = 0;
+  auto converter = [&](const char* begin, const char* end, Int32& value) {
+    Int64 v = 0;
+    if (!_parseInt(begin, end, v))
+      return false;
+    if (v < std::numeric_limits<Int32>::min() || v > std::numeric_limits<Int32>::max()) {
+      if (!has_out_of_range.exchange(true))
+        out_of_range_value = v;
+      value = 0;
+      return true;
+    }
+    value = static_cast<Int32>(v);
+    return true;
+  };
+  _readAsciiValues(values, converter);
+  if (has_out_of_range)
+    ARCANE_FATAL("Value '{0}' is outside the range of 'Int32'", out_of_range_value.load());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VtkFile::
+getReals(Span<Real> values, eDataType data_type)
+{
+  if (m_is_binary_file) {
+    switch (data_type) {
+    case eDataType::Int:
+      _readBinaryValues<Int32>(values);
+      break;
+    case eDataType::Float:
+      _readBinaryValues<float>(values);
+      break;
+    case eDataType::Double:
+      _readBinaryValues<double>(values);
+      break;
+    }
+    return;
+  }
+  if (data_type == eDataType::Int) {
+    auto converter = [](const char* begin, const char* end, Real& value) {
+      Int64 v = 0;
+      if (!_parseInt(begin, end, v))
+        return false;
+      value = static_cast<Real>(v);
+      return true;
+    };
+    _readAsciiValues(values, converter);
+    return;
+  }
+  const bool is_float = (data_type == eDataType::Float);
+  auto converter = [is_float](const char* begin, const char* end, Real& value) {
+    double v = 0.0;
+    if (!_parseReal(begin, end, v))
+      return false;
+    // Pour être cohérent avec la lecture binaire, arrondi en simple précision.
+    value = (is_float) ? static_cast<float>(v) : v;
+    return true;
+  };
+  _readAsciiValues(values, converter);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*!
+ * \brief Retourne le type de données correspondant à \a type_name.
+ *
+ * Une exception est envoyée si le type n'est pas 'int', 'float' ou 'double'.
+ */
+VtkFile::eDataType VtkFile::
+dataType(const String& type_name)
+{
+  if (isEqualString(type_name, "int"))
+    return eDataType::Int;
+  if (isEqualString(type_name, "float"))
+    return eDataType::Float;
+  if (isEqualString(type_name, "double"))
+    return eDataType::Double;
+  throw IOException("VtkFile::dataType()", "Invalid type name '" + type_name + "'");
 }
 
 /*---------------------------------------------------------------------------*/
@@ -610,62 +1191,36 @@ VtkMeshIOService::
 bool VtkMeshIOService::
 readMesh(IPrimaryMesh* mesh, const String& file_name, const String& dir_name, bool use_internal_partition)
 {
-  std::ifstream ifile(file_name.localstr(), std::ifstream::binary);
-
-  if (!ifile) {
-    error() << "Unable to read file '" << file_name << "'";
-    return true;
-  }
-
-  debug() << "Fichier ouvert : " << file_name.localstr();
-
-  VtkFile vtk_file(&ifile);
-  const char* buf = 0;
-
-  // Lecture de la description
-  // Lecture title.
-  String title = vtk_file.getNextLine();
-
-  info() << "Titre du fichier VTK : " << title.localstr();
-
-  // Lecture format.
-  String format = vtk_file.getNextLine();
-
-  debug() << "Format du fichier VTK : " << format.localstr();
-
-  if (VtkFile::isEqualString(format, "BINARY")) {
-    vtk_file.setIsBinaryFile(true);
-  }
-
-  eMeshType mesh_type = VTK_MT_Unknown;
+  IParallelMng* pm = mesh->parallelMng();
 
-  // Lecture du type de maillage
-  // TODO: en parallèle, avec use_internal_partition vrai, seul le processeur 0
+  // En parallèle, avec use_internal_partition vrai, seul le sous-domaine 0
   // lit les données. Dans ce cas, inutile que les autres ouvrent le fichier.
-  {
-    buf = vtk_file.getNextLine();
-
-    std::istringstream mesh_type_line(buf);
-    std::string dataset_str;
-    std::string mesh_type_str;
-
-    mesh_type_line >> ws >> dataset_str >> ws >> mesh_type_str;
-
-    vtk_file.checkString(dataset_str, "DATASET");
-
-    if (VtkFile::isEqualString(mesh_type_str, "STRUCTURED_GRID")) {
-      mesh_type = VTK_MT_StructuredGrid;
-    }
+  const bool is_master_io = !use_internal_partition || pm->commRank() == 0;
+
+  VtkFileContent file_content;
+  bool is_file_ok = true;
+  if (is_master_io) {
+    is_file_ok = file_content.open(file_name);
+    if (!is_file_ok)
+      error() << "Unable to read file '" << file_name << "'";
+    else
+      debug() << "Fichier ouvert : " << file_name.localstr();
+  }
 
-    if (VtkFile::isEqualString(mesh_type_str, "UNSTRUCTURED_GRID")) {
-      mesh_type = VTK_MT_UnstructuredGrid;
-    }
+  VtkFile vtk_file(file_content.bytes());
 
-    if (mesh_type == VTK_MT_Unknown) {
+  // Lecture de l'en-tête et du type de maillage
+  Int32 mesh_type = VTK_MT_Unknown;
+  if (is_master_io && is_file_ok) {
+    String mesh_type_str;
+    mesh_type = _readHeader(vtk_file, mesh_type_str);
+    if (mesh_type == VTK_MT_Unknown)
       error() << "Support exists only for 'STRUCTURED_GRID' and 'UNSTRUCTURED_GRID' formats (format=" << mesh_type_str << "')";
-      return true;
-    }
   }
+  if (use_internal_partition)
+    pm->broadcast(Int32ArrayView(1, &mesh_type), 0);
+  if (mesh_type == VTK_MT_Unknown)
+    return true;
   debug() << "Lecture en-tête OK";
 
   bool ret = true;
@@ -684,20 +1239,64 @@ readMesh(IPrimaryMesh* mesh, const String& file_name, const String& dir_name, bo
     }
     break;
 
-  case VTK_MT_Unknown:
+  default:
     break;
   }
-  /*while ( (buf=vtk_file.getNextLine()) != 0 ){
-    info() << " STR " << buf;
-    }*/
-
-  ifile.close();
   return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Lit l'en-tête d'un fichier vtk.
+ *
+ * \param vtk_file Référence vers un objet VtkFile
+ * \param mesh_type_str En retour, le type de maillage lu
+ * \return le type de maillage (VTK_MT_Unknown s'il n'est pas supporté)
+ */
+VtkMeshIOService::eMeshType VtkMeshIOService::
+_readHeader(VtkFile& vtk_file, String& mesh_type_str)
+{
+  // Lecture de la description
+  // Lecture title.
+  String title = vtk_file.getNextLine();
+
+  info() << "Titre du fichier VTK : " << title.localstr();
+
+  // Lecture format.
+  String format = vtk_file.getNextLine();
+
+  debug() << "Format du fichier VTK : " << format.localstr();
+
+  if (VtkFile::isEqualString(format, "BINARY")) {
+    vtk_file.setIsBinaryFile(true);
+  }
+
+  // Lecture du type de maillage
+  const char* buf = vtk_file.getNextLine();
+
+  std::istringstream mesh_type_line(buf);
+  std::string dataset_str;
+  std::string type_str;
+
+  mesh_type_line >> ws >> dataset_str >> ws >> type_str;
+
+  vtk_file.checkString(dataset_str, "DATASET");
+  mesh_type_str = type_str;
+
+  if (VtkFile::isEqualString(mesh_type_str, "STRUCTURED_GRID"))
+    return VTK_MT_StructuredGrid;
+
+  if (VtkFile::isEqualString(mesh_type_str, "UNSTRUCTURED_GRID"))
+    return VTK_MT_UnstructuredGrid;
+
+  return VTK_MT_Unknown;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 /*!
  * \brief Permet de lire un fichier vtk contenant une STRUCTURED_GRID.
  *
@@ -709,64 +1308,73 @@ readMesh(IPrimaryMesh* mesh, const String& file_name, const String& dir_name, bo
 bool VtkMeshIOService::
 _readStructuredGrid(IPrimaryMesh* mesh, VtkFile& vtk_file, bool use_internal_partition)
 {
+  IParallelMng* pm = mesh->parallelMng();
+  Int32 rank = pm->commRank();
+
+  // Si on utilise le partitionneur interne, seul le sous-domaine 0 lit le fichier.
+  const bool is_master_io = !use_internal_partition || rank == 0;
+
   // Lecture du nombre de points: DIMENSIONS nx ny nz
   const char* buf = nullptr;
   Integer nb_node_x = 0;
   Integer nb_node_y = 0;
   Integer nb_node_z = 0;
-  {
-    buf = vtk_file.getNextLine();
-    std::istringstream iline(buf);
-    std::string dimension_str;
-    iline >> ws >> dimension_str >> ws >> nb_node_x >> ws >> nb_node_y >> ws >> nb_node_z;
+  std::string float_str;
+  // Contient 0 si l'en-tête est valide.
+  Int32 has_error = 0;
+  if (is_master_io) {
+    has_error = 1;
+    do {
+      {
+        buf = vtk_file.getNextLine();
+        std::istringstream iline(buf);
+        std::string dimension_str;
+        iline >> ws >> dimension_str >> ws >> nb_node_x >> ws >> nb_node_y >> ws >> nb_node_z;
 
-    if (!iline) {
-      error() << "Syntax error while reading grid dimensions";
-      return true;
-    }
+        if (!iline) {
+          error() << "Syntax error while reading grid dimensions";
+          break;
+        }
 
-    vtk_file.checkString(dimension_str, "DIMENSIONS");
-    if (nb_node_x <= 1 || nb_node_y <= 1 || nb_node_z <= 1) {
-      error() << "Invalid dimensions: x=" << nb_node_x << " y=" << nb_node_y << " z=" << nb_node_z;
-      return true;
-    }
-  }
-  info() << " Infos: " << nb_node_x << " " << nb_node_y << " " << nb_node_z;
-  Integer nb_node = nb_node_x * nb_node_y * nb_node_z;
+        vtk_file.checkString(dimension_str, "DIMENSIONS");
+        if (nb_node_x <= 1 || nb_node_y <= 1 || nb_node_z <= 1) {
+          error() << "Invalid dimensions: x=" << nb_node_x << " y=" << nb_node_y << " z=" << nb_node_z;
+          break;
+        }
+      }
+      info() << " Infos: " << nb_node_x << " " << nb_node_y << " " << nb_node_z;
+      Integer nb_node = nb_node_x * nb_node_y * nb_node_z;
 
-  // Lecture du nombre de points: POINTS nb float
-  std::string float_str;
-  {
-    buf = vtk_file.getNextLine();
-    std::istringstream iline(buf);
-    std::string points_str;
-    Integer nb_node_read = 0;
-    iline >> ws >> points_str >> ws >> nb_node_read >> ws >> float_str;
-    if (!iline) {
-      error() << "Syntax error while reading grid dimensions";
-      return true;
-    }
-    vtk_file.checkString(points_str, "POINTS");
-    if (nb_node_read != nb_node) {
-      error() << "Number of invalid nodes: expected=" << nb_node << " found=" << nb_node_read;
-      return true;
-    }
+      // Lecture du nombre de points: POINTS nb float
+      {
+        buf = vtk_file.getNextLine();
+        std::istringstream iline(buf);
+        std::string points_str;
+        Integer nb_node_read = 0;
+        iline >> ws >> points_str >> ws >> nb_node_read >> ws >> float_str;
+        if (!iline) {
+          error() << "Syntax error while reading grid dimensions";
+          break;
+        }
+        vtk_file.checkString(points_str, "POINTS");
+        if (nb_node_read != nb_node) {
+          error() << "Number of invalid nodes: expected=" << nb_node << " found=" << nb_node_read;
+          break;
+        }
+      }
+      has_error = 0;
+    } while (false);
   }
+  if (use_internal_partition)
+    pm->broadcast(Int32ArrayView(1, &has_error), 0);
+  if (has_error != 0)
+    return true;
 
-  Int32 rank = mesh->parallelMng()->commRank();
-
-  Integer nb_cell_x = nb_node_x - 1;
-  Integer nb_cell_y = nb_node_y - 1;
-  Integer nb_cell_z = nb_node_z - 1;
+  Integer nb_node = nb_node_x * nb_node_y * nb_node_z;
 
-  if (use_internal_partition && rank != 0) {
-    nb_node_x = 0;
-    nb_node_y = 0;
-    nb_node_z = 0;
-    nb_cell_x = 0;
-    nb_cell_y = 0;
-    nb_cell_z = 0;
-  }
+  Integer nb_cell_x = (nb_node_x > 0) ? (nb_node_x - 1) : 0;
+  Integer nb_cell_y = (nb_node_y > 0) ? (nb_node_y - 1) : 0;
+  Integer nb_cell_z = (nb_node_z > 0) ? (nb_node_z - 1) : 0;
 
   const Integer nb_node_yz = nb_node_y * nb_node_z;
   const Integer nb_node_xy = nb_node_x * nb_node_y;
@@ -857,47 +1465,12 @@ _readStructuredGrid(IPrimaryMesh* mesh, VtkFile& vtk_file, bool use_internal_par
     {
       UniqueArray<Real3> coords(nb_node);
 
-      if (vtk_file.isEqualString(float_str, "int")) {
-        for (Integer z = 0; z < nb_node_z; ++z) {
-          for (Integer y = 0; y < nb_node_y; ++y) {
-            for (Integer x = 0; x < nb_node_x; ++x) {
-              Real nx = vtk_file.getInt();
-              Real ny = vtk_file.getInt();
-              Real nz = vtk_file.getInt();
-              Integer node_unique_id = x + y * nb_node_x + z * nb_node_xy;
-              coords[node_unique_id] = Real3(nx, ny, nz);
-            }
-          }
-        }
-      }
-      else if (vtk_file.isEqualString(float_str, "float")) {
-        for (Integer z = 0; z < nb_node_z; ++z) {
-          for (Integer y = 0; y < nb_node_y; ++y) {
-            for (Integer x = 0; x < nb_node_x; ++x) {
-              Real nx = vtk_file.getFloat();
-              Real ny = vtk_file.getFloat();
-              Real nz = vtk_file.getFloat();
-              Integer node_unique_id = x + y * nb_node_x + z * nb_node_xy;
-              coords[node_unique_id] = Real3(nx, ny, nz);
-            }
-          }
-        }
-      }
-      else if (vtk_file.isEqualString(float_str, "double")) {
-        for (Integer z = 0; z < nb_node_z; ++z) {
-          for (Integer y = 0; y < nb_node_y; ++y) {
-            for (Integer x = 0; x < nb_node_x; ++x) {
-              Real nx = vtk_file.getDouble();
-              Real ny = vtk_file.getDouble();
-              Real nz = vtk_file.getDouble();
-              Integer node_unique_id = x + y * nb_node_x + z * nb_node_xy;
-              coords[node_unique_id] = Real3(nx, ny, nz);
-            }
-          }
-        }
-      }
-      else {
-        throw IOException("_readStructuredGrid", "Invalid type name");
+      if (nb_node != 0) {
+        // Les noeuds sont rangés dans l'ordre de leur uniqueId().
+        UniqueArray<Real> values(3 * static_cast<Int64>(nb_node));
+        vtk_file.getReals(values, VtkFile::dataType(float_str));
+        for (Integer i = 0; i < nb_node; ++i)
+          coords[i] = Real3(values[3 * i], values[3 * i + 1], values[3 * i + 2]);
       }
 
       VariableNodeReal3& nodes_coord_var(mesh->nodesCoordinates());
@@ -1012,33 +1585,10 @@ _readNodesUnstructuredGrid(IMesh* mesh, VtkFile& vtk_file, Array<Real3>& node_co
   // Lecture les coordonnées
   node_coords.resize(nb_node);
   {
-    if (vtk_file.isEqualString(data_type_str, "int")) {
-      for (Integer i = 0; i < nb_node; ++i) {
-        Real nx = vtk_file.getInt();
-        Real ny = vtk_file.getInt();
-        Real nz = vtk_file.getInt();
-        node_coords[i] = Real3(nx, ny, nz);
-      }
-    }
-    else if (vtk_file.isEqualString(data_type_str, "float")) {
-      for (Integer i = 0; i < nb_node; ++i) {
-        Real nx = vtk_file.getFloat();
-        Real ny = vtk_file.getFloat();
-        Real nz = vtk_file.getFloat();
-        node_coords[i] = Real3(nx, ny, nz);
-      }
-    }
-    else if (vtk_file.isEqualString(data_type_str, "double")) {
-      for (Integer i = 0; i < nb_node; ++i) {
-        Real nx = vtk_file.getDouble();
-        Real ny = vtk_file.getDouble();
-        Real nz = vtk_file.getDouble();
-        node_coords[i] = Real3(nx, ny, nz);
-      }
-    }
-    else {
-      throw IOException(func_name, "Invalid type name");
-    }
+    UniqueArray<Real> values(3 * static_cast<Int64>(nb_node));
+    vtk_file.getReals(values, VtkFile::dataType(data_type_str));
+    for (Integer i = 0; i < nb_node; ++i)
+      node_coords[i] = Real3(values[3 * i], values[3 * i + 1], values[3 * i + 2]);
   }
   _readMetadata(mesh, vtk_file);
 }
@@ -1094,14 +1644,24 @@ _readCellsUnstructuredGrid(IMesh* mesh, VtkFile& vtk_file,
   cells_connectivity.resize(nb_cell_node);
 
   {
+    // Le bloc contient pour chaque maille son nombre de noeuds suivi
+    // des indices de ses noeuds.
+    UniqueArray<Int32> values(nb_cell_node);
+    vtk_file.getInts(values);
+    Integer index = 0;
     Integer connectivity_index = 0;
     for (Integer i = 0; i < nb_cell; ++i) {
-      Integer n = vtk_file.getInt();
+      if (index >= nb_cell_node)
+        ARCANE_THROW(IOException, "Bad connectivity size for cell '{0}' (total size={1})", i, nb_cell_node);
+      Integer n = values[index];
+      ++index;
+      if (n < 0 || (index + n) > nb_cell_node)
+        ARCANE_THROW(IOException, "Bad number of nodes '{0}' for cell '{1}'", n, i);
       cells_nb_node[i] = n;
       for (Integer j = 0; j < n; ++j) {
-        Integer id = vtk_file.getInt();
-        cells_connectivity[connectivity_index] = id;
+        cells_connectivity[connectivity_index] = values[index];
         ++connectivity_index;
+        ++index;
       }
     }
   }
@@ -1127,10 +1687,13 @@ _readCellsUnstructuredGrid(IMesh* mesh, VtkFile& vtk_file,
     }
   }
 
-  for (Integer i = 0; i < nb_cell; ++i) {
-    Integer vtk_ct = vtk_file.getInt();
-    Int16 it = vtkToArcaneCellType(vtk_ct, cells_nb_node[i]);
-    cells_type[i] = ItemTypeId{ it };
+  {
+    UniqueArray<Int32> vtk_cell_types(nb_cell);
+    vtk_file.getInts(vtk_cell_types);
+    for (Integer i = 0; i < nb_cell; ++i) {
+      Int16 it = vtkToArcaneCellType(vtk_cell_types[i], cells_nb_node[i]);
+      cells_type[i] = ItemTypeId{ it };
+    }
   }
   _readMetadata(mesh, vtk_file);
 }
@@ -1367,59 +1930,43 @@ _readFacesMesh(IMesh* mesh, const String& file_name, const String& dir_name,
 {
   ARCANE_UNUSED(dir_name);
 
-  std::ifstream ifile(file_name.localstr(), std::ifstream::binary);
-  if (!ifile) {
-    info() << "No face descriptor file found '" << file_name << "'";
-    return;
-  }
+  IParallelMng* pm = mesh->parallelMng();
 
-  VtkFile vtk_file(&ifile);
-  const char* buf = 0;
+  // Si on utilise le partitionneur interne, seul le sous-domaine 0 lit le fichier.
+  const bool is_master_io = !use_internal_partition || pm->commRank() == 0;
 
-  // Lecture de la description
-  String title = vtk_file.getNextLine();
-  info() << "Titre du fichier VTK : " << title;
+  // 0 si pas de fichier, 1 si le fichier est invalide et 2 sinon.
+  Int32 file_status = 0;
+  VtkFileContent file_content;
+  if (is_master_io && file_content.open(file_name))
+    file_status = 1;
 
-  String format = vtk_file.getNextLine();
-  if (VtkFile::isEqualString(format, "BINARY")) {
-    vtk_file.setIsBinaryFile(true);
-  }
+  VtkFile vtk_file(file_content.bytes());
 
-  eMeshType mesh_type = VTK_MT_Unknown;
-  // Lecture du type de maillage
-  // TODO: en parallèle, avec use_internal_partition vrai, seul le processeur 0
-  // lit les données. Dans ce cas, inutile que les autres ouvre le fichier.
-  {
-    buf = vtk_file.getNextLine();
-    std::istringstream mesh_type_line(buf);
-    std::string dataset_str;
-    std::string mesh_type_str;
-    mesh_type_line >> ws >> dataset_str >> ws >> mesh_type_str;
-    vtk_file.checkString(dataset_str, "DATASET");
-
-    if (VtkFile::isEqualString(mesh_type_str, "UNSTRUCTURED_GRID")) {
-      mesh_type = VTK_MT_UnstructuredGrid;
-    }
-
-    if (mesh_type == VTK_MT_Unknown) {
+  if (file_status != 0) {
+    // Lecture de l'en-tête et du type de maillage
+    String mesh_type_str;
+    eMeshType mesh_type = _readHeader(vtk_file, mesh_type_str);
+    if (mesh_type == VTK_MT_UnstructuredGrid)
+      file_status = 2;
+    else
       error() << "Face descriptor file type must be 'UNSTRUCTURED_GRID' (format=" << mesh_type_str << "')";
-      return;
-    }
   }
+  if (use_internal_partition)
+    pm->broadcast(Int32ArrayView(1, &file_status), 0);
+  if (file_status == 0) {
+    info() << "No face descriptor file found '" << file_name << "'";
+    return;
+  }
+  if (file_status != 2)
+    return;
 
   {
-    IParallelMng* pm = mesh->parallelMng();
     Integer nb_face = 0;
-    Int32 sid = pm->commRank();
 
     UniqueArray<Int32> faces_local_id;
 
-    // Si on utilise le partitionneur interne, seul le sous-domaine lit le maillage
-    bool need_read = true;
-    if (use_internal_partition)
-      need_read = (sid == 0);
-
-    if (need_read) {
+    if (is_master_io) {
       {
         // Lit des noeuds, mais ne conserve pas leur coordonnées car cela n'est
         // pas nécessaire.
@@ -1766,10 +2313,7 @@ _readCellVariable(IMesh* mesh, VtkFile& vtk_file, const String& var_name, Intege
   auto* var = new VariableCellReal(VariableBuildInfo(mesh, var_name));
   m_variables.add(var);
   RealArrayView values(var->asArray());
-  for (Integer i = 0; i < nb_cell; ++i) {
-    Real v = vtk_file.getDouble();
-    values[i] = v;
-  }
+  vtk_file.getReals(values.subView(0, nb_cell), VtkFile::eDataType::Double);
   _readMetadata(mesh, vtk_file);
   info() << "Variable build finished: " << vtk_file.isEof();
 }
@@ -1794,10 +2338,11 @@ _readItemGroup(IMesh* mesh, VtkFile& vtk_file, const String& name, Integer nb_it
   IItemFamily* item_family = mesh->itemFamily(ik);
   info() << "Reading group info for group: " << name;
 
+  Int32UniqueArray values(nb_item);
+  vtk_file.getInts(values);
   Int32UniqueArray ids;
   for (Integer i = 0; i < nb_item; ++i) {
-    Integer v = vtk_file.getInt();
-    if (v != 0)
+    if (values[i] != 0)
       ids.add(local_id[i]);
   }
   info() << "Building group: " << name << " nb_element=" << ids.size();
@@ -1824,10 +2369,11 @@ _readNodeGroup(IMesh* mesh, VtkFile& vtk_file, const String& name, Integer nb_it
   IItemFamily* item_family = mesh->itemFamily(IK_Node);
   info() << "Lecture infos groupes de noeuds pour le groupe: " << name;
 
+  Int32UniqueArray values(nb_item);
+  vtk_file.getInts(values);
   Int32UniqueArray ids;
   for (Integer i = 0; i < nb_item; ++i) {
-    Integer v = vtk_file.getInt();
-    if (v != 0)
+    if (values[i] != 0)
       ids.add(i);
   }
   info() << "Création groupe: " << name << " nb_element=" << ids.size();
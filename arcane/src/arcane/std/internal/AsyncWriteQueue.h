@@ -0,0 +1,91 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* AsyncWriteQueue.h                                           (C) 2000-2024 */
+/*                                                                           */
+/* File d'opérations d'écriture exécutées par un thread en tâche de fond.    */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_STD_INTERNAL_ASYNCWRITEQUEUE_H
+#define ARCANE_STD_INTERNAL_ASYNCWRITEQUEUE_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/ArcaneGlobal.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <exception>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief File d'opérations d'écriture exécutées par un thread en tâche de fond.
+ *
+ * Les opérations sont exécutées dans l'ordre où elles ont été ajoutées.
+ * Chaque opération est associée à une taille qui correspond à la mémoire
+ * utilisée par les valeurs en attente d'écriture. Si la somme de ces tailles
+ * dépasse la taille maximale, add() attend que des opérations soient
+ * terminées.
+ *
+ * Si une opération lève une exception, les opérations suivantes ne sont pas
+ * exécutées et l'exception est relancée lors de l'appel à wait().
+ */
+class AsyncWriteQueue
+{
+  struct Item
+  {
+    std::function<void()> m_function;
+    Int64 m_size = 0;
+  };
+
+ public:
+
+  explicit AsyncWriteQueue(Int64 max_staging_size);
+  ~AsyncWriteQueue();
+
+ public:
+
+  //! Ajoute l'opération \a func utilisant \a size octets
+  void add(std::function<void()> func, Int64 size);
+  //! Attend que toutes les opérations soient terminées
+  void wait();
+
+ private:
+
+  Int64 m_max_staging_size = 0;
+  Int64 m_staged_size = 0;
+  Int64 m_nb_pending = 0;
+  bool m_is_stopping = false;
+  std::deque<Item> m_items;
+  std::exception_ptr m_exception;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::thread m_thread;
+
+ private:
+
+  void _run();
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
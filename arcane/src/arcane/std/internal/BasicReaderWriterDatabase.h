@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* BasicReaderWriterDatabase.h                                 (C) 2000-2023 */
+/* BasicReaderWriterDatabase.h                                 (C) 2000-2024 */
 /*                                                                           */
 /* Base de donnée pour le service 'BasicReaderWriter'.                       */
 /*---------------------------------------------------------------------------*/
@@ -45,7 +45,7 @@ namespace Arcane::impl
  * versions 1 et 2 du format où les données étaient écrites de manière
  * séquentielles.
  */
-class KeyValueTextWriter
+class ARCANE_STD_EXPORT KeyValueTextWriter
 : public TraceAccessor
 {
   class Impl;
@@ -70,6 +70,15 @@ class KeyValueTextWriter
   Ref<IDataCompressor> dataCompressor() const;
   void setHashAlgorithm(Ref<IHashAlgorithm> v);
   Ref<IHashAlgorithm> hashAlgorithm() const;
+  /*!
+   * \brief Positionne la taille (en octet) des blocs pour la compression.
+   *
+   * Si non nul et si un compresseur est positionné, les valeurs sont
+   * découpées en blocs de cette taille compressés indépendamment et en
+   * parallèle. Cela n'est utilisé qu'à partir de la version 3.
+   */
+  void setCompressionChunkSize(Int64 v);
+  Int64 compressionChunkSize() const;
 
  private:
 
@@ -82,7 +91,7 @@ class KeyValueTextWriter
  * \internal
  * \brief Classe d'écriture d'un fichier texte pour les protections/reprises
  */
-class KeyValueTextReader
+class ARCANE_STD_EXPORT KeyValueTextReader
 : public TraceAccessor
 {
   class Impl;
@@ -100,10 +109,22 @@ class KeyValueTextReader
   void getExtents(const String& key_name, SmallSpan<Int64> extents);
   void readIntegers(const String& key, Span<Integer> values);
   void read(const String& key, Span<std::byte> values);
+  /*!
+   * \brief Lit une partie des valeurs de la clé \a key.
+   *
+   * Lit les \a values.size() octets à partir de la position \a offset
+   * d'une valeur dont la taille totale est \a full_size octets. Si les
+   * valeurs ont été compressées par blocs, seuls les blocs nécessaires
+   * sont décompressés. Cette méthode n'est disponible qu'à partir
+   * de la version 3.
+   */
+  void readPart(const String& key, Int64 full_size, Int64 offset, Span<std::byte> values);
 
  public:
 
   String fileName() const;
+  //! Taille des blocs de compression (0 si pas de compression par blocs)
+  Int64 compressionChunkSize() const;
   void setDataCompressor(Ref<IDataCompressor> ds);
   Ref<IDataCompressor> dataCompressor() const;
   void setHashAlgorithm(Ref<IHashAlgorithm> v);
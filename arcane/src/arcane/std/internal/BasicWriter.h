@@ -20,17 +20,27 @@
 
 #include <map>
 #include <set>
+#include <memory>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
 namespace Arcane::impl
 {
+class AsyncWriteQueue;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
  * \brief Lecture/Ecriture simple.
+ *
+ * Si l'écriture asynchrone est active (setAsyncWrite()), les valeurs des
+ * variables sont copiées lors de l'appel à write() et la compression, le
+ * calcul des hash et l'écriture dans les fichiers sont effectués par un
+ * thread en tâche de fond. Les opérations collectives (tri des valeurs
+ * et hash de comparaison) restent effectuées par le thread appelant.
+ * Il faut appeler waitAsyncWrite() pour s'assurer que toutes les
+ * écritures sont terminées. Le destructeur appelle aussi cette méthode.
  */
 class BasicWriter
 : public BasicReaderWriterCommon
@@ -40,6 +50,7 @@ class BasicWriter
 
   BasicWriter(IApplication* app, IParallelMng* pm, const String& path,
               eOpenMode open_mode, Integer version, bool want_parallel);
+  ~BasicWriter() override;
 
  public:
 
@@ -70,6 +81,23 @@ class BasicWriter
     _checkNoInit();
     m_is_save_values = v;
   }
+  /*!
+   * \brief Active l'écriture asynchrone. Doit être appelé avant initialize()
+   *
+   * \a max_staging_size est la taille maximale (en octets) des copies de
+   * valeurs en attente d'écriture. Lorsqu'elle est atteinte, write() attend
+   * que des écritures en cours soient terminées.
+   */
+  void setAsyncWrite(bool v, Int64 max_staging_size)
+  {
+    _checkNoInit();
+    m_is_async_write = v;
+    m_async_max_staging_size = max_staging_size;
+  }
+  //! Indique si l'écriture est asynchrone
+  bool isAsyncWrite() const { return m_is_async_write; }
+  //! Attend la fin des écritures asynchrones en cours
+  void waitAsyncWrite();
   void initialize();
 
  private:
@@ -80,6 +108,8 @@ class BasicWriter
   //! Indique si on sauve les valeurs
   bool m_is_save_values = true;
   Int32 m_version = -1;
+  bool m_is_async_write = false;
+  Int64 m_async_max_staging_size = 0;
 
   Ref<IDataCompressor> m_data_compressor;
   Ref<IHashAlgorithm> m_compare_hash_algorithm;
@@ -90,6 +120,7 @@ class BasicWriter
   std::set<ItemGroup> m_written_groups;
 
   ScopedPtrT<IGenericWriter> m_global_writer;
+  std::unique_ptr<AsyncWriteQueue> m_async_queue;
 
  private:
 
@@ -7,6 +7,7 @@ set(ARCANE_SOURCES
   BasicGenericWriter.cc
   BasicReader.cc
   BasicWriter.cc
+  AsyncWriteQueue.cc
   BasicReaderWriter.cc
   BasicReaderWriterDatabase.cc
   ParallelDataReader.cc
@@ -43,6 +44,7 @@ set(ARCANE_SOURCES
   CartesianMeshGenerator.cc
   CartesianMeshGenerator.h
   ArcanePostProcessingModule.cc
+  AsyncPostProcessor.cc
   ArcaneCheckpointModule.cc
   ArcaneDirectExecution.cc
   ArcaneCasePartitioner.cc
@@ -121,6 +123,7 @@ set(ARCANE_SOURCES
   internal/BasicReaderWriterDatabase.h
   internal/BasicReader.h
   internal/BasicWriter.h
+  internal/AsyncWriteQueue.h
   internal/VariableDataInfo.h
   internal/ParallelDataReader.h
   internal/ParallelDataWriter.h
@@ -134,6 +137,7 @@ set(AXL_FILES
   ArcaneLoadBalance
   Ensight7PostProcessor
   ArcanePostProcessing
+  AsyncPostProcessor
   ArcaneCheckpoint
   ArcaneDirectExecution
   ArcaneCasePartitioner
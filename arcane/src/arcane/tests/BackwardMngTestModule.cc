@@ -0,0 +1,191 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* BackwardMngTestModule.cc                                    (C) 2000-2024 */
+/*                                                                           */
+/* Module de test du retour-arrière.                                         */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ValueChecker.h"
+
+#include "arcane/core/EntryPoint.h"
+#include "arcane/core/ITimeLoopMng.h"
+#include "arcane/core/ItemEnumerator.h"
+
+#include "arcane/tests/BackwardMngTest_axl.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace ArcaneTest
+{
+using namespace Arcane;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Module de test du retour-arrière.
+ *
+ * La variable 'BackwardValue' est modifiée à chaque itération (avec appel
+ * à setUpToDate()) alors que 'BackwardConstantValue' ne l'est jamais.
+ * Un retour-arrière est effectué une fois et les valeurs restaurées sont
+ * comparées à celles attendues pour l'itération sauvegardée. Les variables
+ * restaurées doivent aussi avoir été mises à jour (setUpToDate()). Le test est
+ * exécuté avec et sans le mode incrémental (ARCANE_BACKWARD_INCREMENTAL)
+ * qui doivent donner les mêmes valeurs.
+ */
+class BackwardMngTestModule
+: public ArcaneBackwardMngTestObject
+{
+  static constexpr Int32 SAVE_PERIOD = 2;
+  static constexpr Int32 BACKWARD_ITERATION = 7;
+  static constexpr Int32 LAST_ITERATION = 12;
+
+ public:
+
+  explicit BackwardMngTestModule(const ModuleBuildInfo& mb);
+
+ public:
+
+  VersionInfo versionInfo() const override { return VersionInfo(1, 0, 0); }
+
+ public:
+
+  void init();
+  void compute();
+  void restore();
+
+ private:
+
+  bool m_backward_done = false;
+  bool m_restore_done = false;
+  Int32 m_nb_restore = 0;
+  //! Temps de modification des variables avant le retour-arrière
+  Int64 m_value_modified_time = 0;
+  Int64 m_constant_value_modified_time = 0;
+
+ private:
+
+  static Real _value(Int32 iteration, Int64 uid)
+  {
+    return static_cast<Real>(iteration) * 1000.0 + static_cast<Real>(uid);
+  }
+  static Real _constantValue(Int64 uid) { return 3.0 * static_cast<Real>(uid) + 1.0; }
+  void _checkValues();
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_MODULE_BACKWARDMNGTEST(BackwardMngTestModule);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+BackwardMngTestModule::
+BackwardMngTestModule(const ModuleBuildInfo& mb)
+: ArcaneBackwardMngTestObject(mb)
+{
+  addEntryPoint(this, "Init", &BackwardMngTestModule::init, IEntryPoint::WInit);
+  addEntryPoint(this, "Compute", &BackwardMngTestModule::compute);
+  addEntryPoint(this, "Restore", &BackwardMngTestModule::restore, IEntryPoint::WRestore);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void BackwardMngTestModule::
+init()
+{
+  ENUMERATE_ (Cell, icell, allCells()) {
+    Int64 uid = (*icell).uniqueId().asInt64();
+    m_value[icell] = _value(0, uid);
+    m_constant_value[icell] = _constantValue(uid);
+  }
+  m_value.setUpToDate();
+  m_constant_value.setUpToDate();
+  m_last_iteration = 0;
+  subDomain()->timeLoopMng()->setBackwardSavePeriod(SAVE_PERIOD);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void BackwardMngTestModule::
+restore()
+{
+  info() << "BackwardMngTest restore";
+  m_restore_done = true;
+  ++m_nb_restore;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void BackwardMngTestModule::
+compute()
+{
+  Int32 iteration = m_global_iteration();
+  if (m_restore_done) {
+    _checkValues();
+    m_restore_done = false;
+  }
+
+  if (iteration == BACKWARD_ITERATION && !m_backward_done) {
+    info() << "BackwardMngTest go backward at iteration " << iteration;
+    m_backward_done = true;
+    m_value_modified_time = m_value.variable()->modifiedTime();
+    m_constant_value_modified_time = m_constant_value.variable()->modifiedTime();
+    subDomain()->timeLoopMng()->goBackward();
+    return;
+  }
+
+  ENUMERATE_ (Cell, icell, allCells()) {
+    m_value[icell] = _value(iteration, (*icell).uniqueId().asInt64());
+  }
+  m_value.setUpToDate();
+  m_last_iteration = iteration;
+
+  if (iteration >= LAST_ITERATION) {
+    if (m_nb_restore != 1)
+      ARCANE_FATAL("Bad number of restore n={0} expected=1", m_nb_restore);
+    subDomain()->timeLoopMng()->stopComputeLoop(true);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void BackwardMngTestModule::
+_checkValues()
+{
+  Int32 saved_iteration = m_last_iteration();
+  info() << "BackwardMngTest check restored values iteration=" << m_global_iteration()
+         << " saved_iteration=" << saved_iteration;
+  if (saved_iteration >= BACKWARD_ITERATION || saved_iteration < 0)
+    ARCANE_FATAL("Bad saved iteration '{0}'", saved_iteration);
+  ValueChecker vc(A_FUNCINFO);
+  ENUMERATE_ (Cell, icell, allCells()) {
+    Int64 uid = (*icell).uniqueId().asInt64();
+    vc.areEqual(m_value[icell], _value(saved_iteration, uid), "Value");
+    vc.areEqual(m_constant_value[icell], _constantValue(uid), "ConstantValue");
+  }
+  if (m_value.variable()->modifiedTime() <= m_value_modified_time)
+    ARCANE_FATAL("Variable '{0}' is not up to date after restore", m_value.name());
+  if (m_constant_value.variable()->modifiedTime() <= m_constant_value_modified_time)
+    ARCANE_FATAL("Variable '{0}' is not up to date after restore", m_constant_value.name());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace ArcaneTest
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* CheckpointTesterService.cc                                  (C) 2000-2022 */
+/* CheckpointTesterService.cc                                  (C) 2000-2024 */
 /*                                                                           */
 /* Service de test des protections/reprises.                                 */
 /*---------------------------------------------------------------------------*/
@@ -13,6 +13,9 @@
 
 #include "arcane/utils/OStringStream.h"
 #include "arcane/utils/ArrayShape.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/IDataCompressor.h"
+#include "arcane/utils/PlatformUtils.h"
 
 #include "arcane/BasicTimeLoopService.h"
 #include "arcane/tests/StdArrayMeshVariables.h"
@@ -35,6 +38,10 @@
 #include "arcane/IPrimaryMesh.h"
 #include "arcane/IMainFactory.h"
 #include "arcane/IParallelMng.h"
+#include "arcane/core/VariableView.h"
+#include "arcane/core/ServiceBuilder.h"
+
+#include "arcane/std/internal/BasicReaderWriterDatabase.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -93,6 +100,7 @@ class CheckpointTesterService
   VariableScalarString m_mesh_properties;
   VariableArrayString m_group_names;
   VariableCellArrayReal m_variable_with_shape;
+  VariableCellFloat32 m_cell_float32;
   IItemFamily* m_particle_family;
   ObserverPool m_observer_pool;
 
@@ -106,6 +114,8 @@ class CheckpointTesterService
   String _getProperties();
   void _checkConnectivity();
   void _checkConnectivity(IItemFamily* family);
+  void _testPartialRead();
+  static Real _float32Value(Integer iteration, Cell cell);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -136,6 +146,7 @@ CheckpointTesterService(const ServiceBuildInfo& sbi)
 , m_mesh_properties(VariableBuildInfo(sbi.meshHandle(),"TestCheckpointMeshProperties"))
 , m_group_names({sbi.meshHandle(),"TestCheckpointGroupNames"})
 , m_variable_with_shape(VariableBuildInfo(sbi.meshHandle(),"TestVariableWithShape"))
+, m_cell_float32(VariableBuildInfo(sbi.meshHandle(),"TestCheckpointCellFloat32"))
 , m_particle_family(nullptr)
 {
   // Sauve les valeurs des propriétés dans une variable pour vérifier leur
@@ -175,6 +186,7 @@ void CheckpointTesterService::
 onTimeLoopStartInit()
 {
   _checkConnectivity();
+  _testPartialRead();
   m_global_deltat = 0.1;
   m_is_continue = false;
   m_particle_family = mesh()->findItemFamily(IK_Particle,"CheckpointParticle",true);
@@ -218,6 +230,79 @@ onTimeLoopStartInit()
   m_variable_with_shape.variable()->data()->setShape(shape);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Teste la lecture d'une partie d'une valeur avec et sans
+ * compression par blocs.
+ */
+void CheckpointTesterService::
+_testPartialRead()
+{
+  using impl::KeyValueTextReader;
+  using impl::KeyValueTextWriter;
+
+  Ref<IDataCompressor> compressor;
+  compressor = ServiceBuilder<IDataCompressor>::createReference(subDomain()->application(), "LZ4DataCompressor", SB_AllowNull);
+
+  const Int64 chunk_size = 1024;
+  const Int32 nb_value = 5000;
+  UniqueArray<Int64> values(nb_value);
+  for (Int32 i = 0; i < nb_value; ++i)
+    values[i] = (i * 7) % 311;
+  Span<const std::byte> bytes(asBytes(values.span()));
+  const Int64 full_size = bytes.size();
+  const Int64 extents[1] = { nb_value };
+
+  // Parties (offset,taille) à relire. La première chevauche la limite
+  // entre deux blocs.
+  const Int64 parts[][2] = {
+    { chunk_size - 100, 300 },
+    { 2 * chunk_size + 10, 100 },
+    { chunk_size, 3 * chunk_size },
+    { full_size - 50, 50 },
+    { 0, full_size }
+  };
+
+  String file_name = String::format("partial_read_{0}.acr", subDomain()->parallelMng()->commRank());
+  for (Int32 with_compression = 0; with_compression < 2; ++with_compression) {
+    if (with_compression && !compressor.get()) {
+      info() << "Compressor 'LZ4DataCompressor' is not available. Skipping test of chunked partial read";
+      continue;
+    }
+    {
+      KeyValueTextWriter writer(traceMng(), file_name, 3);
+      if (with_compression) {
+        writer.setDataCompressor(compressor);
+        writer.setCompressionChunkSize(chunk_size);
+      }
+      writer.setExtents("Values", SmallSpan<const Int64>(extents, 1));
+      writer.write("Values", bytes);
+    }
+    KeyValueTextReader reader(traceMng(), file_name, 3);
+    if (with_compression) {
+      reader.setDataCompressor(compressor);
+      if (reader.compressionChunkSize() != chunk_size)
+        ARCANE_FATAL("Bad chunk size v={0} expected={1}", reader.compressionChunkSize(), chunk_size);
+    }
+    UniqueArray<std::byte> full_values(full_size);
+    reader.read("Values", full_values);
+    if (full_values.span() != bytes)
+      ARCANE_FATAL("Bad values for full read (with_compression={0})", with_compression);
+    for (const auto& part : parts) {
+      Int64 offset = part[0];
+      Int64 size = part[1];
+      info() << "Partial read with_compression=" << with_compression << " offset=" << offset << " size=" << size;
+      UniqueArray<std::byte> part_values(size);
+      reader.readPart("Values", full_size, offset, part_values);
+      if (part_values.span() != full_values.span().subSpan(offset, size))
+        ARCANE_FATAL("Bad values for partial read offset={0} size={1} (with_compression={2})",
+                     offset, size, with_compression);
+    }
+  }
+  platform::removeFile(file_name);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -379,6 +464,26 @@ _writeCheckpoint()
   m_array_cells.setValues(current_iteration, mesh->allCells());
   if (m_array_particles)
     m_array_particles->setValues(current_iteration,m_particle_family->allItems());
+
+  auto out_cell_float32 = viewOutAs<Real>(m_cell_float32);
+  ENUMERATE_CELL(icell,mesh->allCells()){
+    out_cell_float32[icell] = _float32Value(current_iteration,*icell);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Valeur de la variable 'Float32' pour la maille \a cell.
+ *
+ * La valeur retournée est celle relue depuis la variable, c'est-à-dire
+ * arrondie en simple précision.
+ */
+Real CheckpointTesterService::
+_float32Value(Integer iteration, Cell cell)
+{
+  Real v = static_cast<Real>(cell.uniqueId().asInt64()) + 0.125 * iteration;
+  return static_cast<Real>(static_cast<Float32>(v));
 }
 
 /*---------------------------------------------------------------------------*/
@@ -408,6 +513,20 @@ _compareCheckpoint()
   if (m_array_particles)
     nb_error += m_array_particles->checkValues(saved_iteration,m_particle_family->allItems());
 
+  {
+    auto in_cell_float32 = viewInAs<Real>(m_cell_float32);
+    ENUMERATE_CELL(icell,mesh->allCells()){
+      Real expected = _float32Value(saved_iteration,*icell);
+      Real value = in_cell_float32[icell];
+      if (value!=expected){
+        if (nb_error<10)
+          info() << "Bad value for Float32 variable cell=" << ItemPrinter(*icell)
+                 << " v=" << value << " expected=" << expected;
+        ++nb_error;
+      }
+    }
+  }
+
   {
     String scalar_string = String("String_") + saved_iteration;
     String value = m_variable_scalar_string.value();
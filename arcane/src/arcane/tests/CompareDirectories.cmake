@@ -0,0 +1,35 @@
+﻿# Compare le contenu de deux répertoires.
+#
+# Utilisation:
+#   cmake -DREFERENCE_DIR=<dir1> -DCOMPARE_DIR=<dir2> -P CompareDirectories.cmake
+#
+# Le test échoue si les deux répertoires ne contiennent pas les mêmes
+# fichiers ou si le contenu d'un fichier est différent.
+
+if (NOT REFERENCE_DIR OR NOT COMPARE_DIR)
+  message(FATAL_ERROR "Variables 'REFERENCE_DIR' and 'COMPARE_DIR' have to be set")
+endif()
+
+get_filename_component(REFERENCE_DIR ${REFERENCE_DIR} ABSOLUTE)
+get_filename_component(COMPARE_DIR ${COMPARE_DIR} ABSOLUTE)
+file(GLOB_RECURSE _ref_files RELATIVE ${REFERENCE_DIR} ${REFERENCE_DIR}/*)
+file(GLOB_RECURSE _compare_files RELATIVE ${COMPARE_DIR} ${COMPARE_DIR}/*)
+list(SORT _ref_files)
+list(SORT _compare_files)
+if (NOT _ref_files)
+  message(FATAL_ERROR "No file in directory '${REFERENCE_DIR}'")
+endif()
+if (NOT "${_ref_files}" STREQUAL "${_compare_files}")
+  message(FATAL_ERROR "Directories have different files\n"
+    "  ${REFERENCE_DIR}: ${_ref_files}\n"
+    "  ${COMPARE_DIR}: ${_compare_files}")
+endif()
+
+foreach(_file ${_ref_files})
+  execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${REFERENCE_DIR}/${_file} ${COMPARE_DIR}/${_file}
+    RESULT_VARIABLE _result)
+  if (NOT _result EQUAL 0)
+    message(FATAL_ERROR "File '${_file}' is different")
+  endif()
+endforeach()
+message(STATUS "Compared ${REFERENCE_DIR} and ${COMPARE_DIR}: OK")
@@ -0,0 +1,265 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* ConcurrentEntryPointTestModule.cc                           (C) 2000-2024 */
+/*                                                                           */
+/* Module de test de l'exécution concurrente des points d'entrée.            */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ValueChecker.h"
+#include "arcane/utils/ValueConvert.h"
+
+#include "arcane/core/EntryPoint.h"
+#include "arcane/core/ITimeLoopMng.h"
+#include "arcane/core/ItemEnumerator.h"
+#include "arcane/core/Concurrency.h"
+
+#include "arcane/tests/ConcurrentEntryPointTest_axl.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace ArcaneTest
+{
+using namespace Arcane;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Module de test de l'exécution concurrente des points d'entrée.
+ *
+ * Les points d'entrée 'ComputeA' et 'ComputeB' sont indépendants ainsi
+ * que 'ComputeC' et 'ComputeD' qui utilisent les valeurs calculées par les
+ * deux premiers. Le point d'entrée 'ComputeE', qui est après 'ComputeD'
+ * dans la boucle en temps, est indépendant de tous les autres et doit donc
+ * être exécuté avec 'ComputeA' et 'ComputeB'. Le point d'entrée 'Check'
+ * ne déclare pas ses variables et est donc toujours exécuté seul.
+ *
+ * Si l'exécution concurrente est active, chaque point d'entrée d'un groupe
+ * attend que les autres points d'entrée du groupe aient commencé. Cela
+ * permet de vérifier que les points d'entrée ont bien été regroupés et
+ * exécutés en même temps.
+ */
+class ConcurrentEntryPointTestModule
+: public ArcaneConcurrentEntryPointTestObject
+{
+ public:
+
+  explicit ConcurrentEntryPointTestModule(const ModuleBuildInfo& mb);
+
+ public:
+
+  VersionInfo versionInfo() const override { return VersionInfo(1, 0, 0); }
+
+ public:
+
+  void init();
+  void computeA();
+  void computeB();
+  void computeC();
+  void computeD();
+  void computeE();
+  void check();
+
+ private:
+
+  EntryPoint* m_compute_a_entry_point = nullptr;
+  EntryPoint* m_compute_d_entry_point = nullptr;
+  bool m_is_concurrent_expected = false;
+  //! Nombre de points d'entrée commencés du groupe (A,B,E)
+  std::atomic<Int32> m_nb_started_abe = 0;
+  //! Nombre de points d'entrée commencés du groupe (C,D)
+  std::atomic<Int32> m_nb_started_cd = 0;
+  //! Nombre de points d'entrée ayant vu les autres points d'entrée de leur groupe
+  std::atomic<Int32> m_nb_concurrent_call = 0;
+
+ private:
+
+  Real _iteration() { return static_cast<Real>(m_global_iteration()); }
+  void _waitOtherEntryPoints(std::atomic<Int32>& nb_started, Int32 group_size);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_MODULE_CONCURRENTENTRYPOINTTEST(ConcurrentEntryPointTestModule);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ConcurrentEntryPointTestModule::
+ConcurrentEntryPointTestModule(const ModuleBuildInfo& mb)
+: ArcaneConcurrentEntryPointTestObject(mb)
+{
+  addEntryPoint(this, "Init", &ConcurrentEntryPointTestModule::init, IEntryPoint::WInit);
+
+  m_compute_a_entry_point = addEntryPoint(this, "ComputeA", &ConcurrentEntryPointTestModule::computeA);
+  m_compute_a_entry_point->addWriteVariable(m_value_a.variable());
+
+  EntryPoint* ep_b = addEntryPoint(this, "ComputeB", &ConcurrentEntryPointTestModule::computeB);
+  ep_b->addWriteVariable(m_value_b.variable());
+
+  EntryPoint* ep_c = addEntryPoint(this, "ComputeC", &ConcurrentEntryPointTestModule::computeC);
+  ep_c->addReadVariable(m_value_a.variable());
+  ep_c->addReadVariable(m_value_b.variable());
+  ep_c->addWriteVariable(m_value_c.variable());
+
+  m_compute_d_entry_point = addEntryPoint(this, "ComputeD", &ConcurrentEntryPointTestModule::computeD);
+  m_compute_d_entry_point->addReadVariable(m_value_a.variable());
+  m_compute_d_entry_point->addWriteVariable(m_value_d.variable());
+
+  EntryPoint* ep_e = addEntryPoint(this, "ComputeE", &ConcurrentEntryPointTestModule::computeE);
+  ep_e->addWriteVariable(m_value_e.variable());
+
+  addEntryPoint(this, "Check", &ConcurrentEntryPointTestModule::check);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ConcurrentEntryPointTestModule::
+init()
+{
+  bool use_concurrent = false;
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_CONCURRENT_ENTRY_POINTS", true))
+    use_concurrent = (v.value() != 0);
+  m_is_concurrent_expected = use_concurrent && TaskFactory::isActive();
+  info() << "ConcurrentEntryPointTest is_concurrent_expected=" << m_is_concurrent_expected;
+
+  m_value_a.fill(0.0);
+  m_value_b.fill(0.0);
+  m_value_c.fill(0.0);
+  m_value_d.fill(0.0);
+  m_value_e.fill(0.0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ConcurrentEntryPointTestModule::
+_waitOtherEntryPoints(std::atomic<Int32>& nb_started, Int32 group_size)
+{
+  if (!m_is_concurrent_expected)
+    return;
+  ++nb_started;
+  // Si les points d'entrée ne sont pas exécutés en même temps, les autres
+  // points d'entrée ne commenceront qu'après celui-ci. On arrête donc
+  // d'attendre au bout d'un délai maximal.
+  auto max_time = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (nb_started.load() < group_size && std::chrono::steady_clock::now() < max_time)
+    std::this_thread::yield();
+  if (nb_started.load() >= group_size)
+    ++m_nb_concurrent_call;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ConcurrentEntryPointTestModule::
+computeA()
+{
+  _waitOtherEntryPoints(m_nb_started_abe, 3);
+  Real iteration = _iteration();
+  ENUMERATE_ (Cell, icell, allCells()) {
+    m_value_a[icell] = iteration * static_cast<Real>((*icell).uniqueId().asInt64());
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ConcurrentEntryPointTestModule::
+computeB()
+{
+  _waitOtherEntryPoints(m_nb_started_abe, 3);
+  Real iteration = _iteration();
+  ENUMERATE_ (Cell, icell, allCells()) {
+    m_value_b[icell] = 2.0 * iteration * static_cast<Real>((*icell).uniqueId().asInt64());
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ConcurrentEntryPointTestModule::
+computeC()
+{
+  _waitOtherEntryPoints(m_nb_started_cd, 2);
+  ENUMERATE_ (Cell, icell, allCells()) {
+    m_value_c[icell] = m_value_a[icell] + m_value_b[icell];
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ConcurrentEntryPointTestModule::
+computeD()
+{
+  _waitOtherEntryPoints(m_nb_started_cd, 2);
+  ENUMERATE_ (Cell, icell, allCells()) {
+    m_value_d[icell] = 2.0 * m_value_a[icell];
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ConcurrentEntryPointTestModule::
+computeE()
+{
+  _waitOtherEntryPoints(m_nb_started_abe, 3);
+  Real iteration = _iteration();
+  ENUMERATE_ (Cell, icell, allCells()) {
+    m_value_e[icell] = 4.0 * iteration * static_cast<Real>((*icell).uniqueId().asInt64());
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ConcurrentEntryPointTestModule::
+check()
+{
+  Real iteration = _iteration();
+  ValueChecker vc(A_FUNCINFO);
+  ENUMERATE_ (Cell, icell, allCells()) {
+    Real uid = static_cast<Real>((*icell).uniqueId().asInt64());
+    vc.areEqual(m_value_c[icell], 3.0 * iteration * uid, "ValueC");
+    vc.areEqual(m_value_d[icell], 2.0 * iteration * uid, "ValueD");
+    vc.areEqual(m_value_e[icell], 4.0 * iteration * uid, "ValueE");
+  }
+  Integer nb_iteration = m_global_iteration();
+  vc.areEqual(m_compute_a_entry_point->nbCall(), nb_iteration, "NbCallA");
+  vc.areEqual(m_compute_d_entry_point->nbCall(), nb_iteration, "NbCallD");
+
+  // Vérifie que les groupes (A,B,E) et (C,D) ont été exécutés en concurrence.
+  if (m_is_concurrent_expected) {
+    info() << "NbConcurrentCall=" << m_nb_concurrent_call.load();
+    vc.areEqual(m_nb_concurrent_call.load(), 5, "NbConcurrentCall");
+  }
+  m_nb_started_abe = 0;
+  m_nb_started_cd = 0;
+  m_nb_concurrent_call = 0;
+
+  if (nb_iteration >= 10)
+    subDomain()->timeLoopMng()->stopComputeLoop(true);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace ArcaneTest
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,304 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* MeshLocalityUnitTest.cc                                     (C) 2000-2024 */
+/*                                                                           */
+/* Service de test de la renumérotation des entités pour la localité.        */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ValueChecker.h"
+
+#include "arcane/core/BasicUnitTest.h"
+#include "arcane/core/ServiceFactory.h"
+#include "arcane/core/IMesh.h"
+#include "arcane/core/IMeshModifier.h"
+#include "arcane/core/IItemFamily.h"
+#include "arcane/core/IParallelMng.h"
+#include "arcane/core/ItemInternal.h"
+#include "arcane/core/IItemInternalSortFunction.h"
+#include "arcane/core/MeshVariableScalarRef.h"
+
+#include "arcane/mesh/ItemLocalitySortFunction.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace ArcaneTest
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+using namespace Arcane;
+using mesh::eItemLocalityOrdering;
+using mesh::ItemLocalitySortFunction;
+using mesh::ItemLocalityCellsRank;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Fonction de tri mélangeant les entités.
+ *
+ * Cela permet de simuler un maillage dont la numérotation locale n'a pas de
+ * rapport avec la géométrie (par exemple après un équilibrage de charge).
+ */
+class ShuffleItemSortFunction
+: public IItemInternalSortFunction
+{
+ public:
+
+  const String& name() const override { return m_name; }
+  void sortItems(ItemInternalMutableArrayView items) override
+  {
+    auto compare = [](const ItemInternal* item1, const ItemInternal* item2) {
+      bool s1 = item1->isSuppressed();
+      bool s2 = item2->isSuppressed();
+      if (s1 != s2)
+        return s2;
+      UInt64 h1 = _hash(item1->uniqueId());
+      UInt64 h2 = _hash(item2->uniqueId());
+      if (h1 != h2)
+        return h1 < h2;
+      return item1->uniqueId() < item2->uniqueId();
+    };
+    std::sort(std::begin(items), std::end(items), compare);
+  }
+
+ private:
+
+  static UInt64 _hash(Int64 v)
+  {
+    UInt64 z = static_cast<UInt64>(v) + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+
+  String m_name = "TestShuffle";
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Service de test de la renumérotation des entités pour la localité.
+ *
+ * Ce test renumérote les entités du maillage de manière aléatoire puis
+ * avec les différentes méthodes de ItemLocalitySortFunction. Après chaque
+ * renumérotation, il vérifie que les valeurs des variables ont bien été
+ * conservées et mesure le temps de boucles avec accès indirects.
+ */
+class MeshLocalityUnitTest
+: public BasicUnitTest
+{
+ public:
+
+  explicit MeshLocalityUnitTest(const ServiceBuildInfo& sbi);
+
+ public:
+
+  void initializeTest() override {}
+  void executeTest() override;
+
+ private:
+
+  VariableCellReal m_cell_value;
+  VariableNodeReal m_node_value;
+  VariableFaceReal m_face_value;
+  VariableCellReal3 m_cell_center;
+
+ private:
+
+  Real _renumber(const String& name, std::function<IItemInternalSortFunction*(IItemFamily*)> create_func);
+  void _checkValues();
+  Real _computeNodeSpread();
+  Real _gatherBench(Int32 nb_loop);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_SERVICE(MeshLocalityUnitTest,
+                        ServiceProperty("MeshLocalityUnitTest", ST_CaseOption),
+                        ARCANE_SERVICE_INTERFACE(IUnitTest));
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MeshLocalityUnitTest::
+MeshLocalityUnitTest(const ServiceBuildInfo& sbi)
+: BasicUnitTest(sbi)
+, m_cell_value(VariableBuildInfo(sbi.mesh(), "LocalityTestCellValue"))
+, m_node_value(VariableBuildInfo(sbi.mesh(), "LocalityTestNodeValue"))
+, m_face_value(VariableBuildInfo(sbi.mesh(), "LocalityTestFaceValue"))
+, m_cell_center(VariableBuildInfo(sbi.mesh(), "LocalityTestCellCenter"))
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshLocalityUnitTest::
+executeTest()
+{
+  ENUMERATE_ (Cell, icell, allCells()) {
+    m_cell_value[icell] = static_cast<Real>((*icell).uniqueId().asInt64());
+  }
+  ENUMERATE_ (Node, inode, allNodes()) {
+    m_node_value[inode] = static_cast<Real>((*inode).uniqueId().asInt64());
+  }
+
+  Real shuffled_spread = _renumber("Shuffle", [](IItemFamily*) -> IItemInternalSortFunction* {
+    return new ShuffleItemSortFunction();
+  });
+  Real hilbert_spread = _renumber("Hilbert", [](IItemFamily* family) -> IItemInternalSortFunction* {
+    return new ItemLocalitySortFunction(family, eItemLocalityOrdering::Hilbert);
+  });
+  Real rcm_spread = _renumber("RCM", [](IItemFamily* family) -> IItemInternalSortFunction* {
+    return new ItemLocalitySortFunction(family, eItemLocalityOrdering::ReverseCuthillMcKee);
+  });
+  // Rang des mailles partagé entre les familles comme dans DynamicMesh:
+  // il ne doit être calculé qu'une seule fois pour le compactage et donner
+  // la même numérotation.
+  {
+    auto cells_rank = std::make_shared<ItemLocalityCellsRank>(mesh(), eItemLocalityOrdering::ReverseCuthillMcKee);
+    cells_rank->setKeepResult(true);
+    Real shared_spread = _renumber("SharedRCM", [&](IItemFamily* family) -> IItemInternalSortFunction* {
+      return new ItemLocalitySortFunction(family, cells_rank);
+    });
+    cells_rank->setKeepResult(false);
+    if (cells_rank->nbCompute() != 1)
+      ARCANE_FATAL("Cells rank computed several times nb_compute={0}", cells_rank->nbCompute());
+    if (shared_spread != rcm_spread)
+      ARCANE_FATAL("Bad spread for shared RCM ordering shared={0} rcm={1}", shared_spread, rcm_spread);
+  }
+  // Remet la fonction de tri par défaut
+  _renumber("Default", [](IItemFamily*) -> IItemInternalSortFunction* { return nullptr; });
+
+  // Les numérotations pour la localité doivent rapprocher les numéros des
+  // noeuds d'une même maille.
+  if (allCells().size() > 8) {
+    if (hilbert_spread >= shuffled_spread)
+      ARCANE_FATAL("Bad spread for Hilbert ordering hilbert={0} shuffle={1}", hilbert_spread, shuffled_spread);
+    if (rcm_spread >= shuffled_spread)
+      ARCANE_FATAL("Bad spread for RCM ordering rcm={0} shuffle={1}", rcm_spread, shuffled_spread);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Renumérote les entités avec les fonctions de tri créées par
+ * \a create_func et retourne l'écart moyen entre les numéros des noeuds
+ * d'une maille.
+ */
+Real MeshLocalityUnitTest::
+_renumber(const String& name, std::function<IItemInternalSortFunction*(IItemFamily*)> create_func)
+{
+  IMesh* mesh = this->mesh();
+  IItemFamily* families[4] = { mesh->nodeFamily(), mesh->edgeFamily(), mesh->faceFamily(), mesh->cellFamily() };
+  for (IItemFamily* family : families)
+    family->setItemSortFunction(create_func(family));
+
+  // L'appel à endUpdate() provoque un compactage avec tri des entités.
+  mesh->modifier()->endUpdate();
+
+  _checkValues();
+  mesh->checkValidMesh();
+
+  const Int32 nb_loop = 50;
+  Real spread = _computeNodeSpread();
+  Real bench_time = _gatherBench(nb_loop);
+  info() << "Locality ordering=" << name << " node_spread=" << spread
+         << " gather_time=" << bench_time << " (nb_loop=" << nb_loop << ")";
+  return spread;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshLocalityUnitTest::
+_checkValues()
+{
+  ValueChecker vc(A_FUNCINFO);
+  ENUMERATE_ (Cell, icell, allCells()) {
+    Real expected = static_cast<Real>((*icell).uniqueId().asInt64());
+    vc.areEqual(m_cell_value[icell], expected, "CellValue");
+  }
+  ENUMERATE_ (Node, inode, allNodes()) {
+    Real expected = static_cast<Real>((*inode).uniqueId().asInt64());
+    vc.areEqual(m_node_value[inode], expected, "NodeValue");
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Moyenne sur les mailles de l'écart entre le plus grand et le plus
+ * petit numéro local des noeuds de la maille.
+ */
+Real MeshLocalityUnitTest::
+_computeNodeSpread()
+{
+  Int64 total_spread = 0;
+  ENUMERATE_ (Cell, icell, allCells()) {
+    Int32 min_lid = std::numeric_limits<Int32>::max();
+    Int32 max_lid = 0;
+    for (NodeLocalId node : (*icell).nodeIds()) {
+      min_lid = std::min(min_lid, node.localId());
+      max_lid = std::max(max_lid, node.localId());
+    }
+    total_spread += (max_lid - min_lid);
+  }
+  Int32 nb_cell = allCells().size();
+  if (nb_cell == 0)
+    return 0.0;
+  return static_cast<Real>(total_spread) / static_cast<Real>(nb_cell);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Boucles avec accès indirects (maille vers noeuds et face vers
+ * mailles).
+ */
+Real MeshLocalityUnitTest::
+_gatherBench(Int32 nb_loop)
+{
+  VariableNodeReal3& nodes_coord = mesh()->nodesCoordinates();
+  Real begin_time = platform::getRealTime();
+  for (Int32 i = 0; i < nb_loop; ++i) {
+    ENUMERATE_ (Cell, icell, allCells()) {
+      Real3 center;
+      for (NodeLocalId node : (*icell).nodeIds())
+        center += nodes_coord[node];
+      m_cell_center[icell] = center;
+    }
+    ENUMERATE_ (Face, iface, allFaces()) {
+      Real v = 0.0;
+      for (CellLocalId cell : (*iface).cellIds())
+        v += m_cell_value[cell] + m_cell_center[cell].x;
+      m_face_value[iface] = v;
+    }
+  }
+  return platform::getRealTime() - begin_time;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace ArcaneTest
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
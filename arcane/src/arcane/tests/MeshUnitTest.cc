@@ -78,6 +78,7 @@
 #include "arcane/core/MeshVisitor.h"
 #include "arcane/core/MeshKind.h"
 #include "arcane/core/MeshEvents.h"
+#include "arcane/core/internal/IItemFamilyInternal.h"
 
 #include <set>
 
@@ -213,6 +214,7 @@ class MeshUnitTest
   void _testCoherency();
   void _testFindOneItem();
   void _testEvents();
+  void _testCompactConnectivities();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -317,6 +319,7 @@ executeTest()
   _testCoherency();
   _testFindOneItem();
   _testEvents();
+  _testCompactConnectivities();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1615,6 +1618,37 @@ _testCoherency()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void MeshUnitTest::
+_testCompactConnectivities()
+{
+  // Vérifie que la reconstruction des connectivités ne modifie pas
+  // les entités connectées.
+  ValueChecker vc(A_FUNCINFO);
+  UniqueArray<Int64> ref_node_uids;
+  ENUMERATE_(Cell,icell,allCells()){
+    for( Node node : (*icell).nodes() )
+      ref_node_uids.add(node.uniqueId());
+  }
+
+  for( IItemFamily* family : mesh()->itemFamilies() ){
+    IItemFamilyInternal* family_internal = family->_internalApi();
+    info() << "Fragmentation family=" << family->name()
+           << " ratio=" << family_internal->connectivityFragmentationRatio();
+    family_internal->compactConnectivities(-1.0);
+    vc.areEqual(family_internal->connectivityFragmentationRatio(),0.0,"FragmentationRatio");
+  }
+
+  UniqueArray<Int64> node_uids;
+  ENUMERATE_(Cell,icell,allCells()){
+    for( Node node : (*icell).nodes() )
+      node_uids.add(node.uniqueId());
+  }
+  vc.areEqualArray(node_uids.constView(),ref_node_uids.constView(),"CellNodes");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void MeshUnitTest::
 _testFindOneItem()
 {
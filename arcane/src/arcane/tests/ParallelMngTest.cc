@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelMngTest.cc                                          (C) 2000-2020 */
+/* ParallelMngTest.cc                                          (C) 2000-2024 */
 /*                                                                           */
 /* Test des opérations de base du parallèlisme.                              */
 /*---------------------------------------------------------------------------*/
@@ -925,6 +925,14 @@ _testProcessMessages()
     options.setExchangeMode(ParallelExchangerOptions::EM_Collective);
     _testProcessMessages(&options);
   }
+  {
+    // Force le découpage de l'échange collectif en plusieurs étapes.
+    ParallelExchangerOptions options;
+    info() << "Test: TestProcessMessage with collective and small max size";
+    options.setExchangeMode(ParallelExchangerOptions::EM_Collective);
+    options.setMaxCollectiveMessageSize(64);
+    _testProcessMessages(&options);
+  }
  {
     ParallelExchangerOptions options;
     info() << "Test: TestProcessMessage with max pending";
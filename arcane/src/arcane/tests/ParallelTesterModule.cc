@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelTesterModule.cc                                     (C) 2000-2023 */
+/* ParallelTesterModule.cc                                     (C) 2000-2024 */
 /*                                                                           */
 /* Module de test du parallèlisme.                                           */
 /*---------------------------------------------------------------------------*/
@@ -16,6 +16,7 @@
 #include "arcane/utils/CheckedConvert.h"
 #include "arcane/utils/ValueChecker.h"
 #include "arcane/utils/Event.h"
+#include "arcane/utils/PlatformUtils.h"
 
 #include "arcane/core/MeshVariableInfo.h"
 #include "arcane/core/EntryPoint.h"
@@ -316,6 +317,7 @@ class ParallelTesterModule
  private:
 
   void _testSynchronize();
+  void _benchmarkSynchronize();
   void _testMultiSynchronize();
   void _testSameValuesOnAllReplica();
   void _testDifferentValuesOnAllReplica();
@@ -576,6 +578,8 @@ testLoop()
     _testSameValuesOnAllReplica();
     _testDifferentValuesOnAllReplica();
   }
+  if (options()->nbBenchmarkSync()>0)
+    _benchmarkSynchronize();
   Timer timer(subDomain(),"ParallelTesterModule::testLoop",Timer::TimerReal);
   {
     Timer::Sentry sentry(&timer);
@@ -856,6 +860,59 @@ _testDifferentValuesOnAllReplica()
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Mesure la latence des synchronisations.
+ *
+ * Effectue 'nb-benchmark-sync' synchronisations successives d'une
+ * variable scalaire et d'une variable tableau aux mailles et affiche
+ * le temps moyen d'une synchronisation (maximum sur l'ensemble des rangs).
+ * Cela permet de comparer les implémentations choisies via la variable
+ * d'environnement ARCANE_SYNCHRONIZE_VERSION.
+ */
+void ParallelTesterModule::
+_benchmarkSynchronize()
+{
+  const Int32 nb_sync = options()->nbBenchmarkSync();
+  IParallelMng* pm = parallelMng();
+
+  VariableCellReal scalar_var(VariableBuildInfo(this,"BenchmarkSyncScalar"));
+  VariableCellArrayReal array_var(VariableBuildInfo(this,"BenchmarkSyncArray"));
+  array_var.resize(8);
+  ENUMERATE_CELL(icell,ownCells()){
+    scalar_var[icell] = (Real)(icell->uniqueId().asInt64());
+    array_var[icell].fill((Real)(icell->owner()));
+  }
+
+  auto do_benchmark = [&](const String& name,IVariable* var){
+    // Une première synchronisation pour initialiser les structures internes.
+    var->synchronize();
+    pm->barrier();
+    Real begin_time = platform::getRealTime();
+    for( Int32 i=0; i<nb_sync; ++i )
+      var->synchronize();
+    Real elapsed = platform::getRealTime() - begin_time;
+    Real max_elapsed = pm->reduce(Parallel::ReduceMax,elapsed);
+    info() << "BenchmarkSynchronize name=" << name << " nb_sync=" << nb_sync
+           << " time_per_sync (us)=" << (max_elapsed * 1.0e6) / nb_sync;
+  };
+
+  do_benchmark("Scalar",scalar_var.variable());
+  do_benchmark("Array",array_var.variable());
+
+  // Vérifie que les valeurs synchronisées sont correctes
+  Integer nb_error = 0;
+  ENUMERATE_CELL(icell,allCells()){
+    if (scalar_var[icell] != (Real)(icell->uniqueId().asInt64()))
+      ++nb_error;
+    if (array_var[icell][7] != (Real)(icell->owner()))
+      ++nb_error;
+  }
+  if (nb_error!=0)
+    ARCANE_FATAL("Error in synchronize benchmark: n={0}",nb_error);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
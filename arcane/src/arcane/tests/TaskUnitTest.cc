@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* TaskUnitTest.cc                                             (C) 2000-2023 */
+/* TaskUnitTest.cc                                             (C) 2000-2024 */
 /*                                                                           */
 /* Service de test des tâches.                                               */
 /*---------------------------------------------------------------------------*/
@@ -31,9 +31,11 @@
 #include "arcane_packages.h"
 
 #include <thread>
+#include <vector>
 
 #ifdef ARCANE_HAS_PACKAGE_TBB
 #include <tbb/spin_mutex.h>
+#include "arcane/parallel/thread/internal/TBBCostBlockedRange.h"
 using namespace tbb;
 #endif
 
@@ -131,6 +133,9 @@ class Test3
     _exec1();
     _exec2();
     _exec3();
+#ifdef ARCANE_HAS_PACKAGE_TBB
+    _execCostBlockedRange();
+#endif
   }
 
   void _exec1()
@@ -180,6 +185,134 @@ class Test3
              << " TASK_IDX=" << TaskFactory::currentTaskIndex();
       TaskFactory::setVerboseLevel(v);
     }
+
+    {
+      info() << "Test Weighted partitionner";
+      // Coût variant d'un facteur 10 entre les noeuds
+      Integer nb_node = nodes.size();
+      UniqueArray<Real> costs(nb_node);
+      UniqueArray<Real> cost_prefix_sum(nb_node+1);
+      cost_prefix_sum[0] = 0.0;
+      for( Integer i=0; i<nb_node; ++i ){
+        costs[i] = ((i % 4)==0) ? 10.0 : 1.0;
+        cost_prefix_sum[i+1] = cost_prefix_sum[i] + costs[i];
+      }
+      for( Integer i=0; i<2; ++i ){
+        _reset();
+        ParallelLoopOptions options;
+        options.setPartitioner(ParallelLoopOptions::Partitioner::Weighted);
+        if (i==0)
+          options.setItemCosts(costs);
+        else
+          options.setItemCostPrefixSum(cost_prefix_sum);
+        arcaneParallelForeach(nodes, options, this, &Test3::_testWeightedCallback);
+        _checkNbAccess();
+        _checkValid();
+      }
+      info() << "End test Weighted partitionner";
+    }
+  }
+#ifdef ARCANE_HAS_PACKAGE_TBB
+  //! Teste directement le découpage de 'TBBCostBlockedRange'
+  void _execCostBlockedRange()
+  {
+    info() << "Test TBBCostBlockedRange";
+    // Les 100 premières itérations coûtent 100 fois plus que les autres.
+    const Integer nb_iter = 1000;
+    const Integer base_index = 5;
+    const Real max_iter_cost = 100.0;
+    UniqueArray<Real> prefix_sum(nb_iter+1);
+    prefix_sum[0] = 0.0;
+    for( Integer i=0; i<nb_iter; ++i )
+      prefix_sum[i+1] = prefix_sum[i] + ((i<100) ? max_iter_cost : 1.0);
+    const Real total_cost = prefix_sum[nb_iter];
+
+    {
+      TBBCostBlockedRange r1(base_index,base_index+nb_iter,base_index,prefix_sum.data(),0.0,1);
+      if (!r1.is_divisible())
+        ARCANE_FATAL("Skewed range should be divisible");
+      TBBCostBlockedRange r2(r1,tbb::split());
+      info() << "Split skewed range middle=" << r1.end() << " cost1=" << r1.cost() << " cost2=" << r2.cost();
+      _checkCostSplit(r1,r2,total_cost,max_iter_cost);
+      // Avec un découpage en nombre d'itérations, la première moitié
+      // aurait un coût de 10400 contre 500 pour la seconde.
+      if (r1.end()>=(base_index+nb_iter/2))
+        ARCANE_FATAL("Bad middle '{0}' for skewed range",r1.end());
+    }
+
+    // Découpe récursivement jusqu'au coût minimum.
+    {
+      const Real min_cost = total_cost / 16.0;
+      std::vector<TBBCostBlockedRange> ranges;
+      ranges.push_back(TBBCostBlockedRange(base_index,base_index+nb_iter,base_index,prefix_sum.data(),min_cost,1));
+      Integer nb_split = 0;
+      for( size_t i=0; i<ranges.size(); ++i ){
+        while (ranges[i].is_divisible()){
+          TBBCostBlockedRange r1(ranges[i]);
+          TBBCostBlockedRange r2(r1,tbb::split());
+          _checkCostSplit(r1,r2,r1.cost()+r2.cost(),max_iter_cost);
+          ranges[i] = r1;
+          ranges.push_back(r2);
+          ++nb_split;
+        }
+      }
+      Real sum = 0.0;
+      for( const TBBCostBlockedRange& r : ranges ){
+        if (r.empty())
+          ARCANE_FATAL("Empty range [{0},{1}[",r.begin(),r.end());
+        sum += r.cost();
+      }
+      info() << "Recursive split nb_split=" << nb_split << " nb_range=" << ranges.size();
+      if (!math::isNearlyEqual(sum,total_cost))
+        ARCANE_FATAL("Bad total cost v={0} expected={1}",sum,total_cost);
+    }
+
+    // Coût nul : l'intervalle n'est pas divisible mais un découpage doit
+    // rester valide.
+    {
+      UniqueArray<Real> zero_prefix_sum(nb_iter+1);
+      zero_prefix_sum.fill(0.0);
+      TBBCostBlockedRange r1(0,nb_iter,0,zero_prefix_sum.data(),0.0,1);
+      if (r1.is_divisible())
+        ARCANE_FATAL("Range with zero cost should not be divisible");
+      TBBCostBlockedRange r2(r1,tbb::split());
+      if (r1.empty() || r2.empty() || r1.end()!=r2.begin() || r1.begin()!=0 || r2.end()!=nb_iter)
+        ARCANE_FATAL("Bad split for zero cost range [{0},{1}[ [{2},{3}[",r1.begin(),r1.end(),r2.begin(),r2.end());
+    }
+
+    // Une seule itération : l'intervalle n'est pas divisible.
+    {
+      TBBCostBlockedRange r(base_index+3,base_index+4,base_index,prefix_sum.data(),0.0,1);
+      if (r.empty() || r.is_divisible())
+        ARCANE_FATAL("Range with one iteration should not be divisible");
+      if (!math::isNearlyEqual(r.cost(),max_iter_cost))
+        ARCANE_FATAL("Bad cost for one iteration v={0}",r.cost());
+    }
+    info() << "End test TBBCostBlockedRange";
+  }
+  void _checkCostSplit(const TBBCostBlockedRange& r1,const TBBCostBlockedRange& r2,
+                       Real total_cost,Real max_iter_cost)
+  {
+    if (r1.empty() || r2.empty() || r1.end()!=r2.begin())
+      ARCANE_FATAL("Bad split [{0},{1}[ [{2},{3}[",r1.begin(),r1.end(),r2.begin(),r2.end());
+    if (!math::isNearlyEqual(r1.cost()+r2.cost(),total_cost))
+      ARCANE_FATAL("Bad split total cost v={0} expected={1}",r1.cost()+r2.cost(),total_cost);
+    // Les deux parties ne peuvent différer de plus du coût d'une itération.
+    if (math::abs(r1.cost()-r2.cost())>max_iter_cost)
+      ARCANE_FATAL("Unbalanced split cost1={0} cost2={1}",r1.cost(),r2.cost());
+  }
+#endif
+  void _testWeightedCallback(NodeVectorView nodes)
+  {
+    Real local_total_coord = 0.0;
+    ENUMERATE_NODE(inode,nodes){
+      local_total_coord += m_node_coord[inode].squareNormL2();
+      m_node_nb_access[inode] = m_node_nb_access[inode] + 1;
+    }
+    {
+      SpinLock::ScopedLock s(m_reduce_lock);
+      m_total_value += local_total_coord;
+    }
   }
   void _testDeterministCallback(NodeVectorView nodes)
   {
@@ -337,6 +470,19 @@ class Test3
       ARCANE_FATAL("Bad parallel for total coords v={0} expected={1} diff={2}",
                    m_saved_value,m_total_value,(m_saved_value-m_total_value));
   }
+  void _checkNbAccess()
+  {
+    Integer nb_error = 0;
+    ENUMERATE_NODE(inode,m_mesh->allNodes()){
+      Integer n = m_node_nb_access[inode];
+      if (n!=1){
+        info() << "ERROR: bad nb_access for node=" << ItemPrinter(*inode) << " n=" << n;
+        ++nb_error;
+      }
+    }
+    if (nb_error!=0)
+      ARCANE_FATAL("Bad nb access nb_error={0}",nb_error);
+  }
   void _checkNbAccess(Integer nb_task)
   {
     Integer nb_error = 0;
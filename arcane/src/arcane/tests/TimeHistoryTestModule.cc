@@ -1,20 +1,23 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* TimeHistoryTestModule.cc                                    (C) 2000-2018 */
+/* TimeHistoryTestModule.cc                                    (C) 2000-2024 */
 /*                                                                           */
 /* Module de test de 'ITimeHistoryMng'.                                      */
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+#include "arcane/utils/FatalErrorException.h"
+
 #include "arcane/ITimeLoopMng.h"
 #include "arcane/ITimeHistoryMng.h"
 #include "arcane/ITimeHistoryTransformer.h"
 #include "arcane/ITimeHistoryCurveWriter2.h"
+#include "arcane/IParallelMng.h"
 
 #include "arcane/tests/TimeHistoryTest_axl.h"
 
@@ -111,6 +114,13 @@ class TimeHistoryTestModule
     void writeCurve(const TimeHistoryCurveInfo& infos) override
     {
       info() << "MY_CURVE=" << infos.name();
+      if (infos.name()=="ReducedNbRankCurve"){
+        // Chaque sous-domaine ajoute 1.0 donc la somme doit valoir le nombre de rangs.
+        Real nb_rank = static_cast<Real>(m_module->parallelMng()->commSize());
+        for( Real v : infos.values() )
+          if (v!=nb_rank)
+            ARCANE_FATAL("Bad reduced value v={0} expected={1}",v,nb_rank);
+      }
       if (infos.name().length()==6){
         String new_name = String("New") + infos.name();
         info() << "ADD_NEW_CURVE: " << new_name;
@@ -129,7 +139,34 @@ class TimeHistoryTestModule
     TimeHistoryTestModule* m_module;
   };
 
+  //! Ecrivain qui échoue systématiquement
+  class FailingWriter
+  : public ITimeHistoryCurveWriter2
+  {
+   public:
+    void build() override {}
+    void beginWrite(const TimeHistoryCurveWriterInfo& infos) override
+    { ARCANE_UNUSED(infos); }
+    void endWrite() override {}
+    void writeCurve(const TimeHistoryCurveInfo& infos) override
+    {
+      ARCANE_FATAL("Simulated write error for curve '{0}'",infos.name());
+    }
+    String name() const override { return "FailingWriter"; }
+    void setOutputPath(const String& path) override { m_output_path = path; }
+    String outputPath() const override { return m_output_path; }
+   private:
+    String m_output_path;
+  };
+
   std::map<String,CurveValues> m_curves;
+  UniqueArray<TimeHistoryCurveHandle> m_batched_handles;
+  UniqueArray<TimeHistoryCurveHandle> m_reduced_handles;
+
+ private:
+
+  void _addBatchedValues(Integer nb_iter,Real x);
+  void _testAsyncWriteError();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -201,6 +238,13 @@ computeLoop()
       thm->addValue(String("Curve")+i,((Real)x+(Real)i)*2.3);
   }
 
+  // Teste aussi l'écriture asynchrone des courbes.
+  if (nb_iter==50)
+    thm->setAsyncWrite(true);
+  if (nb_iter==60)
+    _testAsyncWriteError();
+  _addBatchedValues(nb_iter,x);
+
   // En fin de calcul, rÃ©cupÃ¨re les courbes et applique une transformation
   // pour les 10 premiÃ¨res courbes. La transformation consiste Ã  crÃ©er une
   // nouvelle courbe dont les valeurs sont deux fois celle de la courbe
@@ -217,6 +261,61 @@ computeLoop()
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
+/*!
+ * \brief Ajoute des valeurs via les courbes pré-enregistrées.
+ */
+void TimeHistoryTestModule::
+_addBatchedValues(Integer nb_iter,Real x)
+{
+  ITimeHistoryMng* thm = subDomain()->timeHistoryMng();
+  if (m_batched_handles.empty()){
+    m_batched_handles.add(thm->registerCurve("BatchedCurve1"));
+    m_batched_handles.add(thm->registerCurve("BatchedCurve2",2));
+    m_batched_handles.add(thm->registerCurve("BatchedCurve3",1,false));
+    m_reduced_handles.add(thm->registerCurve("ReducedNbRankCurve"));
+    m_reduced_handles.add(thm->registerCurve("ReducedRankSumCurve"));
+    // Enregistrer de nouveau une courbe doit retourner la même référence.
+    TimeHistoryCurveHandle h = thm->registerCurve("BatchedCurve2",2);
+    if (h.index()!=m_batched_handles[1].index())
+      ARCANE_FATAL("Bad handle for curve 'BatchedCurve2' index={0} expected={1}",
+                   h.index(),m_batched_handles[1].index());
+  }
+
+  RealUniqueArray values = { x, x * 2.0, x * 3.0, (Real)nb_iter };
+  thm->addValues(m_batched_handles,values);
+
+  IParallelMng* pm = parallelMng();
+  RealUniqueArray local_values = { 1.0, (Real)pm->commRank() };
+  thm->addReducedValues(Parallel::ReduceSum,m_reduced_handles,local_values);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie qu'une erreur lors de l'écriture asynchrone est signalée
+ * lors de la synchronisation suivante.
+ */
+void TimeHistoryTestModule::
+_testAsyncWriteError()
+{
+  ITimeHistoryMng* thm = subDomain()->timeHistoryMng();
+  FailingWriter writer;
+  thm->addCurveWriter(&writer);
+  thm->dumpHistory(false);
+  bool has_error = false;
+  try{
+    thm->setAsyncWrite(false);
+  }
+  catch(const FatalErrorException& ex){
+    info() << "Expected asynchronous write error: " << ex.message();
+    has_error = true;
+  }
+  thm->removeCurveWriter(&writer);
+  thm->setAsyncWrite(true);
+  // Seul le sous-domaine qui écrit les courbes peut avoir une erreur.
+  if (thm->isDumpActive() && subDomain()->allReplicaParallelMng()->isMasterIO() && !has_error)
+    ARCANE_FATAL("No error reported for asynchronous write with failing writer");
+}
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* UtilsUnitTest.cc                                            (C) 2000-2023 */
+/* UtilsUnitTest.cc                                            (C) 2000-2024 */
 /*                                                                           */
 /* Test des fonctions utilitaires de Arcane.                                 */
 /*---------------------------------------------------------------------------*/
@@ -837,7 +837,9 @@ _testHashAlgorithm()
     "SHA3_224HashAlgorithm",
     "SHA3_256HashAlgorithm",
     "SHA3_384HashAlgorithm",
-    "SHA3_512HashAlgorithm"
+    "SHA3_512HashAlgorithm",
+    "XXH3_64HashAlgorithm",
+    "XXH3_64TreeHashAlgorithm"
   };
   ServiceBuilder<IHashAlgorithm> builder(subDomain()->application());
   UniqueArray<Int32> test_values(12345);
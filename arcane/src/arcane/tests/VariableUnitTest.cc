@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableUnitTest.cc                                         (C) 2000-2023 */
+/* VariableUnitTest.cc                                         (C) 2000-2024 */
 /*                                                                           */
 /* Service de test des variables.                                            */
 /*---------------------------------------------------------------------------*/
@@ -103,6 +103,7 @@ class VariableUnitTest
   void _testUsed();
   void _testRefersTo();
   void _testSimpleView();
+  void _testFloat32View();
   void _checkException(Integer i);
   void _testAlignment();
   void _testSwap();
@@ -147,6 +148,7 @@ executeTest()
 {
   _testRefersTo();
   _testSimpleView();
+  _testFloat32View();
   _testUsed();
   _testSwap();
   _testAlignment();
@@ -403,6 +405,66 @@ _testSimpleView()
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*
+ * \brief Teste les vues avec conversion sur une variable 'Float32'.
+ */
+void VariableUnitTest::
+_testFloat32View()
+{
+  ValueChecker vc(A_FUNCINFO);
+
+  VariableCellFloat32 var1(VariableBuildInfo(mesh(),"CellFloat32Test1"));
+  VariableCellReal var2(VariableBuildInfo(mesh(),"CellRealTest3"));
+  vc.areEqual(var1.variable()->dataType(),DT_Float32,"Bad data type");
+  {
+    info() << A_FUNCINFO << " Test Float32 view Out/In";
+    auto v1 = viewOutAs<Real>(var1);
+    ENUMERATE_CELL(icell,allCells()){
+      v1[icell] = 0.5 + icell.itemLocalId();
+    }
+    auto v1_in = viewInAs<Real>(var1);
+    auto v2 = viewOut(var2);
+    ENUMERATE_CELL(icell,allCells()){
+      v2[icell] = v1_in[icell];
+    }
+    ENUMERATE_CELL(icell,allCells()){
+      vc.areEqual(var2[icell],0.5 + icell.itemLocalId(),"Bad values (1)");
+    }
+  }
+  {
+    info() << A_FUNCINFO << " Test Float32 view InOut";
+    auto v1 = viewInOutAs<Real>(var1);
+    ENUMERATE_CELL(icell,allCells()){
+      v1[icell] += 1.0;
+      v1[icell] *= 2.0;
+    }
+    ENUMERATE_CELL(icell,allCells()){
+      Float32 expected = static_cast<Float32>((1.5 + icell.itemLocalId()) * 2.0);
+      vc.areEqual(var1[icell],expected,"Bad values (2)");
+    }
+  }
+  {
+    info() << A_FUNCINFO << " Test Float32 synchronize";
+    // Seules les mailles propres sont modifiées. Les mailles fantômes
+    // doivent avoir la valeur de leur propriétaire après synchronisation.
+    auto v1 = viewOutAs<Real>(var1);
+    ENUMERATE_CELL(icell,allCells()){
+      v1[icell] = -1.0;
+    }
+    ENUMERATE_CELL(icell,ownCells()){
+      v1[icell] = 0.25 + static_cast<Real>(icell->uniqueId().asInt64());
+    }
+    var1.synchronize();
+    auto v1_in = viewInAs<Real>(var1);
+    ENUMERATE_CELL(icell,allCells()){
+      Real expected = 0.25 + static_cast<Real>(icell->uniqueId().asInt64());
+      vc.areEqual(v1_in[icell],static_cast<Real>(static_cast<Float32>(expected)),"Bad values after synchronize");
+    }
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
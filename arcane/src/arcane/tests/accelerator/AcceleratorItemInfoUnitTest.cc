@@ -12,6 +12,8 @@
 /*---------------------------------------------------------------------------*/
 
 #include "arcane/utils/ValueChecker.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ParallelLoopOptions.h"
 
 #include "arcane/core/BasicUnitTest.h"
 #include "arcane/core/ServiceFactory.h"
@@ -22,6 +24,7 @@
 
 #include "arcane/accelerator/core/IAcceleratorMng.h"
 #include "arcane/accelerator/core/RunQueue.h"
+#include "arcane/accelerator/core/Runner.h"
 
 #include "arcane/accelerator/RunCommandEnumerate.h"
 #include "arcane/accelerator/VariableViews.h"
@@ -55,6 +58,7 @@ class AcceleratorItemInfoUnitTest
 
   void _executeTest1();
   void _executeTest2();
+  void _executeTest3();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -83,6 +87,7 @@ executeTest()
 {
   _executeTest1();
   _executeTest2();
+  _executeTest3();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -181,6 +186,80 @@ _executeTest2()
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Teste le partitionneur ParallelLoopOptions::Partitioner::Weighted
+ * via RunCommand::setParallelLoopOptions() avec la politique eExecutionPolicy::Thread.
+ */
+void AcceleratorItemInfoUnitTest::
+_executeTest3()
+{
+  VariableCellInt32 var_nb_access(VariableBuildInfo(mesh(), "TestWeightedNbAccess"));
+  CellVectorView cells = allCells().view();
+  const Int32 nb_cell = cells.size();
+
+  // Coût variant d'un facteur 50 entre les mailles
+  UniqueArray<Real> costs(nb_cell);
+  UniqueArray<Real> cost_prefix_sum(nb_cell + 1);
+  cost_prefix_sum[0] = 0.0;
+  for (Int32 i = 0; i < nb_cell; ++i) {
+    costs[i] = ((i % 8) == 0) ? 50.0 : 1.0;
+    cost_prefix_sum[i + 1] = cost_prefix_sum[i] + costs[i];
+  }
+
+  ax::Runner runner(ax::eExecutionPolicy::Thread);
+  auto queue = makeQueue(runner);
+  for (Int32 i = 0; i < 2; ++i) {
+    var_nb_access.fill(0);
+    ParallelLoopOptions options;
+    options.setPartitioner(ParallelLoopOptions::Partitioner::Weighted);
+    if (i == 0)
+      options.setItemCosts(costs);
+    else
+      options.setItemCostPrefixSum(cost_prefix_sum);
+    {
+      auto command = makeCommand(queue);
+      command.setParallelLoopOptions(options);
+      if (!command.parallelLoopOptions().hasItemCosts())
+        ARCANE_FATAL("Item costs are not kept by the command");
+      auto inout_nb_access = viewInOut(command, var_nb_access);
+      command << RUNCOMMAND_ENUMERATE (Cell, vi, cells)
+      {
+        inout_nb_access[vi] = inout_nb_access[vi] + 1;
+      };
+    }
+    ENUMERATE_ (Cell, icell, allCells()) {
+      if (var_nb_access[icell] != 1)
+        ARCANE_FATAL("Bad nb access for cell uid={0} n={1}", icell->uniqueId(), var_nb_access[icell]);
+    }
+  }
+
+  // Vérifie que les coûts sont bien utilisés par la commande : un tableau
+  // trop petit doit provoquer une erreur.
+  if (nb_cell > 1) {
+    bool has_error = false;
+    ParallelLoopOptions options;
+    options.setPartitioner(ParallelLoopOptions::Partitioner::Weighted);
+    options.setItemCosts(costs.subConstView(0, nb_cell - 1));
+    try {
+      auto command = makeCommand(queue);
+      command.setParallelLoopOptions(options);
+      auto inout_nb_access = viewInOut(command, var_nb_access);
+      command << RUNCOMMAND_ENUMERATE (Cell, vi, cells)
+      {
+        inout_nb_access[vi] = inout_nb_access[vi] + 1;
+      };
+    }
+    catch (const FatalErrorException& ex) {
+      info() << "Expected error: " << ex.message();
+      has_error = true;
+    }
+    if (!has_error)
+      ARCANE_FATAL("Item costs with a bad size have not been detected");
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
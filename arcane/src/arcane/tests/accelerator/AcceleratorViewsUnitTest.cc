@@ -76,6 +76,7 @@ class AcceleratorViewsUnitTest
   void _executeTestMemoryCopy();
   void _executeTestVariableCopy();
   void _executeTestVariableFill();
+  void _executeTestFloat32View();
   void _checkResultReal2(Real to_add);
   void _checkResultReal3(Real to_add);
   void _checkResultReal2x2(Real to_add);
@@ -169,6 +170,7 @@ executeTest()
   _executeTestMemoryCopy();
   _executeTestVariableCopy();
   _executeTestVariableFill();
+  _executeTestFloat32View();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -698,6 +700,56 @@ _executeTestVariableFill()
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Teste les vues avec conversion sur une variable 'Float32'.
+ */
+void AcceleratorViewsUnitTest::
+_executeTestFloat32View()
+{
+  info() << "Execute Test Float32View";
+
+  ValueChecker vc(A_FUNCINFO);
+
+  auto queue = makeQueue(m_runner);
+  VariableCellFloat32 cell_float32(VariableBuildInfo(mesh(), "TestCellFloat32"));
+  VariableCellReal cell_real(VariableBuildInfo(mesh(), "TestCellRealFromFloat32"));
+
+  {
+    auto command = makeCommand(queue);
+    auto out_float32 = ax::viewOutAs<Real>(command, cell_float32);
+    command << RUNCOMMAND_ENUMERATE(Cell, vi, allCells())
+    {
+      out_float32[vi] = 0.5 + static_cast<Real>(vi.localId());
+    };
+  }
+  {
+    auto command = makeCommand(queue);
+    auto inout_float32 = ax::viewInOutAs<Real>(command, cell_float32);
+    command << RUNCOMMAND_ENUMERATE(Cell, vi, allCells())
+    {
+      Real v = inout_float32[vi];
+      inout_float32[vi] = v * 2.0;
+    };
+  }
+  {
+    auto command = makeCommand(queue);
+    auto in_float32 = ax::viewInAs<Real>(command, cell_float32);
+    auto out_real = ax::viewOut(command, cell_real);
+    command << RUNCOMMAND_ENUMERATE(Cell, vi, allCells())
+    {
+      out_real[vi] = in_float32[vi];
+    };
+  }
+
+  ENUMERATE_ (Cell, icell, allCells()) {
+    Real expected = (0.5 + static_cast<Real>(icell.itemLocalId())) * 2.0;
+    vc.areEqual(cell_real[icell], expected, "Bad Real value");
+    vc.areEqual(cell_float32[icell], static_cast<Float32>(expected), "Bad Float32 value");
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -43,6 +43,8 @@
 #include "arcane/materials/MeshEnvironmentVariableRef.h"
 #include "arcane/materials/EnvItemVector.h"
 #include "arcane/materials/CellToAllEnvCellConverter.h"
+#include "arcane/core/materials/CellMajorComponentIndex.h"
+#include "arcane/core/materials/CellMajorMaterialVariableScalar.h"
 
 #include "arcane/accelerator/core/Runner.h"
 #include "arcane/accelerator/core/IAcceleratorMng.h"
@@ -125,6 +127,12 @@ class MeshMaterialAcceleratorUnitTest
   void _executeTest3(Integer nb_z);
   void _executeTest4(Integer nb_z);
   void _executeTest5(Integer nb_z,MatCellVectorView mat);
+  void _executeTest6(Integer nb_z);
+  void _checkTest6Values(const char* name);
+  void _executeTest6Layouts();
+  void _executeTest7(Integer nb_z);
+  void _checkCellToAllEnvCellIndex();
+  void _checkCellToAllEnvCellIndexRecompute();
   void _checkEnvValues1();
   void _checkMatValues1();
   void _checkEnvironmentValues();
@@ -344,6 +352,12 @@ executeTest()
     IMeshMaterial* mat2 = env2->materials()[1];
     _executeTest5(nb_z,mat2->matView());
   }
+  {
+    _executeTest6(nb_z);
+  }
+  {
+    _executeTest7(nb_z);
+  }
 }
 
 /*---------------------------------------------------------------------------*/
@@ -819,6 +833,375 @@ void _checkOneValue(Real value,Real ref_value,const char* var_name)
 
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Test du stockage contigu par maille (CellMajorMaterialVariableScalar).
+ *
+ * Compare le parcours des milieux de chaque maille via les variables
+ * multi-matériaux avec le parcours via la copie contiguë. Les deux calculs
+ * sont faits avec la même file et seuls les noyaux de calcul sont comparés.
+ * Le coût de construction de la copie (recompute() et gather()) et de
+ * recopie du résultat (scatter()) est affiché séparément car il doit être
+ * amorti sur plusieurs calculs.
+ */
+void MeshMaterialAcceleratorUnitTest::
+_executeTest6(Integer nb_z)
+{
+  info() << "Execute Test 6";
+
+  // Ref CPU
+  {
+    CellToAllEnvCellConverter allenvcell_converter(m_mm_mng);
+    for (Integer z=0, iz=nb_z; z<iz; ++z) {
+      ENUMERATE_CELL(icell, allCells()) {
+        AllEnvCell all_env_cell = allenvcell_converter[*icell];
+        Real sum = 0.0;
+        ENUMERATE_CELL_ENVCELL(iev,all_env_cell) {
+          sum += m_mat_d_ref[iev];
+        }
+        ENUMERATE_CELL_ENVCELL(iev,all_env_cell) {
+          m_mat_a_ref[iev] = m_mat_d_ref[iev] * m_mat_e_ref[iev] - sum;
+        }
+      }
+    }
+  }
+
+  auto queue = makeQueue(m_runner);
+
+  // Accès direct aux variables multi-matériaux
+  m_mat_a.fill(0.0);
+  Real direct_time = 0.0;
+  {
+    m_mm_mng->enableCellToAllEnvCellForRunCommand(true,true);
+    CellToAllEnvCellAccessor cell2allenvcell(m_mm_mng);
+
+    auto cmd = makeCommand(queue);
+    auto out_a = ax::viewOut(cmd, m_mat_a);
+    auto in_d = ax::viewIn(cmd, m_mat_d);
+    auto in_e = ax::viewIn(cmd, m_mat_e);
+
+    Real begin_time = platform::getRealTime();
+    for (Integer z=0, iz=nb_z; z<iz; ++z) {
+      cmd << RUNCOMMAND_ENUMERATE_CELL_ALLENVCELL(cell2allenvcell, cid, allCells()) {
+        Real sum = 0.0;
+        ENUMERATE_CELL_ALLENVCELL(iev, cid, cell2allenvcell) {
+          sum += in_d[*iev];
+        }
+        ENUMERATE_CELL_ALLENVCELL(iev, cid, cell2allenvcell) {
+          out_a[*iev] = in_d[*iev] * in_e[*iev] - sum;
+        }
+      };
+    }
+    queue.barrier();
+    direct_time = platform::getRealTime() - begin_time;
+  }
+  _checkTest6Values("Test6_direct_mat_a");
+
+  // Copie contiguë par maille
+  m_mat_a.fill(0.0);
+  Real setup_time = 0.0;
+  Real packed_time = 0.0;
+  Real scatter_time = 0.0;
+  {
+    Real setup_begin_time = platform::getRealTime();
+    CellMajorComponentIndex index(m_mm_mng, MatVarSpace::Environment);
+    index.recompute();
+
+    CellMajorMaterialVariableScalar<Real> packed_a(index);
+    CellMajorMaterialVariableScalar<Real> packed_d(index);
+    CellMajorMaterialVariableScalar<Real> packed_e(index);
+    packed_a.gather(m_mat_a.materialVariable(), &queue);
+    packed_d.gather(m_mat_d.materialVariable(), &queue);
+    packed_e.gather(m_mat_e.materialVariable(), &queue);
+    queue.barrier();
+    setup_time = platform::getRealTime() - setup_begin_time;
+
+    {
+      auto cmd = makeCommand(queue);
+      auto out_a = ax::viewOut(cmd, packed_a);
+      auto in_d = ax::viewIn(cmd, packed_d);
+      auto in_e = ax::viewIn(cmd, packed_e);
+
+      Real begin_time = platform::getRealTime();
+      for (Integer z=0, iz=nb_z; z<iz; ++z) {
+        cmd << RUNCOMMAND_ENUMERATE(Cell, cid, allCells()) {
+          const Int32 begin = in_d.begin(cid);
+          const Int32 end = in_d.end(cid);
+          Real sum = 0.0;
+          for (Int32 i = begin; i < end; ++i)
+            sum += in_d[i];
+          for (Int32 i = begin; i < end; ++i)
+            out_a[i] = in_d[i] * in_e[i] - sum;
+        };
+      }
+      queue.barrier();
+      packed_time = platform::getRealTime() - begin_time;
+    }
+
+    Real scatter_begin_time = platform::getRealTime();
+    packed_a.scatter(m_mat_a.materialVariable(), &queue);
+    queue.barrier();
+    scatter_time = platform::getRealTime() - scatter_begin_time;
+  }
+  info() << "Test6 kernel time direct=" << direct_time << " packed=" << packed_time
+         << " (packed copy setup=" << setup_time << " scatter=" << scatter_time << ")";
+  _checkTest6Values("Test6_packed_mat_a");
+
+  _executeTest6Layouts();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Test du choix du stockage variable par variable.
+ *
+ * Effectue le calcul du test 6 pour toutes les combinaisons possibles:
+ * chacune des variables 'a', 'd' et 'e' est accédée soit directement
+ * (stockage par constituant) soit via sa copie contiguë par maille. Les
+ * deux types d'accès sont utilisés dans le même noyau de calcul via un même
+ * CellMajorComponentIndex. Cela n'utilise pas
+ * IMeshMaterialMng::enableCellToAllEnvCellForRunCommand().
+ */
+void MeshMaterialAcceleratorUnitTest::
+_executeTest6Layouts()
+{
+  auto queue = makeQueue(m_runner);
+
+  CellMajorComponentIndex index(m_mm_mng, MatVarSpace::Environment);
+  index.recompute();
+  CellMajorComponentIndexView index_view = index.view();
+
+  for (Int32 layout_mask = 0; layout_mask < 8; ++layout_mask) {
+    const bool is_packed_a = (layout_mask & 1);
+    const bool is_packed_d = (layout_mask & 2);
+    const bool is_packed_e = (layout_mask & 4);
+    info() << "Test6 layouts packed_a=" << is_packed_a << " packed_d=" << is_packed_d
+           << " packed_e=" << is_packed_e;
+
+    m_mat_a.fill(0.0);
+    CellMajorMaterialVariableScalar<Real> packed_a(index);
+    CellMajorMaterialVariableScalar<Real> packed_d(index);
+    CellMajorMaterialVariableScalar<Real> packed_e(index);
+    // La copie de 'a' est entièrement écrite par le calcul.
+    packed_a.gather(m_mat_a.materialVariable(), &queue);
+    if (is_packed_d)
+      packed_d.gather(m_mat_d.materialVariable(), &queue);
+    if (is_packed_e)
+      packed_e.gather(m_mat_e.materialVariable(), &queue);
+
+    {
+      auto cmd = makeCommand(queue);
+      auto out_a = ax::viewOut(cmd, m_mat_a);
+      auto in_d = ax::viewIn(cmd, m_mat_d);
+      auto in_e = ax::viewIn(cmd, m_mat_e);
+      auto packed_out_a = ax::viewOut(cmd, packed_a);
+      auto packed_in_d = ax::viewIn(cmd, packed_d);
+      auto packed_in_e = ax::viewIn(cmd, packed_e);
+
+      cmd << RUNCOMMAND_ENUMERATE(Cell, cid, allCells()) {
+        Real sum = 0.0;
+        ENUMERATE_CELL_COMPONENT_INDEX(iev, cid, index_view) {
+          sum += (is_packed_d) ? packed_in_d[iev.index()] : in_d[*iev];
+        }
+        ENUMERATE_CELL_COMPONENT_INDEX(iev, cid, index_view) {
+          Int32 i = iev.index();
+          Real d = (is_packed_d) ? packed_in_d[i] : in_d[*iev];
+          Real e = (is_packed_e) ? packed_in_e[i] : in_e[*iev];
+          Real v = d * e - sum;
+          if (is_packed_a)
+            packed_out_a[i] = v;
+          else
+            out_a[*iev] = v;
+        }
+      };
+    }
+
+    if (is_packed_a)
+      packed_a.scatter(m_mat_a.materialVariable(), &queue);
+    queue.barrier();
+    String name = String::format("Test6_layout{0}_mat_a", layout_mask);
+    _checkTest6Values(name.localstr());
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialAcceleratorUnitTest::
+_checkTest6Values(const char* name)
+{
+  ENUMERATE_ENV(ienv, m_mm_mng) {
+    IMeshEnvironment* env = *ienv;
+    ENUMERATE_ENVCELL(iev,env) {
+      _checkOneValue(m_mat_a[iev], m_mat_a_ref[iev], name);
+    }
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Test de l'index maille -> milieux géré par IMeshMaterialMng.
+ *
+ * Vérifie que l'index est utilisable dans un RUNCOMMAND_ENUMERATE via
+ * ENUMERATE_CELL_COMPONENT_INDEX et qu'il reste cohérent après une
+ * modification des matériaux.
+ */
+void MeshMaterialAcceleratorUnitTest::
+_executeTest7(Integer nb_z)
+{
+  info() << "Execute Test 7";
+
+  m_mm_mng->enableCellToAllEnvCellIndex(true);
+  _checkCellToAllEnvCellIndex();
+
+  MaterialVariableCellReal& b_ref(m_mat_b_ref);
+  MaterialVariableCellReal& c_ref(m_mat_c_ref);
+
+  // Ref CPU
+  for (Integer z=0, iz=nb_z; z<iz; ++z) {
+    CellToAllEnvCellConverter allenvcell_converter(m_mm_mng);
+    ENUMERATE_CELL(icell, allCells()) {
+      AllEnvCell all_env_cell = allenvcell_converter[*icell];
+      Real sum = 0.0;
+      ENUMERATE_CELL_ENVCELL(iev,all_env_cell) {
+        sum += b_ref[iev];
+      }
+      ENUMERATE_CELL_ENVCELL(iev,all_env_cell) {
+        c_ref[iev] = b_ref[iev] - sum;
+      }
+    }
+  }
+
+  // GPU
+  {
+    auto queue = makeQueue(m_runner);
+    auto cmd = makeCommand(queue);
+
+    auto in_b = ax::viewIn(cmd, m_mat_b);
+    auto out_c = ax::viewOut(cmd, m_mat_c);
+    CellMajorComponentIndexView index_view = m_mm_mng->cellToAllEnvCellIndex()->view();
+
+    for (Integer z=0, iz=nb_z; z<iz; ++z) {
+      cmd << RUNCOMMAND_ENUMERATE(Cell, cid, allCells()) {
+        Real sum = 0.0;
+        ENUMERATE_CELL_COMPONENT_INDEX(iev, cid, index_view) {
+          sum += in_b[*iev];
+        }
+        ENUMERATE_CELL_COMPONENT_INDEX(iev, cid, index_view) {
+          out_c[*iev] = in_b[*iev] - sum;
+        }
+      };
+    }
+  }
+
+  ENUMERATE_ENV(ienv, m_mm_mng) {
+    IMeshEnvironment* env = *ienv;
+    ENUMERATE_ENVCELL(iev,env) {
+      _checkOneValue(m_mat_c[iev], m_mat_c_ref[iev],"Test7_mat_c");
+    }
+  }
+
+  // Supprime le premier matériau du premier milieu d'une maille sur deux.
+  // Cela modifie le nombre de milieux de certaines mailles et transforme des
+  // mailles partielles en mailles pures.
+  {
+    IMeshMaterial* mat = m_mm_mng->environments()[0]->materials()[0];
+    Int32UniqueArray removed_ids;
+    ENUMERATE_MATCELL(imc, mat){
+      if ((imc.index() % 2) == 0)
+        removed_ids.add((*imc).globalCell().localId());
+    }
+    // La mise à jour incrémentale de l'index n'est utilisée que si les
+    // optimisations sont actives (ARCANE_MATERIAL_MODIFICATION_FLAGS=3).
+    int flags = m_mm_mng->modificationFlags();
+    bool is_incremental = (flags & (int)eModificationFlags::GenericOptimize) &&
+                          (flags & (int)eModificationFlags::OptimizeMultiAddRemove);
+    info() << "Test7 remove nb_cell=" << removed_ids.size() << " from material=" << mat->name()
+           << " modification_flags=" << flags << " is_incremental=" << is_incremental;
+    Materials::MeshMaterialModifier modifier(m_mm_mng);
+    modifier.removeCells(mat, removed_ids);
+  }
+  _checkCellToAllEnvCellIndex();
+  _checkCellToAllEnvCellIndexRecompute();
+
+  m_mm_mng->enableCellToAllEnvCellIndex(false);
+  if (m_mm_mng->cellToAllEnvCellIndex())
+    ARCANE_FATAL("Index should be null after disabling it");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie que IMeshMaterialMng::cellToAllEnvCellIndex() est
+ * cohérent avec les milieux de chaque maille.
+ */
+void MeshMaterialAcceleratorUnitTest::
+_checkCellToAllEnvCellIndex()
+{
+  ValueChecker vc(A_FUNCINFO);
+  const CellMajorComponentIndex* index = m_mm_mng->cellToAllEnvCellIndex();
+  if (!index)
+    ARCANE_FATAL("Null index");
+  CellMajorComponentIndexView index_view = index->view();
+  CellToAllEnvCellConverter allenvcell_converter(m_mm_mng);
+  ENUMERATE_CELL(icell, allCells()) {
+    AllEnvCell all_env_cell = allenvcell_converter[*icell];
+    CellLocalId cid(icell.itemLocalId());
+    vc.areEqual(index_view.nbComponent(cid), all_env_cell.nbEnvironment(), "NbEnvironment");
+    Int32 pos = index_view.begin(cid);
+    ENUMERATE_CELL_ENVCELL(iev,all_env_cell) {
+      EnvCell env_cell = *iev;
+      vc.areEqual(index_view.matVarIndex(pos), env_cell._varIndex(), "MatVarIndex");
+      vc.areEqual(index_view.componentId(pos), env_cell.environmentId(), "EnvironmentId");
+      ++pos;
+    }
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie que l'index courant, éventuellement mis à jour de manière
+ * incrémentale, est identique à celui obtenu par un recalcul complet.
+ */
+void MeshMaterialAcceleratorUnitTest::
+_checkCellToAllEnvCellIndexRecompute()
+{
+  ValueChecker vc(A_FUNCINFO);
+  // Recopie pour chaque maille le nombre de milieux puis, pour chaque milieu,
+  // le MatVarIndex et l'indice du milieu.
+  auto fill_values = [&](UniqueArray<Int32>& nb_components, UniqueArray<Int32>& values) {
+    CellMajorComponentIndexView index_view = m_mm_mng->cellToAllEnvCellIndex()->view();
+    ENUMERATE_CELL(icell, allCells()) {
+      CellLocalId cid(icell.itemLocalId());
+      nb_components.add(index_view.nbComponent(cid));
+      for (Int32 pos = index_view.begin(cid), end = index_view.end(cid); pos < end; ++pos) {
+        MatVarIndex mvi = index_view.matVarIndex(pos);
+        values.add(mvi.arrayIndex());
+        values.add(mvi.valueIndex());
+        values.add(index_view.componentId(pos));
+      }
+    }
+  };
+
+  UniqueArray<Int32> current_nb_component;
+  UniqueArray<Int32> current_values;
+  fill_values(current_nb_component, current_values);
+
+  // Désactive puis réactive l'index pour forcer un appel à recompute().
+  m_mm_mng->enableCellToAllEnvCellIndex(false);
+  m_mm_mng->enableCellToAllEnvCellIndex(true);
+
+  UniqueArray<Int32> ref_nb_component;
+  UniqueArray<Int32> ref_values;
+  fill_values(ref_nb_component, ref_values);
+
+  vc.areEqualArray(current_nb_component.constView(), ref_nb_component.constView(), "NbComponent");
+  vc.areEqualArray(current_values.constView(), ref_values.constView(), "Values");
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
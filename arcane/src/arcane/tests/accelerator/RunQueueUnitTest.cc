@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* RunQueueUnitTest.cc                                         (C) 2000-2023 */
+/* RunQueueUnitTest.cc                                         (C) 2000-2024 */
 /*                                                                           */
 /* Service de test unitaire des 'RunQueue'.                                  */
 /*---------------------------------------------------------------------------*/
@@ -21,9 +21,11 @@
 #include "arcane/accelerator/core/Runner.h"
 #include "arcane/accelerator/core/RunQueueEvent.h"
 #include "arcane/accelerator/core/IAcceleratorMng.h"
+#include "arcane/accelerator/core/Memory.h"
 
 #include "arcane/accelerator/NumArrayViews.h"
 #include "arcane/accelerator/RunCommandLoop.h"
+#include "arcane/accelerator/Reduce.h"
 
 #include <thread>
 #include <chrono>
@@ -63,6 +65,7 @@ class RunQueueUnitTest
   void _executeTest1(bool use_priority);
   void _executeTest2();
   void _executeTest3();
+  void _executeTest4();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -111,6 +114,7 @@ executeTest()
   _executeTest1(false);
   _executeTest1(true);
   _executeTest3();
+  _executeTest4();
   m_runner->setConcurrentQueueCreation(old_v);
 }
 
@@ -267,6 +271,55 @@ _executeTest3()
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+// Test l'ordre des commandes, des copies et des réductions sur une file asynchrone.
+void RunQueueUnitTest::
+_executeTest4()
+{
+  info() << "Test4: async commands with copy and reduction";
+  ValueChecker vc(A_FUNCINFO);
+
+  auto queue{ makeQueue(*m_runner) };
+  queue.setAsync(true);
+
+  Integer nb_value = 100000;
+  NumArray<Int64, MDDim1> values(nb_value);
+  NumArray<Int64, MDDim1> copied_values(nb_value);
+  {
+    auto command = makeCommand(queue);
+    auto v = viewOut(command, values);
+    command << RUNCOMMAND_LOOP1 (iter, nb_value)
+    {
+      auto [i] = iter();
+      v(iter) = i + 1;
+    };
+  }
+  // La copie asynchrone doit avoir lieu après la commande précédente.
+  queue.copyMemory(ax::MemoryCopyArgs(copied_values.bytes(), values.bytes()).addAsync());
+  Int64 sum = 0;
+  {
+    auto command = makeCommand(queue);
+    ax::ReducerSum<Int64> reducer(command);
+    auto v = viewInOut(command, values);
+    command << RUNCOMMAND_LOOP1 (iter, nb_value)
+    {
+      reducer.add(v(iter));
+      v(iter) = v(iter) * 2;
+    };
+    // La réduction doit attendre la fin de la commande.
+    sum = reducer.reduce();
+  }
+  queue.barrier();
+
+  Int64 n = nb_value;
+  vc.areEqual(sum, (n * (n + 1)) / 2, "Bad sum");
+  for (Integer i = 0; i < nb_value; ++i) {
+    vc.areEqual(copied_values(i), (Int64)(i + 1), "Bad copied value");
+    vc.areEqual(values(i), (Int64)(2 * (i + 1)), "Bad value");
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
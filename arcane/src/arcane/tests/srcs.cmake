@@ -18,6 +18,7 @@ set(ARCANE_SOURCES
   ModuleSimpleHydroDepend.cc
   MeshMergeBoundariesUnitTest.cc
   MeshMergeNodesUnitTest.cc
+  MeshLocalityUnitTest.cc
   MeshUnitTest.cc
   MultipleMeshUnitTest.cc
   ThreadUnitTest.cc
@@ -52,6 +53,8 @@ set(ARCANE_SOURCES
   ParallelMngDataTypeTest.cc
   SingletonServiceTestModule.cc
   TimeHistoryTestModule.cc
+  ConcurrentEntryPointTestModule.cc
+  BackwardMngTestModule.cc
   MeshModificationTester.cc
   DirectedGraphUnitTest.cc
   ExchangeItemsUnitTest.cc
@@ -103,6 +106,8 @@ set(AXL_FILES
   VoronoiTest
   SingletonServiceTest
   TimeHistoryTest
+  ConcurrentEntryPointTest
+  BackwardMngTest
   MeshModificationTester
   DirectedGraphUnitTest
   ExchangeItemsUnitTest
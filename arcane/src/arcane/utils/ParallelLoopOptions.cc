@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelLoopOptions.cc                                      (C) 2000-2022 */
+/* ParallelLoopOptions.cc                                      (C) 2000-2024 */
 /*                                                                           */
 /* Options de configuration pour les boucles parallèles en multi-thread.     */
 /*---------------------------------------------------------------------------*/
@@ -35,6 +35,8 @@ namespace
       return "static";
     case ParallelLoopOptions::Partitioner::Deterministic:
       return "deterministic";
+    case ParallelLoopOptions::Partitioner::Weighted:
+      return "weighted";
     case ParallelLoopOptions::Partitioner::Auto:
       return "auto";
     }
@@ -48,9 +50,11 @@ namespace
       return ParallelLoopOptions::Partitioner::Static;
     if (str == "deterministic")
       return ParallelLoopOptions::Partitioner::Deterministic;
+    if (str == "weighted")
+      return ParallelLoopOptions::Partitioner::Weighted;
     if (str == "auto")
       return ParallelLoopOptions::Partitioner::Auto;
-    ARCANE_FATAL("Bad value '{0}' for partitioner. Valid values are 'auto', 'static' or 'deterministic'", str);
+    ARCANE_FATAL("Bad value '{0}' for partitioner. Valid values are 'auto', 'static', 'deterministic' or 'weighted'", str);
   }
 } // namespace
 
@@ -68,7 +72,7 @@ _applyPropertyVisitor(V& p)
        .addSetter([](auto a) { a.x.setGrainSize(a.v); });
 
   p << b.addString("ParallelLoopPartitioner")
-       .addDescription("Partitioner for the loop (auto, static or deterministic)")
+       .addDescription("Partitioner for the loop (auto, static, deterministic or weighted)")
        .addCommandLineArgument("ParallelLoopPartitioner")
        .addGetter([](auto a) { return _partitionerToString(a.x.partitioner()); })
        .addSetter([](auto a) { a.x.setPartitioner(_stringToPartitioner(a.v)); });
@@ -82,6 +86,31 @@ ARCANE_REGISTER_PROPERTY_CLASS(ParallelLoopOptions, ());
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void ParallelLoopOptions::
+_checkItemCosts(ConstArrayView<Real> costs)
+{
+  // Un coût négatif rend la somme préfixe non monotone et le découpage
+  // par recherche dichotomique de Partitioner::Weighted invalide.
+  for (Integer i = 0, n = costs.size(); i < n; ++i)
+    if (costs[i] < 0.0)
+      ARCANE_FATAL("Invalid negative cost '{0}' for iteration '{1}'", costs[i], i);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ParallelLoopOptions::
+_checkItemCostPrefixSum(ConstArrayView<Real> prefix_sum)
+{
+  for (Integer i = 1, n = prefix_sum.size(); i < n; ++i)
+    if (prefix_sum[i] < prefix_sum[i - 1])
+      ARCANE_FATAL("Invalid decreasing cost prefix sum at index '{0}' ({1} < {2})",
+                   i, prefix_sum[i], prefix_sum[i - 1]);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // End namespace Arcane
 
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ParallelLoopOptions.h                                       (C) 2000-2022 */
+/* ParallelLoopOptions.h                                       (C) 2000-2024 */
 /*                                                                           */
 /* Options de configuration pour les boucles parallèles en multi-thread.     */
 /*---------------------------------------------------------------------------*/
@@ -16,6 +16,7 @@
 
 #include "arcane/utils/UtilsTypes.h"
 #include "arcane/utils/PropertyDeclarations.h"
+#include "arcane/utils/ArrayView.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -43,7 +44,8 @@ class ARCANE_UTILS_EXPORT ParallelLoopOptions
   {
     SF_MaxThread = 1,
     SF_GrainSize = 2,
-    SF_Partitioner = 4
+    SF_Partitioner = 4,
+    SF_ItemCosts = 8
   };
 
  public:
@@ -74,7 +76,25 @@ class ARCANE_UTILS_EXPORT ParallelLoopOptions
      * \note Actuellement ce mode de partitionnement n'est disponible que
      * pour la parallélisation des boucles 1D.
      */
-    Deterministic = 2
+    Deterministic = 2,
+    /*!
+     * \brief Utilise un partitionnement basé sur le coût des itérations.
+     *
+     * Dans ce mode, les intervalles d'itération sont découpés pour avoir
+     * un coût équivalent et non pas un nombre d'itérations équivalent.
+     * Le coût des itérations est spécifié via setItemCosts() ou
+     * setItemCostPrefixSum(). L'ordonnancement est dynamique et un intervalle
+     * n'est découpé que si un thread est inoccupé (vol de tâche).
+     *
+     * Ce mode est utile lorsque le coût de chaque itération est très variable,
+     * par exemple pour les boucles sur les mailles mixtes.
+     *
+     * Si aucun coût n'est spécifié, ce mode est équivalent à Partitioner::Auto.
+     *
+     * \note Actuellement ce mode de partitionnement n'est disponible que
+     * pour la parallélisation des boucles 1D.
+     */
+    Weighted = 3
   };
 
  public:
@@ -127,6 +147,54 @@ class ARCANE_UTILS_EXPORT ParallelLoopOptions
   //! Indique si grainSize() est positionné
   bool hasPartitioner() const { return m_flags & SF_Partitioner; }
 
+  /*!
+   * \brief Positionne le coût de chaque itération pour Partitioner::Weighted.
+   *
+   * \a costs[i] est le coût de la i-ème itération de la boucle (l'indice
+   * 0 correspondant à la première itération) et doit être positif ou nul.
+   * Pour les boucles sur les entités, il s'agit du coût de la i-ème entité
+   * de la vue. En mode vérification, un coût négatif provoque une
+   * erreur fatale.
+   *
+   * L'instance conserve uniquement une vue sur \a costs qui doit donc
+   * rester valide pendant l'exécution de la boucle. Il est préférable
+   * d'utiliser setItemCostPrefixSum() si les coûts sont utilisés pour
+   * plusieurs boucles car la somme préfixe est alors calculée une seule fois.
+   */
+  void setItemCosts(ConstArrayView<Real> costs)
+  {
+    if (arcaneIsCheck())
+      _checkItemCosts(costs);
+    m_item_costs = costs;
+    m_item_cost_prefix_sum = ConstArrayView<Real>();
+    m_flags |= SF_ItemCosts;
+  }
+  /*!
+   * \brief Positionne la somme préfixe des coûts des itérations pour Partitioner::Weighted.
+   *
+   * \a prefix_sum doit avoir une taille égale au nombre d'itérations plus un,
+   * avec \a prefix_sum[i] le coût cumulé des \a i premières itérations
+   * (et donc \a prefix_sum[0] vaut 0). En mode vérification, une somme
+   * préfixe décroissante provoque une erreur fatale.
+   *
+   * L'instance conserve uniquement une vue sur \a prefix_sum qui doit donc
+   * rester valide pendant l'exécution de la boucle.
+   */
+  void setItemCostPrefixSum(ConstArrayView<Real> prefix_sum)
+  {
+    if (arcaneIsCheck())
+      _checkItemCostPrefixSum(prefix_sum);
+    m_item_cost_prefix_sum = prefix_sum;
+    m_item_costs = ConstArrayView<Real>();
+    m_flags |= SF_ItemCosts;
+  }
+  //! Coût de chaque itération (peut être vide)
+  ConstArrayView<Real> itemCosts() const { return m_item_costs; }
+  //! Somme préfixe des coûts des itérations (peut être vide)
+  ConstArrayView<Real> itemCostPrefixSum() const { return m_item_cost_prefix_sum; }
+  //! Indique si les coûts des itérations sont positionnés
+  bool hasItemCosts() const { return m_flags & SF_ItemCosts; }
+
  public:
 
   //! Fusionne les valeurs non modifiées de l'instance par celles de \a po.
@@ -138,6 +206,11 @@ class ARCANE_UTILS_EXPORT ParallelLoopOptions
       setGrainSize(po.grainSize());
     if (!hasPartitioner())
       setPartitioner(po.partitioner());
+    if (!hasItemCosts() && po.hasItemCosts()) {
+      m_item_costs = po.itemCosts();
+      m_item_cost_prefix_sum = po.itemCostPrefixSum();
+      m_flags |= SF_ItemCosts;
+    }
   }
 
  private:
@@ -148,8 +221,17 @@ class ARCANE_UTILS_EXPORT ParallelLoopOptions
   Int32 m_max_thread = -1;
   //!< Type de partitionneur.
   Partitioner m_partitioner = Partitioner::Auto;
+  //! Coût des itérations pour Partitioner::Weighted
+  ConstArrayView<Real> m_item_costs;
+  //! Somme préfixe du coût des itérations pour Partitioner::Weighted
+  ConstArrayView<Real> m_item_cost_prefix_sum;
 
   unsigned int m_flags = 0;
+
+ private:
+
+  static void _checkItemCosts(ConstArrayView<Real> costs);
+  static void _checkItemCostPrefixSum(ConstArrayView<Real> prefix_sum);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,864 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* XXH3HashAlgorithm.cc                                        (C) 2000-2024 */
+/*                                                                           */
+/* Calcule la fonction de hashage non cryptographique XXH3 (64 bits).        */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/XXH3HashAlgorithm.h"
+
+#include "arcane/utils/Array.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ConcurrencyUtils.h"
+#include "arcane/utils/RangeFunctor.h"
+#include "arcane/utils/ParallelLoopOptions.h"
+#include "arcane/utils/Ref.h"
+
+#include <cstring>
+
+// L'algorithme est décrit ici:
+// https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+//
+// Cette implémentation suit la version de référence (XXH3_64bits() sans
+// graine et avec le secret par défaut) de la bibliothèque xxHash:
+//
+// Copyright (C) 2019-2021 Yann Collet
+// BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+//
+// Comme pour les autres algorithmes de hashage de Arcane, on suppose que
+// la machine est little-endian.
+
+#if (defined(_M_X64) || defined(__x86_64__)) && !defined(ARCANE_NO_SSE)
+#if defined(__AVX2__)
+#define ARCANE_XXH3_USE_AVX2
+#include <immintrin.h>
+#else
+#define ARCANE_XXH3_USE_SSE2
+#include <emmintrin.h>
+#endif
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::XXH3Algorithm
+{
+
+namespace
+{
+  constexpr UInt64 PRIME32_1 = 0x9E3779B1U;
+  constexpr UInt64 PRIME32_2 = 0x85EBCA77U;
+  constexpr UInt64 PRIME32_3 = 0xC2B2AE3DU;
+  constexpr UInt64 PRIME64_1 = 0x9E3779B185EBCA87ULL;
+  constexpr UInt64 PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+  constexpr UInt64 PRIME64_3 = 0x165667B19E3779F9ULL;
+  constexpr UInt64 PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+  constexpr UInt64 PRIME64_5 = 0x27D4EB2F165667C5ULL;
+  constexpr UInt64 PRIME_MX1 = 0x165667919E3779F9ULL;
+  constexpr UInt64 PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+  constexpr Int64 STRIPE_LEN = 64;
+  constexpr Int64 SECRET_CONSUME_RATE = 8;
+  constexpr Int64 ACC_NB = STRIPE_LEN / sizeof(UInt64);
+  constexpr Int64 SECRET_SIZE = 192;
+  constexpr Int64 SECRET_SIZE_MIN = 136;
+  constexpr Int64 SECRET_LIMIT = SECRET_SIZE - STRIPE_LEN;
+  constexpr Int64 NB_STRIPES_PER_BLOCK = SECRET_LIMIT / SECRET_CONSUME_RATE;
+  constexpr Int64 BLOCK_LEN = STRIPE_LEN * NB_STRIPES_PER_BLOCK;
+  constexpr Int64 MIDSIZE_MAX = 240;
+  constexpr Int64 MIDSIZE_STARTOFFSET = 3;
+  constexpr Int64 MIDSIZE_LASTOFFSET = 17;
+  constexpr Int64 SECRET_LASTACC_START = 7;
+  constexpr Int64 SECRET_MERGEACCS_START = 11;
+  constexpr Int64 INTERNAL_BUFFER_SIZE = 256;
+  constexpr Int64 INTERNAL_BUFFER_STRIPES = INTERNAL_BUFFER_SIZE / STRIPE_LEN;
+
+  //! Secret par défaut
+  alignas(64) const std::byte kSecret[SECRET_SIZE] = {
+#define B(x) std::byte{ x }
+    B(0xb8), B(0xfe), B(0x6c), B(0x39), B(0x23), B(0xa4), B(0x4b), B(0xbe), B(0x7c), B(0x01), B(0x81), B(0x2c), B(0xf7), B(0x21), B(0xad), B(0x1c),
+    B(0xde), B(0xd4), B(0x6d), B(0xe9), B(0x83), B(0x90), B(0x97), B(0xdb), B(0x72), B(0x40), B(0xa4), B(0xa4), B(0xb7), B(0xb3), B(0x67), B(0x1f),
+    B(0xcb), B(0x79), B(0xe6), B(0x4e), B(0xcc), B(0xc0), B(0xe5), B(0x78), B(0x82), B(0x5a), B(0xd0), B(0x7d), B(0xcc), B(0xff), B(0x72), B(0x21),
+    B(0xb8), B(0x08), B(0x46), B(0x74), B(0xf7), B(0x43), B(0x24), B(0x8e), B(0xe0), B(0x35), B(0x90), B(0xe6), B(0x81), B(0x3a), B(0x26), B(0x4c),
+    B(0x3c), B(0x28), B(0x52), B(0xbb), B(0x91), B(0xc3), B(0x00), B(0xcb), B(0x88), B(0xd0), B(0x65), B(0x8b), B(0x1b), B(0x53), B(0x2e), B(0xa3),
+    B(0x71), B(0x64), B(0x48), B(0x97), B(0xa2), B(0x0d), B(0xf9), B(0x4e), B(0x38), B(0x19), B(0xef), B(0x46), B(0xa9), B(0xde), B(0xac), B(0xd8),
+    B(0xa8), B(0xfa), B(0x76), B(0x3f), B(0xe3), B(0x9c), B(0x34), B(0x3f), B(0xf9), B(0xdc), B(0xbb), B(0xc7), B(0xc7), B(0x0b), B(0x4f), B(0x1d),
+    B(0x8a), B(0x51), B(0xe0), B(0x4b), B(0xcd), B(0xb4), B(0x59), B(0x31), B(0xc8), B(0x9f), B(0x7e), B(0xc9), B(0xd9), B(0x78), B(0x73), B(0x64),
+    B(0xea), B(0xc5), B(0xac), B(0x83), B(0x34), B(0xd3), B(0xeb), B(0xc3), B(0xc5), B(0x81), B(0xa0), B(0xff), B(0xfa), B(0x13), B(0x63), B(0xeb),
+    B(0x17), B(0x0d), B(0xdd), B(0x51), B(0xb7), B(0xf0), B(0xda), B(0x49), B(0xd3), B(0x16), B(0x55), B(0x26), B(0x29), B(0xd4), B(0x68), B(0x9e),
+    B(0x2b), B(0x16), B(0xbe), B(0x58), B(0x7d), B(0x47), B(0xa1), B(0xfc), B(0x8f), B(0xf8), B(0xb8), B(0xd1), B(0x7a), B(0xd0), B(0x31), B(0xce),
+    B(0x45), B(0xcb), B(0x3a), B(0x8f), B(0x95), B(0x16), B(0x04), B(0x28), B(0xaf), B(0xd7), B(0xfb), B(0xca), B(0xbb), B(0x4b), B(0x40), B(0x7e),
+#undef B
+  };
+
+  inline UInt32 _readLE32(const std::byte* p)
+  {
+    UInt32 v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+  }
+
+  inline UInt64 _readLE64(const std::byte* p)
+  {
+    UInt64 v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+  }
+
+  inline UInt32 _swap32(UInt32 x)
+  {
+    return ((x << 24) & 0xff000000) | ((x << 8) & 0x00ff0000) |
+    ((x >> 8) & 0x0000ff00) | ((x >> 24) & 0x000000ff);
+  }
+
+  inline UInt64 _swap64(UInt64 x)
+  {
+    return (static_cast<UInt64>(_swap32(static_cast<UInt32>(x))) << 32) |
+    static_cast<UInt64>(_swap32(static_cast<UInt32>(x >> 32)));
+  }
+
+  inline UInt64 _rotl64(UInt64 x, int r)
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  inline UInt64 _xorshift64(UInt64 v, int shift)
+  {
+    return v ^ (v >> shift);
+  }
+
+  //! Multiplie \a lhs par \a rhs sur 128 bits et retourne le xor des deux moitiés.
+  inline UInt64 _mul128Fold64(UInt64 lhs, UInt64 rhs)
+  {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using UInt128 = unsigned __int128;
+    UInt128 product = static_cast<UInt128>(lhs) * static_cast<UInt128>(rhs);
+    return static_cast<UInt64>(product) ^ static_cast<UInt64>(product >> 64);
+#else
+    const UInt64 mask = 0xFFFFFFFFULL;
+    UInt64 lo_lo = (lhs & mask) * (rhs & mask);
+    UInt64 hi_lo = (lhs >> 32) * (rhs & mask);
+    UInt64 lo_hi = (lhs & mask) * (rhs >> 32);
+    UInt64 hi_hi = (lhs >> 32) * (rhs >> 32);
+    UInt64 cross = (lo_lo >> 32) + (hi_lo & mask) + lo_hi;
+    UInt64 upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+    UInt64 lower = (cross << 32) | (lo_lo & mask);
+    return lower ^ upper;
+#endif
+  }
+
+  inline UInt64 _xxh64Avalanche(UInt64 h)
+  {
+    h ^= h >> 33;
+    h *= PRIME64_2;
+    h ^= h >> 29;
+    h *= PRIME64_3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  inline UInt64 _avalanche(UInt64 h)
+  {
+    h = _xorshift64(h, 37);
+    h *= PRIME_MX1;
+    h = _xorshift64(h, 32);
+    return h;
+  }
+
+  inline UInt64 _rrmxmx(UInt64 h, UInt64 len)
+  {
+    h ^= _rotl64(h, 49) ^ _rotl64(h, 24);
+    h *= PRIME_MX2;
+    h ^= (h >> 35) + len;
+    h *= PRIME_MX2;
+    return _xorshift64(h, 28);
+  }
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+
+  UInt64 _hashLen1To3(const std::byte* input, UInt64 len)
+  {
+    UInt32 c1 = std::to_integer<UInt32>(input[0]);
+    UInt32 c2 = std::to_integer<UInt32>(input[len >> 1]);
+    UInt32 c3 = std::to_integer<UInt32>(input[len - 1]);
+    UInt32 combined = (c1 << 16) | (c2 << 24) | (c3 << 0) | (static_cast<UInt32>(len) << 8);
+    UInt64 bitflip = (_readLE32(kSecret) ^ _readLE32(kSecret + 4));
+    return _xxh64Avalanche(static_cast<UInt64>(combined) ^ bitflip);
+  }
+
+  UInt64 _hashLen4To8(const std::byte* input, UInt64 len)
+  {
+    UInt32 input1 = _readLE32(input);
+    UInt32 input2 = _readLE32(input + len - 4);
+    UInt64 bitflip = (_readLE64(kSecret + 8) ^ _readLE64(kSecret + 16));
+    UInt64 input64 = input2 + (static_cast<UInt64>(input1) << 32);
+    return _rrmxmx(input64 ^ bitflip, len);
+  }
+
+  UInt64 _hashLen9To16(const std::byte* input, UInt64 len)
+  {
+    UInt64 bitflip1 = (_readLE64(kSecret + 24) ^ _readLE64(kSecret + 32));
+    UInt64 bitflip2 = (_readLE64(kSecret + 40) ^ _readLE64(kSecret + 48));
+    UInt64 input_lo = _readLE64(input) ^ bitflip1;
+    UInt64 input_hi = _readLE64(input + len - 8) ^ bitflip2;
+    UInt64 acc = len + _swap64(input_lo) + input_hi + _mul128Fold64(input_lo, input_hi);
+    return _avalanche(acc);
+  }
+
+  UInt64 _hashLen0To16(const std::byte* input, UInt64 len)
+  {
+    if (len > 8)
+      return _hashLen9To16(input, len);
+    if (len >= 4)
+      return _hashLen4To8(input, len);
+    if (len > 0)
+      return _hashLen1To3(input, len);
+    return _xxh64Avalanche(_readLE64(kSecret + 56) ^ _readLE64(kSecret + 64));
+  }
+
+  inline UInt64 _mix16B(const std::byte* input, const std::byte* secret)
+  {
+    UInt64 input_lo = _readLE64(input);
+    UInt64 input_hi = _readLE64(input + 8);
+    return _mul128Fold64(input_lo ^ _readLE64(secret), input_hi ^ _readLE64(secret + 8));
+  }
+
+  UInt64 _hashLen17To128(const std::byte* input, UInt64 len)
+  {
+    UInt64 acc = len * PRIME64_1;
+    if (len > 32) {
+      if (len > 64) {
+        if (len > 96) {
+          acc += _mix16B(input + 48, kSecret + 96);
+          acc += _mix16B(input + len - 64, kSecret + 112);
+        }
+        acc += _mix16B(input + 32, kSecret + 64);
+        acc += _mix16B(input + len - 48, kSecret + 80);
+      }
+      acc += _mix16B(input + 16, kSecret + 32);
+      acc += _mix16B(input + len - 32, kSecret + 48);
+    }
+    acc += _mix16B(input + 0, kSecret + 0);
+    acc += _mix16B(input + len - 16, kSecret + 16);
+    return _avalanche(acc);
+  }
+
+  UInt64 _hashLen129To240(const std::byte* input, UInt64 len)
+  {
+    UInt64 acc = len * PRIME64_1;
+    const Int64 nb_round = static_cast<Int64>(len) / 16;
+    for (Int64 i = 0; i < 8; ++i)
+      acc += _mix16B(input + (16 * i), kSecret + (16 * i));
+    UInt64 acc_end = _mix16B(input + len - 16, kSecret + SECRET_SIZE_MIN - MIDSIZE_LASTOFFSET);
+    acc = _avalanche(acc);
+    for (Int64 i = 8; i < nb_round; ++i)
+      acc_end += _mix16B(input + (16 * i), kSecret + (16 * (i - 8)) + MIDSIZE_STARTOFFSET);
+    return _avalanche(acc + acc_end);
+  }
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+  /*
+   * Boucles internes pour les données de plus de MIDSIZE_MAX octets.
+   *
+   * L'état est constitué de ACC_NB accumulateurs de 64 bits qui sont
+   * traités par bandes (stripe) de STRIPE_LEN octets. Ces boucles
+   * représentent l'essentiel du temps de calcul pour les gros tableaux et
+   * sont donc vectorisées si possible.
+   */
+
+#if defined(ARCANE_XXH3_USE_AVX2)
+
+  inline void _accumulate512(UInt64* acc, const std::byte* input, const std::byte* secret)
+  {
+    auto* xacc = reinterpret_cast<__m256i*>(acc);
+    auto* xinput = reinterpret_cast<const __m256i*>(input);
+    auto* xsecret = reinterpret_cast<const __m256i*>(secret);
+    for (Int64 i = 0; i < STRIPE_LEN / Int64(sizeof(__m256i)); ++i) {
+      __m256i data_vec = _mm256_loadu_si256(xinput + i);
+      __m256i key_vec = _mm256_loadu_si256(xsecret + i);
+      __m256i data_key = _mm256_xor_si256(data_vec, key_vec);
+      __m256i data_key_lo = _mm256_srli_epi64(data_key, 32);
+      __m256i product = _mm256_mul_epu32(data_key, data_key_lo);
+      __m256i data_swap = _mm256_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+      __m256i sum = _mm256_add_epi64(_mm256_load_si256(xacc + i), data_swap);
+      _mm256_store_si256(xacc + i, _mm256_add_epi64(product, sum));
+    }
+  }
+
+  inline void _scrambleAcc(UInt64* acc, const std::byte* secret)
+  {
+    auto* xacc = reinterpret_cast<__m256i*>(acc);
+    auto* xsecret = reinterpret_cast<const __m256i*>(secret);
+    const __m256i prime32 = _mm256_set1_epi32(static_cast<int>(PRIME32_1));
+    for (Int64 i = 0; i < STRIPE_LEN / Int64(sizeof(__m256i)); ++i) {
+      __m256i acc_vec = _mm256_load_si256(xacc + i);
+      __m256i shifted = _mm256_srli_epi64(acc_vec, 47);
+      __m256i data_vec = _mm256_xor_si256(acc_vec, shifted);
+      __m256i key_vec = _mm256_loadu_si256(xsecret + i);
+      __m256i data_key = _mm256_xor_si256(data_vec, key_vec);
+      __m256i data_key_hi = _mm256_srli_epi64(data_key, 32);
+      __m256i prod_lo = _mm256_mul_epu32(data_key, prime32);
+      __m256i prod_hi = _mm256_mul_epu32(data_key_hi, prime32);
+      _mm256_store_si256(xacc + i, _mm256_add_epi64(prod_lo, _mm256_slli_epi64(prod_hi, 32)));
+    }
+  }
+
+#elif defined(ARCANE_XXH3_USE_SSE2)
+
+  inline void _accumulate512(UInt64* acc, const std::byte* input, const std::byte* secret)
+  {
+    auto* xacc = reinterpret_cast<__m128i*>(acc);
+    auto* xinput = reinterpret_cast<const __m128i*>(input);
+    auto* xsecret = reinterpret_cast<const __m128i*>(secret);
+    for (Int64 i = 0; i < STRIPE_LEN / Int64(sizeof(__m128i)); ++i) {
+      __m128i data_vec = _mm_loadu_si128(xinput + i);
+      __m128i key_vec = _mm_loadu_si128(xsecret + i);
+      __m128i data_key = _mm_xor_si128(data_vec, key_vec);
+      __m128i data_key_lo = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+      __m128i product = _mm_mul_epu32(data_key, data_key_lo);
+      __m128i data_swap = _mm_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+      __m128i sum = _mm_add_epi64(_mm_load_si128(xacc + i), data_swap);
+      _mm_store_si128(xacc + i, _mm_add_epi64(product, sum));
+    }
+  }
+
+  inline void _scrambleAcc(UInt64* acc, const std::byte* secret)
+  {
+    auto* xacc = reinterpret_cast<__m128i*>(acc);
+    auto* xsecret = reinterpret_cast<const __m128i*>(secret);
+    const __m128i prime32 = _mm_set1_epi32(static_cast<int>(PRIME32_1));
+    for (Int64 i = 0; i < STRIPE_LEN / Int64(sizeof(__m128i)); ++i) {
+      __m128i acc_vec = _mm_load_si128(xacc + i);
+      __m128i shifted = _mm_srli_epi64(acc_vec, 47);
+      __m128i data_vec = _mm_xor_si128(acc_vec, shifted);
+      __m128i key_vec = _mm_loadu_si128(xsecret + i);
+      __m128i data_key = _mm_xor_si128(data_vec, key_vec);
+      __m128i data_key_hi = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+      __m128i prod_lo = _mm_mul_epu32(data_key, prime32);
+      __m128i prod_hi = _mm_mul_epu32(data_key_hi, prime32);
+      _mm_store_si128(xacc + i, _mm_add_epi64(prod_lo, _mm_slli_epi64(prod_hi, 32)));
+    }
+  }
+
+#else
+
+  inline void _accumulate512(UInt64* acc, const std::byte* input, const std::byte* secret)
+  {
+    for (Int64 i = 0; i < ACC_NB; ++i) {
+      UInt64 data_val = _readLE64(input + i * 8);
+      UInt64 data_key = data_val ^ _readLE64(secret + i * 8);
+      acc[i ^ 1] += data_val;
+      acc[i] += (data_key & 0xFFFFFFFFULL) * (data_key >> 32);
+    }
+  }
+
+  inline void _scrambleAcc(UInt64* acc, const std::byte* secret)
+  {
+    for (Int64 i = 0; i < ACC_NB; ++i) {
+      UInt64 key64 = _readLE64(secret + i * 8);
+      UInt64 acc64 = acc[i];
+      acc64 = _xorshift64(acc64, 47);
+      acc64 ^= key64;
+      acc64 *= PRIME32_1;
+      acc[i] = acc64;
+    }
+  }
+
+#endif
+
+  inline void _accumulate(UInt64* acc, const std::byte* input, const std::byte* secret, Int64 nb_stripe)
+  {
+    for (Int64 n = 0; n < nb_stripe; ++n)
+      _accumulate512(acc, input + n * STRIPE_LEN, secret + n * SECRET_CONSUME_RATE);
+  }
+
+  inline void _initAcc(UInt64* acc)
+  {
+    acc[0] = PRIME32_3;
+    acc[1] = PRIME64_1;
+    acc[2] = PRIME64_2;
+    acc[3] = PRIME64_3;
+    acc[4] = PRIME64_4;
+    acc[5] = PRIME32_2;
+    acc[6] = PRIME64_5;
+    acc[7] = PRIME32_1;
+  }
+
+  UInt64 _mergeAccs(const UInt64* acc, const std::byte* secret, UInt64 start)
+  {
+    UInt64 result = start;
+    for (Int64 i = 0; i < 4; ++i)
+      result += _mul128Fold64(acc[2 * i] ^ _readLE64(secret + 16 * i),
+                              acc[2 * i + 1] ^ _readLE64(secret + 16 * i + 8));
+    return _avalanche(result);
+  }
+
+  UInt64 _hashLong(const std::byte* input, UInt64 len)
+  {
+    alignas(64) UInt64 acc[ACC_NB];
+    _initAcc(acc);
+    const UInt64 nb_block = (len - 1) / BLOCK_LEN;
+    for (UInt64 n = 0; n < nb_block; ++n) {
+      _accumulate(acc, input + n * BLOCK_LEN, kSecret, NB_STRIPES_PER_BLOCK);
+      _scrambleAcc(acc, kSecret + SECRET_LIMIT);
+    }
+    // Dernier bloc partiel puis dernière bande.
+    const Int64 nb_stripe = static_cast<Int64>(((len - 1) - (BLOCK_LEN * nb_block)) / STRIPE_LEN);
+    _accumulate(acc, input + nb_block * BLOCK_LEN, kSecret, nb_stripe);
+    _accumulate512(acc, input + len - STRIPE_LEN, kSecret + SECRET_LIMIT - SECRET_LASTACC_START);
+    return _mergeAccs(acc, kSecret + SECRET_MERGEACCS_START, len * PRIME64_1);
+  }
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+
+  //! Calcule le hash XXH3 64 bits de \a input.
+  UInt64 _hash64(Span<const std::byte> input)
+  {
+    const std::byte* ptr = input.data();
+    const UInt64 len = static_cast<UInt64>(input.size());
+    if (len <= 16)
+      return _hashLen0To16(ptr, len);
+    if (len <= 128)
+      return _hashLen17To128(ptr, len);
+    if (len <= MIDSIZE_MAX)
+      return _hashLen129To240(ptr, len);
+    return _hashLong(ptr, len);
+  }
+
+  //! Range \a hash au format canonique (big-endian) dans \a out.
+  void _writeCanonical(UInt64 hash, std::byte* out)
+  {
+    for (Int32 i = 0; i < 8; ++i)
+      out[i] = static_cast<std::byte>((hash >> (8 * (7 - i))) & 0xFF);
+  }
+
+  void _setValue(UInt64 hash, HashAlgorithmValue& value)
+  {
+    value.setSize(8);
+    _writeCanonical(hash, value.bytes().data());
+  }
+
+  /*---------------------------------------------------------------------------*/
+  /*---------------------------------------------------------------------------*/
+  /*!
+   * \brief Calcule en concurrence le hash des blocs de \a input.
+   *
+   * Les \a nb_chunk blocs ont une taille \a chunk_size sauf éventuellement
+   * le dernier. Les hashs sont ajoutés au format canonique dans \a hashes.
+   */
+  void _hashChunks(Span<const std::byte> input, Int64 chunk_size, Int32 nb_chunk,
+                   Array<std::byte>& hashes)
+  {
+    const Int64 pos = hashes.size();
+    hashes.resize(pos + 8 * nb_chunk);
+    std::byte* out = hashes.data() + pos;
+    const Int64 input_size = input.size();
+    auto func = [&](Integer begin, Integer size) {
+      for (Integer i = begin; i < (begin + size); ++i) {
+        Int64 offset = chunk_size * i;
+        Int64 n = math::min(chunk_size, input_size - offset);
+        _writeCanonical(_hash64(input.subspan(offset, n)), out + 8 * i);
+      }
+    };
+    if (nb_chunk == 1) {
+      func(0, 1);
+      return;
+    }
+    // Les blocs sont gros donc on traite un bloc par tâche.
+    ParallelLoopOptions options;
+    options.setGrainSize(1);
+    LambdaRangeFunctorT<decltype(func)> functor(func);
+    TaskFactory::executeParallelFor(0, nb_chunk, options, &functor);
+  }
+
+  Int32 _nbChunk(Int64 size, Int64 chunk_size)
+  {
+    Int64 nb_chunk = (size + chunk_size - 1) / chunk_size;
+    if (nb_chunk > INT32_MAX)
+      ARCANE_FATAL("Too many chunks ({0}) for XXH3 tree hash. Increase chunk size (current={1})",
+                   nb_chunk, chunk_size);
+    return static_cast<Int32>(nb_chunk);
+  }
+
+  //! Calcule le hash par arbre de \a input.
+  UInt64 _treeHash64(Span<const std::byte> input, Int64 chunk_size)
+  {
+    if (input.size() <= chunk_size)
+      return _hash64(input);
+    UniqueArray<std::byte> hashes;
+    _hashChunks(input, chunk_size, _nbChunk(input.size(), chunk_size), hashes);
+    return _hash64(hashes);
+  }
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Contexte pour le calcul incrémental du hash XXH3 64 bits.
+ */
+class XXH3_64
+: public IHashAlgorithmContext
+{
+ public:
+
+  XXH3_64() { reset(); }
+
+ public:
+
+  void reset() override
+  {
+    _initAcc(m_acc);
+    m_buffered_size = 0;
+    m_nb_stripe_so_far = 0;
+    m_total_len = 0;
+  }
+
+  void updateHash(Span<const std::byte> input) override;
+
+  void computeHashValue(HashAlgorithmValue& value) override
+  {
+    _setValue(computeHash64(), value);
+  }
+
+  UInt64 computeHash64() const;
+
+ private:
+
+  alignas(64) UInt64 m_acc[ACC_NB];
+  alignas(64) std::byte m_buffer[INTERNAL_BUFFER_SIZE];
+  Int64 m_buffered_size = 0;
+  Int64 m_nb_stripe_so_far = 0;
+  Int64 m_total_len = 0;
+
+ private:
+
+  static const std::byte* _consumeStripes(UInt64* acc, Int64& nb_stripe_so_far,
+                                          const std::byte* input, Int64 nb_stripe);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+const std::byte* XXH3_64::
+_consumeStripes(UInt64* acc, Int64& nb_stripe_so_far, const std::byte* input, Int64 nb_stripe)
+{
+  const std::byte* initial_secret = kSecret + nb_stripe_so_far * SECRET_CONSUME_RATE;
+  if (nb_stripe >= (NB_STRIPES_PER_BLOCK - nb_stripe_so_far)) {
+    // Termine le bloc courant puis traite les blocs complets
+    Int64 nb_stripe_this_iter = NB_STRIPES_PER_BLOCK - nb_stripe_so_far;
+    do {
+      _accumulate(acc, input, initial_secret, nb_stripe_this_iter);
+      _scrambleAcc(acc, kSecret + SECRET_LIMIT);
+      input += nb_stripe_this_iter * STRIPE_LEN;
+      nb_stripe -= nb_stripe_this_iter;
+      nb_stripe_this_iter = NB_STRIPES_PER_BLOCK;
+      initial_secret = kSecret;
+    } while (nb_stripe >= NB_STRIPES_PER_BLOCK);
+    nb_stripe_so_far = 0;
+  }
+  if (nb_stripe > 0) {
+    _accumulate(acc, input, initial_secret, nb_stripe);
+    input += nb_stripe * STRIPE_LEN;
+    nb_stripe_so_far += nb_stripe;
+  }
+  return input;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64::
+updateHash(Span<const std::byte> input)
+{
+  Int64 len = input.size();
+  if (len == 0)
+    return;
+  const std::byte* ptr = input.data();
+  const std::byte* const end_ptr = ptr + len;
+  m_total_len += len;
+
+  if (len <= (INTERNAL_BUFFER_SIZE - m_buffered_size)) {
+    std::memcpy(m_buffer + m_buffered_size, ptr, len);
+    m_buffered_size += len;
+    return;
+  }
+
+  // On garde toujours au moins un octet dans le tampon pour que
+  // computeHash64() puisse traiter la dernière bande.
+  if (m_buffered_size > 0) {
+    Int64 load_size = INTERNAL_BUFFER_SIZE - m_buffered_size;
+    std::memcpy(m_buffer + m_buffered_size, ptr, load_size);
+    ptr += load_size;
+    _consumeStripes(m_acc, m_nb_stripe_so_far, m_buffer, INTERNAL_BUFFER_STRIPES);
+    m_buffered_size = 0;
+  }
+  if ((end_ptr - ptr) > INTERNAL_BUFFER_SIZE) {
+    Int64 nb_stripe = (end_ptr - 1 - ptr) / STRIPE_LEN;
+    ptr = _consumeStripes(m_acc, m_nb_stripe_so_far, ptr, nb_stripe);
+    // Conserve la dernière bande traitée pour le cas où il reste
+    // moins de STRIPE_LEN octets à la fin.
+    std::memcpy(m_buffer + INTERNAL_BUFFER_SIZE - STRIPE_LEN, ptr - STRIPE_LEN, STRIPE_LEN);
+  }
+  m_buffered_size = end_ptr - ptr;
+  std::memcpy(m_buffer, ptr, m_buffered_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+UInt64 XXH3_64::
+computeHash64() const
+{
+  if (m_total_len <= MIDSIZE_MAX)
+    return _hash64(Span<const std::byte>(m_buffer, m_total_len));
+
+  alignas(64) UInt64 acc[ACC_NB];
+  std::memcpy(acc, m_acc, sizeof(acc));
+  std::byte last_stripe[STRIPE_LEN];
+  const std::byte* last_stripe_ptr = nullptr;
+  if (m_buffered_size >= STRIPE_LEN) {
+    Int64 nb_stripe = (m_buffered_size - 1) / STRIPE_LEN;
+    Int64 nb_stripe_so_far = m_nb_stripe_so_far;
+    _consumeStripes(acc, nb_stripe_so_far, m_buffer, nb_stripe);
+    last_stripe_ptr = m_buffer + m_buffered_size - STRIPE_LEN;
+  }
+  else {
+    // Complète avec la fin de la bande précédente.
+    Int64 catchup_size = STRIPE_LEN - m_buffered_size;
+    std::memcpy(last_stripe, m_buffer + INTERNAL_BUFFER_SIZE - catchup_size, catchup_size);
+    std::memcpy(last_stripe + catchup_size, m_buffer, m_buffered_size);
+    last_stripe_ptr = last_stripe;
+  }
+  _accumulate512(acc, last_stripe_ptr, kSecret + SECRET_LIMIT - SECRET_LASTACC_START);
+  return _mergeAccs(acc, kSecret + SECRET_MERGEACCS_START, static_cast<UInt64>(m_total_len) * PRIME64_1);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Contexte pour le calcul incrémental du hash XXH3 64 bits par arbre.
+ *
+ * Le bloc courant est hashé de manière incrémentale. Il n'est terminé que
+ * lorsque de nouvelles données arrivent, ce qui permet d'obtenir le
+ * même résultat que XXH3_64TreeHashAlgorithm::computeHash() lorsque la
+ * taille totale est un multiple de la taille de bloc. Les blocs complets
+ * fournis en une seule fois sont hashés en concurrence.
+ */
+class XXH3_64Tree
+: public IHashAlgorithmContext
+{
+ public:
+
+  explicit XXH3_64Tree(Int64 chunk_size)
+  : m_chunk_size(chunk_size)
+  {}
+
+ public:
+
+  void reset() override
+  {
+    m_current.reset();
+    m_current_size = 0;
+    m_chunk_hashes.clear();
+  }
+
+  void updateHash(Span<const std::byte> input) override
+  {
+    while (!input.empty()) {
+      if (m_current_size == m_chunk_size)
+        _flushCurrent();
+      if (m_current_size == 0 && input.size() > m_chunk_size) {
+        // Garde le dernier bloc (éventuellement complet) dans le bloc courant.
+        Int32 nb_chunk = _nbChunk(input.size() - m_chunk_size, m_chunk_size);
+        Int64 nb_byte = nb_chunk * m_chunk_size;
+        _hashChunks(input.subspan(0, nb_byte), m_chunk_size, nb_chunk, m_chunk_hashes);
+        input = input.subspan(nb_byte, input.size() - nb_byte);
+        continue;
+      }
+      Int64 n = math::min(m_chunk_size - m_current_size, input.size());
+      m_current.updateHash(input.subspan(0, n));
+      m_current_size += n;
+      input = input.subspan(n, input.size() - n);
+    }
+  }
+
+  void computeHashValue(HashAlgorithmValue& value) override
+  {
+    if (m_chunk_hashes.empty()) {
+      m_current.computeHashValue(value);
+      return;
+    }
+    UniqueArray<std::byte> hashes(m_chunk_hashes);
+    hashes.resize(hashes.size() + 8);
+    _writeCanonical(m_current.computeHash64(), hashes.data() + hashes.size() - 8);
+    _setValue(_hash64(hashes), value);
+  }
+
+ private:
+
+  Int64 m_chunk_size = 0;
+  XXH3_64 m_current;
+  Int64 m_current_size = 0;
+  UniqueArray<std::byte> m_chunk_hashes;
+
+ private:
+
+  void _flushCurrent()
+  {
+    Int64 pos = m_chunk_hashes.size();
+    m_chunk_hashes.resize(pos + 8);
+    _writeCanonical(m_current.computeHash64(), m_chunk_hashes.data() + pos);
+    m_current.reset();
+    m_current_size = 0;
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::XXH3Algorithm
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64HashAlgorithm::
+_computeHash64(Span<const std::byte> input, ByteArray& output)
+{
+  HashAlgorithmValue value;
+  computeHash(input, value);
+  output.addRange(value.asLegacyBytes());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64HashAlgorithm::
+computeHash(Span<const std::byte> input, HashAlgorithmValue& value)
+{
+  XXH3Algorithm::_setValue(XXH3Algorithm::_hash64(input), value);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64HashAlgorithm::
+computeHash(ByteConstArrayView input, ByteArray& output)
+{
+  Span<const Byte> input64(input);
+  _computeHash64(asBytes(input64), output);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64HashAlgorithm::
+computeHash64(Span<const Byte> input, ByteArray& output)
+{
+  _computeHash64(asBytes(input), output);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64HashAlgorithm::
+computeHash64(Span<const std::byte> input, ByteArray& output)
+{
+  _computeHash64(input, output);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Ref<IHashAlgorithmContext> XXH3_64HashAlgorithm::
+createContext()
+{
+  return createRef<XXH3Algorithm::XXH3_64>();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64TreeHashAlgorithm::
+setChunkSize(Int64 v)
+{
+  if (v <= 0)
+    ARCANE_FATAL("Invalid chunk size '{0}'. Value has to be strictly positive", v);
+  m_chunk_size = v;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64TreeHashAlgorithm::
+_computeHash64(Span<const std::byte> input, ByteArray& output)
+{
+  HashAlgorithmValue value;
+  computeHash(input, value);
+  output.addRange(value.asLegacyBytes());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64TreeHashAlgorithm::
+computeHash(Span<const std::byte> input, HashAlgorithmValue& value)
+{
+  XXH3Algorithm::_setValue(XXH3Algorithm::_treeHash64(input, m_chunk_size), value);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64TreeHashAlgorithm::
+computeHash(ByteConstArrayView input, ByteArray& output)
+{
+  Span<const Byte> input64(input);
+  _computeHash64(asBytes(input64), output);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64TreeHashAlgorithm::
+computeHash64(Span<const Byte> input, ByteArray& output)
+{
+  _computeHash64(asBytes(input), output);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void XXH3_64TreeHashAlgorithm::
+computeHash64(Span<const std::byte> input, ByteArray& output)
+{
+  _computeHash64(input, output);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Ref<IHashAlgorithmContext> XXH3_64TreeHashAlgorithm::
+createContext()
+{
+  return createRef<XXH3Algorithm::XXH3_64Tree>(m_chunk_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,122 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* XXH3HashAlgorithm.h                                         (C) 2000-2024 */
+/*                                                                           */
+/* Calcule la fonction de hashage non cryptographique XXH3 (64 bits).        */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_UTILS_XXH3HASHALGORITHM_H
+#define ARCANE_UTILS_XXH3HASHALGORITHM_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/IHashAlgorithm.h"
+#include "arcane/utils/String.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation de l'algorithme XXH3 sur 64 bits.
+ *
+ * Il s'agit d'un hash non cryptographique beaucoup plus rapide que
+ * les algorithmes de la famille SHA. Il est adapté pour détecter les
+ * différences entre deux jeux de données (par exemple pour les
+ * protections/reprises) mais pas pour un usage sécuritaire.
+ *
+ * L'implémentation utilise le secret par défaut et une graine nulle. Le
+ * résultat est donc identique à celui de la fonction XXH3_64bits() de la
+ * bibliothèque de référence (https://github.com/Cyan4973/xxHash). La valeur
+ * est retournée au format canonique (octets de poids fort en premier).
+ *
+ * Les boucles d'accumulation utilisent les instructions SSE2 ou AVX2 si
+ * elles sont disponibles à la compilation.
+ */
+class ARCANE_UTILS_EXPORT XXH3_64HashAlgorithm
+: public IHashAlgorithm
+{
+ public:
+
+  void computeHash(Span<const std::byte> input, HashAlgorithmValue& value) override;
+  void computeHash(ByteConstArrayView input, ByteArray& output) override;
+  void computeHash64(Span<const Byte> input, ByteArray& output) override;
+  void computeHash64(Span<const std::byte> input, ByteArray& output) override;
+  String name() const override { return "XXH3_64"; }
+  Int32 hashSize() const override { return 8; }
+  Ref<IHashAlgorithmContext> createContext() override;
+  bool hasCreateContext() const override { return true; }
+
+ private:
+
+  void _computeHash64(Span<const std::byte> input, ByteArray& output);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Hash XXH3 64 bits par arbre pour les gros tableaux.
+ *
+ * Les données sont découpées en blocs de chunkSize() octets. Si les données
+ * tiennent dans un seul bloc, le hash est identique à celui de
+ * XXH3_64HashAlgorithm. Sinon, le hash de chaque bloc est calculé en
+ * concurrence via TaskFactory et la valeur retournée est le hash XXH3 de la
+ * concaténation des hashs (au format canonique) des blocs.
+ *
+ * La valeur dépend donc de chunkSize() et il faut utiliser la même taille
+ * de bloc pour comparer deux hashs. Le mode incrémental (createContext())
+ * donne le même résultat que le mode direct quel que soit le découpage des
+ * appels à IHashAlgorithmContext::updateHash().
+ */
+class ARCANE_UTILS_EXPORT XXH3_64TreeHashAlgorithm
+: public IHashAlgorithm
+{
+ public:
+
+  //! Taille par défaut (en octet) d'un bloc
+  static constexpr Int64 DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+ public:
+
+  void computeHash(Span<const std::byte> input, HashAlgorithmValue& value) override;
+  void computeHash(ByteConstArrayView input, ByteArray& output) override;
+  void computeHash64(Span<const Byte> input, ByteArray& output) override;
+  void computeHash64(Span<const std::byte> input, ByteArray& output) override;
+  String name() const override { return "XXH3_64Tree"; }
+  Int32 hashSize() const override { return 8; }
+  Ref<IHashAlgorithmContext> createContext() override;
+  bool hasCreateContext() const override { return true; }
+
+ public:
+
+  //! Positionne la taille (en octet) d'un bloc. Doit être strictement positive.
+  void setChunkSize(Int64 v);
+  //! Taille (en octet) d'un bloc
+  Int64 chunkSize() const { return m_chunk_size; }
+
+ private:
+
+  Int64 m_chunk_size = DEFAULT_CHUNK_SIZE;
+
+ private:
+
+  void _computeHash64(Span<const std::byte> input, ByteArray& output);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
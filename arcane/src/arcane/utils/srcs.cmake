@@ -305,6 +305,8 @@ set(ARCANE_SOURCES
   SHA1HashAlgorithm.cc
   SHA3HashAlgorithm.h
   SHA3HashAlgorithm.cc
+  XXH3HashAlgorithm.h
+  XXH3HashAlgorithm.cc
   ValueConvert.h
   ScopedPtr.h
   SharedPtr.h
@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -13,6 +13,7 @@
 #include "arcane/utils/MD5HashAlgorithm.h"
 #include "arcane/utils/SHA3HashAlgorithm.h"
 #include "arcane/utils/SHA1HashAlgorithm.h"
+#include "arcane/utils/XXH3HashAlgorithm.h"
 #include "arcane/utils/Ref.h"
 
 #include <gtest/gtest.h>
@@ -302,3 +303,88 @@ TEST(Hash, MD5)
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
+
+TEST(Hash, XXH3_64)
+{
+  std::cout << "TEST_XXH3_64\n";
+
+  // Chaînes de plus de 240 octets pour tester le mode 'long'
+  std::string long_value1(241, 'x');
+  std::string long_value2;
+  for (int i = 0; i < 100; ++i)
+    long_value2 += "abcdefghij";
+  // Chaînes entre 129 et 240 octets (mode 'moyen')
+  std::string mid_value1;
+  for (int i = 0; i < 24; ++i)
+    mid_value1 += "abcdefghij";
+  std::string mid_value2(mid_value1.substr(0, 130));
+  std::string mid_value3(200, 'x');
+
+  std::array<TestInfo, 16> values_to_test = {
+    { { "", "2d06800538d394c2" },
+      { "a", "e6c632b61e964e1f" },
+      { "abc", "78af5f94892f3950" },
+      // Chaînes entre 4 et 8 octets
+      { "abcd", "6497a96f53a89890" },
+      { "12345", "f34099ede96b5581" },
+      { "abcdefgh", "6f45a76842a96483" },
+      { "message digest", "160d8e9329be94f9" },
+      { "abcdefghijklmnopqrstuvwxyz", "810f9ca067fbb90c" },
+      { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", "643542bb51639cb2" },
+      { "12345678901234567890123456789012345678901234567890123456789012345678901234567890", "7f58aa2520c681f9" },
+      { "The quick brown fox jumps over the lazy dog", "ce7d19a5418fb365" },
+      { String(mid_value2), "b5fee04f25bf4e35" },
+      { String(mid_value3), "50ef124fb1e4de53" },
+      { String(mid_value1), "e12147fc00ff9053" },
+      { String(long_value1), "14da9e5c301a6a1d" },
+      { String(long_value2), "f80007a55886e541" } }
+  };
+
+  XXH3_64HashAlgorithm xxh3;
+  _testHash(xxh3, SmallSpan<TestInfo>(values_to_test));
+
+  // Teste un gros tableau (le même que dans _testHash())
+  const Int32 nb_byte = 100000;
+  UniqueArray<std::byte> bytes(nb_byte);
+  for (Int32 i = 0; i < nb_byte; ++i)
+    bytes[i] = std::byte(i % 127);
+  HashAlgorithmValue value;
+  xxh3.computeHash(bytes, value);
+  SmallSpan<const std::byte> hash_bytes(value.bytes());
+  ASSERT_EQ(Convert::toHexaString(hash_bytes), "1fb02f5a1c30ac46");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TEST(Hash, XXH3_64Tree)
+{
+  std::cout << "TEST_XXH3_64Tree\n";
+
+  // Si les données tiennent dans un bloc, le hash est celui de XXH3_64.
+  std::array<TestInfo, 3> values_to_test = {
+    { { "", "2d06800538d394c2" },
+      { "abc", "78af5f94892f3950" },
+      { "The quick brown fox jumps over the lazy dog", "ce7d19a5418fb365" } }
+  };
+
+  XXH3_64TreeHashAlgorithm xxh3_tree;
+  // Utilise des petits blocs pour tester le calcul en parallèle
+  xxh3_tree.setChunkSize(1000);
+  ASSERT_EQ(xxh3_tree.chunkSize(), 1000);
+  _testHash(xxh3_tree, SmallSpan<TestInfo>(values_to_test));
+
+  // Avec plusieurs blocs, la valeur est le hash XXH3 de la concaténation
+  // des hashs de chaque bloc.
+  const Int32 nb_byte = 100000;
+  UniqueArray<std::byte> bytes(nb_byte);
+  for (Int32 i = 0; i < nb_byte; ++i)
+    bytes[i] = std::byte(i % 127);
+  HashAlgorithmValue value;
+  xxh3_tree.computeHash(bytes, value);
+  SmallSpan<const std::byte> hash_bytes(value.bytes());
+  ASSERT_EQ(Convert::toHexaString(hash_bytes), "e3642ac077696442");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -253,6 +253,8 @@ namespace Arcane
 %rename("$ignore", fullname=1) "Arcane::IApplication::userConfigRootElement";
 %rename("$ignore", fullname=1) "Arcane::ITimeHistoryMng::removeCurveWriter";
 %rename("$ignore", fullname=1) "Arcane::ITimeHistoryMng::addCurveWriter";
+%rename("$ignore", fullname=1) "Arcane::ITimeHistoryMng::addValues";
+%rename("$ignore", fullname=1) "Arcane::ITimeHistoryMng::addReducedValues";
 %rename("$ignore", fullname=1) "Arcane::ISubDomain::doInitModules";
 %rename("$ignore", fullname=1) "Arcane::ISubDomain::mesh";
 %rename("$ignore", fullname=1) "Arcane::ISubDomain::findMesh";
@@ -35,13 +35,33 @@
 #include "arccore/message_passing_mpi/StandaloneMpiMessagePassingMng.h"
 
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+// MPI 4 ajoute des versions des fonctions avec le suffixe '_c' qui utilisent
+// le type 'MPI_Count' pour le nombre d'éléments.
+#if defined(MPI_VERSION) && (MPI_VERSION >= 4)
+#define ARCCORE_MPI_HAS_LARGE_COUNT
+#endif
+
 namespace Arccore::MessagePassing::Mpi
 {
 
+/*!
+ * \brief Registre des requêtes allouées.
+ *
+ * Ce registre est une table de hachage à adressage ouvert (sondage linéaire)
+ * préallouée. L'ajout, la recherche et la suppression d'une requête sont en
+ * O(1) en moyenne et ne font pas d'allocation tant que le nombre de requêtes
+ * actives ne dépasse pas la moitié de la capacité.
+ *
+ * Les informations de trace sont conservées dans des tableaux parallèles
+ * aux clés. La pile d'appel n'est conservée que si elle est demandée.
+ */
 class MpiAdapter::RequestSet
 : public TraceAccessor
 {
@@ -52,7 +72,10 @@ class MpiAdapter::RequestSet
     String m_stack_trace;
   };
  public:
-  typedef std::map<MPI_Request,RequestInfo>::iterator Iterator;
+  //! Indice de l'emplacement d'une requête dans le registre (-1 si aucun)
+  using Iterator = Int64;
+  static constexpr Iterator NullIterator = -1;
+  static constexpr Int64 DefaultCapacity = 1024;
  public:
   RequestSet(ITraceMng* tm) : TraceAccessor(tm)
   {
@@ -67,6 +90,7 @@ class MpiAdapter::RequestSet
       m_use_trace_full_stack = true;
     if (Platform::getEnvironmentVariable("ARCCORE_TRACE_MPIREQUEST")=="TRUE")
       m_trace_mpirequest = true;
+    _resizeTable(DefaultCapacity);
   }
  public:
   void addRequest(MPI_Request request)
@@ -97,25 +121,25 @@ class MpiAdapter::RequestSet
   {
     if (m_no_check_request)
       return;
-    if (request_iter==m_allocated_requests.end()){
+    if (request_iter==NullIterator){
       if (m_trace_mpirequest)
         info() << "MpiAdapter: RemoveRequestIter null iterator";
       return;
     }
     if (m_trace_mpirequest)
-      info() << "MpiAdapter: RemoveRequestIter r=" << request_iter->first;
-    m_allocated_requests.erase(request_iter);
+      info() << "MpiAdapter: RemoveRequestIter r=" << m_keys[request_iter];
+    _removeSlot(request_iter);
   }
   //! Vérifie que la requête est dans la liste
   Iterator findRequest(MPI_Request request)
   {
     if (m_no_check_request)
-      return m_allocated_requests.end();
+      return NullIterator;
 
     if (_isEmptyRequest(request))
-      return m_allocated_requests.end();
-    auto ireq = m_allocated_requests.find(request);
-    if (ireq==m_allocated_requests.end()){
+      return NullIterator;
+    Iterator ireq = _findSlot(request);
+    if (ireq==NullIterator){
       if (m_is_report_error_in_request || m_request_error_is_fatal){
         error() << "MpiAdapter::testRequest() request not referenced "
                 << " id=" << request;
@@ -141,8 +165,7 @@ class MpiAdapter::RequestSet
       return;
     ++m_total_added_request;
     //info() << "MPI_ADAPTER:ADD REQUEST " << request;
-    auto i = m_allocated_requests.find(request);
-    if (i!=m_allocated_requests.end()){
+    if (_findSlot(request)!=NullIterator){
       if (m_is_report_error_in_request || m_request_error_is_fatal){
         error() << "MpiAdapter::_addRequest() request already referenced "
                 << " id=" << request;
@@ -150,11 +173,17 @@ class MpiAdapter::RequestSet
       }
       return;
     }
-    RequestInfo rinfo;
-    rinfo.m_trace = trace_info;
+    // Garde un taux de remplissage inférieur à 1/2.
+    if ((m_nb_request+1)*2 > m_keys.largeSize())
+      _resizeTable(m_keys.largeSize()*2);
+    Int64 slot = _hash(request);
+    while (m_keys[slot]!=MPI_REQUEST_NULL)
+      slot = (slot+1) & m_mask;
+    m_keys[slot] = request;
+    m_infos[slot].m_trace = trace_info;
     if (m_use_trace_full_stack)
-      rinfo.m_stack_trace = Platform::getStackTrace();
-    m_allocated_requests.insert(std::make_pair(request,rinfo));
+      m_infos[slot].m_stack_trace = Platform::getStackTrace();
+    ++m_nb_request;
   }
 
   /*!
@@ -172,8 +201,8 @@ class MpiAdapter::RequestSet
     }
     if (_isEmptyRequest(request))
       return;
-    auto i = m_allocated_requests.find(request);
-    if (i==m_allocated_requests.end()){
+    Iterator i = _findSlot(request);
+    if (i==NullIterator){
       if (m_is_report_error_in_request || m_request_error_is_fatal){
         error() << "MpiAdapter::_removeRequest() request not referenced "
                 << " id=" << request;
@@ -181,7 +210,7 @@ class MpiAdapter::RequestSet
       }
     }
     else
-      m_allocated_requests.erase(i);
+      _removeSlot(i);
   }
  public:
   void _checkFatalInRequest()
@@ -189,14 +218,16 @@ class MpiAdapter::RequestSet
     if (m_request_error_is_fatal)
       ARCCORE_FATAL("Error in requests management");
   }
-  Int64 nbRequest() const { return m_allocated_requests.size(); }
+  Int64 nbRequest() const { return m_nb_request; }
   Int64 totalAddedRequest() const { return m_total_added_request; }
   void printRequests() const
   {
     info() << "PRINT REQUESTS\n";
-    for( auto& x : m_allocated_requests ){
-      info() << "Request id=" << x.first << " trace=" << x.second.m_trace
-             << " stack=" << x.second.m_stack_trace;
+    for( Int64 i=0, n=m_keys.largeSize(); i<n; ++i ){
+      if (m_keys[i]==MPI_REQUEST_NULL)
+        continue;
+      info() << "Request id=" << m_keys[i] << " trace=" << m_infos[i].m_trace
+             << " stack=" << m_infos[i].m_stack_trace;
     }
   }
   void setEmptyRequests(MPI_Request r1,MPI_Request r2)
@@ -211,7 +242,11 @@ class MpiAdapter::RequestSet
   //! Vrai si on vérifie pas les requêtes
   bool m_no_check_request = true;
  private:
-  std::map<MPI_Request,RequestInfo> m_allocated_requests;
+  //! Clés de la table. MPI_REQUEST_NULL indique un emplacement libre.
+  UniqueArray<MPI_Request> m_keys;
+  UniqueArray<RequestInfo> m_infos;
+  Int64 m_mask = 0;
+  Int64 m_nb_request = 0;
   bool m_use_trace_full_stack = false;
   MPI_Request m_empty_request1 = MPI_REQUEST_NULL;
   MPI_Request m_empty_request2 = MPI_REQUEST_NULL;
@@ -222,6 +257,75 @@ class MpiAdapter::RequestSet
   {
     return (r==m_empty_request1 || r==m_empty_request2);
   }
+  //! Emplacement initial de la requête \a r dans la table.
+  Int64 _hash(MPI_Request r) const
+  {
+    // Le type 'MPI_Request' peut être un entier ou un pointeur suivant
+    // l'implémentation MPI.
+    std::uint64_t v = 0;
+    std::memcpy(&v,&r,std::min(sizeof(MPI_Request),sizeof(v)));
+    v ^= v >> 33;
+    v *= 0xff51afd7ed558ccdULL;
+    v ^= v >> 33;
+    return static_cast<Int64>(v) & m_mask;
+  }
+  Iterator _findSlot(MPI_Request r) const
+  {
+    Int64 slot = _hash(r);
+    while (m_keys[slot]!=MPI_REQUEST_NULL){
+      if (m_keys[slot]==r)
+        return slot;
+      slot = (slot+1) & m_mask;
+    }
+    return NullIterator;
+  }
+  /*!
+   * \brief Supprime la requête à l'emplacement \a slot.
+   *
+   * Décale les éléments suivants pour ne pas avoir besoin de marqueurs
+   * de suppression.
+   */
+  void _removeSlot(Int64 slot)
+  {
+    m_keys[slot] = MPI_REQUEST_NULL;
+    m_infos[slot] = RequestInfo();
+    --m_nb_request;
+    Int64 next = (slot+1) & m_mask;
+    while (m_keys[next]!=MPI_REQUEST_NULL){
+      Int64 ideal = _hash(m_keys[next]);
+      // Déplace l'élément s'il n'est pas entre son emplacement
+      // idéal et sa position courante (en tenant compte du rebouclage).
+      bool do_move = (slot<=next) ? (ideal<=slot || ideal>next) : (ideal<=slot && ideal>next);
+      if (do_move){
+        m_keys[slot] = m_keys[next];
+        m_infos[slot] = m_infos[next];
+        m_keys[next] = MPI_REQUEST_NULL;
+        m_infos[next] = RequestInfo();
+        slot = next;
+      }
+      next = (next+1) & m_mask;
+    }
+  }
+  void _resizeTable(Int64 new_capacity)
+  {
+    UniqueArray<MPI_Request> old_keys(m_keys);
+    UniqueArray<RequestInfo> old_infos(m_infos);
+    m_keys.resize(new_capacity);
+    m_keys.fill(MPI_REQUEST_NULL);
+    m_infos.clear();
+    m_infos.resize(new_capacity);
+    m_mask = new_capacity - 1;
+    for( Int64 i=0, n=old_keys.largeSize(); i<n; ++i ){
+      MPI_Request r = old_keys[i];
+      if (r==MPI_REQUEST_NULL)
+        continue;
+      Int64 slot = _hash(r);
+      while (m_keys[slot]!=MPI_REQUEST_NULL)
+        slot = (slot+1) & m_mask;
+      m_keys[slot] = r;
+      m_infos[slot] = old_infos[i];
+    }
+  }
 };
 
 #define ARCCORE_ADD_REQUEST(request)\
@@ -238,6 +342,125 @@ int _checkSize(Int64 i64_size)
     ARCCORE_FATAL("Can not convert '{0}' to type integer",i64_size);
   return (int)i64_size;
 }
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Type MPI pour les messages de plus de \a max_count éléments.
+ *
+ * Les fonctions MPI utilisent le type 'int' pour le nombre d'éléments. Si
+ * le nombre d'éléments \a count dépasse \a max_count, on construit un type
+ * dérivé contenant \a count éléments de \a datatype et le message est
+ * envoyé ou reçu sous la forme d'un seul élément de ce type. La signature
+ * du type étant la même, un message envoyé avec le type dérivé peut être
+ * reçu avec le type d'origine et inversement.
+ *
+ * L'étendue du type dérivé vaut \a count fois celle de \a datatype, ce
+ * qui permet aussi de l'utiliser pour les gather.
+ *
+ * Le type dérivé est libéré dans le destructeur. La norme MPI garantit que
+ * les opérations non bloquantes en cours qui l'utilisent se terminent
+ * normalement.
+ */
+class LargeCountDatatype
+{
+ public:
+
+  LargeCountDatatype(Int64 count,MPI_Datatype datatype,Int64 max_count)
+  : m_count(static_cast<int>(count))
+  , m_datatype(datatype)
+  {
+    if (count<=max_count)
+      return;
+    MPI_Aint lb = 0;
+    MPI_Aint extent = 0;
+    MPI_Type_get_extent(datatype,&lb,&extent);
+    Int64 nb_chunk = count / max_count;
+    Int64 remainder = count % max_count;
+    int chunk_size = _checkSize(max_count);
+    // Les 'nb_chunk' premiers blocs de 'max_count' éléments.
+    MPI_Datatype full_type = MPI_DATATYPE_NULL;
+    MPI_Type_vector(_checkSize(nb_chunk),chunk_size,chunk_size,datatype,&full_type);
+    // Les éléments restants
+    if (remainder!=0){
+      MPI_Datatype chunk_type = full_type;
+      MPI_Datatype remainder_type = MPI_DATATYPE_NULL;
+      MPI_Type_contiguous(static_cast<int>(remainder),datatype,&remainder_type);
+      int block_lengths[2] = { 1, 1 };
+      MPI_Aint displacements[2] = { 0, static_cast<MPI_Aint>(nb_chunk*max_count*extent) };
+      MPI_Datatype types[2] = { chunk_type, remainder_type };
+      MPI_Type_create_struct(2,block_lengths,displacements,types,&full_type);
+      MPI_Type_free(&chunk_type);
+      MPI_Type_free(&remainder_type);
+    }
+    MPI_Type_create_resized(full_type,lb,static_cast<MPI_Aint>(count*extent),&m_datatype);
+    MPI_Type_free(&full_type);
+    MPI_Type_commit(&m_datatype);
+    m_count = 1;
+    m_is_derived = true;
+  }
+
+  ~LargeCountDatatype()
+  {
+    if (m_is_derived)
+      MPI_Type_free(&m_datatype);
+  }
+
+  LargeCountDatatype(const LargeCountDatatype&) = delete;
+  LargeCountDatatype& operator=(const LargeCountDatatype&) = delete;
+
+ public:
+
+  //! Nombre d'éléments à utiliser dans l'appel MPI
+  int count() const { return m_count; }
+  //! Type à utiliser dans l'appel MPI
+  MPI_Datatype datatype() const { return m_datatype; }
+
+ private:
+
+  int m_count = 0;
+  MPI_Datatype m_datatype = MPI_DATATYPE_NULL;
+  bool m_is_derived = false;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Découpe \a count éléments de type \a datatype en morceaux d'au
+ * plus \a max_count éléments.
+ *
+ * Appelle \a func(offset,n) pour chaque morceau, avec \a offset le décalage
+ * en octets du début du morceau et \a n son nombre d'éléments. Cela est
+ * utilisé pour les réductions qui ne peuvent pas utiliser de type dérivé
+ * avec les opérateurs prédéfinis. Les réductions étant faites élément par
+ * élément, on n'utilise pas les versions 'MPI_Count' de MPI 4 pour que
+ * chaque morceau passe par l'interface de profiling (IMpiProfiling) qui
+ * n'accepte qu'un nombre d'éléments de type 'int'.
+ */
+template<typename Lambda> void
+_applyByChunk(Int64 count,Int64 max_count,MPI_Datatype datatype,const Lambda& func)
+{
+  MPI_Aint lb = 0;
+  MPI_Aint extent = 0;
+  MPI_Type_get_extent(datatype,&lb,&extent);
+  for( Int64 begin=0; begin<count; begin+=max_count ){
+    Int64 n = std::min(max_count,count-begin);
+    func(static_cast<MPI_Aint>(begin*extent),static_cast<int>(n));
+  }
+}
+
+/*!
+ * \brief Adresse \a buf décalée de \a offset octets.
+ *
+ * MPI_IN_PLACE et le pointeur nul (tampon de réception des rangs autres que
+ * la racine pour MPI_Reduce) sont conservés tels quels.
+ */
+void* _offsetBuffer(void* buf,MPI_Aint offset)
+{
+  if (buf==MPI_IN_PLACE || !buf)
+    return buf;
+  return static_cast<char*>(buf) + offset;
+}
 }
 
 /*---------------------------------------------------------------------------*/
@@ -261,6 +484,15 @@ MpiAdapter(ITraceMng* trace,IStat* stat,MPI_Comm comm,
   if (Platform::getEnvironmentVariable("ARCCORE_TRACE_MPI")=="TRUE")
     m_is_trace = true;
 
+  // Permet de tester les mécanismes pour les grands messages avec des
+  // messages de petite taille.
+  String max_count_str = Platform::getEnvironmentVariable("ARCCORE_MPI_MAX_MESSAGE_COUNT");
+  if (!max_count_str.null()){
+    Int64 v = std::strtoll(max_count_str.localstr(),nullptr,10);
+    if (v>0 && v<m_max_message_count)
+      m_max_message_count = v;
+  }
+
   ::MPI_Comm_rank(m_communicator,&m_comm_rank);
   ::MPI_Comm_size(m_communicator,&m_comm_size);
 
@@ -417,7 +649,7 @@ _trace(const char* function)
 void MpiAdapter::
 broadcast(void* buf,Int64 nb_elem,Int32 root,MPI_Datatype datatype)
 {
-  int _nb_elem = _checkSize(nb_elem);
+  LargeCountDatatype large_type(nb_elem,datatype,m_max_message_count);
   _trace(MpiInfo(eMpiName::Bcast).name().localstr());
   double begin_time = MPI_Wtime();
   if (m_is_trace)
@@ -427,7 +659,7 @@ broadcast(void* buf,Int64 nb_elem,Int32 root,MPI_Datatype datatype)
            << " root=" << root
            << " datatype=" << datatype;
 
-  m_mpi_prof->broadcast(buf, _nb_elem, datatype, root, m_communicator);
+  m_mpi_prof->broadcast(buf, large_type.count(), large_type.datatype(), root, m_communicator);
   double end_time = MPI_Wtime();
   double sr_time   = (end_time-begin_time);
   //TODO determiner la taille des messages
@@ -442,10 +674,10 @@ nonBlockingBroadcast(void* buf,Int64 nb_elem,Int32 root,MPI_Datatype datatype)
 {
   MPI_Request mpi_request = MPI_REQUEST_NULL;
   int ret = -1;
-  int _nb_elem = _checkSize(nb_elem);
+  LargeCountDatatype large_type(nb_elem,datatype,m_max_message_count);
   _trace(" MPI_Bcast");
   double begin_time = MPI_Wtime();
-  ret = MPI_Ibcast(buf,_nb_elem,datatype,root,m_communicator,&mpi_request);
+  ret = MPI_Ibcast(buf,large_type.count(),large_type.datatype(),root,m_communicator,&mpi_request);
   double end_time = MPI_Wtime();
   double sr_time = (end_time-begin_time);
   //TODO determiner la taille des messages
@@ -461,11 +693,13 @@ void MpiAdapter::
 gather(const void* send_buf,void* recv_buf,Int64 nb_elem,Int32 root,MPI_Datatype datatype)
 {
   void* _sbuf = const_cast<void*>(send_buf);
-  int _nb_elem = _checkSize(nb_elem);
+  LargeCountDatatype large_type(nb_elem,datatype,m_max_message_count);
+  int _nb_elem = large_type.count();
+  MPI_Datatype _datatype = large_type.datatype();
   int _root = static_cast<int>(root);
   _trace(MpiInfo(eMpiName::Gather).name().localstr());
   double begin_time = MPI_Wtime();
-  m_mpi_prof->gather(_sbuf, _nb_elem, datatype, recv_buf, _nb_elem, datatype, _root, m_communicator);
+  m_mpi_prof->gather(_sbuf, _nb_elem, _datatype, recv_buf, _nb_elem, _datatype, _root, m_communicator);
   double end_time = MPI_Wtime();
   double sr_time   = (end_time-begin_time);
   //TODO determiner la taille des messages
@@ -482,11 +716,13 @@ nonBlockingGather(const void* send_buf,void* recv_buf,
   MPI_Request mpi_request = MPI_REQUEST_NULL;
   int ret = -1;
   void* _sbuf = const_cast<void*>(send_buf);
-  int _nb_elem = _checkSize(nb_elem);
+  LargeCountDatatype large_type(nb_elem,datatype,m_max_message_count);
+  int _nb_elem = large_type.count();
+  MPI_Datatype _datatype = large_type.datatype();
   int _root = static_cast<int>(root);
   _trace("MPI_Igather");
   double begin_time = MPI_Wtime();
-  ret = MPI_Igather(_sbuf,_nb_elem,datatype,recv_buf,_nb_elem,datatype,_root,
+  ret = MPI_Igather(_sbuf,_nb_elem,_datatype,recv_buf,_nb_elem,_datatype,_root,
                     m_communicator,&mpi_request);
   double end_time = MPI_Wtime();
   double sr_time   = (end_time-begin_time);
@@ -504,10 +740,12 @@ allGather(const void* send_buf,void* recv_buf,
           Int64 nb_elem,MPI_Datatype datatype)
 {
   void* _sbuf = const_cast<void*>(send_buf);
-  int _nb_elem = _checkSize(nb_elem);
+  LargeCountDatatype large_type(nb_elem,datatype,m_max_message_count);
+  int _nb_elem = large_type.count();
+  MPI_Datatype _datatype = large_type.datatype();
   _trace(MpiInfo(eMpiName::Allgather).name().localstr());
   double begin_time = MPI_Wtime();
-  m_mpi_prof->allGather(_sbuf, _nb_elem, datatype, recv_buf, _nb_elem, datatype, m_communicator);
+  m_mpi_prof->allGather(_sbuf, _nb_elem, _datatype, recv_buf, _nb_elem, _datatype, m_communicator);
   double end_time = MPI_Wtime();
   double sr_time   = (end_time-begin_time);
   //TODO determiner la taille des messages
@@ -524,10 +762,12 @@ nonBlockingAllGather(const void* send_buf,void* recv_buf,
   MPI_Request mpi_request = MPI_REQUEST_NULL;
   int ret = -1;
   void* _sbuf = const_cast<void*>(send_buf);
-  int _nb_elem = _checkSize(nb_elem);
+  LargeCountDatatype large_type(nb_elem,datatype,m_max_message_count);
+  int _nb_elem = large_type.count();
+  MPI_Datatype _datatype = large_type.datatype();
   _trace("MPI_Iallgather");
   double begin_time = MPI_Wtime();
-  ret = MPI_Iallgather(_sbuf,_nb_elem,datatype,recv_buf,_nb_elem,datatype,
+  ret = MPI_Iallgather(_sbuf,_nb_elem,_datatype,recv_buf,_nb_elem,_datatype,
                        m_communicator,&mpi_request);
   double end_time = MPI_Wtime();
   double sr_time   = (end_time-begin_time);
@@ -580,7 +820,13 @@ allGatherVariable(const void* send_buf,void* recv_buf,const int* recv_counts,
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
-
+/*!
+ * \brief Scatter avec un nombre d'éléments variable par rang.
+ *
+ * Les nombres d'éléments et les index étant de type 'int', le nombre total
+ * d'éléments doit tenir dans un 'int'. Au delà, MpiTypeDispatcher utilise
+ * des messages point à point.
+ */
 void MpiAdapter::
 scatterVariable(const void* send_buf,const int* send_count,const int* send_indexes,
                 void* recv_buf,Int64 nb_elem,Int32 root,MPI_Datatype datatype)
@@ -613,10 +859,12 @@ void MpiAdapter::
 allToAll(const void* send_buf,void* recv_buf,Integer count,MPI_Datatype datatype)
 {
   void* _sbuf = const_cast<void*>(send_buf);
-  int icount = _checkSize(count);
+  LargeCountDatatype large_type(count,datatype,m_max_message_count);
+  int icount = large_type.count();
+  MPI_Datatype _datatype = large_type.datatype();
   _trace(MpiInfo(eMpiName::Alltoall).name().localstr());
   double begin_time = MPI_Wtime();
-  m_mpi_prof->allToAll(_sbuf, icount, datatype, recv_buf, icount, datatype, m_communicator);
+  m_mpi_prof->allToAll(_sbuf, icount, _datatype, recv_buf, icount, _datatype, m_communicator);
   double end_time = MPI_Wtime();
   double sr_time   = (end_time-begin_time);
   //TODO determiner la taille des messages
@@ -632,10 +880,12 @@ nonBlockingAllToAll(const void* send_buf,void* recv_buf,Integer count,MPI_Dataty
   MPI_Request mpi_request = MPI_REQUEST_NULL;
   int ret = -1;
   void* _sbuf = const_cast<void*>(send_buf);
-  int icount = _checkSize(count);
+  LargeCountDatatype large_type(count,datatype,m_max_message_count);
+  int icount = large_type.count();
+  MPI_Datatype _datatype = large_type.datatype();
   _trace("MPI_IAlltoall");
   double begin_time = MPI_Wtime();
-  ret = MPI_Ialltoall(_sbuf,icount,datatype,recv_buf,icount,datatype,m_communicator,&mpi_request);
+  ret = MPI_Ialltoall(_sbuf,icount,_datatype,recv_buf,icount,_datatype,m_communicator,&mpi_request);
   double end_time = MPI_Wtime();
   double sr_time   = (end_time-begin_time);
   //TODO determiner la taille des messages
@@ -646,7 +896,14 @@ nonBlockingAllToAll(const void* send_buf,void* recv_buf,Integer count,MPI_Dataty
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
-
+/*!
+ * \brief AllToAll avec un nombre d'éléments variable par rang.
+ *
+ * Les messages de plus de 2^31 éléments ne sont pas supportés : les nombres
+ * d'éléments et les index sont de type 'int' dans l'interface et ne peuvent
+ * donc pas décrire de tels messages. Pour les gros échanges, il faut
+ * utiliser ParallelExchanger qui découpe l'échange en plusieurs étapes.
+ */
 void MpiAdapter::
 allToAllVariable(const void* send_buf,const int* send_counts,
                  const int* send_indexes,void* recv_buf,const int* recv_counts,
@@ -730,12 +987,17 @@ void MpiAdapter::
 allReduce(const void* send_buf,void* recv_buf,Int64 count,MPI_Datatype datatype,MPI_Op op)
 {
   void* _sbuf = const_cast<void*>(send_buf);
-  int _n = _checkSize(count);
   double begin_time = MPI_Wtime();
   _trace(MpiInfo(eMpiName::Allreduce).name().localstr());
   try{
     ++m_nb_all_reduce;
-    m_mpi_prof->allReduce(_sbuf, recv_buf, _n, datatype, op, m_communicator);
+    if (count>m_max_message_count){
+      _applyByChunk(count,m_max_message_count,datatype,[&](MPI_Aint offset,int n){
+        m_mpi_prof->allReduce(_offsetBuffer(_sbuf,offset), _offsetBuffer(recv_buf,offset), n, datatype, op, m_communicator);
+      });
+    }
+    else
+      m_mpi_prof->allReduce(_sbuf, recv_buf, static_cast<int>(count), datatype, op, m_communicator);
   }
   catch(TimeoutException& ex)
   {
@@ -763,12 +1025,22 @@ nonBlockingAllReduce(const void* send_buf,void* recv_buf,Int64 count,MPI_Datatyp
   MPI_Request mpi_request = MPI_REQUEST_NULL;
   int ret = -1;
   void* _sbuf = const_cast<void*>(send_buf);
-  int _n = _checkSize(count);
   double begin_time = MPI_Wtime();
   _trace("MPI_IAllreduce");
-  ret = MPI_Iallreduce(_sbuf,recv_buf,_n,datatype,op,m_communicator,&mpi_request);
+  if (count>m_max_message_count){
+    // Une réduction non bloquante ne peut pas être découpée en plusieurs
+    // morceaux car on ne retourne qu'une seule requête.
+#ifdef ARCCORE_MPI_HAS_LARGE_COUNT
+    ret = MPI_Iallreduce_c(_sbuf,recv_buf,count,datatype,op,m_communicator,&mpi_request);
+#else
+    ARCCORE_FATAL("Non blocking allReduce with count '{0}' greater than '{1}' requires MPI 4",
+                  count,m_max_message_count);
+#endif
+  }
+  else
+    ret = MPI_Iallreduce(_sbuf,recv_buf,static_cast<int>(count),datatype,op,m_communicator,&mpi_request);
   double end_time = MPI_Wtime();
-  m_stat->add("IReduce",end_time-begin_time,_n);
+  m_stat->add("IReduce",end_time-begin_time,count);
   ARCCORE_ADD_REQUEST(mpi_request);
   return buildRequest(ret,mpi_request);
 }
@@ -780,13 +1052,18 @@ void MpiAdapter::
 reduce(const void* send_buf,void* recv_buf,Int64 count,MPI_Datatype datatype,MPI_Op op,Integer root)
 {
   void* _sbuf = const_cast<void*>(send_buf);
-  int _n = _checkSize(count);
   int _root = static_cast<int>(root);
   double begin_time = MPI_Wtime();
   _trace(MpiInfo(eMpiName::Reduce).name().localstr());
   try{
     ++m_nb_reduce;
-    m_mpi_prof->reduce(_sbuf, recv_buf, _n, datatype, op, _root, m_communicator);
+    if (count>m_max_message_count){
+      _applyByChunk(count,m_max_message_count,datatype,[&](MPI_Aint offset,int n){
+        m_mpi_prof->reduce(_offsetBuffer(_sbuf,offset), _offsetBuffer(recv_buf,offset), n, datatype, op, _root, m_communicator);
+      });
+    }
+    else
+      m_mpi_prof->reduce(_sbuf, recv_buf, static_cast<int>(count), datatype, op, _root, m_communicator);
   }
   catch(TimeoutException& ex)
   {
@@ -814,10 +1091,15 @@ void MpiAdapter::
 scan(const void* send_buf,void* recv_buf,Int64 count,MPI_Datatype datatype,MPI_Op op)
 {
   void* _sbuf = const_cast<void*>(send_buf);
-  int _n = _checkSize(count);
   double begin_time = MPI_Wtime();
   _trace(MpiInfo(eMpiName::Scan).name().localstr());
-  m_mpi_prof->scan(_sbuf, recv_buf, _n, datatype, op, m_communicator);
+  if (count>m_max_message_count){
+    _applyByChunk(count,m_max_message_count,datatype,[&](MPI_Aint offset,int n){
+      m_mpi_prof->scan(_offsetBuffer(_sbuf,offset), _offsetBuffer(recv_buf,offset), n, datatype, op, m_communicator);
+    });
+  }
+  else
+    m_mpi_prof->scan(_sbuf, recv_buf, static_cast<int>(count), datatype, op, m_communicator);
   double end_time = MPI_Wtime();
   m_stat->add(MpiInfo(eMpiName::Scan).name(),end_time-begin_time,count);
 }
@@ -834,10 +1116,10 @@ directSendRecv(const void* send_buffer,Int64 send_buffer_size,
   MPI_Status mpi_status;
   double begin_time = MPI_Wtime();
   _trace(MpiInfo(eMpiName::Sendrecv).name().localstr());
-  int sbuf_size = _checkSize(send_buffer_size);
-  int rbuf_size = _checkSize(recv_buffer_size);
-  m_mpi_prof->sendRecv(v_send_buffer, sbuf_size, data_type, proc, 99,
-                  recv_buffer, rbuf_size, data_type, proc, 99,
+  LargeCountDatatype send_type(send_buffer_size,data_type,m_max_message_count);
+  LargeCountDatatype recv_type(recv_buffer_size,data_type,m_max_message_count);
+  m_mpi_prof->sendRecv(v_send_buffer, send_type.count(), send_type.datatype(), proc, 99,
+                  recv_buffer, recv_type.count(), recv_type.datatype(), proc, 99,
                   m_communicator, &mpi_status);
   double end_time = MPI_Wtime();
   Int64 send_size = send_buffer_size * elem_size;
@@ -858,9 +1140,9 @@ sendNonBlockingNoStat(const void* send_buffer,Int64 send_buffer_size,
 {
   void* v_send_buffer = const_cast<void*>(send_buffer);
   MPI_Request mpi_request = MPI_REQUEST_NULL;
-  int sbuf_size = _checkSize(send_buffer_size);
+  LargeCountDatatype send_type(send_buffer_size,data_type,m_max_message_count);
   int ret = 0;
-  m_mpi_prof->iSend(v_send_buffer, sbuf_size, data_type, dest_rank, mpi_tag, m_communicator, &mpi_request);
+  m_mpi_prof->iSend(v_send_buffer, send_type.count(), send_type.datatype(), dest_rank, mpi_tag, m_communicator, &mpi_request);
   if (m_is_trace)
     info() << " ISend ret=" << ret << " proc=" << dest_rank << " tag=" << mpi_tag << " request=" << mpi_request;
   ARCCORE_ADD_REQUEST(mpi_request);
@@ -899,8 +1181,8 @@ directSend(const void* send_buffer,Int64 send_buffer_size,
       {
         MpiLock::Section mls(m_mpi_lock);
         begin_time = MPI_Wtime();
-        int sbuf_size = _checkSize(send_buffer_size);
-        m_mpi_prof->iSend(v_send_buffer, sbuf_size, data_type, proc, mpi_tag, m_communicator, &mpi_request);
+        LargeCountDatatype send_type(send_buffer_size,data_type,m_max_message_count);
+        m_mpi_prof->iSend(v_send_buffer, send_type.count(), send_type.datatype(), proc, mpi_tag, m_communicator, &mpi_request);
       }
       int is_finished = 0;
       MPI_Status mpi_status;
@@ -917,8 +1199,8 @@ directSend(const void* send_buffer,Int64 send_buffer_size,
     else{
       MpiLock::Section mls(m_mpi_lock);
       begin_time = MPI_Wtime();
-      int sbuf_size = _checkSize(send_buffer_size);
-      m_mpi_prof->send(v_send_buffer, sbuf_size, data_type, proc, mpi_tag, m_communicator);
+      LargeCountDatatype send_type(send_buffer_size,data_type,m_max_message_count);
+      m_mpi_prof->send(v_send_buffer, send_type.count(), send_type.datatype(), proc, mpi_tag, m_communicator);
       end_time = MPI_Wtime();
     }
   }
@@ -926,8 +1208,8 @@ directSend(const void* send_buffer,Int64 send_buffer_size,
     {
       MpiLock::Section mls(m_mpi_lock);
       begin_time = MPI_Wtime();
-      int sbuf_size = _checkSize(send_buffer_size);
-      m_mpi_prof->iSend(v_send_buffer, sbuf_size, data_type, proc, mpi_tag, m_communicator, &mpi_request);
+      LargeCountDatatype send_type(send_buffer_size,data_type,m_max_message_count);
+      m_mpi_prof->iSend(v_send_buffer, send_type.count(), send_type.datatype(), proc, mpi_tag, m_communicator, &mpi_request);
       if (m_is_trace)
         info() << " ISend ret=" << ret << " proc=" << proc << " tag=" << mpi_tag << " request=" << mpi_request;
       end_time = MPI_Wtime();
@@ -980,10 +1262,10 @@ Request MpiAdapter::
 receiveNonBlockingNoStat(void* recv_buffer,Int64 recv_buffer_size,
                          Int32 source_rank,MPI_Datatype data_type,int mpi_tag)
 {
-  int rbuf_size = _checkSize(recv_buffer_size);
+  LargeCountDatatype recv_type(recv_buffer_size,data_type,m_max_message_count);
   int ret = 0;
   MPI_Request mpi_request = MPI_REQUEST_NULL;
-  m_mpi_prof->iRecv(recv_buffer, rbuf_size, data_type, source_rank, mpi_tag, m_communicator, &mpi_request);
+  m_mpi_prof->iRecv(recv_buffer, recv_type.count(), recv_type.datatype(), source_rank, mpi_tag, m_communicator, &mpi_request);
   ARCCORE_ADD_REQUEST(mpi_request);
   return buildRequest(ret,mpi_request);
 }
@@ -1028,8 +1310,8 @@ directRecv(void* recv_buffer,Int64 recv_buffer_size,
       {
         MpiLock::Section mls(m_mpi_lock);
         begin_time = MPI_Wtime();
-        int rbuf_size = _checkSize(recv_buffer_size);
-        m_mpi_prof->iRecv(recv_buffer, rbuf_size, data_type, i_proc, mpi_tag, m_communicator, &mpi_request);
+        LargeCountDatatype recv_type(recv_buffer_size,data_type,m_max_message_count);
+        m_mpi_prof->iRecv(recv_buffer, recv_type.count(), recv_type.datatype(), i_proc, mpi_tag, m_communicator, &mpi_request);
       }
       int is_finished = 0;
       MPI_Status mpi_status;
@@ -1046,8 +1328,8 @@ directRecv(void* recv_buffer,Int64 recv_buffer_size,
     else{
       MpiLock::Section mls(m_mpi_lock);
       begin_time = MPI_Wtime();
-      int rbuf_size = _checkSize(recv_buffer_size);
-      m_mpi_prof->recv(recv_buffer, rbuf_size, data_type, i_proc, mpi_tag, m_communicator, &mpi_status);
+      LargeCountDatatype recv_type(recv_buffer_size,data_type,m_max_message_count);
+      m_mpi_prof->recv(recv_buffer, recv_type.count(), recv_type.datatype(), i_proc, mpi_tag, m_communicator, &mpi_status);
       end_time = MPI_Wtime();
     }
   }
@@ -1055,8 +1337,8 @@ directRecv(void* recv_buffer,Int64 recv_buffer_size,
     {
       MpiLock::Section mls(m_mpi_lock);
       begin_time = MPI_Wtime();
-      int rbuf_size = _checkSize(recv_buffer_size);
-      m_mpi_prof->iRecv(recv_buffer, rbuf_size, data_type, i_proc, mpi_tag, m_communicator, &mpi_request);
+      LargeCountDatatype recv_type(recv_buffer_size,data_type,m_max_message_count);
+      m_mpi_prof->iRecv(recv_buffer, recv_type.count(), recv_type.datatype(), i_proc, mpi_tag, m_communicator, &mpi_request);
       end_time = MPI_Wtime();
       ARCCORE_ADD_REQUEST(mpi_request);
     }
@@ -1239,8 +1521,8 @@ directRecv(void* recv_buffer,Int64 recv_buffer_size,
       {
         MpiLock::Section mls(m_mpi_lock);
         begin_time = MPI_Wtime();
-        int rbuf_size = _checkSize(recv_buffer_size);
-        MPI_Imrecv(recv_buffer,rbuf_size,data_type,&mpi_message,&mpi_request);
+        LargeCountDatatype recv_type(recv_buffer_size,data_type,m_max_message_count);
+        MPI_Imrecv(recv_buffer,recv_type.count(),recv_type.datatype(),&mpi_message,&mpi_request);
         //m_mpi_prof->iRecv(recv_buffer, rbuf_size, data_type, i_proc, mpi_tag, m_communicator, &mpi_request);
       }
       int is_finished = 0;
@@ -1258,8 +1540,8 @@ directRecv(void* recv_buffer,Int64 recv_buffer_size,
     else{
       MpiLock::Section mls(m_mpi_lock);
       begin_time = MPI_Wtime();
-      int rbuf_size = _checkSize(recv_buffer_size);
-      MPI_Mrecv(recv_buffer,rbuf_size,data_type,&mpi_message,&mpi_status);
+      LargeCountDatatype recv_type(recv_buffer_size,data_type,m_max_message_count);
+      MPI_Mrecv(recv_buffer,recv_type.count(),recv_type.datatype(),&mpi_message,&mpi_status);
       //m_mpi_prof->recv(recv_buffer, rbuf_size, data_type, i_proc, mpi_tag, m_communicator, &mpi_status);
       end_time = MPI_Wtime();
     }
@@ -1268,9 +1550,9 @@ directRecv(void* recv_buffer,Int64 recv_buffer_size,
     {
       MpiLock::Section mls(m_mpi_lock);
       begin_time = MPI_Wtime();
-      int rbuf_size = _checkSize(recv_buffer_size);
+      LargeCountDatatype recv_type(recv_buffer_size,data_type,m_max_message_count);
       //m_mpi_prof->iRecv(recv_buffer, rbuf_size, data_type, i_proc, mpi_tag, m_communicator, &mpi_request);
-      ret = MPI_Imrecv(recv_buffer,rbuf_size,data_type,&mpi_message,&mpi_request);
+      ret = MPI_Imrecv(recv_buffer,recv_type.count(),recv_type.datatype(),&mpi_message,&mpi_request);
       //m_mpi_prof->iRecv(recv_buffer, rbuf_size, data_type, i_proc, mpi_tag, m_communicator, &mpi_request);
       end_time = MPI_Wtime();
       ARCCORE_ADD_REQUEST(mpi_request);
@@ -1305,9 +1587,21 @@ directRecvPack(void* recv_buffer,Int64 recv_buffer_size,
 void MpiAdapter::
 waitAllRequests(ArrayView<Request> requests)
 {
-  UniqueArray<bool> indexes(requests.size());
-  UniqueArray<MPI_Status> mpi_status(requests.size());
-  while (_waitAllRequestsMPI(requests, indexes, mpi_status)){
+  WaitRequestsWorkspace workspace;
+  waitAllRequests(requests,workspace);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiAdapter::
+waitAllRequests(ArrayView<Request> requests,WaitRequestsWorkspace& workspace)
+{
+  workspace._resize(requests.size());
+  ArrayView<bool> indexes(workspace.m_done_indexes.view());
+  ArrayView<MPI_Status> mpi_status(workspace.m_mpi_status.view());
+  ArrayView<MPI_Request> mpi_requests(workspace.m_mpi_requests.view());
+  while (_waitAllRequestsMPI(requests, indexes, mpi_status, mpi_requests)){
     ; // Continue tant qu'il y a des requêtes.
   }
 }
@@ -1321,8 +1615,22 @@ waitSomeRequests(ArrayView<Request> requests,
                  ArrayView<bool> indexes,
                  bool is_non_blocking)
 {
-  UniqueArray<MPI_Status> mpi_status(requests.size());
-  waitSomeRequestsMPI(requests, indexes, mpi_status, is_non_blocking);
+  WaitRequestsWorkspace workspace;
+  waitSomeRequests(requests, indexes, is_non_blocking, workspace);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiAdapter::
+waitSomeRequests(ArrayView<Request> requests,
+                 ArrayView<bool> indexes,
+                 bool is_non_blocking,
+                 WaitRequestsWorkspace& workspace)
+{
+  workspace._resize(requests.size());
+  _waitSomeRequestsMPI(requests, indexes, workspace.m_mpi_status, workspace.m_mpi_requests,
+                       workspace.m_completed_indexes, is_non_blocking);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1432,13 +1740,13 @@ _handleEndRequests(ArrayView<Request> requests,ArrayView<bool> done_indexes,
 bool MpiAdapter::
 _waitAllRequestsMPI(ArrayView<Request> requests,
                     ArrayView<bool> indexes,
-                    ArrayView<MPI_Status> mpi_status)
+                    ArrayView<MPI_Status> mpi_status,
+                    ArrayView<MPI_Request> mpi_request)
 {
   Integer size = requests.size();
   if (size==0)
     return false;
   //ATTENTION: Mpi modifie en retour de MPI_Waitall ce tableau
-  UniqueArray<MPI_Request> mpi_request(size);
   for( Integer i=0; i<size; ++i ){
     mpi_request[i] = (MPI_Request)(requests[i]);
   }
@@ -1485,14 +1793,54 @@ _waitAllRequestsMPI(ArrayView<Request> requests,
 void MpiAdapter::
 waitSomeRequestsMPI(ArrayView<Request> requests,ArrayView<bool> indexes,
                     ArrayView<MPI_Status> mpi_status,bool is_non_blocking)
+{
+  if (requests.size()==0)
+    return;
+  WaitRequestsWorkspace workspace;
+  waitSomeRequestsMPI(requests,indexes,mpi_status,is_non_blocking,workspace);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Attend certaines requêtes.
+ *
+ * Les statuts sont retournés dans \a mpi_status. Les autres tableaux
+ * nécessaires à l'attente sont pris dans \a workspace et ne sont donc
+ * pas réalloués si \a workspace est conservé entre deux appels.
+ */
+void MpiAdapter::
+waitSomeRequestsMPI(ArrayView<Request> requests,ArrayView<bool> indexes,
+                    ArrayView<MPI_Status> mpi_status,bool is_non_blocking,
+                    WaitRequestsWorkspace& workspace)
+{
+  Integer size = requests.size();
+  if (size==0)
+    return;
+  workspace._resize(size);
+  _waitSomeRequestsMPI(requests,indexes,mpi_status,workspace.m_mpi_requests,
+                       workspace.m_completed_indexes,is_non_blocking);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation de waitSome/testSome.
+ *
+ * Les tableaux \a saved_mpi_request et \a completed_requests sont des
+ * tableaux de travail fournis par l'appelant et doivent avoir au moins
+ * autant d'éléments que \a requests.
+ */
+void MpiAdapter::
+_waitSomeRequestsMPI(ArrayView<Request> requests,ArrayView<bool> indexes,
+                     ArrayView<MPI_Status> mpi_status,
+                     ArrayView<MPI_Request> saved_mpi_request,
+                     ArrayView<int> completed_requests,
+                     bool is_non_blocking)
 {
   Integer size = requests.size();
   if (size==0)
     return;
-  //TODO: utiliser des StackArray (quand ils seront disponibles...)
-  UniqueArray<MPI_Request> mpi_request(size);
-  UniqueArray<MPI_Request> saved_mpi_request(size);
-  UniqueArray<int> completed_requests(size);
   int nb_completed_request = 0;
 
   // Sauve la requete pour la desallouer dans m_allocated_requests,
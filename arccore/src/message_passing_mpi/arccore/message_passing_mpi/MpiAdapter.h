@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MpiAdapter.h                                                (C) 2000-2020 */
+/* MpiAdapter.h                                                (C) 2000-2024 */
 /*                                                                           */
 /* Implémentation des messages avec MPI.                                     */
 /*---------------------------------------------------------------------------*/
@@ -21,7 +21,7 @@
 #include "arccore/message_passing_mpi/IMpiProfiling.h"
 #include "arccore/message_passing/PointToPointMessageInfo.h"
 #include "arccore/message_passing/Request.h"
-#include "arccore/collections/CollectionsGlobal.h"
+#include "arccore/collections/Array.h"
 
 #include "arccore/base/BaseTypes.h"
 
@@ -51,6 +51,37 @@ class ARCCORE_MESSAGEPASSINGMPI_EXPORT MpiAdapter
  public:
   class RequestSet;
   struct SubRequestInfo;
+
+  /*!
+   * \brief Tableaux de travail pour l'attente des requêtes.
+   *
+   * Une instance de cette classe peut être conservée entre deux appels
+   * à waitAllRequests() ou waitSomeRequests() pour éviter les allocations
+   * mémoire à chaque attente. Une instance ne doit pas être utilisée
+   * simultanément par plusieurs threads.
+   */
+  class WaitRequestsWorkspace
+  {
+    friend MpiAdapter;
+
+   private:
+
+    void _resize(Int32 size)
+    {
+      m_done_indexes.resize(size);
+      m_mpi_status.resize(size);
+      m_mpi_requests.resize(size);
+      m_completed_indexes.resize(size);
+    }
+
+   private:
+
+    UniqueArray<bool> m_done_indexes;
+    UniqueArray<MPI_Status> m_mpi_status;
+    UniqueArray<MPI_Request> m_mpi_requests;
+    UniqueArray<int> m_completed_indexes;
+  };
+
  public:
 
   MpiAdapter(ITraceMng* msg,IStat* stat,
@@ -125,19 +156,37 @@ class ARCCORE_MESSAGEPASSINGMPI_EXPORT MpiAdapter
                          Int32 proc,int mpi_tag,bool is_blocking);
 
   void waitAllRequests(ArrayView<Request> requests);
+  //! Attend toutes les requêtes en utilisant les tableaux de travail \a workspace
+  void waitAllRequests(ArrayView<Request> requests,WaitRequestsWorkspace& workspace);
 
 
  private:
   bool _waitAllRequestsMPI(ArrayView<Request> requests,ArrayView<bool> indexes,
-                           ArrayView<MPI_Status> mpi_status);
+                           ArrayView<MPI_Status> mpi_status,
+                           ArrayView<MPI_Request> mpi_requests);
+  void _waitSomeRequestsMPI(ArrayView<Request> requests,ArrayView<bool> indexes,
+                            ArrayView<MPI_Status> mpi_status,
+                            ArrayView<MPI_Request> mpi_requests,
+                            ArrayView<int> completed_requests,
+                            bool is_non_blocking);
  public:
   void waitSomeRequests(ArrayView<Request> requests,
                         ArrayView<bool> indexes,
                         bool is_non_blocking);
+  //! Attend certaines requêtes en utilisant les tableaux de travail \a workspace
+  void waitSomeRequests(ArrayView<Request> requests,
+                        ArrayView<bool> indexes,
+                        bool is_non_blocking,
+                        WaitRequestsWorkspace& workspace);
 
   void waitSomeRequestsMPI(ArrayView<Request> requests,
                            ArrayView<bool> indexes,
                            ArrayView<MPI_Status> mpi_status,bool is_non_blocking);
+  //! Attend certaines requêtes en utilisant les tableaux de travail \a workspace
+  void waitSomeRequestsMPI(ArrayView<Request> requests,
+                           ArrayView<bool> indexes,
+                           ArrayView<MPI_Status> mpi_status,bool is_non_blocking,
+                           WaitRequestsWorkspace& workspace);
  public:
   //! Rang de cette instance dans le communicateur
   int commRank() const { return m_comm_rank; }
@@ -169,6 +218,17 @@ class ARCCORE_MESSAGEPASSINGMPI_EXPORT MpiAdapter
 
   int toMPISize(Int64 count);
 
+  /*!
+   * \brief Nombre maximum d'éléments d'un message MPI utilisant un 'int'.
+   *
+   * Au delà de cette valeur, les envois et réceptions utilisent un type
+   * dérivé et les réductions utilisent les fonctions MPI 4 ou sont
+   * découpées en plusieurs morceaux. Vaut INT32_MAX par défaut. La variable
+   * d'environnement ARCCORE_MPI_MAX_MESSAGE_COUNT permet de diminuer cette
+   * valeur pour tester ces mécanismes.
+   */
+  Int64 maxMessageCount() const { return m_max_message_count; }
+
   //! Construit une requête Arccore à partir d'une requête MPI.
   Request buildRequest(int ret,MPI_Request request);
 
@@ -217,6 +277,7 @@ class ARCCORE_MESSAGEPASSINGMPI_EXPORT MpiAdapter
   int m_comm_size;
   Int64 m_nb_all_reduce = 0;
   Int64 m_nb_reduce = 0;
+  Int64 m_max_message_count = INT32_MAX;
   bool m_is_trace = false;
   RequestSet* m_request_set = nullptr;
   //! Requêtes vides. Voir MpiAdapter.cc pour plus d'infos.
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MpiRequestList.cc                                           (C) 2000-2020 */
+/* MpiRequestList.cc                                           (C) 2000-2024 */
 /*                                                                           */
 /* Classe de base d'une liste de requêtes.                                   */
 /*---------------------------------------------------------------------------*/
@@ -28,7 +28,7 @@ _wait(eWaitType wait_type)
 {
   switch(wait_type){
   case WaitAll:
-    m_adapter->waitAllRequests(_requests());
+    m_adapter->waitAllRequests(_requests(),m_workspace);
     break;
   case WaitSome:
     _doWaitSome(false);
@@ -45,9 +45,7 @@ _wait(eWaitType wait_type)
 void MpiRequestList::
 _doWaitSome(bool is_non_blocking)
 {
-  Integer nb_request = size();
-  m_requests_status.resize(nb_request);
-  m_adapter->waitSomeRequests(_requests(),_requestsDone(), is_non_blocking);
+  m_adapter->waitSomeRequests(_requests(),_requestsDone(), is_non_blocking, m_workspace);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MpiRequestList.h                                            (C) 2000-2020 */
+/* MpiRequestList.h                                            (C) 2000-2024 */
 /*                                                                           */
 /* Liste de requêtes MPI.                                                    */
 /*---------------------------------------------------------------------------*/
@@ -16,6 +16,7 @@
 
 #include "arccore/message_passing/RequestListBase.h"
 #include "arccore/message_passing_mpi/MessagePassingMpiGlobal.h"
+#include "arccore/message_passing_mpi/MpiAdapter.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -39,7 +40,8 @@ class ARCCORE_MESSAGEPASSINGMPI_EXPORT MpiRequestList
  private:
 
   MpiAdapter* m_adapter;
-  UniqueArray<MPI_Status> m_requests_status;
+  //! Tableaux de travail conservés entre deux attentes
+  MpiAdapter::WaitRequestsWorkspace m_workspace;
 
  private:
 
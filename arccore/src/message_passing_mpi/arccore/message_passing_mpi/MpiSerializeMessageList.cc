@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MpiSerializeMessageList.cc                                  (C) 2000-2023 */
+/* MpiSerializeMessageList.cc                                  (C) 2000-2024 */
 /*                                                                           */
 /* Gestion des messages de sérialisationd via MPI.                           */
 /*---------------------------------------------------------------------------*/
@@ -260,12 +260,12 @@ _waitMessages2(eWaitType wait_type)
     case WaitSome:
       msg->debug() << " rank=" << comm_rank << "Wait some " << nb_message;
       if (nb_message>0)
-        adapter->waitSomeRequestsMPI(requests,done_indexes,mpi_status,false);
+        adapter->waitSomeRequestsMPI(requests,done_indexes,mpi_status,false,m_wait_workspace);
       break;
     case WaitSomeNonBlocking:
       msg->debug() << " rank=" << comm_rank << "Wait some non blocking " << nb_message;
       if (nb_message>0)
-        adapter->waitSomeRequestsMPI(requests,done_indexes,mpi_status,true);
+        adapter->waitSomeRequestsMPI(requests,done_indexes,mpi_status,true,m_wait_workspace);
       break;
     }
   }
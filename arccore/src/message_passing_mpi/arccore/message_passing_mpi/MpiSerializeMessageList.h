@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MpiSerializeMessageList.h                                   (C) 2000-2020 */
+/* MpiSerializeMessageList.h                                   (C) 2000-2024 */
 /*                                                                           */
 /* Implémentation de ISerializeMessageList pour MPI.                         */
 /*---------------------------------------------------------------------------*/
@@ -15,6 +15,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "arccore/message_passing_mpi/MessagePassingMpiGlobal.h"
+#include "arccore/message_passing_mpi/MpiAdapter.h"
 #include "arccore/message_passing/ISerializeMessageList.h"
 #include "arccore/message_passing/Request.h"
 #include "arccore/trace/TraceGlobal.h"
@@ -91,6 +92,8 @@ class ARCCORE_MESSAGEPASSINGMPI_EXPORT MpiSerializeMessageList
   UniqueArray<MpiSerializeMessageRequest> m_messages_request;
   TimeMetricAction m_message_passing_phase;
   bool m_is_verbose = false;
+  //! Tableaux de travail conservés entre deux attentes
+  MpiAdapter::WaitRequestsWorkspace m_wait_workspace;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -84,6 +84,10 @@ class MpiTypeDispatcher
  private:
 
   void _gatherVariable2(Span<const Type> send_buf, Array<Type>& recv_buf, Integer rank);
+  void _gatherVariableLarge(Span<const Type> send_buf, Array<Type>& recv_buf,
+                            ConstArrayView<Int64> counts, Int32 rank);
+  void _scatterVariableLarge(Span<const Type> send_buf, Span<Type> recv_buf,
+                             ConstArrayView<Int64> counts, Int32 root);
 };
 
 /*---------------------------------------------------------------------------*/
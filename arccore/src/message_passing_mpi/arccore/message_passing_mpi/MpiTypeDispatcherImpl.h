@@ -110,38 +110,78 @@ template<class Type> void MpiTypeDispatcher<Type>::
 _gatherVariable2(Span<const Type> send_buf,Array<Type>& recv_buf,Int32 rank)
 {
   Int32 comm_size = m_parallel_mng->commSize();
-  UniqueArray<int> send_counts(comm_size);
-  UniqueArray<int> send_indexes(comm_size);
+  Int32 my_rank = m_adapter->commRank();
 
+  // Récupère le nombre d'éléments de chaque processeur. Tous les rangs ont
+  // besoin du nombre total d'éléments pour choisir le mode d'échange.
+  UniqueArray<Int64> counts(comm_size);
   Int64 nb_elem = send_buf.size();
-  int my_buf_count = (int)nb_elem;
-  Span<const int> count_r(&my_buf_count,1);
+  Span<const Int64> count_r(&nb_elem,1);
+  mpAllGather(m_parallel_mng,count_r,counts);
 
-  // Récupère le nombre d'éléments de chaque processeur
-  if (rank!=A_NULL_RANK)
-    mpGather(m_parallel_mng,count_r,send_counts,rank);
-  else
-    mpAllGather(m_parallel_mng,count_r,send_counts);
+  Int64 total_elem = 0;
+  for( Integer i=0, is=comm_size; i<is; ++i )
+    total_elem += counts[i];
 
-  // Remplit le tableau des index
-  if (rank==A_NULL_RANK || rank==m_adapter->commRank()){
-    Int64 index = 0;
-    for( Integer i=0, is=comm_size; i<is; ++i ){
-      send_indexes[i] = (int)index;
-      index += send_counts[i];
-      //info() << " SEND " << i << " index=" << send_indexes[i] << " count=" << send_counts[i];
-    }
-    Int64 i64_total_elem = index;
-    Int64 max_size = ARCCORE_INT64_MAX;
-    if (i64_total_elem>max_size){
-      ARCCORE_FATAL("Invalid size '{0}'",i64_total_elem);
-    }
-    Int64 total_elem = i64_total_elem;
+  bool is_receiver = (rank==A_NULL_RANK || rank==my_rank);
+  if (is_receiver)
     recv_buf.resize(total_elem);
+
+  if (total_elem>m_adapter->maxMessageCount()){
+    _gatherVariableLarge(send_buf,recv_buf,counts,rank);
+    return;
+  }
+
+  // Remplit le tableau des index
+  UniqueArray<int> send_counts(comm_size);
+  UniqueArray<int> send_indexes(comm_size);
+  Int64 index = 0;
+  for( Integer i=0, is=comm_size; i<is; ++i ){
+    send_counts[i] = (int)counts[i];
+    send_indexes[i] = (int)index;
+    index += counts[i];
   }
   gatherVariable(send_buf,recv_buf,send_counts,send_indexes,rank);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief GatherVariable lorsque le nombre total d'éléments ne tient pas
+ * dans un 'int'.
+ *
+ * Dans ce cas, les index de MPI_Gatherv() ne sont pas représentables. La
+ * contribution de chaque rang est alors envoyée séparément, via un
+ * broadcast pour allGatherVariable() et via un message point à point vers
+ * \a rank pour gatherVariable(). Les messages de plus de 2^31 éléments sont
+ * gérés par MpiAdapter.
+ */
+template<class Type> void MpiTypeDispatcher<Type>::
+_gatherVariableLarge(Span<const Type> send_buf,Array<Type>& recv_buf,
+                     ConstArrayView<Int64> counts,Int32 rank)
+{
+  Int32 comm_size = m_parallel_mng->commSize();
+  Int32 my_rank = m_adapter->commRank();
+  bool is_all_gather = (rank==A_NULL_RANK);
+
+  if (!is_all_gather && my_rank!=rank){
+    send(send_buf,rank,true);
+    return;
+  }
+
+  Int64 index = 0;
+  for( Int32 i=0; i<comm_size; ++i ){
+    Span<Type> part = recv_buf.span().subSpan(index,counts[i]);
+    index += counts[i];
+    if (i==my_rank)
+      part.copy(send_buf);
+    if (is_all_gather)
+      broadcast(part,i);
+    else if (i!=my_rank)
+      receive(part,i,true);
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -170,19 +210,29 @@ scatterVariable(Span<const Type> send_buf,Span<Type> recv_buf,Int32 root)
   MPI_Datatype type = m_datatype->datatype();
 
   Int32 comm_size = m_adapter->commSize();
-  UniqueArray<int> recv_counts(comm_size);
-  UniqueArray<int> recv_indexes(comm_size);
 
+  // Récupère le nombre d'éléments de chaque processeur. Tous les rangs ont
+  // besoin du nombre total d'éléments pour choisir le mode d'échange.
+  UniqueArray<Int64> counts(comm_size);
   Int64 nb_elem = recv_buf.size();
-  int my_buf_count = m_adapter->toMPISize(nb_elem);
-  Span<const int> count_r(&my_buf_count,1);
+  Span<const Int64> count_r(&nb_elem,1);
+  mpAllGather(m_parallel_mng,count_r,counts);
 
-  // Récupère le nombre d'éléments de chaque processeur
-  mpAllGather(m_parallel_mng,count_r,recv_counts);
+  Int64 total_elem = 0;
+  for( Integer i=0, is=comm_size; i<is; ++i )
+    total_elem += counts[i];
+
+  if (total_elem>m_adapter->maxMessageCount()){
+    _scatterVariableLarge(send_buf,recv_buf,counts,root);
+    return;
+  }
 
   // Remplit le tableau des index
+  UniqueArray<int> recv_counts(comm_size);
+  UniqueArray<int> recv_indexes(comm_size);
   int index = 0;
   for( Integer i=0, is=comm_size; i<is; ++i ){
+    recv_counts[i] = (int)counts[i];
     recv_indexes[i] = index;
     index += recv_counts[i];
   }
@@ -191,6 +241,39 @@ scatterVariable(Span<const Type> send_buf,Span<Type> recv_buf,Int32 root)
                              recv_buf.data(),nb_elem,root,type);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief ScatterVariable lorsque le nombre total d'éléments ne tient pas
+ * dans un 'int'.
+ *
+ * Comme pour _gatherVariableLarge(), la partie de chaque rang est envoyée
+ * par \a root via un message point à point. Les messages de plus de 2^31
+ * éléments sont gérés par MpiAdapter.
+ */
+template<class Type> void MpiTypeDispatcher<Type>::
+_scatterVariableLarge(Span<const Type> send_buf,Span<Type> recv_buf,
+                      ConstArrayView<Int64> counts,Int32 root)
+{
+  Int32 comm_size = m_parallel_mng->commSize();
+  Int32 my_rank = m_adapter->commRank();
+
+  if (my_rank!=root){
+    receive(recv_buf,root,true);
+    return;
+  }
+
+  Int64 index = 0;
+  for( Int32 i=0; i<comm_size; ++i ){
+    Span<const Type> part = send_buf.subSpan(index,counts[i]);
+    index += counts[i];
+    if (i==my_rank)
+      recv_buf.copy(part);
+    else
+      send(part,i,true);
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
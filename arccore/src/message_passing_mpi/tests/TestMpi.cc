@@ -12,10 +12,13 @@
 #include "arccore/base/Float16.h"
 #include "arccore/collections/Array.h"
 #include "arccore/message_passing/Messages.h"
+#include "arccore/message_passing/IRequestList.h"
+#include "arccore/message_passing/PointToPointMessageInfo.h"
 #include "arccore/serialize/ISerializer.h"
 
 #include "TestMain.h"
 
+#include <cstdlib>
 #include <iostream>
 
 using namespace Arccore;
@@ -79,6 +82,45 @@ TEST(MessagePassingMpi, SerializeGather)
   ASSERT_EQ(send_buf[2], receive_buf[2]);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+// Teste un grand nombre de requêtes simultanées pour vérifier la gestion
+// interne des requêtes (agrandissement du registre et suppression).
+
+TEST(MessagePassingMpi, ManyRequests)
+{
+  Ref<IMessagePassingMng> pm(StandaloneMpiMessagePassingMng::createRef(global_mpi_comm_world));
+  ASSERT_EQ(pm->commSize(), 2);
+  Int32 my_rank = pm->commRank();
+  Int32 other_rank = 1 - my_rank;
+  const Int32 nb_message = 5000;
+  UniqueArray<Int32> send_buf(nb_message);
+  UniqueArray<Int32> receive_buf(nb_message);
+  for (Int32 i = 0; i < nb_message; ++i) {
+    send_buf[i] = i + (my_rank * 10000);
+    receive_buf[i] = -1;
+  }
+
+  Ref<IRequestList> request_list = mpCreateRequestListRef(pm.get());
+  for (Int32 i = 0; i < nb_message; ++i) {
+    PointToPointMessageInfo msg(MessageRank(other_rank), MessageTag(i), NonBlocking);
+    request_list->add(mpReceive(pm.get(), receive_buf.span().subSpan(i, 1), msg));
+  }
+  for (Int32 i = 0; i < nb_message; ++i) {
+    PointToPointMessageInfo msg(MessageRank(other_rank), MessageTag(i), NonBlocking);
+    request_list->add(mpSend(pm.get(), send_buf.constSpan().subSpan(i, 1), msg));
+  }
+
+  Int32 nb_done = 0;
+  while (request_list->size() > 0) {
+    nb_done += request_list->wait(WaitSome);
+    request_list->removeDoneRequests();
+  }
+  ASSERT_EQ(nb_done, 2 * nb_message);
+  for (Int32 i = 0; i < nb_message; ++i)
+    ASSERT_EQ(receive_buf[i], i + (other_rank * 10000));
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -139,3 +181,150 @@ TEST(MessagePassingMpi, Float16)
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
+// Teste les messages dont la taille dépasse MpiAdapter::maxMessageCount().
+// Ce test est lancé avec la variable d'environnement
+// ARCCORE_MPI_MAX_MESSAGE_COUNT positionnée à une petite valeur pour
+// utiliser les mécanismes des messages de plus de 2^31 éléments.
+
+namespace
+{
+
+void _doTestLargeMessage(IMessagePassingMng* pm, Int64 nb_value)
+{
+  Int32 nb_rank = pm->commSize();
+  Int32 my_rank = pm->commRank();
+  auto value = [](Int32 rank, Int64 i) { return static_cast<Byte>((rank * 7 + i) % 251); };
+
+  // Envoi/réception bloquants et non bloquants entre les rangs 0 et 1.
+  if (nb_rank >= 2 && my_rank < 2) {
+    Int32 other_rank = 1 - my_rank;
+    UniqueArray<Byte> send_buf(nb_value);
+    UniqueArray<Byte> receive_buf(nb_value);
+    for (Int64 i = 0; i < nb_value; ++i)
+      send_buf[i] = value(my_rank, i);
+    if (my_rank == 0) {
+      mpSend(pm, send_buf, other_rank);
+      mpReceive(pm, receive_buf, other_rank);
+    }
+    else {
+      mpReceive(pm, receive_buf, other_rank);
+      mpSend(pm, send_buf, other_rank);
+    }
+    for (Int64 i = 0; i < nb_value; ++i)
+      ASSERT_EQ(receive_buf[i], value(other_rank, i));
+
+    receive_buf.fill(0);
+    Ref<IRequestList> request_list = mpCreateRequestListRef(pm);
+    PointToPointMessageInfo recv_msg(MessageRank(other_rank), NonBlocking);
+    request_list->add(mpReceive(pm, receive_buf.span(), recv_msg));
+    PointToPointMessageInfo send_msg(MessageRank(other_rank), NonBlocking);
+    request_list->add(mpSend(pm, send_buf.constSpan(), send_msg));
+    request_list->wait(WaitAll);
+    for (Int64 i = 0; i < nb_value; ++i)
+      ASSERT_EQ(receive_buf[i], value(other_rank, i));
+  }
+
+  // Broadcast
+  {
+    UniqueArray<Byte> buf(nb_value);
+    if (my_rank == 0)
+      for (Int64 i = 0; i < nb_value; ++i)
+        buf[i] = value(0, i);
+    mpBroadcast(pm, buf.span(), 0);
+    for (Int64 i = 0; i < nb_value; ++i)
+      ASSERT_EQ(buf[i], value(0, i));
+  }
+
+  // AllGatherVariable avec un nombre d'éléments différent par rang.
+  {
+    Int64 my_size = nb_value / nb_rank + my_rank;
+    UniqueArray<Byte> send_buf(my_size);
+    for (Int64 i = 0; i < my_size; ++i)
+      send_buf[i] = value(my_rank, i);
+    UniqueArray<Byte> receive_buf;
+    mpAllGatherVariable(pm, send_buf.constSpan(), receive_buf);
+    Int64 index = 0;
+    for (Int32 r = 0; r < nb_rank; ++r) {
+      Int64 size = nb_value / nb_rank + r;
+      for (Int64 i = 0; i < size; ++i)
+        ASSERT_EQ(receive_buf[index + i], value(r, i));
+      index += size;
+    }
+    ASSERT_EQ(receive_buf.size(), index);
+  }
+
+  // ScatterVariable avec un nombre d'éléments différent par rang.
+  {
+    Int32 root = nb_rank - 1;
+    Int64 total_size = 0;
+    for (Int32 r = 0; r < nb_rank; ++r)
+      total_size += nb_value / nb_rank + r;
+    UniqueArray<Byte> send_buf;
+    if (my_rank == root) {
+      send_buf.resize(total_size);
+      Int64 index = 0;
+      for (Int32 r = 0; r < nb_rank; ++r) {
+        Int64 size = nb_value / nb_rank + r;
+        for (Int64 i = 0; i < size; ++i)
+          send_buf[index + i] = value(r, i);
+        index += size;
+      }
+    }
+    Int64 my_size = nb_value / nb_rank + my_rank;
+    UniqueArray<Byte> receive_buf(my_size);
+    mpScatterVariable(pm, send_buf.constSpan(), receive_buf.span(), root);
+    for (Int64 i = 0; i < my_size; ++i)
+      ASSERT_EQ(receive_buf[i], value(my_rank, i));
+  }
+
+  // AllToAll
+  {
+    Int32 count = static_cast<Int32>(nb_value / nb_rank);
+    UniqueArray<Byte> send_buf(static_cast<Int64>(count) * nb_rank);
+    UniqueArray<Byte> receive_buf(static_cast<Int64>(count) * nb_rank);
+    for (Int32 r = 0; r < nb_rank; ++r)
+      for (Int64 i = 0; i < count; ++i)
+        send_buf[static_cast<Int64>(r) * count + i] = value(my_rank, i + r);
+    mpAllToAll(pm, send_buf.constSpan(), receive_buf.span(), count);
+    for (Int32 r = 0; r < nb_rank; ++r)
+      for (Int64 i = 0; i < count; ++i)
+        ASSERT_EQ(receive_buf[static_cast<Int64>(r) * count + i], value(r, i + my_rank));
+  }
+
+  // Réduction découpée en plusieurs morceaux.
+  {
+    Int64 nb_reduce = nb_value / 8;
+    UniqueArray<Int64> buf(nb_reduce);
+    for (Int64 i = 0; i < nb_reduce; ++i)
+      buf[i] = i + my_rank;
+    mpAllReduce(pm, ReduceSum, buf.span());
+    Int64 rank_sum = (static_cast<Int64>(nb_rank) * (nb_rank - 1)) / 2;
+    for (Int64 i = 0; i < nb_reduce; ++i)
+      ASSERT_EQ(buf[i], i * nb_rank + rank_sum);
+  }
+}
+
+} // namespace
+
+TEST(MessagePassingMpi, LargeMessage)
+{
+  Ref<IMessagePassingMng> pm(StandaloneMpiMessagePassingMng::createRef(global_mpi_comm_world));
+  _doTestLargeMessage(pm.get(), 25037);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+// Teste des messages de plus de 2 Go. Ce test utilise beaucoup de mémoire
+// et n'est effectué que si la variable d'environnement
+// ARCCORE_TEST_HUGE_MPI_MESSAGE est positionnée.
+
+TEST(MessagePassingMpi, HugeMessage)
+{
+  if (!std::getenv("ARCCORE_TEST_HUGE_MPI_MESSAGE"))
+    GTEST_SKIP() << "Set environment variable ARCCORE_TEST_HUGE_MPI_MESSAGE to run this test";
+  Ref<IMessagePassingMng> pm(StandaloneMpiMessagePassingMng::createRef(global_mpi_comm_world));
+  _doTestLargeMessage(pm.get(), (Int64(1) << 31) + 4099);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
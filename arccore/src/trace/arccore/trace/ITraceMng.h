@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ITraceMng.h                                                 (C) 2000-2021 */
+/* ITraceMng.h                                                 (C) 2000-2024 */
 /*                                                                           */
 /* Gestionnaire des traces.                                                  */
 /*---------------------------------------------------------------------------*/
@@ -405,6 +405,32 @@ class ARCCORE_TRACE_EXPORT ITraceMng
 extern "C++" ARCCORE_TRACE_EXPORT
 ITraceMng* arccoreCreateDefaultTraceMng();
 
+/*!
+ * \brief Écrit les traces en attente dans les tampons asynchrones.
+ *
+ * Cette méthode ne fait rien si l'écriture asynchrone des traces n'est
+ * pas active (variable d'environnement ARCCORE_TRACE_ASYNC).
+ *
+ * \warning Cette méthode utilise des verrous et n'est donc pas
+ * utilisable dans un gestionnaire de signal. Il faut dans ce cas utiliser
+ * arccoreWriteAsyncTracesSignalSafe().
+ */
+extern "C++" ARCCORE_TRACE_EXPORT
+void arccoreFlushAsyncTraces();
+
+/*!
+ * \brief Écrit les traces en attente dans les tampons asynchrones dans
+ * le descripteur de fichier \a fd.
+ *
+ * Cette méthode n'utilise ni verrou ni allocation mémoire et peut être
+ * appelée depuis un gestionnaire de signal. Les messages sont écrits
+ * directement via write(2), sans couleur, et ne seront pas réécrits par
+ * la vidange suivante. Elle ne fait rien si l'écriture asynchrone des
+ * traces n'est pas active.
+ */
+extern "C++" ARCCORE_TRACE_EXPORT
+void arccoreWriteAsyncTracesSignalSafe(int fd);
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
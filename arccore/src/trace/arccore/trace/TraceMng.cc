@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* TraceMng.cc                                                 (C) 2000-2021 */
+/* TraceMng.cc                                                 (C) 2000-2024 */
 /*                                                                           */
 /* Gestionnaire des traces.                                                  */
 /*---------------------------------------------------------------------------*/
@@ -35,9 +35,23 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
 
 #include <time.h>
 
+#ifdef ARCCORE_OS_WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -186,6 +200,210 @@ namespace
 thread_local TraceMngStreamListStorage global_stream_list_storage;
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Tampon circulaire sans verrou pour un producteur et un consommateur.
+ *
+ * Le producteur est le thread qui génère les traces. Le consommateur est
+ * le thread d'écriture de TraceAsyncWriter ou un thread qui force la
+ * vidange via TraceAsyncWriter::drain(). Chaque message est précédé
+ * d'un en-tête qui contient sa taille et ses destinations.
+ *
+ * Les positions sont des compteurs croissants et la capacité est une
+ * puissance de 2.
+ *
+ * writeSignalSafe() permet d'écrire les messages en attente depuis un
+ * gestionnaire de signal. Elle ne modifie pas la position de lecture pour
+ * ne pas interférer avec le consommateur, mais conserve la position jusqu'à
+ * laquelle les messages ont été écrits pour qu'ils ne soient pas écrits
+ * une seconde fois lors de la vidange suivante.
+ */
+class TraceAsyncRingBuffer
+{
+ public:
+
+  struct Header
+  {
+    UInt32 size;
+    Byte targets;
+    Int8 color;
+    Byte padding[2];
+  };
+  static constexpr Int64 HEADER_SIZE = sizeof(Header);
+
+ public:
+
+  explicit TraceAsyncRingBuffer(Int64 capacity)
+  : m_capacity(capacity), m_mask(capacity-1), m_buffer(new Byte[capacity])
+  {
+  }
+
+ public:
+
+  Int64 capacity() const { return m_capacity; }
+  Int64 usedSize() const
+  {
+    return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+  }
+  //! Indique que le TraceAsyncWriter associé a été détruit
+  bool isClosed() const { return m_is_closed.load(std::memory_order_acquire); }
+  void close() { m_is_closed.store(true,std::memory_order_release); }
+
+  //! Ajoute un message. Retourne \a false s'il n'y a pas assez de place.
+  bool tryPush(const Header& header,Span<const Byte> data)
+  {
+    const Int64 needed = HEADER_SIZE + data.size();
+    const Int64 head = m_head.load(std::memory_order_relaxed);
+    if (needed > (m_capacity - (head - m_cached_tail))){
+      m_cached_tail = m_tail.load(std::memory_order_acquire);
+      if (needed > (m_capacity - (head - m_cached_tail)))
+        return false;
+    }
+    _copyIn(head,&header,HEADER_SIZE);
+    _copyIn(head+HEADER_SIZE,data.data(),data.size());
+    m_head.store(head+needed,std::memory_order_release);
+    return true;
+  }
+
+  /*!
+   * \brief Consomme tous les messages disponibles et appelle \a func pour chacun.
+   *
+   * \a tmp_buffer sert à recopier les messages qui sont à cheval sur la fin
+   * du tampon. Retourne le nombre de messages consommés.
+   */
+  template<typename Func> Int64
+  consume(const Func& func,std::vector<Byte>& tmp_buffer)
+  {
+    Int64 tail = m_tail.load(std::memory_order_relaxed);
+    const Int64 head = m_head.load(std::memory_order_acquire);
+    Int64 nb_message = 0;
+    while (tail<head){
+      Header header;
+      _copyOut(tail,&header,HEADER_SIZE);
+      const Int64 size = header.size;
+      const Int64 pos = (tail+HEADER_SIZE) & m_mask;
+      Span<const Byte> data;
+      if ((pos+size)<=m_capacity)
+        data = Span<const Byte>(m_buffer.get()+pos,size);
+      else{
+        tmp_buffer.resize(size);
+        _copyOut(tail+HEADER_SIZE,tmp_buffer.data(),size);
+        data = Span<const Byte>(tmp_buffer.data(),size);
+      }
+      // Ne réécrit pas les messages déjà écrits par writeSignalSafe().
+      if (tail>=m_signal_written_pos.load(std::memory_order_acquire))
+        func(header,data);
+      tail += HEADER_SIZE + size;
+      // Libère la place au fur et à mesure pour débloquer le producteur.
+      m_tail.store(tail,std::memory_order_release);
+      ++nb_message;
+    }
+    return nb_message;
+  }
+
+  /*!
+   * \brief Écrit les messages en attente dans le descripteur \a fd.
+   *
+   * Cette méthode n'utilise ni verrou ni allocation mémoire et peut donc
+   * être appelée depuis un gestionnaire de signal.
+   */
+  void writeSignalSafe(int fd)
+  {
+    Int64 tail = std::max(m_tail.load(std::memory_order_acquire),
+                          m_signal_written_pos.load(std::memory_order_acquire));
+    const Int64 head = m_head.load(std::memory_order_acquire);
+    while (tail<head){
+      Header header;
+      _copyOut(tail,&header,HEADER_SIZE);
+      const Int64 size = header.size;
+      // Le message peut être incohérent si le tampon est modifié pendant
+      // l'appel. Dans ce cas on s'arrête.
+      if ((tail+HEADER_SIZE+size)>head)
+        break;
+      _writeOut(fd,tail+HEADER_SIZE,size);
+      tail += HEADER_SIZE + size;
+    }
+    m_signal_written_pos.store(tail,std::memory_order_release);
+  }
+
+ private:
+
+  const Int64 m_capacity;
+  const Int64 m_mask;
+  std::unique_ptr<Byte[]> m_buffer;
+  std::atomic<bool> m_is_closed = false;
+  // Position d'écriture (modifiée uniquement par le producteur)
+  alignas(64) std::atomic<Int64> m_head = 0;
+  // Dernière valeur connue de \a m_tail (utilisée uniquement par le producteur)
+  Int64 m_cached_tail = 0;
+  // Position de lecture (modifiée uniquement par le consommateur)
+  alignas(64) std::atomic<Int64> m_tail = 0;
+  // Position jusqu'à laquelle les messages ont été écrits par writeSignalSafe()
+  std::atomic<Int64> m_signal_written_pos = 0;
+
+ private:
+
+  void _copyIn(Int64 pos,const void* data,Int64 size)
+  {
+    const Int64 p = pos & m_mask;
+    const Int64 n1 = std::min(size,m_capacity-p);
+    std::memcpy(m_buffer.get()+p,data,n1);
+    if (n1<size)
+      std::memcpy(m_buffer.get(),static_cast<const Byte*>(data)+n1,size-n1);
+  }
+  void _copyOut(Int64 pos,void* data,Int64 size) const
+  {
+    const Int64 p = pos & m_mask;
+    const Int64 n1 = std::min(size,m_capacity-p);
+    std::memcpy(data,m_buffer.get()+p,n1);
+    if (n1<size)
+      std::memcpy(static_cast<Byte*>(data)+n1,m_buffer.get(),size-n1);
+  }
+  void _writeOut(int fd,Int64 pos,Int64 size) const
+  {
+    const Int64 p = pos & m_mask;
+    const Int64 n1 = std::min(size,m_capacity-p);
+    _writeFd(fd,m_buffer.get()+p,n1);
+    if (n1<size)
+      _writeFd(fd,m_buffer.get(),size-n1);
+  }
+  static void _writeFd(int fd,const Byte* data,Int64 size)
+  {
+    while (size>0){
+#ifdef ARCCORE_OS_WIN32
+      int n = ::_write(fd,data,static_cast<unsigned int>(std::min(size,Int64(1<<30))));
+#else
+      ssize_t n = ::write(fd,data,static_cast<size_t>(size));
+#endif
+      if (n<=0)
+        return;
+      data += n;
+      size -= n;
+    }
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace
+{
+//! Tampon d'un thread pour un TraceAsyncWriter donné.
+struct TraceAsyncThreadBuffer
+{
+  Int64 writer_id;
+  std::shared_ptr<TraceAsyncRingBuffer> buffer;
+};
+thread_local std::vector<TraceAsyncThreadBuffer> global_async_thread_buffers;
+}
+
+class TraceMng;
+class TraceAsyncWriter;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -306,10 +524,12 @@ class TraceMng
 
   void setRedirectStream(std::ostream* ro) override
   {
+    _flushAsync();
     m_listing_stream = new FileTraceStream(ro,false);
   }
   void setRedirectStream(ITraceStream* stream) override
   {
+    _flushAsync();
     m_listing_stream = stream;
   }
 
@@ -340,6 +560,21 @@ class TraceMng
 
   void visitClassConfigs(IFunctorWithArgumentT<std::pair<String,TraceClassConfig>>* functor) override;
 
+ public:
+
+  //! Destinations d'un message écrit de manière asynchrone
+  enum eAsyncTarget : Byte
+  {
+    AT_Listing = 1,
+    AT_Stdout = 2,
+    AT_Log = 4
+  };
+
+  // Méthodes appelées par TraceAsyncWriter lors de la vidange des tampons.
+  void _writeAsyncMessage(Byte targets,int color,Span<const Byte> input);
+  void _writeAsyncDroppedMessage(Int64 nb_dropped);
+  void _flushAsyncStreams();
+
  protected:
 	
   TraceMessage _log(bool print_date)
@@ -453,6 +688,8 @@ class TraceMng
   bool m_is_error_disabled;
   bool m_is_log_disabled;
   bool m_has_color;
+  //! Gestion des écritures asynchrones (nul si non actif)
+  std::unique_ptr<TraceAsyncWriter> m_async_writer;
 
  private:
 
@@ -493,6 +730,10 @@ class TraceMng
   void _write(std::ostream& output,Span<const Byte> input,bool do_flush=false);
   void _writeColor(std::ostream& output,Span<const Byte> input,int color,bool do_flush);
   void _writeListing(Span<const Byte> input,int level,int color,bool do_flush);
+  Byte _listingTargets(Int32 level);
+  bool _writeListingAsync(Span<const Byte> input,Int32 level,int color);
+  void _flushAsync();
+  void _createAsyncWriter();
   void _write(std::ostream* output,Span<const Byte> input,bool do_flush=false);
   void _writeStackTrace(std::ostream* output,const String& stack_trace);
   void _endTrace(const TraceMessage* msg);
@@ -506,6 +747,357 @@ class TraceMng
   FileTraceStream* _createFileStream(StringView file_name);
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Écriture asynchrone des traces d'un TraceMng.
+ *
+ * Chaque thread qui génère des traces dispose de son propre tampon
+ * circulaire sans verrou (TraceAsyncRingBuffer). Un thread dédié vide
+ * régulièrement ces tampons dans les flux de sortie. L'ordre des messages
+ * d'un même thread est conservé pour chaque flux.
+ *
+ * Lorsque le tampon d'un thread est plein, le comportement dépend de
+ * eBackPressurePolicy:
+ * - Block: le thread attend que le thread d'écriture ait libéré de la place,
+ * - Drop: le message est ignoré et le nombre de messages ignorés est
+ *   affiché lors de la vidange suivante,
+ * - Sync: le thread vide lui-même les tampons.
+ *
+ * Les messages trop gros pour tenir dans un tampon sont écrits de
+ * manière synchrone après avoir vidé les tampons.
+ */
+class TraceAsyncWriter
+{
+ public:
+
+  enum class eBackPressurePolicy
+  {
+    Block,
+    Drop,
+    Sync
+  };
+
+  //! Intervalle maximum entre deux vidanges par le thread d'écriture
+  static constexpr std::chrono::milliseconds FLUSH_INTERVAL{20};
+
+ public:
+
+  TraceAsyncWriter(TraceMng* tm,Int64 buffer_size,eBackPressurePolicy policy);
+  ~TraceAsyncWriter();
+
+ public:
+
+  /*!
+   * \brief Ajoute un message dans le tampon du thread courant.
+   *
+   * Retourne \a false si le message doit être écrit de manière synchrone
+   * par l'appelant.
+   */
+  bool push(Byte targets,int color,Span<const Byte> data);
+  //! Vide les tampons de tous les threads.
+  void drain();
+  //! Écrit les messages en attente dans \a fd depuis un gestionnaire de signal.
+  void writeSignalSafe(int fd);
+
+ public:
+
+  //! Nombre maximum de tampons accessibles depuis un gestionnaire de signal
+  static constexpr Int32 MAX_SIGNAL_SAFE_BUFFER = 1024;
+
+ private:
+
+  static std::atomic<Int64> m_next_id;
+  Int64 m_id;
+  TraceMng* m_trace_mng;
+  Int64 m_buffer_size;
+  eBackPressurePolicy m_policy;
+  std::mutex m_buffers_mutex;
+  std::vector<std::shared_ptr<TraceAsyncRingBuffer>> m_buffers;
+  std::mutex m_drain_mutex;
+  std::vector<std::shared_ptr<TraceAsyncRingBuffer>> m_drain_buffers;
+  std::vector<Byte> m_drain_tmp_buffer;
+  std::mutex m_wakeup_mutex;
+  std::condition_variable m_wakeup_condition;
+  std::atomic<bool> m_wakeup_requested = false;
+  bool m_is_stopping = false;
+  std::once_flag m_thread_once_flag;
+  std::thread m_thread;
+  std::atomic<Int64> m_nb_dropped = 0;
+  //! Tampons utilisables par writeSignalSafe() (sans verrou)
+  std::atomic<TraceAsyncRingBuffer*> m_signal_safe_buffers[MAX_SIGNAL_SAFE_BUFFER] = {};
+
+ private:
+
+  TraceAsyncRingBuffer* _threadBuffer();
+  void _setSignalSafeBuffer(TraceAsyncRingBuffer* old_buffer,TraceAsyncRingBuffer* new_buffer);
+  void _wakeUp();
+  void _run();
+  void _drainLocked();
+};
+
+std::atomic<Int64> TraceAsyncWriter::m_next_id = 0;
+
+namespace
+{
+std::mutex global_async_writers_mutex;
+std::set<TraceAsyncWriter*> global_async_writers;
+//! Instances utilisables depuis un gestionnaire de signal (sans verrou)
+constexpr Int32 MAX_SIGNAL_SAFE_WRITER = 64;
+std::atomic<TraceAsyncWriter*> global_signal_safe_writers[MAX_SIGNAL_SAFE_WRITER];
+
+/*!
+ * \brief Remplace \a old_value par \a new_value dans le premier des
+ * \a nb_slot emplacements de \a slots qui contient \a old_value.
+ *
+ * Si aucun emplacement ne convient (tableau plein), ne fait rien.
+ */
+template<typename T> void
+_replaceSignalSafeSlot(std::atomic<T*>* slots,Int32 nb_slot,T* old_value,T* new_value)
+{
+  for( Int32 i=0; i<nb_slot; ++i ){
+    T* expected = old_value;
+    if (slots[i].compare_exchange_strong(expected,new_value,std::memory_order_acq_rel))
+      return;
+  }
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TraceAsyncWriter::
+TraceAsyncWriter(TraceMng* tm,Int64 buffer_size,eBackPressurePolicy policy)
+: m_id(++m_next_id)
+, m_trace_mng(tm)
+, m_buffer_size(buffer_size)
+, m_policy(policy)
+{
+  std::lock_guard<std::mutex> lk(global_async_writers_mutex);
+  global_async_writers.insert(this);
+  _replaceSignalSafeSlot(global_signal_safe_writers,MAX_SIGNAL_SAFE_WRITER,
+                         static_cast<TraceAsyncWriter*>(nullptr),this);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TraceAsyncWriter::
+~TraceAsyncWriter()
+{
+  {
+    std::lock_guard<std::mutex> lk(global_async_writers_mutex);
+    global_async_writers.erase(this);
+    _replaceSignalSafeSlot(global_signal_safe_writers,MAX_SIGNAL_SAFE_WRITER,
+                           this,static_cast<TraceAsyncWriter*>(nullptr));
+  }
+  {
+    std::lock_guard<std::mutex> lk(m_wakeup_mutex);
+    m_is_stopping = true;
+  }
+  m_wakeup_condition.notify_one();
+  if (m_thread.joinable())
+    m_thread.join();
+  drain();
+  // Indique aux threads qu'ils peuvent libérer leur tampon.
+  std::lock_guard<std::mutex> lk(m_buffers_mutex);
+  for( auto& b : m_buffers )
+    b->close();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TraceAsyncRingBuffer* TraceAsyncWriter::
+_threadBuffer()
+{
+  auto& thread_buffers = global_async_thread_buffers;
+  for( const auto& x : thread_buffers )
+    if (x.writer_id==m_id)
+      return x.buffer.get();
+
+  // Supprime les tampons des instances détruites.
+  thread_buffers.erase(std::remove_if(thread_buffers.begin(),thread_buffers.end(),
+                                      [](const TraceAsyncThreadBuffer& x){ return x.buffer->isClosed(); }),
+                       thread_buffers.end());
+
+  std::call_once(m_thread_once_flag,[this](){ m_thread = std::thread([this](){ _run(); }); });
+
+  auto buffer = std::make_shared<TraceAsyncRingBuffer>(m_buffer_size);
+  {
+    std::lock_guard<std::mutex> lk(m_buffers_mutex);
+    m_buffers.push_back(buffer);
+    _setSignalSafeBuffer(nullptr,buffer.get());
+  }
+  thread_buffers.push_back(TraceAsyncThreadBuffer{m_id,buffer});
+  return buffer.get();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool TraceAsyncWriter::
+push(Byte targets,int color,Span<const Byte> data)
+{
+  if ((data.size()+TraceAsyncRingBuffer::HEADER_SIZE)>m_buffer_size){
+    // Le message ne tient pas dans le tampon. Il sera écrit directement
+    // et il faut donc d'abord écrire les messages en attente.
+    drain();
+    return false;
+  }
+  TraceAsyncRingBuffer* buffer = _threadBuffer();
+  TraceAsyncRingBuffer::Header header;
+  header.size = static_cast<UInt32>(data.size());
+  header.targets = targets;
+  header.color = static_cast<Int8>(color);
+  header.padding[0] = header.padding[1] = 0;
+  if (buffer->tryPush(header,data)){
+    // Réveille le thread d'écriture si le tampon est à moitié plein.
+    if ((buffer->usedSize()*2)>m_buffer_size)
+      _wakeUp();
+    return true;
+  }
+  switch(m_policy){
+  case eBackPressurePolicy::Drop:
+    ++m_nb_dropped;
+    _wakeUp();
+    return true;
+  case eBackPressurePolicy::Sync:
+    drain();
+    break;
+  case eBackPressurePolicy::Block:
+    _wakeUp();
+    break;
+  }
+  while (!buffer->tryPush(header,data)){
+    _wakeUp();
+    std::this_thread::yield();
+  }
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TraceAsyncWriter::
+_wakeUp()
+{
+  m_wakeup_requested.store(true,std::memory_order_release);
+  m_wakeup_condition.notify_one();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TraceAsyncWriter::
+_run()
+{
+  std::unique_lock<std::mutex> lk(m_wakeup_mutex);
+  while (!m_is_stopping){
+    m_wakeup_condition.wait_for(lk,FLUSH_INTERVAL,[this](){
+      return m_is_stopping || m_wakeup_requested.load(std::memory_order_acquire);
+    });
+    m_wakeup_requested.store(false,std::memory_order_release);
+    lk.unlock();
+    drain();
+    lk.lock();
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TraceAsyncWriter::
+drain()
+{
+  std::lock_guard<std::mutex> lk(m_drain_mutex);
+  _drainLocked();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TraceAsyncWriter::
+_drainLocked()
+{
+  {
+    std::lock_guard<std::mutex> lk(m_buffers_mutex);
+    // Supprime les tampons vides des threads terminés.
+    m_buffers.erase(std::remove_if(m_buffers.begin(),m_buffers.end(),
+                                   [this](const std::shared_ptr<TraceAsyncRingBuffer>& x)
+                                   {
+                                     if (x.use_count()==1 && x->usedSize()==0){
+                                       _setSignalSafeBuffer(x.get(),nullptr);
+                                       return true;
+                                     }
+                                     return false;
+                                   }),
+                    m_buffers.end());
+    m_drain_buffers = m_buffers;
+  }
+  Int64 nb_written = 0;
+  Int64 nb_dropped = m_nb_dropped.exchange(0);
+  if (nb_dropped!=0){
+    m_trace_mng->_writeAsyncDroppedMessage(nb_dropped);
+    ++nb_written;
+  }
+  auto func = [this](const TraceAsyncRingBuffer::Header& header,Span<const Byte> data)
+  {
+    m_trace_mng->_writeAsyncMessage(header.targets,header.color,data);
+  };
+  for( auto& b : m_drain_buffers )
+    nb_written += b->consume(func,m_drain_tmp_buffer);
+  m_drain_buffers.clear();
+  if (nb_written!=0)
+    m_trace_mng->_flushAsyncStreams();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TraceAsyncWriter::
+_setSignalSafeBuffer(TraceAsyncRingBuffer* old_buffer,TraceAsyncRingBuffer* new_buffer)
+{
+  _replaceSignalSafeSlot(m_signal_safe_buffers,MAX_SIGNAL_SAFE_BUFFER,old_buffer,new_buffer);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TraceAsyncWriter::
+writeSignalSafe(int fd)
+{
+  for( std::atomic<TraceAsyncRingBuffer*>& x : m_signal_safe_buffers ){
+    TraceAsyncRingBuffer* b = x.load(std::memory_order_acquire);
+    if (b)
+      b->writeSignalSafe(fd);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" ARCCORE_TRACE_EXPORT
+void arccoreFlushAsyncTraces()
+{
+  std::lock_guard<std::mutex> lk(global_async_writers_mutex);
+  for( TraceAsyncWriter* w : global_async_writers )
+    w->drain();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" ARCCORE_TRACE_EXPORT
+void arccoreWriteAsyncTracesSignalSafe(int fd)
+{
+  for( std::atomic<TraceAsyncWriter*>& x : global_signal_safe_writers ){
+    TraceAsyncWriter* w = x.load(std::memory_order_acquire);
+    if (w)
+      w->writeSignalSafe(fd);
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -554,6 +1146,48 @@ TraceMng()
 #endif
 
   m_has_color = Platform::getConsoleHasColor();
+  _createAsyncWriter();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Active l'écriture asynchrone si demandé.
+ *
+ * Les variables d'environnement suivantes sont utilisées:
+ * - ARCCORE_TRACE_ASYNC: si '1' ou 'TRUE', active le mode asynchrone,
+ * - ARCCORE_TRACE_ASYNC_BUFFER_SIZE: taille (en Ko) du tampon de chaque
+ *   thread (1024 par défaut). Elle est arrondie à la puissance de 2
+ *   supérieure,
+ * - ARCCORE_TRACE_ASYNC_POLICY: comportement lorsque le tampon d'un thread
+ *   est plein ('block', 'drop' ou 'sync'. 'block' par défaut).
+ */
+void TraceMng::
+_createAsyncWriter()
+{
+  String s = Platform::getEnvironmentVariable("ARCCORE_TRACE_ASYNC");
+  if (!(s=="1" || s=="TRUE"))
+    return;
+
+  Int64 buffer_size = 1024 * 1024;
+  String size_str = Platform::getEnvironmentVariable("ARCCORE_TRACE_ASYNC_BUFFER_SIZE");
+  if (!size_str.null()){
+    long long v = std::strtoll(size_str.localstr(),nullptr,10);
+    if (v>0)
+      buffer_size = v * 1024;
+  }
+  Int64 capacity = 1;
+  while (capacity<buffer_size)
+    capacity *= 2;
+
+  auto policy = TraceAsyncWriter::eBackPressurePolicy::Block;
+  String policy_str = Platform::getEnvironmentVariable("ARCCORE_TRACE_ASYNC_POLICY");
+  if (policy_str=="drop")
+    policy = TraceAsyncWriter::eBackPressurePolicy::Drop;
+  else if (policy_str=="sync")
+    policy = TraceAsyncWriter::eBackPressurePolicy::Sync;
+
+  m_async_writer = std::make_unique<TraceAsyncWriter>(this,capacity,policy);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -562,6 +1196,8 @@ TraceMng()
 TraceMng::
 ~TraceMng()
 {
+  // Doit être détruit en premier car il peut encore écrire dans les flux.
+  m_async_writer.reset();
   for( const auto& i : m_trace_class_config_map )
     delete i.second;
   delete m_listeners;
@@ -621,6 +1257,7 @@ _logStream()
 void TraceMng::
 flush()
 {
+  _flushAsync();
   std::cout.flush();
   _flushStream(m_listing_stream.get());
 }
@@ -628,6 +1265,16 @@ flush()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void TraceMng::
+_flushAsync()
+{
+  if (m_async_writer)
+    m_async_writer->drain();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 FileTraceStream* TraceMng::
 _createFileStream(Arccore::StringView file_name)
 {
@@ -649,6 +1296,7 @@ setErrorFileName(const String& file_name)
 {
   if (m_error_file_name==file_name)
     return;
+  _flushAsync();
   m_error_file_name = file_name;
   m_error_file = nullptr;
   m_is_error_disabled = m_error_file_name.null();
@@ -664,6 +1312,7 @@ setLogFileName(const String& file_name)
 {
   if (m_log_file_name==file_name)
     return;
+  _flushAsync();
   m_log_file_name = file_name;
   m_is_log_disabled = m_log_file_name.null();
   m_log_file = nullptr;
@@ -902,10 +1551,35 @@ _writeColor(std::ostream& output,Span<const Byte> input,int color, bool do_flush
 void TraceMng::
 _writeListing(Span<const Byte> input,Int32 level,int color,bool do_flush)
 {
-  std::ostream* listing_stream = (m_listing_stream) ? m_listing_stream->stream() : nullptr;
   if (!m_has_color)
     color = 0;
 
+  Byte targets = _listingTargets(level);
+
+  // Sortie ITraceStream. Pas de couleur si on redirige les sorties
+  if (targets & AT_Listing)
+    _writeColor(*(m_listing_stream->stream()),input,0,do_flush);
+
+  // Sortie std::cout
+  if (targets & AT_Stdout)
+    _writeColor(std::cout,input,color,do_flush);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Détermine les sorties du listing pour un message de niveau \a level.
+ *
+ * Le listing peut sortir à la fois sur std::cout et dans un
+ * ITraceStream si *m_listing_stream* est non nul. Le niveau de verbosité
+ * peut être différent dans les deux cas.
+ */
+Byte TraceMng::
+_listingTargets(Int32 level)
+{
+  std::ostream* listing_stream = (m_listing_stream) ? m_listing_stream->stream() : nullptr;
+  Byte targets = 0;
+
   // Regarde si le niveau de verbosité souhaité est suffisant pour afficher
   // le message.
   Int32 message_level = level;
@@ -915,11 +1589,8 @@ _writeListing(Span<const Byte> input,Int32 level,int color,bool do_flush)
     Int32 verbosity_level = m_current_class_verbosity_level;
     if (verbosity_level==Trace::UNSPECIFIED_VERBOSITY_LEVEL)
       verbosity_level = m_verbosity_level;
-    // Pas de couleur si on redirige les sorties
-    int listing_color = 0;
-    bool is_printed = (message_level <= verbosity_level);
-    if (is_printed)
-      _writeColor(*listing_stream,input,listing_color,do_flush);
+    if (message_level <= verbosity_level)
+      targets |= AT_Listing;
   }
 
   // Sortie std::cout
@@ -927,10 +1598,72 @@ _writeListing(Span<const Byte> input,Int32 level,int color,bool do_flush)
     Int32 verbosity_level = m_current_class_verbosity_level;
     if (verbosity_level==Trace::UNSPECIFIED_VERBOSITY_LEVEL)
       verbosity_level = (listing_stream) ? m_stdout_verbosity_level : m_verbosity_level;
-    bool is_printed = (message_level <= verbosity_level);
-    if (is_printed)
-      _writeColor(std::cout,input,color,do_flush);
+    if (message_level <= verbosity_level)
+      targets |= AT_Stdout;
   }
+  return targets;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Écrit le listing de manière asynchrone si possible.
+ *
+ * Retourne \a false si le message doit être écrit directement.
+ */
+bool TraceMng::
+_writeListingAsync(Span<const Byte> input,Int32 level,int color)
+{
+  if (!m_async_writer)
+    return false;
+  Byte targets = _listingTargets(level);
+  if (targets==0)
+    return true;
+  if (!m_has_color)
+    color = 0;
+  return m_async_writer->push(targets,color,input);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TraceMng::
+_writeAsyncMessage(Byte targets,int color,Span<const Byte> input)
+{
+  if (targets & AT_Listing){
+    std::ostream* listing_stream = (m_listing_stream) ? m_listing_stream->stream() : nullptr;
+    if (listing_stream)
+      _writeColor(*listing_stream,input,0,false);
+  }
+  if (targets & AT_Stdout)
+    _writeColor(std::cout,input,color,false);
+  if (targets & AT_Log)
+    _write(_logStream(),input);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TraceMng::
+_writeAsyncDroppedMessage(Int64 nb_dropped)
+{
+  std::ostringstream ostr;
+  ostr << "*W* TraceMng: " << nb_dropped << " message(s) dropped because asynchronous trace buffer was full\n";
+  const std::string& str = ostr.str();
+  Span<const Byte> bytes(reinterpret_cast<const Byte*>(str.data()),str.length());
+  std::ostream* listing_stream = (m_listing_stream) ? m_listing_stream->stream() : nullptr;
+  _write((listing_stream) ? *listing_stream : std::cout,bytes);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void TraceMng::
+_flushAsyncStreams()
+{
+  std::cout.flush();
+  _flushStream(m_listing_stream.get());
+  _flushStream(m_log_file.get());
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1067,20 +1800,28 @@ _writeDirect(const TraceMessage* msg,Span<const Byte> buf_array,
   const bool write_stack_trace_for_error = false;
   switch(id){
   case Trace::Normal:
+    if (_writeListingAsync(buf_array,print_level,color))
+      break;
     _writeListing(buf_array,print_level,color,false);
     _checkFlush();
     break;
   case Trace::Info:
+    if (_writeListingAsync(buf_array,msg->level(),color))
+      break;
     _writeListing(buf_array,msg->level(),color,false);
     _checkFlush();
     break;
   case Trace::Log:
+    if (m_async_writer && m_async_writer->push(AT_Log,0,buf_array))
+      break;
     _write(_logStream(),buf_array);
     _checkFlush();
     break;
   case Trace::Warning:
   case Trace::Error:
     {
+      // Écrit d'abord les messages en attente pour conserver l'ordre.
+      _flushAsync();
       auto error_stream = _errorStream();
       auto log_stream = _logStream();
       auto tc_color = (id==Trace::Warning) ? Trace::Color::DarkYellow : Trace::Color::DarkRed;
@@ -1098,6 +1839,7 @@ _writeDirect(const TraceMessage* msg,Span<const Byte> buf_array,
     break;
   case Trace::Fatal:
   case Trace::ParallelFatal:
+    _flushAsync();
     if (m_is_master || id==Trace::Fatal){
       auto error_stream = _errorStream();
       auto log_stream = _logStream();
@@ -1117,6 +1859,8 @@ _writeDirect(const TraceMessage* msg,Span<const Byte> buf_array,
       throw ex;
     }
   case Trace::Debug:
+    if (_writeListingAsync(buf_array,print_level,color))
+      break;
     _writeListing(buf_array,print_level,color,true);
     break;
   case Trace::Null:
@@ -1187,10 +1931,14 @@ pushTraceClass(const String& name)
 void TraceMng::
 popTraceClass()
 {
-  Mutex::ScopedLock sl(m_trace_mutex);
-  m_trace_class_stack.pop_back();
-  m_current_msg_class = m_trace_class_stack.back();
-  _updateCurrentClassConfig();
+  {
+    Mutex::ScopedLock sl(m_trace_mutex);
+    m_trace_class_stack.pop_back();
+    m_current_msg_class = m_trace_class_stack.back();
+    _updateCurrentClassConfig();
+  }
+  // Ne doit pas être appelé avec le verrou car le thread d'écriture
+  // asynchrone peut en avoir besoin.
   flush();
 }
 
@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -9,12 +9,16 @@
 #include "arccore/base/String.h"
 #include "arccore/base/ReferenceCounter.h"
 #include "arccore/base/FatalErrorException.h"
+#include "arccore/base/PlatformUtils.h"
 #include "arccore/trace/ITraceMng.h"
 #include "arccore/trace/TraceAccessor.h"
 #include "arccore/trace/StandaloneTraceMessage.h"
 
 #include <memory>
 #include <sstream>
+#include <thread>
+#include <vector>
+#include <cstdio>
 
 using namespace Arccore;
 
@@ -60,3 +64,167 @@ TEST(TraceMng, FatalMessage2)
   ASSERT_TRUE(new_message==message) <<
   String::format("Bad message(wanted='{0}' current='{1}'",message,new_message);
 }
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+// Vérifie que l'ordre des messages de chaque thread est conservé.
+// Les écritures concurrentes ne sont possibles qu'avec le mode asynchrone
+// (ARCCORE_TRACE_ASYNC). Sinon, le test est fait avec un seul thread.
+
+TEST(TraceMng, MessageOrder)
+{
+  String async_str = Platform::getEnvironmentVariable("ARCCORE_TRACE_ASYNC");
+  bool is_async = (async_str=="1" || async_str=="TRUE");
+  bool is_drop = (Platform::getEnvironmentVariable("ARCCORE_TRACE_ASYNC_POLICY")=="drop");
+  const int nb_thread = (is_async) ? 4 : 1;
+  const int nb_message = 1000;
+
+  std::ostringstream ostr;
+  {
+    ReferenceCounter<ITraceMng> tm(arccoreCreateDefaultTraceMng());
+    tm->setMaster(false);
+    tm->setRedirectStream(&ostr);
+    tm->finishInitialize();
+    std::vector<std::thread> threads;
+    for( int t=0; t<nb_thread; ++t ){
+      threads.emplace_back([&tm,t,nb_message](){
+        TraceAccessor tr(tm.get());
+        for( int j=0; j<nb_message; ++j )
+          tr.info() << "T" << t << " M" << j;
+      });
+    }
+    for( auto& t : threads )
+      t.join();
+    tm->flush();
+  }
+
+  std::vector<int> last_index(nb_thread,-1);
+  std::vector<int> nb_received(nb_thread,0);
+  std::istringstream istr(ostr.str());
+  std::string line;
+  while (std::getline(istr,line)){
+    auto pos = line.find(" T");
+    if (pos==std::string::npos)
+      continue;
+    int t = -1;
+    int j = -1;
+    if (std::sscanf(line.c_str()+pos," T%d M%d",&t,&j)!=2)
+      continue;
+    ASSERT_TRUE(t>=0 && t<nb_thread) << "Bad thread index line=" << line;
+    ASSERT_TRUE(j>last_index[t]) << "Bad message order line=" << line;
+    last_index[t] = j;
+    ++nb_received[t];
+  }
+  if (!is_drop)
+    for( int t=0; t<nb_thread; ++t )
+      ASSERT_EQ(nb_received[t],nb_message) << "Missing messages for thread " << t;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+// Vérifie que les messages d'avertissement et d'erreur fatale sont écrits
+// après les messages qui les précèdent, même en mode asynchrone.
+
+TEST(TraceMng, WarningAndFatalOrder)
+{
+  const int nb_message = 100;
+  std::ostringstream ostr;
+  {
+    ReferenceCounter<ITraceMng> tm(arccoreCreateDefaultTraceMng());
+    tm->setMaster(true);
+    tm->setRedirectStream(&ostr);
+    tm->finishInitialize();
+    TraceAccessor tr(tm.get());
+    for( int j=0; j<nb_message; ++j )
+      tr.info() << "BeforeWarning M" << j;
+    tr.warning() << "TestOrderWarning";
+    for( int j=0; j<nb_message; ++j )
+      tr.info() << "BeforeFatal M" << j;
+    try{
+      tr.fatal() << "TestOrderFatal";
+    }
+    catch(const FatalErrorException&)
+    {
+    }
+    tm->flush();
+  }
+
+  bool has_warning = false;
+  bool has_fatal = false;
+  std::istringstream istr(ostr.str());
+  std::string line;
+  while (std::getline(istr,line)){
+    if (line.find("TestOrderWarning")!=std::string::npos)
+      has_warning = true;
+    else if (line.find("TestOrderFatal")!=std::string::npos)
+      has_fatal = true;
+    else if (line.find("BeforeWarning")!=std::string::npos){
+      ASSERT_FALSE(has_warning) << "Message written after warning line=" << line;
+    }
+    else if (line.find("BeforeFatal")!=std::string::npos){
+      ASSERT_TRUE(has_warning) << "Message written before warning line=" << line;
+      ASSERT_FALSE(has_fatal) << "Message written after fatal line=" << line;
+    }
+  }
+  ASSERT_TRUE(has_warning) << "Warning message not found";
+  ASSERT_TRUE(has_fatal) << "Fatal message not found";
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+// Vérifie que arccoreWriteAsyncTracesSignalSafe() écrit les messages en
+// attente et qu'aucun message n'est perdu après la vidange suivante.
+
+TEST(TraceMng, SignalSafeWrite)
+{
+  String async_str = Platform::getEnvironmentVariable("ARCCORE_TRACE_ASYNC");
+  bool is_async = (async_str=="1" || async_str=="TRUE");
+  bool is_drop = (Platform::getEnvironmentVariable("ARCCORE_TRACE_ASYNC_POLICY")=="drop");
+  const int nb_message = 200;
+
+  std::FILE* file = std::tmpfile();
+  ASSERT_TRUE(file!=nullptr);
+  std::ostringstream ostr;
+  {
+    ReferenceCounter<ITraceMng> tm(arccoreCreateDefaultTraceMng());
+    tm->setMaster(false);
+    tm->setRedirectStream(&ostr);
+    tm->finishInitialize();
+    TraceAccessor tr(tm.get());
+    for( int j=0; j<nb_message; ++j )
+      tr.info() << "SignalSafe M" << j;
+    arccoreWriteAsyncTracesSignalSafe(fileno(file));
+    tm->flush();
+  }
+
+  std::string file_content;
+  std::rewind(file);
+  char buf[4096];
+  size_t n = 0;
+  while ((n = std::fread(buf,1,sizeof(buf),file))>0)
+    file_content.append(buf,n);
+  std::fclose(file);
+  if (!is_async)
+    ASSERT_TRUE(file_content.empty());
+
+  // Chaque message doit être écrit au moins une fois dans l'un des flux.
+  // Il peut l'être deux fois si le thread d'écriture le vide en même temps.
+  std::vector<int> nb_received(nb_message,0);
+  for( const std::string& content : { file_content, ostr.str() } ){
+    std::istringstream istr(content);
+    std::string line;
+    while (std::getline(istr,line)){
+      auto pos = line.find("SignalSafe M");
+      if (pos==std::string::npos)
+        continue;
+      int j = -1;
+      if (std::sscanf(line.c_str()+pos,"SignalSafe M%d",&j)!=1)
+        continue;
+      ASSERT_TRUE(j>=0 && j<nb_message) << "Bad message index line=" << line;
+      ++nb_received[j];
+    }
+  }
+  if (!is_drop)
+    for( int j=0; j<nb_message; ++j )
+      ASSERT_TRUE(nb_received[j]>=1) << "Missing message " << j;
+}